@@ -37,6 +37,7 @@
  */
 
 #include <gstaravis.h>
+#include <gstaravismeta.h>
 #include <arvgvspprivate.h>
 #include <time.h>
 #include <string.h>
@@ -73,6 +74,7 @@ enum
   PROP_USB_MODE,
   PROP_STREAM,
   PROP_TRIGGER,
+  PROP_CHUNKS,
   N_PROPERTIES
 };
 
@@ -224,6 +226,113 @@ gst_aravis_get_caps (GstBaseSrc * src, GstCaps * filter)
 	return caps;
 }
 
+static void
+gst_aravis_chunk_clear (GstAravisChunk *chunk)
+{
+	g_clear_pointer (&chunk->name, g_free);
+	g_clear_pointer (&chunk->feature, g_free);
+}
+
+/* Enables the chunk data listed in the chunks property, and retrieves their feature types */
+
+static void
+gst_aravis_set_chunks (GstAravis *gst_aravis, GError **error)
+{
+	GError *local_error = NULL;
+	ArvGc *genicam;
+	char **names;
+	guint i;
+
+	g_clear_object (&gst_aravis->chunk_parser);
+	g_clear_pointer (&gst_aravis->chunk_list, g_array_unref);
+
+	if (gst_aravis->chunks == NULL)
+		return;
+
+	arv_camera_set_chunks (gst_aravis->camera, gst_aravis->chunks, &local_error);
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		return;
+	}
+
+	/* The list may still be used by the chunk data reading of a frame, a new one is built on each change */
+	gst_aravis->chunk_list = g_array_new (FALSE, FALSE, sizeof (GstAravisChunk));
+	g_array_set_clear_func (gst_aravis->chunk_list, (GDestroyNotify) gst_aravis_chunk_clear);
+
+	genicam = arv_device_get_genicam (arv_camera_get_device (gst_aravis->camera));
+	names = g_strsplit_set (gst_aravis->chunks, " ,:;", -1);
+
+	for (i = 0; names[i] != NULL; i++) {
+		GstAravisChunk chunk;
+		ArvGcNode *node;
+
+		if (names[i][0] == '\0')
+			continue;
+
+		chunk.name = g_strdup (names[i]);
+		chunk.feature = g_strdup_printf ("Chunk%s", names[i]);
+
+		node = arv_gc_get_node (genicam, chunk.feature);
+		if (ARV_IS_GC_FLOAT (node))
+			chunk.type = G_TYPE_DOUBLE;
+		else if (ARV_IS_GC_BOOLEAN (node))
+			chunk.type = G_TYPE_BOOLEAN;
+		else if (ARV_IS_GC_INTEGER (node))
+			chunk.type = G_TYPE_INT64;
+		else if (ARV_IS_GC_STRING (node))
+			chunk.type = G_TYPE_STRING;
+		else {
+			GST_WARNING_OBJECT (gst_aravis, "Unsupported chunk data '%s'", chunk.feature);
+			gst_aravis_chunk_clear (&chunk);
+			continue;
+		}
+
+		g_array_append_val (gst_aravis->chunk_list, chunk);
+	}
+
+	g_strfreev (names);
+
+	if (gst_aravis->chunk_list->len > 0)
+		gst_aravis->chunk_parser = arv_camera_create_chunk_parser (gst_aravis->camera);
+	else
+		g_clear_pointer (&gst_aravis->chunk_list, g_array_unref);
+}
+
+/* Meta transport counters, a fixed subset of the stream informations, resolved once per stream */
+
+static const struct {
+	const char *name;
+	gsize offset;
+} gst_aravis_transport_infos[] = {
+	{ "n_completed_buffers",	G_STRUCT_OFFSET (GstAravisMeta, n_completed_buffers) },
+	{ "n_failures",			G_STRUCT_OFFSET (GstAravisMeta, n_failures) },
+	{ "n_underruns",		G_STRUCT_OFFSET (GstAravisMeta, n_underruns) },
+	{ "n_missing_packets",		G_STRUCT_OFFSET (GstAravisMeta, n_missing_packets) },
+	{ "n_resent_packets",		G_STRUCT_OFFSET (GstAravisMeta, n_resent_packets) },
+	{ "n_transferred_bytes",	G_STRUCT_OFFSET (GstAravisMeta, n_transferred_bytes) }
+};
+
+G_STATIC_ASSERT (G_N_ELEMENTS (gst_aravis_transport_infos) == GST_ARAVIS_N_TRANSPORT_INFOS);
+
+static void
+gst_aravis_set_transport_infos (GstAravis *gst_aravis)
+{
+	guint i, j;
+
+	for (i = 0; i < GST_ARAVIS_N_TRANSPORT_INFOS; i++) {
+		gst_aravis->transport_info_ids[i] = -1;
+
+		for (j = 0; j < arv_stream_get_n_infos (gst_aravis->stream); j++) {
+			if (arv_stream_get_info_type (gst_aravis->stream, j) == G_TYPE_UINT64 &&
+			    g_strcmp0 (arv_stream_get_info_name (gst_aravis->stream, j),
+				       gst_aravis_transport_infos[i].name) == 0) {
+				gst_aravis->transport_info_ids[i] = j;
+				break;
+			}
+		}
+	}
+}
+
 static gboolean
 gst_aravis_set_caps (GstBaseSrc *src, GstCaps *caps)
 {
@@ -273,6 +382,9 @@ gst_aravis_set_caps (GstBaseSrc *src, GstCaps *caps)
 
 	pixel_format = arv_pixel_format_from_gst_caps (gst_structure_get_name (structure), format_string, bpp, depth);
 
+	/* Only raw video formats can be described by a GstVideoMeta */
+	gst_aravis->has_video_info = gst_video_info_from_caps (&gst_aravis->video_info, caps);
+
 	if (!pixel_format) {
 		GST_ERROR_OBJECT (src, "did not find matching pixel_format");
 		goto failed;
@@ -361,12 +473,15 @@ gst_aravis_set_caps (GstBaseSrc *src, GstCaps *caps)
 	}
 
 	if (!error) arv_device_set_features_from_string (arv_camera_get_device (gst_aravis->camera), gst_aravis->features, &error);
+	if (!error) gst_aravis_set_chunks (gst_aravis, &error);
 
 	if (!error) gst_aravis->payload = arv_camera_get_payload (gst_aravis->camera, &error);
 	if (!error) gst_aravis->stream = arv_camera_create_stream (gst_aravis->camera, NULL, NULL, NULL, &error);
 	if (error)
 		goto errored;
 
+	gst_aravis_set_transport_infos (gst_aravis);
+
 	if (ARV_IS_GV_STREAM (gst_aravis->stream)) {
 		if (gst_aravis->packet_resend)
 			g_object_set (gst_aravis->stream, "packet-resend", ARV_GV_STREAM_PACKET_RESEND_ALWAYS, NULL);
@@ -377,6 +492,7 @@ gst_aravis_set_caps (GstBaseSrc *src, GstCaps *caps)
 	for (i = 0; i < gst_aravis->num_arv_buffers; i++)
 		arv_stream_push_buffer (gst_aravis->stream,
 					arv_buffer_new (gst_aravis->payload, NULL));
+	gst_aravis->n_allocation_buffers = 0;
 
 	GST_LOG_OBJECT (gst_aravis, "Start acquisition");
 	arv_camera_start_acquisition (gst_aravis->camera, &error);
@@ -518,6 +634,8 @@ gst_aravis_stop( GstBaseSrc * src )
 	camera = g_steal_pointer (&gst_aravis->camera);
 	stream = g_steal_pointer (&gst_aravis->stream);
 	all_caps = g_steal_pointer (&gst_aravis->all_caps);
+	g_clear_object (&gst_aravis->chunk_parser);
+	g_clear_pointer (&gst_aravis->chunk_list, g_array_unref);
 	GST_OBJECT_UNLOCK (gst_aravis);
 
 	if (stream != NULL)
@@ -559,6 +677,121 @@ gst_aravis_get_times (GstBaseSrc * basesrc, GstBuffer * buffer,
 	}
 }
 
+static gboolean
+gst_aravis_decide_allocation (GstBaseSrc *src, GstQuery *query)
+{
+	GstAravis *gst_aravis = GST_ARAVIS (src);
+	guint min_buffers = 0;
+	guint i;
+
+	/* The stream buffers are directly wrapped, no pool is needed, but each buffer held downstream is not available
+	 * for the acquisition */
+	if (gst_query_get_n_allocation_pools (query) > 0)
+		gst_query_parse_nth_allocation_pool (query, 0, NULL, NULL, &min_buffers, NULL);
+	while (gst_query_get_n_allocation_pools (query) > 0)
+		gst_query_remove_nth_allocation_pool (query, 0);
+
+	GST_OBJECT_LOCK (gst_aravis);
+
+	gst_aravis->video_meta_supported = gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+
+	if (gst_aravis->stream != NULL && gst_aravis->payload > 0) {
+		for (i = gst_aravis->n_allocation_buffers; i < min_buffers; i++)
+			arv_stream_push_buffer (gst_aravis->stream, arv_buffer_new (gst_aravis->payload, NULL));
+		gst_aravis->n_allocation_buffers = MAX (gst_aravis->n_allocation_buffers, min_buffers);
+	}
+
+	GST_DEBUG_OBJECT (gst_aravis, "Video meta %ssupported, %u buffer(s) held downstream",
+			  gst_aravis->video_meta_supported ? "" : "not ", min_buffers);
+
+	GST_OBJECT_UNLOCK (gst_aravis);
+
+	return TRUE;
+}
+
+/* Copies the frame informations and the transport counters, the chunk data values are set once the object lock is
+ * released */
+
+static GstAravisMeta *
+gst_aravis_add_meta (GstAravis *gst_aravis, GstBuffer *buffer, ArvBuffer *arv_buffer)
+{
+	GstAravisMeta *aravis_meta;
+	guint i;
+
+	aravis_meta = gst_buffer_add_aravis_meta (buffer, arv_buffer);
+	if (aravis_meta == NULL)
+		return NULL;
+
+	for (i = 0; i < GST_ARAVIS_N_TRANSPORT_INFOS; i++)
+		if (gst_aravis->transport_info_ids[i] >= 0)
+			G_STRUCT_MEMBER (guint64, aravis_meta, gst_aravis_transport_infos[i].offset) =
+				arv_stream_get_info_uint64 (gst_aravis->stream, gst_aravis->transport_info_ids[i]);
+
+	return aravis_meta;
+}
+
+/* Reads the values of the chunk data of @chunk_list, once per frame. The chunk parser of a source is only used from
+ * its streaming thread, the caller holds its own references on the parser and the list, which are replaced and not
+ * modified on a chunks property change. */
+
+static GstStructure *
+gst_aravis_read_chunks (GstAravis *gst_aravis, ArvChunkParser *chunk_parser, GArray *chunk_list,
+			ArvBuffer *arv_buffer)
+{
+	GstStructure *chunks;
+	guint i;
+
+	chunks = gst_structure_new_empty ("aravis-chunks");
+
+	for (i = 0; i < chunk_list->len; i++) {
+		GstAravisChunk *chunk = &g_array_index (chunk_list, GstAravisChunk, i);
+		GError *error = NULL;
+
+		switch (chunk->type) {
+			case G_TYPE_DOUBLE:
+				{
+					double value = arv_chunk_parser_get_float_value (chunk_parser, arv_buffer,
+											 chunk->feature, &error);
+					if (error == NULL)
+						gst_structure_set (chunks, chunk->name, G_TYPE_DOUBLE, value, NULL);
+				}
+				break;
+			case G_TYPE_BOOLEAN:
+				{
+					gboolean value = arv_chunk_parser_get_boolean_value (chunk_parser, arv_buffer,
+											     chunk->feature, &error);
+					if (error == NULL)
+						gst_structure_set (chunks, chunk->name, G_TYPE_BOOLEAN, value, NULL);
+				}
+				break;
+			case G_TYPE_INT64:
+				{
+					gint64 value = arv_chunk_parser_get_integer_value (chunk_parser, arv_buffer,
+											   chunk->feature, &error);
+					if (error == NULL)
+						gst_structure_set (chunks, chunk->name, G_TYPE_INT64, value, NULL);
+				}
+				break;
+			default:
+				{
+					const char *value = arv_chunk_parser_get_string_value (chunk_parser, arv_buffer,
+											       chunk->feature, &error);
+					if (error == NULL)
+						gst_structure_set (chunks, chunk->name, G_TYPE_STRING, value, NULL);
+				}
+				break;
+		}
+
+		if (error != NULL) {
+			GST_DEBUG_OBJECT (gst_aravis, "Failed to read chunk data '%s': %s",
+					  chunk->feature, error->message);
+			g_error_free (error);
+		}
+	}
+
+	return chunks;
+}
+
 static GstFlowReturn
 gst_aravis_create (GstPushSrc * push_src, GstBuffer ** buffer)
 {
@@ -570,6 +803,10 @@ gst_aravis_create (GstPushSrc * push_src, GstBuffer ** buffer)
 	guint64 timestamp_ns;
 	gboolean base_src_does_timestamp;
 	ArvBuffer *arv_buffer = NULL;
+	GstAravisFrame *frame;
+	GstAravisMeta *aravis_meta;
+	ArvChunkParser *chunk_parser = NULL;
+	GArray *chunk_list = NULL;
 
 	gst_aravis = GST_ARAVIS (push_src);
 	base_src_does_timestamp = gst_base_src_get_do_timestamp(GST_BASE_SRC(push_src));
@@ -589,8 +826,39 @@ gst_aravis_create (GstPushSrc * push_src, GstBuffer ** buffer)
 	arv_row_stride = width * ARV_PIXEL_FORMAT_BIT_PER_PIXEL (arv_buffer_get_image_pixel_format (arv_buffer)) / 8;
 	timestamp_ns = arv_buffer_get_timestamp (arv_buffer);
 
-	/* Gstreamer requires row stride to be a multiple of 4 */
-	if ((arv_row_stride & 0x3) != 0) {
+	/* The ArvBuffer goes back to the stream once the chunk data are read, and the GstBuffer released downstream if it
+	 * wraps the ArvBuffer data */
+	frame = gst_aravis_frame_new (gst_aravis->stream, arv_buffer);
+
+	if (gst_aravis->chunk_parser != NULL && arv_buffer_has_chunks (arv_buffer)) {
+		chunk_parser = g_object_ref (gst_aravis->chunk_parser);
+		chunk_list = g_array_ref (gst_aravis->chunk_list);
+	}
+
+	/* Gstreamer default row stride is a multiple of 4. Other strides are described by a video meta, when downstream
+	 * supports it and the format has a single plane. */
+	if ((arv_row_stride & 0x3) == 0 ||
+	    (gst_aravis->video_meta_supported &&
+	     gst_aravis->has_video_info &&
+	     GST_VIDEO_INFO_N_PLANES (&gst_aravis->video_info) == 1 &&
+	     GST_VIDEO_INFO_WIDTH (&gst_aravis->video_info) == width &&
+	     GST_VIDEO_INFO_HEIGHT (&gst_aravis->video_info) == height)) {
+		*buffer = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+						       buffer_data, buffer_size, 0, buffer_size,
+						       gst_aravis_frame_ref (frame),
+						       (GDestroyNotify) gst_aravis_frame_unref);
+
+		if ((arv_row_stride & 0x3) != 0) {
+			gsize offset[GST_VIDEO_MAX_PLANES] = {0};
+			gint stride[GST_VIDEO_MAX_PLANES] = {0};
+
+			stride[0] = arv_row_stride;
+
+			gst_buffer_add_video_meta_full (*buffer, GST_VIDEO_FRAME_FLAG_NONE,
+							GST_VIDEO_INFO_FORMAT (&gst_aravis->video_info),
+							width, height, 1, offset, stride);
+		}
+	} else {
 		int gst_row_stride;
 		size_t size;
 		char *data;
@@ -605,11 +873,10 @@ gst_aravis_create (GstPushSrc * push_src, GstBuffer ** buffer)
 			memcpy (data + i * gst_row_stride, buffer_data + i * arv_row_stride, arv_row_stride);
 
 		*buffer = gst_buffer_new_wrapped (data, size);
-	} else {
-		// FIXME Should arv_stream_push_buffer when the GstBuffer is destroyed
-		*buffer = gst_buffer_new_wrapped_full (0, buffer_data, buffer_size, 0, buffer_size, NULL, NULL);
 	}
 
+	aravis_meta = gst_aravis_add_meta (gst_aravis, *buffer, arv_buffer);
+
 	if (!base_src_does_timestamp) {
 		if (gst_aravis->timestamp_offset == 0) {
 			gst_aravis->timestamp_offset = timestamp_ns;
@@ -622,9 +889,18 @@ gst_aravis_create (GstPushSrc * push_src, GstBuffer ** buffer)
 		gst_aravis->last_timestamp = timestamp_ns;
 	}
 
-	arv_stream_push_buffer (gst_aravis->stream, arv_buffer);
 	GST_OBJECT_UNLOCK (gst_aravis);
 
+	if (chunk_parser != NULL) {
+		if (aravis_meta != NULL)
+			aravis_meta->chunks = gst_aravis_read_chunks (gst_aravis, chunk_parser, chunk_list, arv_buffer);
+
+		g_object_unref (chunk_parser);
+		g_array_unref (chunk_list);
+	}
+
+	gst_aravis_frame_unref (frame);
+
 	return GST_FLOW_OK;
 
 error:
@@ -680,6 +956,8 @@ gst_aravis_fixate_caps (GstBaseSrc * bsrc, GstCaps * caps)
 static void
 gst_aravis_init (GstAravis *gst_aravis)
 {
+	guint i;
+
 	gst_base_src_set_live (GST_BASE_SRC (gst_aravis), TRUE);
 	gst_base_src_set_format (GST_BASE_SRC (gst_aravis), GST_FORMAT_TIME);
 
@@ -702,6 +980,9 @@ gst_aravis_init (GstAravis *gst_aravis)
         gst_aravis->packet_resend = TRUE;
 	gst_aravis->num_arv_buffers = GST_ARAVIS_DEFAULT_N_BUFFERS;
 	gst_aravis->payload = 0;
+	gst_aravis->has_video_info = FALSE;
+	gst_aravis->video_meta_supported = FALSE;
+	gst_aravis->n_allocation_buffers = 0;
 	gst_aravis->usb_mode = ARV_UV_USB_MODE_DEFAULT;
 
 	gst_aravis->buffer_timeout_us = GST_ARAVIS_BUFFER_TIMEOUT_DEFAULT;
@@ -709,6 +990,12 @@ gst_aravis_init (GstAravis *gst_aravis)
 
 	gst_aravis->trigger_source = NULL;
 
+	gst_aravis->chunks = NULL;
+	gst_aravis->chunk_parser = NULL;
+	gst_aravis->chunk_list = NULL;
+	for (i = 0; i < GST_ARAVIS_N_TRANSPORT_INFOS; i++)
+		gst_aravis->transport_info_ids[i] = -1;
+
 	gst_aravis->camera = NULL;
 	gst_aravis->stream = NULL;
 
@@ -730,6 +1017,9 @@ gst_aravis_finalize (GObject * object)
 	g_clear_pointer (&gst_aravis->camera_name, g_free);
 	g_clear_pointer (&gst_aravis->features, g_free);
         g_clear_pointer (&gst_aravis->trigger_source, g_free);
+	g_clear_pointer (&gst_aravis->chunks, g_free);
+	g_clear_object (&gst_aravis->chunk_parser);
+	g_clear_pointer (&gst_aravis->chunk_list, g_array_unref);
 	GST_OBJECT_UNLOCK (gst_aravis);
 
 	if (camera != NULL)
@@ -850,6 +1140,12 @@ gst_aravis_set_property (GObject * object, guint prop_id,
                         gst_aravis->features = g_value_dup_string (value);
                         GST_OBJECT_UNLOCK (gst_aravis);
                         break;
+                case PROP_CHUNKS:
+                        GST_OBJECT_LOCK (gst_aravis);
+                        g_free (gst_aravis->chunks);
+                        gst_aravis->chunks = g_value_dup_string (value);
+                        GST_OBJECT_UNLOCK (gst_aravis);
+                        break;
                 case PROP_NUM_ARV_BUFFERS:
                         gst_aravis->num_arv_buffers = g_value_get_int (value);
                         break;
@@ -959,6 +1255,9 @@ gst_aravis_get_property (GObject * object, guint prop_id, GValue * value,
 		case PROP_FEATURES:
 			g_value_set_string (value, gst_aravis->features);
 			break;
+		case PROP_CHUNKS:
+			g_value_set_string (value, gst_aravis->chunks);
+			break;
 		case PROP_NUM_ARV_BUFFERS:
 			g_value_set_int (value, gst_aravis->num_arv_buffers);
 			break;
@@ -1145,6 +1444,13 @@ gst_aravis_class_init (GstAravisClass * klass)
 				     "Additional configuration parameters as a space separated list of feature assignations",
 				     NULL,
 				     G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+	properties[PROP_CHUNKS] =
+		g_param_spec_string ("chunks",
+				     "Chunk data",
+				     "Chunk data to enable and attach to each buffer GstAravisMeta, as a comma separated list "
+				     "of chunk names (e.g. \"ExposureTime,Gain,LineStatusAll\")",
+				     NULL,
+				     G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 	properties[PROP_NUM_ARV_BUFFERS] =
 		g_param_spec_int ("num-arv-buffers",
 				  "Number of Buffers allocated",
@@ -1197,6 +1503,7 @@ gst_aravis_class_init (GstAravisClass * klass)
 	gstbasesrc_class->start = GST_DEBUG_FUNCPTR (gst_aravis_start);
 	gstbasesrc_class->stop = GST_DEBUG_FUNCPTR (gst_aravis_stop);
 	gstbasesrc_class->query = GST_DEBUG_FUNCPTR (gst_aravis_query);
+	gstbasesrc_class->decide_allocation = GST_DEBUG_FUNCPTR (gst_aravis_decide_allocation);
 
 	gstbasesrc_class->get_times = GST_DEBUG_FUNCPTR (gst_aravis_get_times);
 
@@ -28,6 +28,7 @@
 
 #include <gst/gst.h>
 #include <gst/base/gstpushsrc.h>
+#include <gst/video/video.h>
 #include <arv.h>
 
 G_BEGIN_DECLS
@@ -38,6 +39,8 @@ G_BEGIN_DECLS
 #define GST_IS_ARAVIS(obj) 		(G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_ARAVIS))
 #define GST_IS_ARAVIS_CLASS(obj)	(G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_ARAVIS))
 
+#define GST_ARAVIS_N_TRANSPORT_INFOS	6
+
 typedef struct _GstAravis GstAravis;
 typedef struct _GstAravisClass GstAravisClass;
 
@@ -71,6 +74,11 @@ struct _GstAravis {
 
 	gint payload;
 
+	GstVideoInfo video_info;
+	gboolean has_video_info;
+	gboolean video_meta_supported;
+	gint n_allocation_buffers;
+
 	guint64 buffer_timeout_us;
         gdouble frame_rate;
 
@@ -85,6 +93,12 @@ struct _GstAravis {
 	char *trigger_source;
 
 	char *features;
+
+	char *chunks;
+	ArvChunkParser *chunk_parser;
+	GArray *chunk_list;
+
+	gint transport_info_ids[GST_ARAVIS_N_TRANSPORT_INFOS];
 };
 
 struct _GstAravisClass {
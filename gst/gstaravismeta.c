@@ -0,0 +1,210 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#include <gstaravismeta.h>
+
+/* Held by the GstMemory wrapping the ArvBuffer data, the ArvBuffer goes back to its stream when the last reference is
+ * dropped */
+
+struct _GstAravisFrame {
+	gint ref_count;
+
+	GWeakRef stream;
+	ArvBuffer *arv_buffer;
+};
+
+/**
+ * gst_aravis_frame_new:
+ * @stream: the #ArvStream @arv_buffer was popped from
+ * @arv_buffer: (transfer full): a #ArvBuffer
+ *
+ * Returns: (transfer full): a new #GstAravisFrame, which pushes @arv_buffer back to @stream on finalization.
+ */
+
+GstAravisFrame *
+gst_aravis_frame_new (ArvStream *stream, ArvBuffer *arv_buffer)
+{
+	GstAravisFrame *frame;
+
+	g_return_val_if_fail (ARV_IS_STREAM (stream), NULL);
+	g_return_val_if_fail (ARV_IS_BUFFER (arv_buffer), NULL);
+
+	frame = g_new0 (GstAravisFrame, 1);
+	frame->ref_count = 1;
+	g_weak_ref_init (&frame->stream, stream);
+	frame->arv_buffer = arv_buffer;
+
+	return frame;
+}
+
+GstAravisFrame *
+gst_aravis_frame_ref (GstAravisFrame *frame)
+{
+	g_return_val_if_fail (frame != NULL, NULL);
+
+	g_atomic_int_inc (&frame->ref_count);
+
+	return frame;
+}
+
+void
+gst_aravis_frame_unref (GstAravisFrame *frame)
+{
+	ArvStream *stream;
+
+	g_return_if_fail (frame != NULL);
+
+	if (!g_atomic_int_dec_and_test (&frame->ref_count))
+		return;
+
+	stream = g_weak_ref_get (&frame->stream);
+	if (stream != NULL) {
+		arv_stream_push_buffer (stream, frame->arv_buffer);
+		g_object_unref (stream);
+	} else
+		g_object_unref (frame->arv_buffer);
+
+	g_weak_ref_clear (&frame->stream);
+	g_free (frame);
+}
+
+GType
+gst_aravis_meta_api_get_type (void)
+{
+	static GType type = 0;
+	/* No tags, the informations are not related to the buffer content format or memory */
+	static const gchar *tags[] = { NULL };
+
+	if (g_once_init_enter (&type)) {
+		GType _type = gst_meta_api_type_register ("GstAravisMetaAPI", tags);
+
+		g_once_init_leave (&type, _type);
+	}
+
+	return type;
+}
+
+static gboolean
+gst_aravis_meta_init (GstMeta *meta, gpointer params, GstBuffer *buffer)
+{
+	GstAravisMeta *aravis_meta = (GstAravisMeta *) meta;
+
+	aravis_meta->frame_id = 0;
+	aravis_meta->timestamp = 0;
+	aravis_meta->system_timestamp = 0;
+	aravis_meta->status = ARV_BUFFER_STATUS_UNKNOWN;
+	aravis_meta->n_completed_buffers = 0;
+	aravis_meta->n_failures = 0;
+	aravis_meta->n_underruns = 0;
+	aravis_meta->n_missing_packets = 0;
+	aravis_meta->n_resent_packets = 0;
+	aravis_meta->n_transferred_bytes = 0;
+	aravis_meta->chunks = NULL;
+
+	return TRUE;
+}
+
+static void
+gst_aravis_meta_free (GstMeta *meta, GstBuffer *buffer)
+{
+	GstAravisMeta *aravis_meta = (GstAravisMeta *) meta;
+
+	g_clear_pointer (&aravis_meta->chunks, gst_structure_free);
+}
+
+static gboolean
+gst_aravis_meta_transform (GstBuffer *dest, GstMeta *meta, GstBuffer *buffer, GQuark type, gpointer data)
+{
+	GstAravisMeta *aravis_meta = (GstAravisMeta *) meta;
+	GstAravisMeta *dest_meta;
+
+	if (!GST_META_TRANSFORM_IS_COPY (type))
+		return FALSE;
+
+	dest_meta = (GstAravisMeta *) gst_buffer_add_meta (dest, GST_ARAVIS_META_INFO, NULL);
+	if (dest_meta == NULL)
+		return FALSE;
+
+	dest_meta->frame_id = aravis_meta->frame_id;
+	dest_meta->timestamp = aravis_meta->timestamp;
+	dest_meta->system_timestamp = aravis_meta->system_timestamp;
+	dest_meta->status = aravis_meta->status;
+	dest_meta->n_completed_buffers = aravis_meta->n_completed_buffers;
+	dest_meta->n_failures = aravis_meta->n_failures;
+	dest_meta->n_underruns = aravis_meta->n_underruns;
+	dest_meta->n_missing_packets = aravis_meta->n_missing_packets;
+	dest_meta->n_resent_packets = aravis_meta->n_resent_packets;
+	dest_meta->n_transferred_bytes = aravis_meta->n_transferred_bytes;
+	dest_meta->chunks = aravis_meta->chunks != NULL ? gst_structure_copy (aravis_meta->chunks) : NULL;
+
+	return TRUE;
+}
+
+const GstMetaInfo *
+gst_aravis_meta_get_info (void)
+{
+	static const GstMetaInfo *meta_info = NULL;
+
+	if (g_once_init_enter ((GstMetaInfo **) &meta_info)) {
+		const GstMetaInfo *info = gst_meta_register (GST_ARAVIS_META_API_TYPE,
+							     "GstAravisMeta",
+							     sizeof (GstAravisMeta),
+							     gst_aravis_meta_init,
+							     gst_aravis_meta_free,
+							     gst_aravis_meta_transform);
+
+		g_once_init_leave ((GstMetaInfo **) &meta_info, (GstMetaInfo *) info);
+	}
+
+	return meta_info;
+}
+
+/**
+ * gst_buffer_add_aravis_meta:
+ * @buffer: a #GstBuffer
+ * @arv_buffer: the #ArvBuffer @buffer was produced from
+ *
+ * Adds a #GstAravisMeta to @buffer, with the frame informations of @arv_buffer. The transport counters and the chunk
+ * data values are left to the caller.
+ *
+ * Returns: (transfer none): the #GstAravisMeta added to @buffer.
+ */
+
+GstAravisMeta *
+gst_buffer_add_aravis_meta (GstBuffer *buffer, ArvBuffer *arv_buffer)
+{
+	GstAravisMeta *aravis_meta;
+
+	g_return_val_if_fail (GST_IS_BUFFER (buffer), NULL);
+	g_return_val_if_fail (ARV_IS_BUFFER (arv_buffer), NULL);
+
+	aravis_meta = (GstAravisMeta *) gst_buffer_add_meta (buffer, GST_ARAVIS_META_INFO, NULL);
+	if (aravis_meta == NULL)
+		return NULL;
+
+	aravis_meta->frame_id = arv_buffer_get_frame_id (arv_buffer);
+	aravis_meta->timestamp = arv_buffer_get_timestamp (arv_buffer);
+	aravis_meta->system_timestamp = arv_buffer_get_system_timestamp (arv_buffer);
+	aravis_meta->status = arv_buffer_get_status (arv_buffer);
+
+	return aravis_meta;
+}
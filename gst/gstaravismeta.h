@@ -0,0 +1,96 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef GST_ARAVIS_META_H
+#define GST_ARAVIS_META_H
+
+#include <gst/gst.h>
+#include <arv.h>
+
+G_BEGIN_DECLS
+
+#define GST_ARAVIS_META_API_TYPE	(gst_aravis_meta_api_get_type())
+#define GST_ARAVIS_META_INFO		(gst_aravis_meta_get_info())
+
+typedef struct _GstAravisMeta GstAravisMeta;
+typedef struct _GstAravisFrame GstAravisFrame;
+
+/**
+ * GstAravisMeta:
+ * @meta: parent #GstMeta
+ * @frame_id: device frame id
+ * @timestamp: device timestamp, in ns
+ * @system_timestamp: host reception timestamp, in ns
+ * @status: #ArvBuffer status
+ * @n_completed_buffers: number of completed buffers of the stream at the time of the frame reception
+ * @n_failures: number of failed buffers of the stream
+ * @n_underruns: number of stream underruns
+ * @n_missing_packets: number of missing packets, GigEVision streams only, 0 otherwise
+ * @n_resent_packets: number of resent packets, GigEVision streams only, 0 otherwise
+ * @n_transferred_bytes: number of bytes received by the stream
+ * @chunks: (nullable): an "aravis-chunks" structure, holding the values of the chunk data listed in the chunks
+ * property of aravissrc under their names, %NULL if the frame has no chunk data
+ *
+ * Per frame informations of the buffers produced by aravissrc. The meta API is registered as "GstAravisMetaAPI",
+ * and the layout of the fields is stable, for use by applications which do not link to the plugin.
+ */
+
+struct _GstAravisMeta {
+	GstMeta meta;
+
+	guint64 frame_id;
+	guint64 timestamp;
+	guint64 system_timestamp;
+	ArvBufferStatus status;
+
+	guint64 n_completed_buffers;
+	guint64 n_failures;
+	guint64 n_underruns;
+	guint64 n_missing_packets;
+	guint64 n_resent_packets;
+	guint64 n_transferred_bytes;
+
+	GstStructure *chunks;
+};
+
+GType			gst_aravis_meta_api_get_type	(void);
+const GstMetaInfo *	gst_aravis_meta_get_info	(void);
+
+GstAravisMeta *		gst_buffer_add_aravis_meta	(GstBuffer *buffer, ArvBuffer *arv_buffer);
+
+/* Plugin internals */
+
+typedef struct {
+	char *name;
+	char *feature;
+	GType type;
+} GstAravisChunk;
+
+GstAravisFrame *	gst_aravis_frame_new		(ArvStream *stream, ArvBuffer *arv_buffer);
+GstAravisFrame *	gst_aravis_frame_ref		(GstAravisFrame *frame);
+void			gst_aravis_frame_unref		(GstAravisFrame *frame);
+
+#define gst_buffer_get_aravis_meta(b)	((GstAravisMeta *) gst_buffer_get_meta ((b), GST_ARAVIS_META_API_TYPE))
+
+G_END_DECLS
+
+#endif
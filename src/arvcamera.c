@@ -123,6 +123,13 @@ typedef struct {
 
         gboolean has_region_offset;
 
+	/* Vendor specific feature choices, resolved at construction */
+	ArvFeatureHandle *frame_rate;
+	gboolean frame_rate_is_enumeration;
+	ArvFeatureHandle *frame_rate_enable;
+	ArvFeatureHandle *exposure_time;
+	ArvFeatureHandle *gain;
+
 	GError *init_error;
 } ArvCameraPrivate;
 
@@ -301,6 +308,19 @@ arv_camera_is_region_offset_available (ArvCamera *camera, GError **error)
         return has_offset_x && has_offset_y;
 }
 
+/* Commits the current device transaction, or aborts it if @error is already set */
+
+static void
+_camera_end_transaction (ArvCamera *camera, GError **error)
+{
+	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
+
+	if (*error == NULL)
+		arv_device_commit_transaction (priv->device, error);
+	else
+		arv_device_abort_transaction (priv->device);
+}
+
 /**
  * arv_camera_set_region:
  * @camera: a #ArvCamera
@@ -324,23 +344,42 @@ arv_camera_set_region (ArvCamera *camera, gint x, gint y, gint width, gint heigh
 
 	g_return_if_fail (ARV_IS_CAMERA (camera));
 
+	/* The region features are written in transactions, which allows the merge of the register writes. The bounds of
+	 * Width and Height depend on the offsets, and the bounds of the offsets on the size, which are only up to date once
+	 * the writes they depend on reached the device. The offset reset, the size and the offset changes are hence
+	 * committed one after the other. */
+
         if (priv->has_region_offset) {
+		arv_device_begin_transaction (priv->device);
+
                 if (x >= 0)
                         arv_camera_set_integer (camera, "OffsetX", 0, &local_error);
                 if (y >= 0 && local_error == NULL)
                         arv_camera_set_integer (camera, "OffsetY", 0, &local_error);
+
+		_camera_end_transaction (camera, &local_error);
         }
 
-        if (width > 0 && local_error == NULL)
-                arv_camera_set_integer (camera, "Width", width, &local_error);
-        if (height > 0 && local_error == NULL)
-                arv_camera_set_integer (camera, "Height", height, &local_error);
+	if (local_error == NULL) {
+		arv_device_begin_transaction (priv->device);
 
-        if (priv->has_region_offset) {
-                if (x >= 0 && local_error == NULL)
+		if (width > 0)
+			arv_camera_set_integer (camera, "Width", width, &local_error);
+		if (height > 0 && local_error == NULL)
+			arv_camera_set_integer (camera, "Height", height, &local_error);
+
+		_camera_end_transaction (camera, &local_error);
+	}
+
+        if (priv->has_region_offset && local_error == NULL) {
+		arv_device_begin_transaction (priv->device);
+
+                if (x >= 0)
                         arv_camera_set_integer (camera, "OffsetX", x, &local_error);
                 if (y >= 0 && local_error == NULL)
                         arv_camera_set_integer (camera, "OffsetY", y, &local_error);
+
+		_camera_end_transaction (camera, &local_error);
         }
 
 	if (local_error != NULL)
@@ -1042,7 +1081,6 @@ arv_camera_set_frame_rate (ArvCamera *camera, double frame_rate, GError **error)
 {
 	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
 	GError *local_error = NULL;
-	ArvGcNode *feature;
 	double minimum;
 	double maximum;
 
@@ -1078,19 +1116,15 @@ arv_camera_set_frame_rate (ArvCamera *camera, double frame_rate, GError **error)
 				arv_camera_set_frame_rate_enable(camera, TRUE, &local_error);
 			}
 			if (local_error == NULL)
-				arv_camera_set_float (camera,
-						      priv->has_acquisition_frame_rate ?
-						      "AcquisitionFrameRate":
-						      "AcquisitionFrameRateAbs", frame_rate, &local_error);
+				arv_feature_handle_set_float_value (priv->frame_rate, frame_rate, &local_error);
 			break;
 		case ARV_CAMERA_VENDOR_PROSILICA:
 			if (local_error == NULL)
-				arv_camera_set_float (camera, "AcquisitionFrameRateAbs", frame_rate, &local_error);
+				arv_feature_handle_set_float_value (priv->frame_rate, frame_rate, &local_error);
 			break;
 		case ARV_CAMERA_VENDOR_TIS:
 			if (local_error == NULL) {
-				feature = arv_device_get_feature (priv->device, "FPS");
-				if (ARV_IS_GC_ENUMERATION (feature)) {
+				if (priv->frame_rate_is_enumeration) {
 					gint64 *values;
 					guint n_values;
 					guint i;
@@ -1103,15 +1137,16 @@ arv_camera_set_frame_rate (ArvCamera *camera, double frame_rate, GError **error)
 
 							e = (int)((10000000/(double) values[i]) * 100 + 0.5) / 100.0;
 							if (e == frame_rate) {
-								arv_camera_set_integer (camera, "FPS",
-                                                                                        values[i], &local_error);
+								arv_feature_handle_set_integer_value (priv->frame_rate,
+												      values[i],
+												      &local_error);
 								break;
 							}
 						}
 					}
 					g_free (values);
 				} else
-					arv_camera_set_float (camera, "FPS", frame_rate, &local_error);
+					arv_feature_handle_set_float_value (priv->frame_rate, frame_rate, &local_error);
 			}
 			break;
 		case ARV_CAMERA_VENDOR_POINT_GREY_FLIR:
@@ -1133,10 +1168,7 @@ arv_camera_set_frame_rate (ArvCamera *camera, double frame_rate, GError **error)
 		case ARV_CAMERA_VENDOR_UNKNOWN:
 			arv_camera_set_frame_rate_enable(camera, TRUE, &local_error);
 			if (local_error == NULL)
-				arv_camera_set_float (camera,
-                                                      priv->has_acquisition_frame_rate ?
-                                                      "AcquisitionFrameRate":
-                                                      "AcquisitionFrameRateAbs", frame_rate, &local_error);
+				arv_feature_handle_set_float_value (priv->frame_rate, frame_rate, &local_error);
                         break;
         }
 
@@ -1158,27 +1190,25 @@ double
 arv_camera_get_frame_rate (ArvCamera *camera, GError **error)
 {
 	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
-	ArvGcNode *feature;
 
 	g_return_val_if_fail (ARV_IS_CAMERA (camera), 0);
 
 	switch (priv->vendor) {
 		case ARV_CAMERA_VENDOR_PROSILICA:
-			return arv_camera_get_float (camera, "AcquisitionFrameRateAbs", error);
+			return arv_feature_handle_get_float_value (priv->frame_rate, error);
 		case ARV_CAMERA_VENDOR_TIS:
 			{
-				feature = arv_device_get_feature (priv->device, "FPS");
-				if (ARV_IS_GC_ENUMERATION (feature)) {
+				if (priv->frame_rate_is_enumeration) {
 					gint64 i;
 
-					i = arv_camera_get_integer (camera, "FPS", error);
+					i = arv_feature_handle_get_integer_value (priv->frame_rate, error);
 
 					if (i > 0)
 						return (int)((10000000/(double) i) * 100 + 0.5) / 100.0;
 					else
 						return 0;
 				} else
-					return arv_camera_get_float (camera, "FPS", error);
+					return arv_feature_handle_get_float_value (priv->frame_rate, error);
 			}
 		case ARV_CAMERA_VENDOR_POINT_GREY_FLIR:
 		case ARV_CAMERA_VENDOR_DALSA:
@@ -1188,10 +1218,7 @@ arv_camera_get_frame_rate (ArvCamera *camera, GError **error)
 		case ARV_CAMERA_VENDOR_MATRIX_VISION:
 		case ARV_CAMERA_VENDOR_IMPERX:
 		case ARV_CAMERA_VENDOR_UNKNOWN:
-			return arv_camera_get_float (camera,
-						     priv->has_acquisition_frame_rate ?
-						     "AcquisitionFrameRate": "AcquisitionFrameRateAbs",
-						     error);
+			return arv_feature_handle_get_float_value (priv->frame_rate, error);
 	}
 
 	return 0;
@@ -1213,14 +1240,12 @@ void
 arv_camera_get_frame_rate_bounds (ArvCamera *camera, double *min, double *max, GError **error)
 {
 	ArvCameraPrivate *priv = arv_camera_get_instance_private (camera);
-	ArvGcNode *feature;
 
 	g_return_if_fail (ARV_IS_CAMERA (camera));
 
 	switch (priv->vendor) {
 		case ARV_CAMERA_VENDOR_TIS:
-			feature = arv_device_get_feature (priv->device, "FPS");
-			if (ARV_IS_GC_ENUMERATION (feature)) {
+			if (priv->frame_rate_is_enumeration) {
 				GError *local_error = NULL;
 				gint64 *values;
 				guint n_values;
@@ -1253,10 +1278,10 @@ arv_camera_get_frame_rate_bounds (ArvCamera *camera, double *min, double *max, G
 
 				return;
 			} else
-				arv_camera_get_float_bounds (camera, "FPS", min, max, error);
+				arv_feature_handle_get_float_bounds (priv->frame_rate, min, max, error);
 			break;
 		case ARV_CAMERA_VENDOR_PROSILICA:
-			arv_camera_get_float_bounds (camera, "AcquisitionFrameRateAbs", min, max, error);
+			arv_feature_handle_get_float_bounds (priv->frame_rate, min, max, error);
 			break;
 		case ARV_CAMERA_VENDOR_POINT_GREY_FLIR:
 		case ARV_CAMERA_VENDOR_DALSA:
@@ -1266,11 +1291,7 @@ arv_camera_get_frame_rate_bounds (ArvCamera *camera, double *min, double *max, G
 		case ARV_CAMERA_VENDOR_MATRIX_VISION:
 		case ARV_CAMERA_VENDOR_IMPERX:
 		case ARV_CAMERA_VENDOR_UNKNOWN:
-			arv_camera_get_float_bounds (camera,
-						     priv->has_acquisition_frame_rate ?
-						     "AcquisitionFrameRate":
-						     "AcquisitionFrameRateAbs",
-						     min, max, error);
+			arv_feature_handle_get_float_bounds (priv->frame_rate, min, max, error);
 			break;
 	}
 }
@@ -1295,12 +1316,8 @@ arv_camera_set_frame_rate_enable(ArvCamera *camera, gboolean enable, GError **er
 
   switch (priv->vendor) {
 		case ARV_CAMERA_VENDOR_POINT_GREY_FLIR:
-			if (local_error == NULL) {
-				if (priv->has_acquisition_frame_rate_enabled)
-					arv_camera_set_boolean (camera, "AcquisitionFrameRateEnabled", enable, &local_error);
-				else
-					arv_camera_set_boolean (camera, "AcquisitionFrameRateEnable", enable, &local_error);
-			}
+			if (local_error == NULL)
+				arv_feature_handle_set_boolean_value (priv->frame_rate_enable, enable, &local_error);
 			break;
 		case ARV_CAMERA_VENDOR_BASLER:
 		case ARV_CAMERA_VENDOR_DALSA:
@@ -1310,9 +1327,10 @@ arv_camera_set_frame_rate_enable(ArvCamera *camera, gboolean enable, GError **er
 		case ARV_CAMERA_VENDOR_IMPERX:
 		case ARV_CAMERA_VENDOR_UNKNOWN:
 			if (local_error == NULL) {
-				if (arv_camera_is_feature_available (camera, "AcquisitionFrameRateEnable", &local_error)) {
+				if (arv_feature_handle_is_available (priv->frame_rate_enable, &local_error)) {
 					if (local_error == NULL)
-						arv_camera_set_boolean (camera, "AcquisitionFrameRateEnable", enable, &local_error);
+						arv_feature_handle_set_boolean_value (priv->frame_rate_enable, enable,
+										      &local_error);
 					}
 			}
 			break;
@@ -1347,11 +1365,7 @@ gboolean arv_camera_get_frame_rate_enable(ArvCamera* camera, GError** error)
 	switch (priv->vendor)
 	{
 		case ARV_CAMERA_VENDOR_POINT_GREY_FLIR:
-			return arv_camera_get_boolean(camera,
-										  priv->has_acquisition_frame_rate_enabled
-											  ? "AcquisitionFrameRateEnabled"
-											  : "AcquisitionFrameRateEnable",
-										  error);
+			return arv_feature_handle_get_boolean_value (priv->frame_rate_enable, error);
 		case ARV_CAMERA_VENDOR_BASLER:
 		case ARV_CAMERA_VENDOR_DALSA:
 		case ARV_CAMERA_VENDOR_RICOH:
@@ -1359,9 +1373,9 @@ gboolean arv_camera_get_frame_rate_enable(ArvCamera* camera, GError** error)
 		case ARV_CAMERA_VENDOR_MATRIX_VISION:
 		case ARV_CAMERA_VENDOR_IMPERX:
 		case ARV_CAMERA_VENDOR_UNKNOWN:
-			if (arv_camera_is_feature_available(camera, "AcquisitionFrameRateEnable", NULL))
+			if (arv_feature_handle_is_available (priv->frame_rate_enable, NULL))
 			{
-				return arv_camera_get_boolean(camera, "AcquisitionFrameRateEnable", error);
+				return arv_feature_handle_get_boolean_value (priv->frame_rate_enable, error);
 			}
 			break;
 		case ARV_CAMERA_VENDOR_PROSILICA:
@@ -1643,10 +1657,8 @@ arv_camera_set_exposure_time (ArvCamera *camera, double exposure_time_us, GError
 				arv_camera_set_integer (camera, "ExposureTimeRaw", 1, &local_error);
 			break;
 		case ARV_CAMERA_SERIES_RICOH:
-			arv_camera_set_integer (camera, "ExposureTimeRaw", exposure_time_us, &local_error);
-			break;
 		case ARV_CAMERA_SERIES_XIMEA:
-			arv_camera_set_integer (camera, "ExposureTime", exposure_time_us, &local_error);
+			arv_feature_handle_set_integer_value (priv->exposure_time, exposure_time_us, &local_error);
 			break;
 		case ARV_CAMERA_SERIES_IMPERX_CHEETAH:
 		case ARV_CAMERA_SERIES_MATRIX_VISION:
@@ -1656,10 +1668,7 @@ arv_camera_set_exposure_time (ArvCamera *camera, double exposure_time_us, GError
 			break;
 		case ARV_CAMERA_SERIES_BASLER_ACE:
 		default:
-			arv_camera_set_float (camera,
-					      priv->has_exposure_time ?
-					      "ExposureTime" :
-					      "ExposureTimeAbs", exposure_time_us, &local_error);
+			arv_feature_handle_set_float_value (priv->exposure_time, exposure_time_us, &local_error);
 			break;
 	}
 
@@ -1686,14 +1695,10 @@ arv_camera_get_exposure_time (ArvCamera *camera, GError **error)
 
 	switch (priv->series) {
 		case ARV_CAMERA_SERIES_XIMEA:
-			return arv_camera_get_integer (camera,"ExposureTime", error);
 		case ARV_CAMERA_SERIES_RICOH:
-			return arv_camera_get_integer (camera,"ExposureTimeRaw", error);
+			return arv_feature_handle_get_integer_value (priv->exposure_time, error);
 		default:
-			return arv_camera_get_float (camera,
-						     priv->has_exposure_time ?
-						     "ExposureTime" :
-						     "ExposureTimeAbs", error);
+			return arv_feature_handle_get_float_value (priv->exposure_time, error);
 	}
 }
 
@@ -1863,16 +1868,10 @@ arv_camera_set_gain (ArvCamera *camera, double gain, GError **error)
 	if (gain < 0)
 		return;
 
-	if (priv->has_gain)
-		arv_camera_set_float (camera, "Gain", gain, error);
-	else {
-		if (priv->gain_raw_as_float)
-			arv_camera_set_float (camera, "GainRaw", gain, error);
-		else if (priv->gain_abs_as_float)
-			arv_camera_set_float (camera, "GainAbs", gain, error);
-		else
-			arv_camera_set_integer (camera, "GainRaw", gain, error);
-	}
+	if (priv->has_gain || priv->gain_raw_as_float || priv->gain_abs_as_float)
+		arv_feature_handle_set_float_value (priv->gain, gain, error);
+	else
+		arv_feature_handle_set_integer_value (priv->gain, gain, error);
 }
 
 /**
@@ -1892,14 +1891,10 @@ arv_camera_get_gain (ArvCamera *camera, GError **error)
 
 	g_return_val_if_fail (ARV_IS_CAMERA (camera), 0.0);
 
-	if (priv->has_gain)
-		return arv_camera_get_float (camera, "Gain", error);
-	else if (priv->gain_raw_as_float)
-		return arv_camera_get_float (camera, "GainRaw", error);
-	else if (priv->gain_abs_as_float)
-		return arv_camera_get_float (camera, "GainAbs", error);
+	if (priv->has_gain || priv->gain_raw_as_float || priv->gain_abs_as_float)
+		return arv_feature_handle_get_float_value (priv->gain, error);
 
-	return arv_camera_get_integer (camera, "GainRaw", error);
+	return arv_feature_handle_get_integer_value (priv->gain, error);
 }
 
 /**
@@ -4415,6 +4410,51 @@ arv_camera_constructed (GObject *object)
 
         priv->has_region_offset = ARV_IS_GC_INTEGER(arv_device_get_feature(priv->device, "OffsetX")) &&
                 ARV_IS_GC_INTEGER(arv_device_get_feature(priv->device, "OffsetY"));
+
+	switch (vendor) {
+		case ARV_CAMERA_VENDOR_PROSILICA:
+			priv->frame_rate = arv_device_get_feature_handle (priv->device, "AcquisitionFrameRateAbs");
+			break;
+		case ARV_CAMERA_VENDOR_TIS:
+			priv->frame_rate = arv_device_get_feature_handle (priv->device, "FPS");
+			priv->frame_rate_is_enumeration =
+				ARV_IS_GC_ENUMERATION (arv_feature_handle_get_node (priv->frame_rate));
+			break;
+		default:
+			priv->frame_rate = arv_device_get_feature_handle (priv->device,
+									  priv->has_acquisition_frame_rate ?
+									  "AcquisitionFrameRate" :
+									  "AcquisitionFrameRateAbs");
+			break;
+	}
+
+	priv->frame_rate_enable = arv_device_get_feature_handle (priv->device,
+								 vendor == ARV_CAMERA_VENDOR_POINT_GREY_FLIR &&
+								 priv->has_acquisition_frame_rate_enabled ?
+								 "AcquisitionFrameRateEnabled" :
+								 "AcquisitionFrameRateEnable");
+
+	switch (series) {
+		case ARV_CAMERA_SERIES_XIMEA:
+			priv->exposure_time = arv_device_get_feature_handle (priv->device, "ExposureTime");
+			break;
+		case ARV_CAMERA_SERIES_RICOH:
+			priv->exposure_time = arv_device_get_feature_handle (priv->device, "ExposureTimeRaw");
+			break;
+		default:
+			priv->exposure_time = arv_device_get_feature_handle (priv->device,
+									     priv->has_exposure_time ?
+									     "ExposureTime" :
+									     "ExposureTimeAbs");
+			break;
+	}
+
+	if (priv->has_gain)
+		priv->gain = arv_device_get_feature_handle (priv->device, "Gain");
+	else if (priv->gain_abs_as_float && !priv->gain_raw_as_float)
+		priv->gain = arv_device_get_feature_handle (priv->device, "GainAbs");
+	else
+		priv->gain = arv_device_get_feature_handle (priv->device, "GainRaw");
 }
 
 static void
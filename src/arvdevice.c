@@ -32,22 +32,29 @@
 #include <arvdevice.h>
 #include <arvdeviceprivate.h>
 #include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvgccommand.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcfeaturenode.h>
+#include <arvgcfeaturenodeprivate.h>
 #include <arvgcboolean.h>
 #include <arvgcenumeration.h>
+#include <arvgccategory.h>
 #include <arvgcregister.h>
+#include <arvgcregisternodeprivate.h>
+#include <arvgcportprivate.h>
 #include <arvgcstring.h>
 #include <arvstream.h>
-#include <arvdebug.h>
+#include <arvdebugprivate.h>
+#include <string.h>
 
 enum {
 	ARV_DEVICE_SIGNAL_CONTROL_LOST,
 #if ARAVIS_HAS_EVENT
 	ARV_DEVICE_SIGNAL_DEVICE_EVENT,
 #endif
+	ARV_DEVICE_SIGNAL_FEATURE_CHANGED,
 	ARV_DEVICE_SIGNAL_LAST
 } ArvDeviceSignals;
 
@@ -59,11 +66,74 @@ arv_device_error_quark (void)
 	return g_quark_from_static_string ("arv-device-error-quark");
 }
 
+typedef struct _ArvDevicePolling ArvDevicePolling;
+
 typedef struct {
 	GError *init_error;
         GSList *streams;
+
+	GHashTable *feature_handles;
+
+	/* Layout of the registers in the device memory, and support of multiple register accesses per request */
+	int register_byte_order;
+	gboolean is_register_batching_supported;
+
+	/* Transaction, owned by a single thread from the outermost begin to the matching commit or abort */
+	GRecMutex transaction_mutex;
+	GThread *transaction_thread;
+	guint transaction_depth;
+	GArray *staged_writes;
+
+	/* Feature polling */
+	GHashTable *polling_times;		/* feature name -> period in ms */
+	ArvDevicePolling *polling;
 } ArvDevicePrivate;
 
+/* A register or memory write delayed until the end of the current transaction. The data are stored as they will
+ * appear in the device memory, register values included, so that memory and register reads share the same view of
+ * the staged writes. */
+
+typedef struct {
+	guint64 address;
+	guint32 size;
+	gboolean is_register;
+	guint8 *data;
+} ArvDeviceStagedWrite;
+
+/* A block of device memory read before a feature snapshot */
+
+typedef struct {
+	guint64 address;
+	guint32 size;
+	guint8 *data;
+} ArvDevicePrefetchedBlock;
+
+/* Device image, built for the duration of a feature snapshot or poll. It is only visible from the thread doing it, as
+ * the values read from other threads must not come from it. */
+
+typedef struct _ArvDevicePrefetch ArvDevicePrefetch;
+
+struct _ArvDevicePrefetch {
+	ArvDevice *device;
+	GArray *blocks;			/* ArvDevicePrefetchedBlock */
+	GHashTable *registers;		/* address -> value */
+	ArvDevicePrefetch *previous;
+};
+
+static GPrivate arv_device_prefetch = G_PRIVATE_INIT (NULL);
+
+static ArvDevicePrefetch *
+_get_prefetch (ArvDevice *device)
+{
+	ArvDevicePrefetch *prefetch;
+
+	for (prefetch = g_private_get (&arv_device_prefetch); prefetch != NULL; prefetch = prefetch->previous)
+		if (prefetch->device == device)
+			return prefetch;
+
+	return NULL;
+}
+
 static void arv_device_initable_iface_init (GInitableIface *iface);
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvDevice, arv_device, G_TYPE_OBJECT,
@@ -109,6 +179,466 @@ arv_device_create_stream (ArvDevice *device,
         return stream;
 }
 
+/* Transport call timing, for the genicam profiler */
+
+static gint64
+_profile_transport_start (ArvDevice *device)
+{
+	if (!arv_gc_is_profiling (ARV_DEVICE_GET_CLASS (device)->get_genicam (device)))
+		return 0;
+
+	return g_get_monotonic_time ();
+}
+
+static gboolean
+_profile_transport_end (ArvDevice *device, const char *operation, guint64 address, guint64 size,
+			gint64 start, gboolean success)
+{
+	if (start != 0)
+		arv_gc_profile_transport (ARV_DEVICE_GET_CLASS (device)->get_genicam (device), operation,
+					  address, size, g_get_monotonic_time () - start, success);
+
+	return success;
+}
+
+/* Device reads, using the prefetched device image if any */
+
+static gboolean
+_read_device_memory (ArvDevice *device, guint64 address, guint32 size, void *buffer, GError **error)
+{
+	ArvDevicePrefetch *prefetch = _get_prefetch (device);
+	gint64 start;
+
+	if (prefetch != NULL) {
+		guint i;
+
+		for (i = 0; i < prefetch->blocks->len; i++) {
+			ArvDevicePrefetchedBlock *block = &g_array_index (prefetch->blocks,
+									  ArvDevicePrefetchedBlock, i);
+
+			if (block->address <= address && block->address + block->size >= address + size) {
+				memcpy (buffer, block->data + (address - block->address), size);
+				return TRUE;
+			}
+		}
+	}
+
+	start = _profile_transport_start (device);
+
+	return _profile_transport_end (device, "ReadMemory", address, size, start,
+				       ARV_DEVICE_GET_CLASS (device)->read_memory (device, address, size,
+										   buffer, error));
+}
+
+static gboolean
+_read_device_register (ArvDevice *device, guint64 address, guint32 *value, GError **error)
+{
+	ArvDevicePrefetch *prefetch = _get_prefetch (device);
+	gpointer prefetched_value;
+	gint64 start;
+
+	if (prefetch != NULL &&
+	    g_hash_table_lookup_extended (prefetch->registers, &address, NULL, &prefetched_value)) {
+		*value = GPOINTER_TO_UINT (prefetched_value);
+		return TRUE;
+	}
+
+	start = _profile_transport_start (device);
+
+	return _profile_transport_end (device, "ReadRegister", address, sizeof (guint32), start,
+				       ARV_DEVICE_GET_CLASS (device)->read_register (device, address, value, error));
+}
+
+/* Transactions */
+
+static void
+_staged_write_clear (ArvDeviceStagedWrite *write)
+{
+	g_clear_pointer (&write->data, g_free);
+}
+
+static void
+_register_to_data (ArvDevicePrivate *priv, guint32 value, guint8 *data)
+{
+	value = priv->register_byte_order == G_BIG_ENDIAN ? GUINT32_TO_BE (value) : GUINT32_TO_LE (value);
+	memcpy (data, &value, sizeof (value));
+}
+
+static guint32
+_data_to_register (ArvDevicePrivate *priv, const guint8 *data)
+{
+	guint32 value;
+
+	memcpy (&value, data, sizeof (value));
+
+	return priv->register_byte_order == G_BIG_ENDIAN ? GUINT32_FROM_BE (value) : GUINT32_FROM_LE (value);
+}
+
+/* Consecutive writes to the same location are combined. Older writes are otherwise kept, as the device may rely on
+ * the intermediate values, for example when an offset is reset before a change of the region size. */
+
+static void
+_stage_write (ArvDevicePrivate *priv, guint64 address, guint32 size, gboolean is_register, const void *buffer)
+{
+	ArvDeviceStagedWrite *last = NULL;
+	ArvDeviceStagedWrite write;
+
+	if (priv->staged_writes->len > 0)
+		last = &g_array_index (priv->staged_writes, ArvDeviceStagedWrite, priv->staged_writes->len - 1);
+
+	if (last != NULL &&
+	    last->is_register == is_register &&
+	    last->address == address &&
+	    last->size == size) {
+		memcpy (last->data, buffer, size);
+		return;
+	}
+
+	write.address = address;
+	write.size = size;
+	write.is_register = is_register;
+	write.data = g_malloc (size);
+	memcpy (write.data, buffer, size);
+
+	g_array_append_val (priv->staged_writes, write);
+}
+
+/* Only the thread owning the transaction stages its writes and sees the staged values. The accesses from the other
+ * threads go directly to the device. */
+
+static gboolean
+_is_transaction_owner (ArvDevicePrivate *priv)
+{
+	return g_atomic_pointer_get (&priv->transaction_thread) == g_thread_self ();
+}
+
+/* Reads inside a transaction see the staged writes, whether they were issued as memory or register writes. Returns
+ * %TRUE if at least one staged write overlaps the requested range. @is_covered is set if a single staged write covers
+ * the whole range, in which case the device does not need to be accessed. */
+
+static gboolean
+_find_staged_writes (ArvDevicePrivate *priv, guint64 address, guint32 size, gboolean *is_covered)
+{
+	gboolean has_overlap = FALSE;
+	guint i;
+
+	*is_covered = FALSE;
+
+	for (i = 0; i < priv->staged_writes->len; i++) {
+		ArvDeviceStagedWrite *write = &g_array_index (priv->staged_writes, ArvDeviceStagedWrite, i);
+
+		if (write->address >= address + size ||
+		    write->address + write->size <= address)
+			continue;
+
+		has_overlap = TRUE;
+		if (write->address <= address && write->address + write->size >= address + size)
+			*is_covered = TRUE;
+	}
+
+	return has_overlap;
+}
+
+static void
+_apply_staged_writes (ArvDevicePrivate *priv, guint64 address, guint32 size, void *buffer)
+{
+	guint i;
+
+	for (i = 0; i < priv->staged_writes->len; i++) {
+		ArvDeviceStagedWrite *write = &g_array_index (priv->staged_writes, ArvDeviceStagedWrite, i);
+		guint64 start, end;
+
+		start = MAX (address, write->address);
+		end = MIN (address + size, write->address + write->size);
+		if (start < end)
+			memcpy ((char *) buffer + (start - address), write->data + (start - write->address), end - start);
+	}
+}
+
+static gboolean
+_read_registers (ArvDevice *device, guint n_registers, const guint64 *addresses, guint32 *values, GError **error)
+{
+	guint i;
+
+	for (i = 0; i < n_registers; i++)
+		if (!ARV_DEVICE_GET_CLASS (device)->read_register (device, addresses[i], &values[i], error))
+			return FALSE;
+
+	return TRUE;
+}
+
+static gboolean
+_write_registers (ArvDevice *device, guint n_registers, const guint64 *addresses, const guint32 *values,
+		  GError **error)
+{
+	guint i;
+
+	for (i = 0; i < n_registers; i++)
+		if (!ARV_DEVICE_GET_CLASS (device)->write_register (device, addresses[i], values[i], error))
+			return FALSE;
+
+	return TRUE;
+}
+
+static guint
+_get_memory_run_end (GArray *staged_writes, guint index)
+{
+	ArvDeviceStagedWrite *write = &g_array_index (staged_writes, ArvDeviceStagedWrite, index);
+	guint64 end = write->address + write->size;
+	guint i;
+
+	for (i = index + 1; i < staged_writes->len; i++) {
+		ArvDeviceStagedWrite *next = &g_array_index (staged_writes, ArvDeviceStagedWrite, i);
+
+		if (next->is_register || next->address != end)
+			break;
+
+		end += next->size;
+	}
+
+	return i;
+}
+
+/* When the device accepts multiple registers per request, an aligned 4 byte memory write which is not merged with its
+ * neighbours is sent along the register writes. */
+
+static gboolean
+_is_register_write (ArvDevicePrivate *priv, GArray *staged_writes, guint index)
+{
+	ArvDeviceStagedWrite *write = &g_array_index (staged_writes, ArvDeviceStagedWrite, index);
+
+	if (write->is_register)
+		return TRUE;
+
+	return priv->is_register_batching_supported &&
+		write->size == sizeof (guint32) &&
+		write->address % sizeof (guint32) == 0 &&
+		_get_memory_run_end (staged_writes, index) == index + 1;
+}
+
+/* Sends the staged writes in order. Runs of register writes are batched in a single device request, if supported by
+ * the device, and runs of memory writes to contiguous addresses are merged in a single memory write. */
+
+static gboolean
+_flush_staged_writes (ArvDevice *device, GArray *staged_writes, GError **error)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvDeviceClass *device_class = ARV_DEVICE_GET_CLASS (device);
+	guint n_requests = 0;
+	guint i, j;
+
+	for (i = 0; i < staged_writes->len; i = j) {
+		ArvDeviceStagedWrite *write = &g_array_index (staged_writes, ArvDeviceStagedWrite, i);
+		gint64 start = _profile_transport_start (device);
+		gboolean success;
+
+		if (_is_register_write (priv, staged_writes, i)) {
+			guint64 *addresses;
+			guint32 *values;
+			guint k;
+
+			for (j = i + 1; j < staged_writes->len && _is_register_write (priv, staged_writes, j); j++);
+
+			addresses = g_new (guint64, j - i);
+			values = g_new (guint32, j - i);
+			for (k = i; k < j; k++) {
+				ArvDeviceStagedWrite *batched = &g_array_index (staged_writes,
+										ArvDeviceStagedWrite, k);
+
+				addresses[k - i] = batched->address;
+				values[k - i] = _data_to_register (priv, batched->data);
+			}
+
+			success = device_class->write_registers (device, j - i, addresses, values, error);
+			_profile_transport_end (device, "WriteRegisters", addresses[0], (j - i) * sizeof (guint32),
+						start, success);
+
+			g_free (addresses);
+			g_free (values);
+		} else {
+			j = _get_memory_run_end (staged_writes, i);
+
+			if (j == i + 1) {
+				success = device_class->write_memory (device, write->address, write->size, write->data,
+								      error);
+				_profile_transport_end (device, "WriteMemory", write->address, write->size,
+							start, success);
+			} else {
+				ArvDeviceStagedWrite *last = &g_array_index (staged_writes, ArvDeviceStagedWrite, j - 1);
+				guint64 end = last->address + last->size;
+				guint8 *data;
+				guint32 offset = 0;
+				guint k;
+
+				data = g_malloc (end - write->address);
+				for (k = i; k < j; k++) {
+					ArvDeviceStagedWrite *merged = &g_array_index (staged_writes,
+										       ArvDeviceStagedWrite, k);
+
+					memcpy (data + offset, merged->data, merged->size);
+					offset += merged->size;
+				}
+
+				success = device_class->write_memory (device, write->address, end - write->address,
+								      data, error);
+				_profile_transport_end (device, "WriteMemory", write->address, end - write->address,
+							start, success);
+				g_free (data);
+			}
+		}
+
+		n_requests++;
+
+		if (!success)
+			return FALSE;
+	}
+
+	arv_debug_device ("[Device::commit_transaction] %u writes sent in %u requests",
+			  staged_writes->len, n_requests);
+
+	return TRUE;
+}
+
+/**
+ * arv_device_begin_transaction:
+ * @device: a #ArvDevice
+ *
+ * Starts a transaction. Until the matching call to arv_device_commit_transaction(), register and memory writes,
+ * either explicit or done through the Genicam features, are not sent to the device, but staged. Reads inside the
+ * transaction see the staged values. Transactions can be nested, only the outermost commit sends the staged writes.
+ *
+ * A transaction belongs to the calling thread: only its accesses are staged, the ones from other threads are sent
+ * directly to the device. If another thread already owns a transaction on @device, this function blocks until it is
+ * committed or aborted. The transaction must be ended from the thread which started it. The Genicam register
+ * caches are shared by all the threads, and may hold staged values until the end of the transaction.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_begin_transaction (ArvDevice *device)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	g_rec_mutex_lock (&priv->transaction_mutex);
+
+	if (priv->transaction_depth == 0)
+		g_atomic_pointer_set (&priv->transaction_thread, g_thread_self ());
+
+	priv->transaction_depth++;
+}
+
+/**
+ * arv_device_commit_transaction:
+ * @device: a #ArvDevice
+ * @error: a #GError placeholder
+ *
+ * Ends a transaction started by arv_device_begin_transaction(). For the outermost transaction, the staged writes are
+ * sent to the device, in the order they were issued. Consecutive writes to adjacent addresses are merged into single
+ * memory writes. If the device accepts multiple registers per request, consecutive register writes, and aligned 4
+ * byte memory writes which were not merged, are sent in a single request.
+ *
+ * On error, the remaining staged writes are dropped, and the register cache is invalidated.
+ *
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_commit_transaction (ArvDevice *device, GError **error)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	GArray *staged_writes;
+	gboolean success;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+	g_return_val_if_fail (_is_transaction_owner (priv), FALSE);
+
+	priv->transaction_depth--;
+	if (priv->transaction_depth > 0) {
+		g_rec_mutex_unlock (&priv->transaction_mutex);
+		return TRUE;
+	}
+
+	staged_writes = priv->staged_writes;
+	priv->staged_writes = g_array_new (FALSE, FALSE, sizeof (ArvDeviceStagedWrite));
+	g_array_set_clear_func (priv->staged_writes, (GDestroyNotify) _staged_write_clear);
+
+	/* The writes are sent outside of the transaction, but before the release of the lock, so that the transaction
+	 * of another thread only starts once they reached the device */
+	g_atomic_pointer_set (&priv->transaction_thread, NULL);
+
+	success = _flush_staged_writes (device, staged_writes, error);
+
+	g_rec_mutex_unlock (&priv->transaction_mutex);
+
+	g_array_unref (staged_writes);
+
+	if (!success) {
+		ArvGc *genicam = arv_device_get_genicam (device);
+
+		if (ARV_IS_GC (genicam))
+			arv_gc_invalidate_register_caches (genicam);
+	}
+
+	return success;
+}
+
+/**
+ * arv_device_abort_transaction:
+ * @device: a #ArvDevice
+ *
+ * Drops all the staged writes and ends the current transaction, including the outer ones if transactions are
+ * nested. As the Genicam register cache may contain values that were never written, it is invalidated.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_device_abort_transaction (ArvDevice *device)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvGc *genicam;
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	if (!_is_transaction_owner (priv))
+		return;
+
+	g_array_set_size (priv->staged_writes, 0);
+	g_atomic_pointer_set (&priv->transaction_thread, NULL);
+
+	for (; priv->transaction_depth > 0; priv->transaction_depth--)
+		g_rec_mutex_unlock (&priv->transaction_mutex);
+
+	genicam = arv_device_get_genicam (device);
+	if (ARV_IS_GC (genicam))
+		arv_gc_invalidate_register_caches (genicam);
+}
+
+/**
+ * arv_device_is_in_transaction:
+ * @device: a #ArvDevice
+ *
+ * Returns: %TRUE if a transaction is in progress in the calling thread.
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_device_is_in_transaction (ArvDevice *device)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+
+	return _is_transaction_owner (priv);
+}
+
 /**
  * arv_device_read_memory:
  * @device: a #ArvDevice
@@ -127,12 +657,28 @@ arv_device_create_stream (ArvDevice *device,
 gboolean
 arv_device_read_memory (ArvDevice *device, guint64 address, guint32 size, void *buffer, GError **error)
 {
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
 	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
 	g_return_val_if_fail (buffer != NULL, FALSE);
 	g_return_val_if_fail (size > 0, FALSE);
 	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	return ARV_DEVICE_GET_CLASS (device)->read_memory (device, address, size, buffer, error);
+	if (_is_transaction_owner (priv)) {
+		gboolean is_covered;
+
+		if (_find_staged_writes (priv, address, size, &is_covered)) {
+			if (!is_covered &&
+			    !_read_device_memory (device, address, size, buffer, error))
+				return FALSE;
+
+			_apply_staged_writes (priv, address, size, buffer);
+
+			return TRUE;
+		}
+	}
+
+	return _read_device_memory (device, address, size, buffer, error);
 }
 
 /**
@@ -153,12 +699,24 @@ arv_device_read_memory (ArvDevice *device, guint64 address, guint32 size, void *
 gboolean
 arv_device_write_memory (ArvDevice *device, guint64 address, guint32 size, const void *buffer, GError **error)
 {
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	gint64 start;
+
 	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
 	g_return_val_if_fail (buffer != NULL, FALSE);
 	g_return_val_if_fail (size > 0, FALSE);
 	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	return ARV_DEVICE_GET_CLASS (device)->write_memory (device, address, size, buffer, error);
+	if (_is_transaction_owner (priv)) {
+		_stage_write (priv, address, size, FALSE, buffer);
+		return TRUE;
+	}
+
+	start = _profile_transport_start (device);
+
+	return _profile_transport_end (device, "WriteMemory", address, size, start,
+				       ARV_DEVICE_GET_CLASS (device)->write_memory (device, address, size,
+										    buffer, error));
 }
 
 /**
@@ -178,11 +736,32 @@ arv_device_write_memory (ArvDevice *device, guint64 address, guint32 size, const
 gboolean
 arv_device_read_register (ArvDevice *device, guint64 address, guint32 *value, GError **error)
 {
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
 	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
 	g_return_val_if_fail (value != NULL, FALSE);
 	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	return ARV_DEVICE_GET_CLASS (device)->read_register (device, address, value, error);
+	if (_is_transaction_owner (priv)) {
+		gboolean is_covered;
+
+		if (_find_staged_writes (priv, address, sizeof (guint32), &is_covered)) {
+			guint8 data[sizeof (guint32)] = {0};
+
+			if (!is_covered) {
+				if (!_read_device_register (device, address, value, error))
+					return FALSE;
+				_register_to_data (priv, *value, data);
+			}
+
+			_apply_staged_writes (priv, address, sizeof (guint32), data);
+			*value = _data_to_register (priv, data);
+
+			return TRUE;
+		}
+	}
+
+	return _read_device_register (device, address, value, error);
 }
 
 /**
@@ -202,10 +781,24 @@ arv_device_read_register (ArvDevice *device, guint64 address, guint32 *value, GE
 gboolean
 arv_device_write_register (ArvDevice *device, guint64 address, guint32 value, GError **error)
 {
-	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	gint64 start;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
 	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	return ARV_DEVICE_GET_CLASS (device)->write_register (device, address, value, error);
+	if (_is_transaction_owner (priv)) {
+		guint8 data[sizeof (guint32)];
+
+		_register_to_data (priv, value, data);
+		_stage_write (priv, address, sizeof (guint32), TRUE, data);
+		return TRUE;
+	}
+
+	start = _profile_transport_start (device);
+
+	return _profile_transport_end (device, "WriteRegister", address, sizeof (guint32), start,
+				       ARV_DEVICE_GET_CLASS (device)->write_register (device, address, value, error));
 }
 
 #if ARAVIS_HAS_EVENT
@@ -428,855 +1021,1972 @@ _get_feature (ArvDevice *device, GType node_type, const char *feature, GError **
 }
 
 /**
- * arv_device_get_feature_representation:
- * @device: a #ArvDevice
- * @feature: feature name
- *
- * Return: enum ArvGcRepresentation, ARV_GC_REPRESENTATION_UNDEFINED if not available.
+ * ArvFeatureHandle:
  *
- * Since: 0.10.0
+ * An opaque handle on a resolved feature, see arv_device_get_feature_handle().
  */
 
-ArvGcRepresentation
-arv_device_get_feature_representation (ArvDevice *device, const char *feature)
+struct _ArvFeatureHandle {
+	char *name;
+	ArvGc *genicam;
+	ArvGcNode *node;
+
+	/* Interfaces resolved at handle creation, NULL if the node doesn't implement them */
+	ArvGcIntegerInterface *integer_iface;
+	ArvGcFloatInterface *float_iface;
+	ArvGcStringInterface *string_iface;
+	gboolean is_boolean;
+};
+
+static ArvFeatureHandle *
+arv_feature_handle_new (ArvGc *genicam, const char *feature)
 {
-	ArvGcNode* node;
+	ArvFeatureHandle *handle;
+	ArvGcNode *node;
 
-	g_return_val_if_fail (ARV_IS_DEVICE (device), ARV_GC_REPRESENTATION_UNDEFINED);
-	g_return_val_if_fail (feature != NULL, ARV_GC_REPRESENTATION_UNDEFINED);
+	node = arv_gc_get_node (genicam, feature);
 
-	node = arv_device_get_feature (device, feature);
+	handle = g_new0 (ArvFeatureHandle, 1);
+	handle->name = g_strdup (feature);
+	handle->genicam = genicam;
 
-	if (ARV_IS_GC_FLOAT(node)) {
-		return arv_gc_float_get_representation(ARV_GC_FLOAT(node));
-	}else if (ARV_IS_GC_INTEGER(node)){
-		return arv_gc_integer_get_representation(ARV_GC_INTEGER (node));
+	if (ARV_IS_GC_FEATURE_NODE (node)) {
+		handle->node = node;
+
+		if (ARV_IS_GC_INTEGER (node))
+			handle->integer_iface = ARV_GC_INTEGER_GET_IFACE (node);
+		if (ARV_IS_GC_FLOAT (node))
+			handle->float_iface = ARV_GC_FLOAT_GET_IFACE (node);
+		if (ARV_IS_GC_STRING (node))
+			handle->string_iface = ARV_GC_STRING_GET_IFACE (node);
+		handle->is_boolean = ARV_IS_GC_BOOLEAN (node);
 	}
 
-	return ARV_GC_REPRESENTATION_UNDEFINED;
+	return handle;
+}
+
+static void
+arv_feature_handle_free (ArvFeatureHandle *handle)
+{
+	if (handle == NULL)
+		return;
+
+	g_free (handle->name);
+	g_free (handle);
+}
+
+static gboolean
+_feature_handle_check_type (ArvFeatureHandle *handle, gboolean is_valid, GType node_type, GError **error)
+{
+	if (G_LIKELY (is_valid))
+		return TRUE;
+
+	if (handle->node == NULL)
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
+			     "[%s] Not found", handle->name);
+	else
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+			     "[%s:%s] Not a %s", handle->name, G_OBJECT_TYPE_NAME (handle->node),
+			     g_type_name (node_type));
+
+	return FALSE;
+}
+
+static inline gboolean
+_feature_handle_check_read_access (ArvFeatureHandle *handle, GError **error)
+{
+	if (arv_gc_get_access_check_policy (handle->genicam) != ARV_ACCESS_CHECK_POLICY_ENABLE)
+		return TRUE;
+
+	return arv_gc_feature_node_check_read_access (ARV_GC_FEATURE_NODE (handle->node), error);
 }
 
 /**
- * arv_device_execute_command:
+ * arv_device_get_feature_handle:
  * @device: a #ArvDevice
  * @feature: feature name
- * @error: a #GError placeholder
  *
- * Execute a genicam command.
+ * Resolves a feature once, and returns a handle that can be used for repeated accesses to the feature value, without
+ * the node lookup and type checks of the name based API. The handle is owned by @device, and stays valid during its
+ * lifetime. A handle is returned even if the feature doesn't exist, in which case any access to its value fails with
+ * a %ARV_DEVICE_ERROR_FEATURE_NOT_FOUND error.
  *
- * Returns: %TRUE on success
+ * Returns: (transfer none): a feature handle.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-gboolean
-arv_device_execute_command (ArvDevice *device, const char *feature, GError **error)
+ArvFeatureHandle *
+arv_device_get_feature_handle (ArvDevice *device, const char *feature)
 {
-	ArvGcNode *node;
-        GError *local_error = NULL;
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvFeatureHandle *handle;
+	ArvGc *genicam;
 
-	node = _get_feature (device, ARV_TYPE_GC_COMMAND, feature, &local_error);
-	if (node != NULL)
-		arv_gc_command_execute (ARV_GC_COMMAND (node), &local_error);
+	g_return_val_if_fail (ARV_IS_DEVICE (device), NULL);
+	g_return_val_if_fail (feature != NULL, NULL);
 
-        if (local_error != NULL) {
-                g_propagate_error (error, local_error);
-                return FALSE;
-        }
+	handle = g_hash_table_lookup (priv->feature_handles, feature);
+	if (handle != NULL)
+		return handle;
 
-        return TRUE;
+	genicam = arv_device_get_genicam (device);
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+
+	handle = arv_feature_handle_new (genicam, feature);
+	g_hash_table_insert (priv->feature_handles, handle->name, handle);
+
+	return handle;
 }
 
 /**
- * arv_device_get_feature_value:
- * @device: a #ArvDevice object
- * @feature: feature name
- * @value: (out): a uninitialized #GValue placeholder
- * @error: a #GError placeholder
+ * arv_feature_handle_get_name:
+ * @handle: a #ArvFeatureHandle
  *
- * Get the value of a feature. Enumeration values are returned as strings.
+ * Returns: the name of the feature.
  *
- * Since: 0.8.32
+ * Since: 0.10.0
  */
 
-void
-arv_device_get_feature_value (ArvDevice *device, const char *feature, GValue *value, GError **error)
+const char *
+arv_feature_handle_get_name (ArvFeatureHandle *handle)
 {
-	ArvGcNode *node;
-	GError *local_error = NULL;
-
-	node = arv_device_get_feature (device, feature);
-
-	if (node == NULL) {
-		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
-			     "[%s] Not found", feature);
-		return;
-	}
+	g_return_val_if_fail (handle != NULL, NULL);
 
-	if (ARV_IS_GC_FLOAT (node)) {
-		g_value_init (value, G_TYPE_DOUBLE);
-		g_value_set_double (value, arv_gc_float_get_value (ARV_GC_FLOAT (node), &local_error));
-	} else if (ARV_IS_GC_ENUMERATION (node)) {
-		// ARV_IS_GC_INTEGER is true for an enum, so keep this before the int
-		g_value_init (value, G_TYPE_STRING);
-		g_value_set_string (value, arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &local_error));
-	} else if (ARV_IS_GC_INTEGER (node)) {
-		g_value_init (value, G_TYPE_INT64);
-		g_value_set_int64 (value, arv_gc_integer_get_value (ARV_GC_INTEGER (node), &local_error));
-	} else if (ARV_IS_GC_BOOLEAN (node)) {
-		g_value_init (value, G_TYPE_BOOLEAN);
-		g_value_set_boolean (value, arv_gc_boolean_get_value (ARV_GC_BOOLEAN (node), &local_error));
-	} else if (ARV_IS_GC_STRING (node)) {
-		g_value_init (value, G_TYPE_STRING);
-		g_value_set_string (value, arv_gc_string_get_value (ARV_GC_STRING (node), &local_error));
-	} else {
-		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-			     "[%s:%s] Not a feature", feature, G_OBJECT_TYPE_NAME (node));
-	}
+	return handle->name;
 }
 
 /**
- * arv_device_set_feature_value:
- * @device: a #ArvDevice object
- * @feature: feature name
- * @value: a #GValue
- * @error: a #GError placeholder
+ * arv_feature_handle_get_node:
+ * @handle: a #ArvFeatureHandle
  *
- * Set value of a feature.
+ * Returns: (transfer none): the genicam node of the feature, %NULL if not found.
  *
- * Since: 0.8.32
+ * Since: 0.10.0
  */
 
-void
-arv_device_set_feature_value (ArvDevice *device, const char *feature, const GValue *value, GError **error)
+ArvGcNode *
+arv_feature_handle_get_node (ArvFeatureHandle *handle)
 {
-	ArvGcNode *node;
-	GValue value_copy = G_VALUE_INIT;
-	GError *local_error = NULL;
-
-	node = arv_device_get_feature (device, feature);
-
-	if (node == NULL) {
-		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
-			     "[%s] Not found", feature);
-		return;
-	}
+	g_return_val_if_fail (handle != NULL, NULL);
 
-	if (ARV_IS_GC_FLOAT (node)) {
-		g_value_init(&value_copy, G_TYPE_DOUBLE);
-		if (g_value_transform(value, &value_copy))
-			arv_gc_float_set_value (ARV_GC_FLOAT (node), g_value_get_double (&value_copy), &local_error);
-		else
-			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-				     "[%s:%s] Not a double", feature, G_OBJECT_TYPE_NAME (node));
-	} else if (ARV_IS_GC_INTEGER (node)) {
-		g_value_init(&value_copy, G_TYPE_INT64);
-		if (g_value_transform(value, &value_copy))
-			arv_gc_integer_set_value (ARV_GC_INTEGER (node), g_value_get_int64 (&value_copy), &local_error);
-		else
-			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-				     "[%s:%s] Not an int64", feature, G_OBJECT_TYPE_NAME (node));
-	} else if (ARV_IS_GC_BOOLEAN (node)) {
-		g_value_init(&value_copy, G_TYPE_BOOLEAN);
-		if (g_value_transform(value, &value_copy))
-			arv_gc_boolean_set_value (ARV_GC_BOOLEAN (node), g_value_get_boolean (&value_copy), &local_error);
-		else
-			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-				     "[%s:%s] Not a boolean", feature, G_OBJECT_TYPE_NAME (node));
-	} else if (ARV_IS_GC_STRING (node)) {
-		g_value_init(&value_copy, G_TYPE_STRING);
-		if (g_value_transform(value, &value_copy))
-			arv_gc_string_set_value (ARV_GC_STRING (node), g_value_get_string (&value_copy), &local_error);
-		else
-			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-				     "[%s:%s] Not a string", feature, G_OBJECT_TYPE_NAME (node));
-	} else if (ARV_IS_GC_ENUMERATION (node)) {
-		if (G_VALUE_HOLDS_STRING (value))
-			arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), g_value_get_string (value), &local_error);
-		else {
-			g_value_init(&value_copy, G_TYPE_INT64);
-			if (g_value_transform(value, &value_copy))
-				arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), g_value_get_int64 (&value_copy), &local_error);
-			else
-				g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-					"[%s:%s] Not a string or int64", feature, G_OBJECT_TYPE_NAME (node));
-		}
-	} else {
-		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
-			     "[%s:%s] Not a feature", feature, G_OBJECT_TYPE_NAME (node));
-	}
+	return handle->node;
 }
 
 /**
- * arv_device_set_boolean_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
- * @value: feature value
+ * arv_feature_handle_is_available:
+ * @handle: a #ArvFeatureHandle
  * @error: a #GError placeholder
  *
- * Set the value of a boolean feature.
+ * Returns: %TRUE if the feature exists and is currently available.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-void
-arv_device_set_boolean_feature_value (ArvDevice *device, const char *feature, gboolean value, GError **error)
+gboolean
+arv_feature_handle_is_available (ArvFeatureHandle *handle, GError **error)
 {
-	ArvGcNode *node;
+	g_return_val_if_fail (handle != NULL, FALSE);
 
-	node = _get_feature (device, ARV_TYPE_GC_BOOLEAN, feature, error);
-	if (node != NULL)
-		arv_gc_boolean_set_value (ARV_GC_BOOLEAN (node), value, error);
+	return handle->node != NULL &&
+		arv_gc_feature_node_is_available (ARV_GC_FEATURE_NODE (handle->node), error);
 }
 
 /**
- * arv_device_get_boolean_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
+ * arv_feature_handle_get_integer_value:
+ * @handle: a #ArvFeatureHandle
  * @error: a #GError placeholder
  *
- * Returns: the feature value, %FALSE on error.
+ * Returns: the integer feature value, 0 on error.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-gboolean
-arv_device_get_boolean_feature_value (ArvDevice *device, const char *feature, GError **error)
+gint64
+arv_feature_handle_get_integer_value (ArvFeatureHandle *handle, GError **error)
 {
-	ArvGcNode *node;
+	gint64 value;
 
-	node = _get_feature (device, ARV_TYPE_GC_BOOLEAN, feature, error);
-	if (node != NULL)
-		return arv_gc_boolean_get_value (ARV_GC_BOOLEAN (node), error);
+	g_return_val_if_fail (handle != NULL, 0);
+	g_return_val_if_fail (error == NULL || *error == NULL, 0);
 
-	return FALSE;
+	if (!_feature_handle_check_type (handle, handle->integer_iface != NULL, ARV_TYPE_GC_INTEGER, error) ||
+	    !_feature_handle_check_read_access (handle, error))
+		return 0;
+
+	arv_gc_profile_enter ((ArvGcFeatureNode *) handle->node, "get_value");
+	value = handle->integer_iface->get_value ((ArvGcInteger *) handle->node, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) handle->node);
+
+	return value;
 }
 
 /**
- * arv_device_get_boolean_feature_value_gi: (rename-to arv_device_get_boolean_feature_value)
- * @device: a #ArvDevice
- * @feature: feature name
- * @value: (out): feature value
+ * arv_feature_handle_set_integer_value:
+ * @handle: a #ArvFeatureHandle
+ * @value: new feature value
  * @error: a #GError placeholder
  *
- * Get the feature value, or %FALSE on error.
+ * Set the integer feature value.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
 void
-arv_device_get_boolean_feature_value_gi	(ArvDevice *device, const char *feature, gboolean *value, GError **error)
+arv_feature_handle_set_integer_value (ArvFeatureHandle *handle, gint64 value, GError **error)
 {
-	g_return_if_fail (value != NULL);
+	g_return_if_fail (handle != NULL);
 
-	*value = arv_device_get_boolean_feature_value (device, feature, error);
+	if (_feature_handle_check_type (handle, handle->integer_iface != NULL, ARV_TYPE_GC_INTEGER, error))
+		arv_gc_integer_set_value ((ArvGcInteger *) handle->node, value, error);
 }
 
 /**
- * arv_device_set_string_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
- * @value: new feature value
+ * arv_feature_handle_get_integer_bounds:
+ * @handle: a #ArvFeatureHandle
+ * @min: (out) (optional): minimum feature value
+ * @max: (out) (optional): maximum feature value
  * @error: a #GError placeholder
  *
- * Set the string feature value.
+ * Retrieves integer feature bounds.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
 void
-arv_device_set_string_feature_value (ArvDevice *device, const char *feature, const char *value, GError **error)
+arv_feature_handle_get_integer_bounds (ArvFeatureHandle *handle, gint64 *min, gint64 *max, GError **error)
 {
-	ArvGcNode *node;
+	GError *local_error = NULL;
+	gint64 minimum = G_MININT64;
+	gint64 maximum = G_MAXINT64;
 
-	node = _get_feature (device, ARV_TYPE_GC_STRING, feature, error);
-	if (node != NULL)
-		arv_gc_string_set_value (ARV_GC_STRING (node), value, error);
+	g_return_if_fail (handle != NULL);
+
+	if (_feature_handle_check_type (handle, handle->integer_iface != NULL, ARV_TYPE_GC_INTEGER, &local_error)) {
+		if (min != NULL)
+			minimum = arv_gc_integer_get_min ((ArvGcInteger *) handle->node, &local_error);
+		if (max != NULL && local_error == NULL)
+			maximum = arv_gc_integer_get_max ((ArvGcInteger *) handle->node, &local_error);
+	}
+
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		minimum = G_MININT64;
+		maximum = G_MAXINT64;
+	}
+
+	if (min != NULL)
+		*min = minimum;
+	if (max != NULL)
+		*max = maximum;
 }
 
 /**
- * arv_device_get_string_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
+ * arv_feature_handle_get_float_value:
+ * @handle: a #ArvFeatureHandle
  * @error: a #GError placeholder
  *
- * Returns: the string feature value, %NULL on error.
+ * Returns: the float feature value, 0.0 on error.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-const char *
-arv_device_get_string_feature_value (ArvDevice *device, const char *feature, GError  **error)
+double
+arv_feature_handle_get_float_value (ArvFeatureHandle *handle, GError **error)
 {
-	ArvGcNode *node;
+	double value;
 
-	node = _get_feature (device, ARV_TYPE_GC_STRING, feature, error);
-	if (node != NULL)
-		return arv_gc_string_get_value (ARV_GC_STRING (node), error);
+	g_return_val_if_fail (handle != NULL, 0.0);
+	g_return_val_if_fail (error == NULL || *error == NULL, 0.0);
 
-	return NULL;
+	if (!_feature_handle_check_type (handle, handle->float_iface != NULL, ARV_TYPE_GC_FLOAT, error) ||
+	    !_feature_handle_check_read_access (handle, error))
+		return 0.0;
+
+	arv_gc_profile_enter ((ArvGcFeatureNode *) handle->node, "get_value");
+	value = handle->float_iface->get_value ((ArvGcFloat *) handle->node, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) handle->node);
+
+	return value;
 }
 
 /**
- * arv_device_set_integer_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
+ * arv_feature_handle_set_float_value:
+ * @handle: a #ArvFeatureHandle
  * @value: new feature value
  * @error: a #GError placeholder
  *
- * Set the integer feature value.
+ * Set the float feature value.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
 void
-arv_device_set_integer_feature_value (ArvDevice *device, const char *feature, gint64 value, GError **error)
+arv_feature_handle_set_float_value (ArvFeatureHandle *handle, double value, GError **error)
 {
-	ArvGcNode *node;
+	g_return_if_fail (handle != NULL);
 
-	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
-	if (node != NULL)
-		arv_gc_integer_set_value (ARV_GC_INTEGER (node), value, error);
+	if (_feature_handle_check_type (handle, handle->float_iface != NULL, ARV_TYPE_GC_FLOAT, error))
+		arv_gc_float_set_value ((ArvGcFloat *) handle->node, value, error);
 }
 
 /**
- * arv_device_get_integer_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
+ * arv_feature_handle_get_float_bounds:
+ * @handle: a #ArvFeatureHandle
+ * @min: (out) (optional): minimum feature value
+ * @max: (out) (optional): maximum feature value
  * @error: a #GError placeholder
  *
- * Returns: the integer feature value, 0 on error.
+ * Retrieves float feature bounds.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-gint64
-arv_device_get_integer_feature_value (ArvDevice *device, const char *feature, GError **error)
+void
+arv_feature_handle_get_float_bounds (ArvFeatureHandle *handle, double *min, double *max, GError **error)
 {
-	ArvGcNode *node;
+	GError *local_error = NULL;
+	double minimum = -G_MAXDOUBLE;
+	double maximum = G_MAXDOUBLE;
 
-	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
-	if (node != NULL)
-		return arv_gc_integer_get_value (ARV_GC_INTEGER (node), error);
+	g_return_if_fail (handle != NULL);
 
-	return 0;
+	if (_feature_handle_check_type (handle, handle->float_iface != NULL, ARV_TYPE_GC_FLOAT, &local_error)) {
+		if (min != NULL)
+			minimum = arv_gc_float_get_min ((ArvGcFloat *) handle->node, &local_error);
+		if (max != NULL && local_error == NULL)
+			maximum = arv_gc_float_get_max ((ArvGcFloat *) handle->node, &local_error);
+	}
+
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		minimum = -G_MAXDOUBLE;
+		maximum = G_MAXDOUBLE;
+	}
+
+	if (min != NULL)
+		*min = minimum;
+	if (max != NULL)
+		*max = maximum;
 }
 
 /**
- * arv_device_get_integer_feature_bounds:
- * @device: a #ArvDevice
- * @feature: feature name
- * @min: (out): minimum feature value
- * @max: (out): maximum feature value
+ * arv_feature_handle_get_boolean_value:
+ * @handle: a #ArvFeatureHandle
  * @error: a #GError placeholder
  *
- * Retrieves feature bounds.
+ * Returns: the boolean feature value, %FALSE on error.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-void
-arv_device_get_integer_feature_bounds (ArvDevice *device, const char *feature, gint64 *min, gint64 *max, GError **error)
+gboolean
+arv_feature_handle_get_boolean_value (ArvFeatureHandle *handle, GError **error)
 {
-	ArvGcNode *node;
-
-	if (min != NULL)
-		*min = G_MININT64;
-	if (max != NULL)
-		*max = G_MAXINT64;
-
-	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
-	if (node != NULL) {
-		GError *local_error = NULL;
-
-		if (min != NULL) {
-			gint64 minimum;
-
-			minimum = arv_gc_integer_get_min (ARV_GC_INTEGER (node), &local_error);
-
-			if (local_error != NULL) {
-				g_propagate_error (error, local_error);
-				return;
-			}
+	g_return_val_if_fail (handle != NULL, FALSE);
 
-			*min = minimum;
-		}
+	if (!_feature_handle_check_type (handle, handle->is_boolean, ARV_TYPE_GC_BOOLEAN, error))
+		return FALSE;
 
-		if (max != NULL) {
-			gint64 maximum;
+	return arv_gc_boolean_get_value ((ArvGcBoolean *) handle->node, error);
+}
 
-			maximum = arv_gc_integer_get_max (ARV_GC_INTEGER (node), &local_error);
+/**
+ * arv_feature_handle_set_boolean_value:
+ * @handle: a #ArvFeatureHandle
+ * @value: new feature value
+ * @error: a #GError placeholder
+ *
+ * Set the boolean feature value.
+ *
+ * Since: 0.10.0
+ */
 
-			if (local_error != NULL) {
-				g_propagate_error (error, local_error);
-				return;
-			}
+void
+arv_feature_handle_set_boolean_value (ArvFeatureHandle *handle, gboolean value, GError **error)
+{
+	g_return_if_fail (handle != NULL);
 
-			*max = maximum;
-		}
-	}
+	if (_feature_handle_check_type (handle, handle->is_boolean, ARV_TYPE_GC_BOOLEAN, error))
+		arv_gc_boolean_set_value ((ArvGcBoolean *) handle->node, value, error);
 }
 
 /**
- * arv_device_get_integer_feature_increment:
- * @device: a #ArvDevice
- * @feature: feature name
+ * arv_feature_handle_get_string_value:
+ * @handle: a #ArvFeatureHandle
  * @error: a #GError placeholder
  *
- * Not all integer features have evenly distributed allowed values, which means the returned increment may not reflect the allowed value
- * set.
- *
- * Returns: feature value increment, or 1 on error.
+ * Returns: the string feature value, %NULL on error.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-gint64
-arv_device_get_integer_feature_increment (ArvDevice *device, const char *feature, GError **error)
+const char *
+arv_feature_handle_get_string_value (ArvFeatureHandle *handle, GError **error)
 {
-	ArvGcNode *node;
-
-	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
-	if (node != NULL) {
-		GError *local_error = NULL;
-		gint64 increment;
+	const char *value;
 
-		increment = arv_gc_integer_get_inc (ARV_GC_INTEGER (node), &local_error);
+	g_return_val_if_fail (handle != NULL, NULL);
+	g_return_val_if_fail (error == NULL || *error == NULL, NULL);
 
-			if (local_error != NULL) {
-				g_propagate_error (error, local_error);
-				return 1;
-			}
+	if (!_feature_handle_check_type (handle, handle->string_iface != NULL, ARV_TYPE_GC_STRING, error) ||
+	    !_feature_handle_check_read_access (handle, error))
+		return NULL;
 
-			return increment;
-	}
+	arv_gc_profile_enter ((ArvGcFeatureNode *) handle->node, "get_value");
+	value = handle->string_iface->get_value ((ArvGcString *) handle->node, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) handle->node);
 
-	return 1;
+	return value;
 }
 
 /**
- * arv_device_set_float_feature_value:
- * @device: a #ArvDevice
- * @feature: feature name
+ * arv_feature_handle_set_string_value:
+ * @handle: a #ArvFeatureHandle
  * @value: new feature value
  * @error: a #GError placeholder
  *
- * Set the float feature value.
+ * Set the string feature value.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
 void
-arv_device_set_float_feature_value (ArvDevice *device, const char *feature, double value, GError **error)
+arv_feature_handle_set_string_value (ArvFeatureHandle *handle, const char *value, GError **error)
 {
-	ArvGcNode *node;
+	g_return_if_fail (handle != NULL);
 
-	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
-	if (node != NULL)
-		arv_gc_float_set_value (ARV_GC_FLOAT (node), value, error);
+	if (_feature_handle_check_type (handle, handle->string_iface != NULL, ARV_TYPE_GC_STRING, error))
+		arv_gc_string_set_value ((ArvGcString *) handle->node, value, error);
 }
 
 /**
- * arv_device_get_float_feature_value:
+ * arv_device_get_feature_representation:
  * @device: a #ArvDevice
  * @feature: feature name
- * @error: a #GError placeholder
  *
- * Returns: the float feature value, 0.0 on error.
+ * Return: enum ArvGcRepresentation, ARV_GC_REPRESENTATION_UNDEFINED if not available.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-double
-arv_device_get_float_feature_value (ArvDevice *device, const char *feature, GError **error)
+ArvGcRepresentation
+arv_device_get_feature_representation (ArvDevice *device, const char *feature)
 {
-	ArvGcNode *node;
+	ArvGcNode* node;
 
-	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
-	if (node != NULL)
-		return  arv_gc_float_get_value (ARV_GC_FLOAT (node), error);
+	g_return_val_if_fail (ARV_IS_DEVICE (device), ARV_GC_REPRESENTATION_UNDEFINED);
+	g_return_val_if_fail (feature != NULL, ARV_GC_REPRESENTATION_UNDEFINED);
 
-	return 0.0;
+	node = arv_device_get_feature (device, feature);
+
+	if (ARV_IS_GC_FLOAT(node)) {
+		return arv_gc_float_get_representation(ARV_GC_FLOAT(node));
+	}else if (ARV_IS_GC_INTEGER(node)){
+		return arv_gc_integer_get_representation(ARV_GC_INTEGER (node));
+	}
+
+	return ARV_GC_REPRESENTATION_UNDEFINED;
 }
 
 /**
- * arv_device_get_float_feature_bounds:
+ * arv_device_execute_command:
  * @device: a #ArvDevice
  * @feature: feature name
- * @min: (out): minimum feature value
- * @max: (out): maximum feature value
  * @error: a #GError placeholder
  *
- * Retrieves feature bounds.
+ * Execute a genicam command.
+ *
+ * Returns: %TRUE on success
  *
  * Since: 0.8.0
  */
 
-void
-arv_device_get_float_feature_bounds (ArvDevice *device, const char *feature, double *min, double *max, GError **error)
+gboolean
+arv_device_execute_command (ArvDevice *device, const char *feature, GError **error)
 {
 	ArvGcNode *node;
+        GError *local_error = NULL;
 
-	if (min != NULL)
-		*min = -G_MAXDOUBLE;
-	if (max != NULL)
-		*max = G_MAXDOUBLE;
-
-	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
-	if (node != NULL) {
-		GError *local_error = NULL;
-
-		if (min != NULL) {
-			double minimum;
-
-			minimum = arv_gc_float_get_min (ARV_GC_FLOAT (node), &local_error);
-
-			if (local_error != NULL) {
-				g_propagate_error (error, local_error);
-				return;
-			}
-
-			*min = minimum;
-		}
-
-		if (max != NULL) {
-			double maximum;
-
-			maximum = arv_gc_float_get_max (ARV_GC_FLOAT (node), &local_error);
+	node = _get_feature (device, ARV_TYPE_GC_COMMAND, feature, &local_error);
+	if (node != NULL)
+		arv_gc_command_execute (ARV_GC_COMMAND (node), &local_error);
 
-			if (local_error != NULL) {
-				g_propagate_error (error, local_error);
-				return;
-			}
+        if (local_error != NULL) {
+                g_propagate_error (error, local_error);
+                return FALSE;
+        }
 
-			*max = maximum;
-		}
-	}
+        return TRUE;
 }
 
 /**
- * arv_device_get_float_feature_increment:
- * @device: a #ArvDevice
+ * arv_device_get_feature_value:
+ * @device: a #ArvDevice object
  * @feature: feature name
+ * @value: (out): a uninitialized #GValue placeholder
  * @error: a #GError placeholder
  *
- * Not all float features have evenly distributed allowed values, which means the returned increment may not reflect the allowed value
- * set.
- *
- * Returns: feature value increment, or #G_MINDOUBLE on error.
+ * Get the value of a feature. Enumeration values are returned as strings.
  *
- * Since: 0.8.16
+ * Since: 0.8.32
  */
 
-double
-arv_device_get_float_feature_increment (ArvDevice *device, const char *feature, GError **error)
+void
+arv_device_get_feature_value (ArvDevice *device, const char *feature, GValue *value, GError **error)
 {
 	ArvGcNode *node;
+	GError *local_error = NULL;
 
-	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
-	if (node != NULL) {
-		GError *local_error = NULL;
-		double increment;
-
-		increment = arv_gc_float_get_inc (ARV_GC_FLOAT (node), &local_error);
-
-			if (local_error != NULL) {
-				g_propagate_error (error, local_error);
-				return G_MINDOUBLE;
-			}
+	node = arv_device_get_feature (device, feature);
 
-			return increment;
+	if (node == NULL) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
+			     "[%s] Not found", feature);
+		return;
 	}
 
-	return G_MINDOUBLE;
+	if (ARV_IS_GC_FLOAT (node)) {
+		g_value_init (value, G_TYPE_DOUBLE);
+		g_value_set_double (value, arv_gc_float_get_value (ARV_GC_FLOAT (node), &local_error));
+	} else if (ARV_IS_GC_ENUMERATION (node)) {
+		// ARV_IS_GC_INTEGER is true for an enum, so keep this before the int
+		g_value_init (value, G_TYPE_STRING);
+		g_value_set_string (value, arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &local_error));
+	} else if (ARV_IS_GC_INTEGER (node)) {
+		g_value_init (value, G_TYPE_INT64);
+		g_value_set_int64 (value, arv_gc_integer_get_value (ARV_GC_INTEGER (node), &local_error));
+	} else if (ARV_IS_GC_BOOLEAN (node)) {
+		g_value_init (value, G_TYPE_BOOLEAN);
+		g_value_set_boolean (value, arv_gc_boolean_get_value (ARV_GC_BOOLEAN (node), &local_error));
+	} else if (ARV_IS_GC_STRING (node)) {
+		g_value_init (value, G_TYPE_STRING);
+		g_value_set_string (value, arv_gc_string_get_value (ARV_GC_STRING (node), &local_error));
+	} else {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+			     "[%s:%s] Not a feature", feature, G_OBJECT_TYPE_NAME (node));
+	}
 }
 
 /**
- * arv_device_set_register_feature_value:
+ * arv_device_set_feature_value:
+ * @device: a #ArvDevice object
+ * @feature: feature name
+ * @value: a #GValue
+ * @error: a #GError placeholder
+ *
+ * Set value of a feature.
+ *
+ * Since: 0.8.32
+ */
+
+void
+arv_device_set_feature_value (ArvDevice *device, const char *feature, const GValue *value, GError **error)
+{
+	ArvGcNode *node;
+	GValue value_copy = G_VALUE_INIT;
+	GError *local_error = NULL;
+
+	node = arv_device_get_feature (device, feature);
+
+	if (node == NULL) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
+			     "[%s] Not found", feature);
+		return;
+	}
+
+	if (ARV_IS_GC_FLOAT (node)) {
+		g_value_init(&value_copy, G_TYPE_DOUBLE);
+		if (g_value_transform(value, &value_copy))
+			arv_gc_float_set_value (ARV_GC_FLOAT (node), g_value_get_double (&value_copy), &local_error);
+		else
+			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+				     "[%s:%s] Not a double", feature, G_OBJECT_TYPE_NAME (node));
+	} else if (ARV_IS_GC_INTEGER (node)) {
+		g_value_init(&value_copy, G_TYPE_INT64);
+		if (g_value_transform(value, &value_copy))
+			arv_gc_integer_set_value (ARV_GC_INTEGER (node), g_value_get_int64 (&value_copy), &local_error);
+		else
+			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+				     "[%s:%s] Not an int64", feature, G_OBJECT_TYPE_NAME (node));
+	} else if (ARV_IS_GC_BOOLEAN (node)) {
+		g_value_init(&value_copy, G_TYPE_BOOLEAN);
+		if (g_value_transform(value, &value_copy))
+			arv_gc_boolean_set_value (ARV_GC_BOOLEAN (node), g_value_get_boolean (&value_copy), &local_error);
+		else
+			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+				     "[%s:%s] Not a boolean", feature, G_OBJECT_TYPE_NAME (node));
+	} else if (ARV_IS_GC_STRING (node)) {
+		g_value_init(&value_copy, G_TYPE_STRING);
+		if (g_value_transform(value, &value_copy))
+			arv_gc_string_set_value (ARV_GC_STRING (node), g_value_get_string (&value_copy), &local_error);
+		else
+			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+				     "[%s:%s] Not a string", feature, G_OBJECT_TYPE_NAME (node));
+	} else if (ARV_IS_GC_ENUMERATION (node)) {
+		if (G_VALUE_HOLDS_STRING (value))
+			arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), g_value_get_string (value), &local_error);
+		else {
+			g_value_init(&value_copy, G_TYPE_INT64);
+			if (g_value_transform(value, &value_copy))
+				arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), g_value_get_int64 (&value_copy), &local_error);
+			else
+				g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+					"[%s:%s] Not a string or int64", feature, G_OBJECT_TYPE_NAME (node));
+		}
+	} else {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE,
+			     "[%s:%s] Not a feature", feature, G_OBJECT_TYPE_NAME (node));
+	}
+}
+
+/**
+ * arv_device_set_boolean_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @value: feature value
+ * @error: a #GError placeholder
+ *
+ * Set the value of a boolean feature.
+ *
+ * Since: 0.8.0
+ */
+
+void
+arv_device_set_boolean_feature_value (ArvDevice *device, const char *feature, gboolean value, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_BOOLEAN, feature, error);
+	if (node != NULL)
+		arv_gc_boolean_set_value (ARV_GC_BOOLEAN (node), value, error);
+}
+
+/**
+ * arv_device_get_boolean_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @error: a #GError placeholder
+ *
+ * Returns: the feature value, %FALSE on error.
+ *
+ * Since: 0.8.0
+ */
+
+gboolean
+arv_device_get_boolean_feature_value (ArvDevice *device, const char *feature, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_BOOLEAN, feature, error);
+	if (node != NULL)
+		return arv_gc_boolean_get_value (ARV_GC_BOOLEAN (node), error);
+
+	return FALSE;
+}
+
+/**
+ * arv_device_get_boolean_feature_value_gi: (rename-to arv_device_get_boolean_feature_value)
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @value: (out): feature value
+ * @error: a #GError placeholder
+ *
+ * Get the feature value, or %FALSE on error.
+ *
+ * Since: 0.8.0
+ */
+
+void
+arv_device_get_boolean_feature_value_gi	(ArvDevice *device, const char *feature, gboolean *value, GError **error)
+{
+	g_return_if_fail (value != NULL);
+
+	*value = arv_device_get_boolean_feature_value (device, feature, error);
+}
+
+/**
+ * arv_device_set_string_feature_value:
  * @device: a #ArvDevice
  * @feature: feature name
  * @value: new feature value
  * @error: a #GError placeholder
  *
- * Set the register feature value.
+ * Set the string feature value.
  *
- * Since:
+ * Since: 0.8.0
  */
 
 void
-arv_device_set_register_feature_value (ArvDevice *device, const char *feature, guint64 length, void* value, GError **error)
+arv_device_set_string_feature_value (ArvDevice *device, const char *feature, const char *value, GError **error)
 {
 	ArvGcNode *node;
 
-	node = _get_feature (device, ARV_TYPE_GC_REGISTER, feature, error);
+	node = _get_feature (device, ARV_TYPE_GC_STRING, feature, error);
 	if (node != NULL)
-		arv_gc_register_set (ARV_GC_REGISTER (node), value, length, error);
+		arv_gc_string_set_value (ARV_GC_STRING (node), value, error);
 }
 
 /**
- * arv_device_dup_register_feature_value:
+ * arv_device_get_string_feature_value:
  * @device: a #ArvDevice
  * @feature: feature name
- * @length: (out) (allow-none): register length
  * @error: a #GError placeholder
  *
- * Returns: the register feature content, must be freed using [func@GLib.free].
+ * Returns: the string feature value, %NULL on error.
  *
- * Since: 0.8.31
+ * Since: 0.8.0
  */
 
-void *
-arv_device_dup_register_feature_value (ArvDevice *device, const char *feature, guint64 *length, GError **error)
+const char *
+arv_device_get_string_feature_value (ArvDevice *device, const char *feature, GError  **error)
 {
 	ArvGcNode *node;
 
-        if (length != NULL)
-                *length = 0;
+	node = _get_feature (device, ARV_TYPE_GC_STRING, feature, error);
+	if (node != NULL)
+		return arv_gc_string_get_value (ARV_GC_STRING (node), error);
 
-	node = _get_feature (device, ARV_TYPE_GC_REGISTER, feature, error);
-        if (node != NULL)
-                return arv_gc_register_dup (ARV_GC_REGISTER(node), length, error);
+	return NULL;
+}
+
+/**
+ * arv_device_set_integer_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @value: new feature value
+ * @error: a #GError placeholder
+ *
+ * Set the integer feature value.
+ *
+ * Since: 0.8.0
+ */
+
+void
+arv_device_set_integer_feature_value (ArvDevice *device, const char *feature, gint64 value, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
+	if (node != NULL)
+		arv_gc_integer_set_value (ARV_GC_INTEGER (node), value, error);
+}
+
+/**
+ * arv_device_get_integer_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @error: a #GError placeholder
+ *
+ * Returns: the integer feature value, 0 on error.
+ *
+ * Since: 0.8.0
+ */
+
+gint64
+arv_device_get_integer_feature_value (ArvDevice *device, const char *feature, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
+	if (node != NULL)
+		return arv_gc_integer_get_value (ARV_GC_INTEGER (node), error);
+
+	return 0;
+}
+
+/**
+ * arv_device_get_integer_feature_bounds:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @min: (out): minimum feature value
+ * @max: (out): maximum feature value
+ * @error: a #GError placeholder
+ *
+ * Retrieves feature bounds.
+ *
+ * Since: 0.8.0
+ */
+
+void
+arv_device_get_integer_feature_bounds (ArvDevice *device, const char *feature, gint64 *min, gint64 *max, GError **error)
+{
+	ArvGcNode *node;
+
+	if (min != NULL)
+		*min = G_MININT64;
+	if (max != NULL)
+		*max = G_MAXINT64;
+
+	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
+	if (node != NULL) {
+		GError *local_error = NULL;
+
+		if (min != NULL) {
+			gint64 minimum;
+
+			minimum = arv_gc_integer_get_min (ARV_GC_INTEGER (node), &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return;
+			}
+
+			*min = minimum;
+		}
+
+		if (max != NULL) {
+			gint64 maximum;
+
+			maximum = arv_gc_integer_get_max (ARV_GC_INTEGER (node), &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return;
+			}
+
+			*max = maximum;
+		}
+	}
+}
+
+/**
+ * arv_device_get_integer_feature_increment:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @error: a #GError placeholder
+ *
+ * Not all integer features have evenly distributed allowed values, which means the returned increment may not reflect the allowed value
+ * set.
+ *
+ * Returns: feature value increment, or 1 on error.
+ *
+ * Since: 0.8.0
+ */
+
+gint64
+arv_device_get_integer_feature_increment (ArvDevice *device, const char *feature, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_INTEGER, feature, error);
+	if (node != NULL) {
+		GError *local_error = NULL;
+		gint64 increment;
+
+		increment = arv_gc_integer_get_inc (ARV_GC_INTEGER (node), &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return 1;
+			}
+
+			return increment;
+	}
+
+	return 1;
+}
+
+/**
+ * arv_device_set_float_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @value: new feature value
+ * @error: a #GError placeholder
+ *
+ * Set the float feature value.
+ *
+ * Since: 0.8.0
+ */
+
+void
+arv_device_set_float_feature_value (ArvDevice *device, const char *feature, double value, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
+	if (node != NULL)
+		arv_gc_float_set_value (ARV_GC_FLOAT (node), value, error);
+}
+
+/**
+ * arv_device_get_float_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @error: a #GError placeholder
+ *
+ * Returns: the float feature value, 0.0 on error.
+ *
+ * Since: 0.8.0
+ */
+
+double
+arv_device_get_float_feature_value (ArvDevice *device, const char *feature, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
+	if (node != NULL)
+		return  arv_gc_float_get_value (ARV_GC_FLOAT (node), error);
+
+	return 0.0;
+}
+
+/**
+ * arv_device_get_float_feature_bounds:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @min: (out): minimum feature value
+ * @max: (out): maximum feature value
+ * @error: a #GError placeholder
+ *
+ * Retrieves feature bounds.
+ *
+ * Since: 0.8.0
+ */
+
+void
+arv_device_get_float_feature_bounds (ArvDevice *device, const char *feature, double *min, double *max, GError **error)
+{
+	ArvGcNode *node;
+
+	if (min != NULL)
+		*min = -G_MAXDOUBLE;
+	if (max != NULL)
+		*max = G_MAXDOUBLE;
+
+	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
+	if (node != NULL) {
+		GError *local_error = NULL;
+
+		if (min != NULL) {
+			double minimum;
+
+			minimum = arv_gc_float_get_min (ARV_GC_FLOAT (node), &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return;
+			}
+
+			*min = minimum;
+		}
+
+		if (max != NULL) {
+			double maximum;
+
+			maximum = arv_gc_float_get_max (ARV_GC_FLOAT (node), &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return;
+			}
+
+			*max = maximum;
+		}
+	}
+}
+
+/**
+ * arv_device_get_float_feature_increment:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @error: a #GError placeholder
+ *
+ * Not all float features have evenly distributed allowed values, which means the returned increment may not reflect the allowed value
+ * set.
+ *
+ * Returns: feature value increment, or #G_MINDOUBLE on error.
+ *
+ * Since: 0.8.16
+ */
+
+double
+arv_device_get_float_feature_increment (ArvDevice *device, const char *feature, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_FLOAT, feature, error);
+	if (node != NULL) {
+		GError *local_error = NULL;
+		double increment;
+
+		increment = arv_gc_float_get_inc (ARV_GC_FLOAT (node), &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				return G_MINDOUBLE;
+			}
+
+			return increment;
+	}
+
+	return G_MINDOUBLE;
+}
+
+/**
+ * arv_device_set_register_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @value: new feature value
+ * @error: a #GError placeholder
+ *
+ * Set the register feature value.
+ *
+ * Since:
+ */
+
+void
+arv_device_set_register_feature_value (ArvDevice *device, const char *feature, guint64 length, void* value, GError **error)
+{
+	ArvGcNode *node;
+
+	node = _get_feature (device, ARV_TYPE_GC_REGISTER, feature, error);
+	if (node != NULL)
+		arv_gc_register_set (ARV_GC_REGISTER (node), value, length, error);
+}
+
+/**
+ * arv_device_dup_register_feature_value:
+ * @device: a #ArvDevice
+ * @feature: feature name
+ * @length: (out) (allow-none): register length
+ * @error: a #GError placeholder
+ *
+ * Returns: the register feature content, must be freed using [func@GLib.free].
+ *
+ * Since: 0.8.31
+ */
+
+void *
+arv_device_dup_register_feature_value (ArvDevice *device, const char *feature, guint64 *length, GError **error)
+{
+	ArvGcNode *node;
+
+        if (length != NULL)
+                *length = 0;
+
+	node = _get_feature (device, ARV_TYPE_GC_REGISTER, feature, error);
+        if (node != NULL)
+                return arv_gc_register_dup (ARV_GC_REGISTER(node), length, error);
+
+        return NULL;
+}
+
+/**
+ * arv_device_dup_available_enumeration_feature_values:
+ * @device: an #ArvDevice
+ * @feature: feature name
+ * @n_values: placeholder for the number of returned values
+ * @error: a #GError placeholder
+ *
+ * Get all the available values of @feature, as integers.
+ *
+ * Returns: (array length=n_values) (transfer container): a newly created array of 64 bit integers, which must freed after use using g_free,
+ * or NULL on error.
+ *
+ * Since: 0.8.0
+ */
+
+gint64 *
+arv_device_dup_available_enumeration_feature_values (ArvDevice *device, const char *feature, guint *n_values, GError **error)
+{
+	ArvGcNode *node;
+
+	if (n_values != NULL)
+		*n_values = 0;
+
+	node = _get_feature (device, ARV_TYPE_GC_ENUMERATION, feature, error);
+	if (node != NULL)
+		return arv_gc_enumeration_dup_available_int_values (ARV_GC_ENUMERATION (node), n_values, error);
+
+	return NULL;
+}
+
+/**
+ * arv_device_dup_available_enumeration_feature_values_as_strings:
+ * @device: an #ArvDevice
+ * @feature: feature name
+ * @n_values: placeholder for the number of returned values
+ * @error: a #GError placeholder
+ *
+ * Get all the available values of @feature, as strings.
+ *
+ * Returns: (array length=n_values) (transfer container): a newly created array of const strings, which must freed after use using g_free,
+ * or NULL on error.
+ *
+ * Since: 0.8.0
+ */
+
+const char **
+arv_device_dup_available_enumeration_feature_values_as_strings (ArvDevice *device, const char *feature, guint *n_values, GError **error)
+{
+	ArvGcNode *node;
+
+	if (n_values != NULL)
+		*n_values = 0;
+
+	node = _get_feature (device, ARV_TYPE_GC_ENUMERATION, feature, error);
+	if (node != NULL)
+		return arv_gc_enumeration_dup_available_string_values (ARV_GC_ENUMERATION (node), n_values, error);
+
+	return NULL;
+}
+
+/**
+ * arv_device_dup_available_enumeration_feature_values_as_display_names:
+ * @device: an #ArvDevice
+ * @feature: feature name
+ * @n_values: placeholder for the number of returned values
+ * @error: a #GError placeholder
+ *
+ * Get display names of all the available entries of @feature.
+ *
+ * Returns: (array length=n_values) (transfer container): a newly created array of const strings, to be freed after use using g_free, or
+ * %NULL on error.
+ *
+ * Since: 0.8.0
+ */
+
+const char **
+arv_device_dup_available_enumeration_feature_values_as_display_names (ArvDevice *device, const char *feature, guint *n_values, GError **error)
+{
+	ArvGcNode *node;
+
+	if (n_values != NULL)
+		*n_values = 0;
+
+	node = _get_feature (device, ARV_TYPE_GC_ENUMERATION, feature, error);
+	if (node != NULL)
+		return arv_gc_enumeration_dup_available_display_names (ARV_GC_ENUMERATION (node), n_values, error);
+
+	return NULL;
+}
+
+/**
+ * arv_device_is_enumeration_entry_available:
+ * @device: an #ArvDevice instance
+ * @feature: enumeration feature name
+ * @entry: entry name
+ * @error: a #GError placeholder
+ *
+ * Returns: %TRUE if the feature and the feature entry are available
+ *
+ * Since: 0.8.17
+ */
+
+gboolean
+arv_device_is_enumeration_entry_available (ArvDevice *device, const char *feature, const char *entry, GError **error)
+{
+        GError *local_error = NULL;
+        const char **entries = NULL;
+        guint n_entries = 0;
+        gboolean is_available = FALSE;
+        unsigned int i;
+
+        if (!arv_device_is_feature_available (device, feature, &local_error)) {
+                if (local_error != NULL)
+                        g_propagate_error (error, local_error);
+                return FALSE;
+        }
+
+        entries = arv_device_dup_available_enumeration_feature_values_as_strings (device, feature, &n_entries,
+                                                                                  &local_error);
+
+        if (local_error != NULL) {
+                g_propagate_error (error, local_error);
+                return FALSE;
+        }
+
+        for (i = 0; i < n_entries && !is_available; i++) {
+                if (g_strcmp0 (entry, entries[i]) == 0)
+                        is_available = TRUE;
+        }
+        g_free (entries);
+
+        return is_available;
+}
+
+/**
+ * arv_device_set_features_from_string:
+ * @device: a #ArvDevice
+ * @string: a space separated list of features assignments
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Set features from a string containing a list of space separated feature assignments or command names. For example:
+ *
+ * |[<!-- language="C" -->
+ * arv_device_set_features_from_string (device, "Width=256 Height=256 PixelFormat='Mono8' TriggerStart", &error);
+ * ]|
+ *
+ * Since: 0.8.0
+ */
+
+gboolean
+arv_device_set_features_from_string (ArvDevice *device, const char *string, GError **error)
+{
+	GMatchInfo *match_info = NULL;
+	GError *local_error = NULL;
+	GRegex *regex;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+
+	if (string == NULL)
+		return TRUE;
+
+	regex = g_regex_new ("((?<Key>[^\\s\"'\\=]+)|\"(?<Key>[^\"]*)\"|'(?<Key>[^']*)')"
+			     "(?:\\=((?<Value>[^\\s\"']+)|\"(?<Value>[^\"]*)\"|'(?<Value>[^']*)'))?",
+			     G_REGEX_DUPNAMES, 0, NULL);
+
+	if (g_regex_match (regex, string, 0, &match_info)) {
+		while (g_match_info_matches (match_info) && local_error == NULL) {
+			ArvGcNode *feature;
+			char *key = g_match_info_fetch_named (match_info, "Key");
+			char *value = g_match_info_fetch_named (match_info, "Value");
+                        size_t key_length = key != NULL ? strlen (key) : 0;
+
+                        if (key_length > 4 && key[0] == 'R' && key[1] == '[' && key[key_length - 1] == ']') {
+                                char *end;
+                                gint64 address;
+                                gint64 int_value;
+
+                                address = g_ascii_strtoll (&key[2], &end, 0);
+                                if (end == NULL || end != key + key_length -1) {
+                                        g_set_error (&local_error,
+                                                     ARV_DEVICE_ERROR,
+                                                     ARV_DEVICE_ERROR_INVALID_PARAMETER,
+                                                     "Invalid address in %s", key);
+                                } else {
+                                        if (value == NULL || strlen (value) == 0) {
+                                                g_set_error (&local_error,
+                                                             ARV_DEVICE_ERROR,
+                                                             ARV_DEVICE_ERROR_INVALID_PARAMETER,
+                                                             "Value not found for %s", key);
+                                        } else {
+                                                int_value = g_ascii_strtoll (value, &end, 0);
+                                                if (end == NULL || end[0] != '\0') {
+                                                        g_set_error (&local_error,
+                                                                     ARV_DEVICE_ERROR,
+                                                                     ARV_DEVICE_ERROR_INVALID_PARAMETER,
+                                                                     "Invalid %s value for %s", value, key);
+                                                } else {
+                                                        arv_device_write_register (device, address, int_value,
+                                                                                   &local_error);
+                                                }
+                                        }
+                                }
+                        } else {
+                                feature = arv_device_get_feature (device, key);
+                                if (ARV_IS_GC_FEATURE_NODE (feature)) {
+                                        if (ARV_IS_GC_COMMAND (feature)) {
+                                                arv_device_execute_command (device, key, &local_error);
+                                        } else if (value != NULL) {
+                                                arv_gc_feature_node_set_value_from_string (ARV_GC_FEATURE_NODE (feature),
+                                                                                           value, &local_error);
+                                        } else {
+                                                g_set_error (&local_error,
+                                                             ARV_DEVICE_ERROR,
+                                                             ARV_DEVICE_ERROR_INVALID_PARAMETER,
+                                                             "[%s] Require a parameter value to set", key);
+                                        }
+                                } else
+                                        g_set_error (&local_error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
+                                                     "[%s] Not found", key);
+                        }
+
+			g_free (key);
+			g_free (value);
+
+			g_match_info_next (match_info, NULL);
+		}
+		g_match_info_unref (match_info);
+	}
+
+	g_regex_unref (regex);
+
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/* Feature snapshot */
+
+typedef struct {
+	guint64 address;
+	guint64 length;
+} ArvDevicePrefetchRange;
+
+static gint
+_compare_prefetch_ranges (gconstpointer a, gconstpointer b)
+{
+	const ArvDevicePrefetchRange *range_a = a;
+	const ArvDevicePrefetchRange *range_b = b;
+
+	return range_a->address < range_b->address ? -1 : range_a->address > range_b->address ? 1 : 0;
+}
+
+static gint
+_compare_addresses (gconstpointer a, gconstpointer b)
+{
+	guint64 address_a = *((const guint64 *) a);
+	guint64 address_b = *((const guint64 *) b);
+
+	return address_a < address_b ? -1 : address_a > address_b ? 1 : 0;
+}
+
+static void
+_prefetched_block_clear (ArvDevicePrefetchedBlock *block)
+{
+	g_clear_pointer (&block->data, g_free);
+}
+
+static void
+_collect_snapshot_features (ArvGc *genicam, ArvGcNode *node, GPtrArray *features, GHashTable *visited)
+{
+	if (!ARV_IS_GC_FEATURE_NODE (node) || !g_hash_table_add (visited, node))
+		return;
+
+	if (ARV_IS_GC_CATEGORY (node)) {
+		const GSList *iter;
+
+		for (iter = arv_gc_category_get_features (ARV_GC_CATEGORY (node)); iter != NULL; iter = iter->next)
+			_collect_snapshot_features (genicam, arv_gc_get_node (genicam, iter->data), features, visited);
+		return;
+	}
+
+	g_ptr_array_add (features, node);
+}
+
+/* Reads the device registers needed for the evaluation of @features, using as few requests as possible. Memory
+ * ranges are sorted, and merged when contiguous or overlapping, in order to be read in a single memory read. Legacy
+ * GigE Vision registers are read using the multiple register read command, if available, along the isolated aligned 4
+ * byte memory ranges. Register nodes already cached are skipped. The device accesses failing here are retried one by
+ * one during the evaluation. The device image is used by the current thread until _end_prefetch() is called. */
+
+static ArvDevicePrefetch *
+_prefetch_feature_registers (ArvDevice *device, ArvGc *genicam, GPtrArray *features)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvDeviceClass *device_class = ARV_DEVICE_GET_CLASS (device);
+	ArvDevicePrefetch *prefetch;
+	GPtrArray *registers;
+	GArray *ranges;
+	GArray *addresses;
+	GArray *memory_addresses;
+	guint n_memory_reads = 0;
+	guint n_register_reads = 0;
+	guint n_registers;
+	gint64 start;
+	guint i, j;
+
+	registers = arv_gc_dup_register_dependencies (genicam, features);
+	ranges = g_array_new (FALSE, FALSE, sizeof (ArvDevicePrefetchRange));
+	addresses = g_array_new (FALSE, FALSE, sizeof (guint64));
+	memory_addresses = g_array_new (FALSE, FALSE, sizeof (guint64));
+
+	for (i = 0; i < registers->len; i++) {
+		ArvGcRegisterNode *register_node = g_ptr_array_index (registers, i);
+		ArvDevicePrefetchRange range;
+		ArvGcPort *port;
+		GError *local_error = NULL;
+		gboolean use_register;
+
+		if (arv_gc_register_node_is_cached (register_node))
+			continue;
+
+		port = arv_gc_register_node_get_port (register_node);
+		if (port == NULL)
+			continue;
+
+		range.address = arv_gc_register_get_address (ARV_GC_REGISTER (register_node), &local_error);
+		if (local_error == NULL)
+			range.length = arv_gc_register_get_length (ARV_GC_REGISTER (register_node), &local_error);
+		if (local_error != NULL) {
+			g_clear_error (&local_error);
+			continue;
+		}
+
+		if (range.length < 1 || range.length > G_MAXUINT32 ||
+		    !arv_gc_port_get_device_access (port, range.length, &use_register))
+			continue;
+
+		if (use_register)
+			g_array_append_val (addresses, range.address);
+		else
+			g_array_append_val (ranges, range);
+	}
+
+	prefetch = g_new0 (ArvDevicePrefetch, 1);
+	prefetch->device = device;
+	prefetch->blocks = g_array_new (FALSE, FALSE, sizeof (ArvDevicePrefetchedBlock));
+	g_array_set_clear_func (prefetch->blocks, (GDestroyNotify) _prefetched_block_clear);
+	prefetch->registers = g_hash_table_new_full (g_int64_hash, g_int64_equal, g_free, NULL);
+
+	g_array_sort (ranges, _compare_prefetch_ranges);
+
+	for (i = 0; i < ranges->len; i = j) {
+		ArvDevicePrefetchedBlock block;
+		guint64 end;
+
+		block.address = g_array_index (ranges, ArvDevicePrefetchRange, i).address;
+		end = block.address + g_array_index (ranges, ArvDevicePrefetchRange, i).length;
+
+		for (j = i + 1; j < ranges->len; j++) {
+			ArvDevicePrefetchRange *range = &g_array_index (ranges, ArvDevicePrefetchRange, j);
+
+			if (range->address > end || range->address + range->length - block.address > G_MAXUINT32)
+				break;
+
+			end = MAX (end, range->address + range->length);
+		}
+
+		block.size = end - block.address;
+
+		/* Scattered registers are read together, if the device accepts multiple registers per request */
+		if (priv->is_register_batching_supported &&
+		    block.size == sizeof (guint32) &&
+		    block.address % sizeof (guint32) == 0) {
+			g_array_append_val (memory_addresses, block.address);
+			continue;
+		}
+
+		block.data = g_malloc (block.size);
+
+		n_memory_reads++;
+		start = _profile_transport_start (device);
+		if (_profile_transport_end (device, "ReadMemory", block.address, block.size, start,
+					    device_class->read_memory (device, block.address, block.size,
+								       block.data, NULL)))
+			g_array_append_val (prefetch->blocks, block);
+		else
+			g_free (block.data);
+	}
+
+	if (addresses->len > 0) {
+		g_array_sort (addresses, _compare_addresses);
+		for (i = 1, j = 1; i < addresses->len; i++)
+			if (g_array_index (addresses, guint64, i) != g_array_index (addresses, guint64, j - 1))
+				g_array_index (addresses, guint64, j++) = g_array_index (addresses, guint64, i);
+		g_array_set_size (addresses, j);
+	}
+
+	/* The legacy registers first, then the memory ranges read as registers */
+	n_registers = addresses->len;
+	g_array_append_vals (addresses, memory_addresses->data, memory_addresses->len);
+
+	if (addresses->len > 0) {
+		guint32 *values;
+
+		values = g_new (guint32, addresses->len);
+
+		n_register_reads++;
+		start = _profile_transport_start (device);
+		if (_profile_transport_end (device, "ReadRegisters", g_array_index (addresses, guint64, 0),
+					    addresses->len * sizeof (guint32), start,
+					    device_class->read_registers (device, addresses->len,
+									  (guint64 *) addresses->data, values, NULL))) {
+			for (i = 0; i < n_registers; i++) {
+				guint64 *address = g_new (guint64, 1);
+
+				*address = g_array_index (addresses, guint64, i);
+				g_hash_table_insert (prefetch->registers, address, GUINT_TO_POINTER (values[i]));
+			}
+
+			for (i = n_registers; i < addresses->len; i++) {
+				ArvDevicePrefetchedBlock block;
+
+				block.address = g_array_index (addresses, guint64, i);
+				block.size = sizeof (guint32);
+				block.data = g_malloc (sizeof (guint32));
+				_register_to_data (priv, values[i], block.data);
+				g_array_append_val (prefetch->blocks, block);
+			}
+		}
+
+		g_free (values);
+	}
+
+	arv_debug_device ("[Device::prefetch_feature_registers] %u register nodes, %u memory ranges prefetched in"
+			  " %u reads, %u registers in %u batched reads",
+			  registers->len, ranges->len, n_memory_reads, addresses->len, n_register_reads);
+
+	g_ptr_array_unref (registers);
+	g_array_unref (ranges);
+	g_array_unref (addresses);
+	g_array_unref (memory_addresses);
+
+	prefetch->previous = g_private_get (&arv_device_prefetch);
+	g_private_set (&arv_device_prefetch, prefetch);
+
+	return prefetch;
+}
+
+static void
+_end_prefetch (ArvDevicePrefetch *prefetch)
+{
+	g_return_if_fail (g_private_get (&arv_device_prefetch) == prefetch);
+
+	g_private_set (&arv_device_prefetch, prefetch->previous);
+
+	g_array_unref (prefetch->blocks);
+	g_hash_table_unref (prefetch->registers);
+	g_free (prefetch);
+}
+
+/**
+ * arv_device_snapshot_features:
+ * @device: a #ArvDevice
+ * @features: (array zero-terminated=1) (allow-none): a %NULL terminated list of feature or category names, %NULL
+ * for the whole feature tree
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Reads the current value of a set of features, and returns them as a list of space separated assignments, in a format
+ * suitable for arv_device_set_features_from_string(). Categories are expanded recursively. Only the available,
+ * implemented and writable features holding a value are included.
+ *
+ * Instead of one device access per feature, the registers needed for the evaluation of all the features are
+ * determined first, and read using as few contiguous memory reads and batched register reads as possible. The feature
+ * values are then computed from this device image.
+ *
+ * Returns: (transfer full): a newly allocated string, to be freed after use, or %NULL on error.
+ *
+ * Since: 0.10.0
+ */
+
+char *
+arv_device_snapshot_features (ArvDevice *device, const char **features, GError **error)
+{
+	static const char *root_features[] = {"Root", NULL};
+	ArvDevicePrefetch *prefetch;
+	GPtrArray *feature_nodes;
+	GHashTable *visited;
+	GString *string;
+	ArvGc *genicam;
+	guint n_values = 0;
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), NULL);
+	g_return_val_if_fail (error == NULL || *error == NULL, NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+
+	if (features == NULL)
+		features = root_features;
+
+	feature_nodes = g_ptr_array_new ();
+	visited = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+	for (i = 0; features[i] != NULL; i++) {
+		ArvGcNode *node = arv_gc_get_node (genicam, features[i]);
+
+		if (!ARV_IS_GC_FEATURE_NODE (node)) {
+			g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
+				     "[%s] Not found", features[i]);
+			g_ptr_array_unref (feature_nodes);
+			g_hash_table_unref (visited);
+			return NULL;
+		}
+
+		_collect_snapshot_features (genicam, node, feature_nodes, visited);
+	}
+
+	g_hash_table_unref (visited);
+
+	prefetch = _prefetch_feature_registers (device, genicam, feature_nodes);
+
+	string = g_string_new (NULL);
+
+	for (i = 0; i < feature_nodes->len; i++) {
+		ArvGcFeatureNode *node = g_ptr_array_index (feature_nodes, i);
+		GError *local_error = NULL;
+		const char *value;
+
+		if (ARV_IS_GC_COMMAND (node) ||
+		    !(ARV_IS_GC_INTEGER (node) || ARV_IS_GC_FLOAT (node) || ARV_IS_GC_BOOLEAN (node) ||
+		      ARV_IS_GC_ENUMERATION (node) || ARV_IS_GC_STRING (node)))
+			continue;
+
+		if (!arv_gc_feature_node_is_implemented (node, &local_error) ||
+		    !arv_gc_feature_node_is_available (node, &local_error) ||
+		    arv_gc_feature_node_get_actual_access_mode (node) != ARV_GC_ACCESS_MODE_RW) {
+			g_clear_error (&local_error);
+			continue;
+		}
+
+		value = arv_gc_feature_node_get_value_as_string (node, &local_error);
+		if (local_error != NULL || value == NULL) {
+			arv_info_device ("[Device::snapshot_features] Skip %s: %s",
+					 arv_gc_feature_node_get_name (node),
+					 local_error != NULL ? local_error->message : "no value");
+			g_clear_error (&local_error);
+			continue;
+		}
+
+		if (strchr (value, '\'') != NULL && strchr (value, '"') != NULL) {
+			arv_warning_device ("[Device::snapshot_features] Skip %s: value can't be quoted",
+					    arv_gc_feature_node_get_name (node));
+			continue;
+		}
+
+		if (n_values > 0)
+			g_string_append_c (string, ' ');
+
+		g_string_append (string, arv_gc_feature_node_get_name (node));
+		g_string_append_c (string, '=');
+
+		if (value[0] == '\0' || strpbrk (value, " \t\n\r\f\v'\"") != NULL) {
+			char quote = strchr (value, '\'') != NULL ? '"' : '\'';
+
+			g_string_append_c (string, quote);
+			g_string_append (string, value);
+			g_string_append_c (string, quote);
+		} else
+			g_string_append (string, value);
+
+		n_values++;
+	}
+
+	_end_prefetch (prefetch);
+
+	g_ptr_array_unref (feature_nodes);
+
+	return g_string_free (string, FALSE);
+}
+
+/* Feature polling */
+
+/* Features sharing the same polling period, read together */
+
+typedef struct {
+	ArvDevice *device;
+	ArvDevicePolling *polling;
+	guint period_ms;
+	GPtrArray *features;		/* ArvGcFeatureNode */
+	GPtrArray *registers;		/* ArvGcRegisterNode, needed for the evaluation of the features */
+	GPtrArray *values;		/* Last feature values, as strings */
+	GSource *source;
+} ArvDevicePollingGroup;
+
+static void
+_polling_group_free (ArvDevicePollingGroup *group)
+{
+	if (group->source != NULL) {
+		g_source_destroy (group->source);
+		g_source_unref (group->source);
+	}
+
+	g_ptr_array_unref (group->features);
+	g_ptr_array_unref (group->registers);
+	g_ptr_array_unref (group->values);
+	g_free (group);
+}
+
+/* Polling state. A feature-changed handler may stop or restart the polling, in which case the state is only released
+ * at the end of the current poll. */
+
+struct _ArvDevicePolling {
+	GMainContext *context;
+	GPtrArray *groups;		/* ArvDevicePollingGroup */
+	guint n_running_polls;
+	gboolean is_stopped;
+};
+
+static void
+_polling_free (ArvDevicePolling *polling)
+{
+	g_ptr_array_unref (polling->groups);
+	g_main_context_unref (polling->context);
+	g_free (polling);
+}
+
+/* The registers of the group are read again, using batched requests, and the features depending on them are
+ * evaluated. The feature-changed signal is emitted for each value different from the one of the previous poll. */
+
+static void
+_poll_group (ArvDevicePollingGroup *group, gboolean emit_signals)
+{
+	ArvDevice *device = group->device;
+	ArvGc *genicam = arv_device_get_genicam (device);
+	ArvDevicePrefetch *prefetch;
+	GPtrArray *changed_features;
+	guint i;
+
+	for (i = 0; i < group->registers->len; i++) {
+		ArvGcRegisterNode *register_node = g_ptr_array_index (group->registers, i);
+
+		arv_gc_register_node_invalidate_cache (register_node);
+		arv_gc_invalidate_dependents (genicam, ARV_GC_FEATURE_NODE (register_node));
+	}
+
+	prefetch = _prefetch_feature_registers (device, genicam, group->features);
+
+	changed_features = g_ptr_array_new ();
+
+	for (i = 0; i < group->features->len; i++) {
+		ArvGcFeatureNode *node = g_ptr_array_index (group->features, i);
+		GError *local_error = NULL;
+		const char *value;
+
+		value = arv_gc_feature_node_get_value_as_string (node, &local_error);
+		if (local_error != NULL) {
+			arv_debug_device ("[Device::poll_features] Failed to read %s: %s",
+					  arv_gc_feature_node_get_name (node), local_error->message);
+			g_clear_error (&local_error);
+			continue;
+		}
+
+		if (g_strcmp0 (value, g_ptr_array_index (group->values, i)) != 0) {
+			g_free (g_ptr_array_index (group->values, i));
+			g_ptr_array_index (group->values, i) = g_strdup (value);
+			g_ptr_array_add (changed_features, node);
+		}
+	}
+
+	_end_prefetch (prefetch);
+
+	if (emit_signals)
+		for (i = 0; i < changed_features->len && !group->polling->is_stopped; i++)
+			g_signal_emit (device, arv_device_signals[ARV_DEVICE_SIGNAL_FEATURE_CHANGED], 0,
+				       arv_gc_feature_node_get_name (g_ptr_array_index (changed_features, i)));
+
+	g_ptr_array_unref (changed_features);
+}
+
+static gboolean
+_polling_group_cb (gpointer user_data)
+{
+	ArvDevicePollingGroup *group = user_data;
+	ArvDevicePolling *polling = group->polling;
+
+	if (polling->is_stopped)
+		return G_SOURCE_REMOVE;
+
+	polling->n_running_polls++;
+	_poll_group (group, TRUE);
+	polling->n_running_polls--;
+
+	if (polling->is_stopped) {
+		if (polling->n_running_polls == 0)
+			_polling_free (polling);
+		return G_SOURCE_REMOVE;
+	}
+
+	return G_SOURCE_CONTINUE;
+}
+
+/* Groups the features by polling period. The period given by arv_device_set_feature_polling_time() takes precedence
+ * over the Genicam PollingTime property. */
+
+static GPtrArray *
+_build_polling_groups (ArvDevice *device, ArvGc *genicam)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	GHashTable *periods;
+	GHashTable *groups_by_period;
+	GPtrArray *polled_features;
+	GPtrArray *groups;
+	GHashTableIter iter;
+	gpointer key, value;
+	guint i;
+
+	periods = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+	polled_features = arv_gc_dup_polled_features (genicam);
+	for (i = 0; i < polled_features->len; i++) {
+		ArvGcFeatureNode *node = g_ptr_array_index (polled_features, i);
+
+		g_hash_table_insert (periods, node, GUINT_TO_POINTER (MIN (arv_gc_feature_node_get_polling_time (node),
+									   G_MAXUINT)));
+	}
+	g_ptr_array_unref (polled_features);
+
+	g_hash_table_iter_init (&iter, priv->polling_times);
+	while (g_hash_table_iter_next (&iter, &key, &value)) {
+		ArvGcNode *node = arv_gc_get_node (genicam, key);
+
+		if (!ARV_IS_GC_FEATURE_NODE (node))
+			continue;
+
+		if (GPOINTER_TO_UINT (value) > 0)
+			g_hash_table_insert (periods, node, value);
+		else
+			g_hash_table_remove (periods, node);
+	}
+
+	groups = g_ptr_array_new_with_free_func ((GDestroyNotify) _polling_group_free);
+	groups_by_period = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+	g_hash_table_iter_init (&iter, periods);
+	while (g_hash_table_iter_next (&iter, &key, &value)) {
+		ArvDevicePollingGroup *group = g_hash_table_lookup (groups_by_period, value);
+
+		if (group == NULL) {
+			group = g_new0 (ArvDevicePollingGroup, 1);
+			group->device = device;
+			group->period_ms = GPOINTER_TO_UINT (value);
+			group->features = g_ptr_array_new ();
+			group->values = g_ptr_array_new_with_free_func (g_free);
+			g_hash_table_insert (groups_by_period, value, group);
+			g_ptr_array_add (groups, group);
+		}
+
+		g_ptr_array_add (group->features, key);
+		g_ptr_array_add (group->values, NULL);
+	}
+
+	for (i = 0; i < groups->len; i++) {
+		ArvDevicePollingGroup *group = g_ptr_array_index (groups, i);
+
+		group->registers = arv_gc_dup_register_dependencies (genicam, group->features);
+
+		arv_info_device ("[Device::build_polling_groups] %u features and %u registers polled every %u ms",
+				 group->features->len, group->registers->len, group->period_ms);
+	}
+
+	g_hash_table_unref (groups_by_period);
+	g_hash_table_unref (periods);
+
+	return groups;
+}
+
+static gboolean
+_start_feature_polling (ArvDevice *device, GMainContext *context, GError **error)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvDevicePolling *polling;
+	ArvGc *genicam;
+	guint i;
+
+	if (priv->polling != NULL) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_INVALID_PARAMETER,
+			     "Feature polling already started");
+		return FALSE;
+	}
+
+	genicam = arv_device_get_genicam (device);
+	if (!ARV_IS_GC (genicam)) {
+		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_GENICAM_NOT_FOUND,
+			     "Genicam data not found");
+		return FALSE;
+	}
 
-        return NULL;
-}
+	polling = g_new0 (ArvDevicePolling, 1);
+	polling->context = context != NULL ? g_main_context_ref (context) : g_main_context_ref_thread_default ();
+	polling->groups = _build_polling_groups (device, genicam);
 
-/**
- * arv_device_dup_available_enumeration_feature_values:
- * @device: an #ArvDevice
- * @feature: feature name
- * @n_values: placeholder for the number of returned values
- * @error: a #GError placeholder
- *
- * Get all the available values of @feature, as integers.
- *
- * Returns: (array length=n_values) (transfer container): a newly created array of 64 bit integers, which must freed after use using g_free,
- * or NULL on error.
- *
- * Since: 0.8.0
- */
+	priv->polling = polling;
 
-gint64 *
-arv_device_dup_available_enumeration_feature_values (ArvDevice *device, const char *feature, guint *n_values, GError **error)
-{
-	ArvGcNode *node;
+	/* The initial values, which don't trigger any signal */
+	for (i = 0; i < polling->groups->len; i++) {
+		ArvDevicePollingGroup *group = g_ptr_array_index (polling->groups, i);
 
-	if (n_values != NULL)
-		*n_values = 0;
+		group->polling = polling;
 
-	node = _get_feature (device, ARV_TYPE_GC_ENUMERATION, feature, error);
-	if (node != NULL)
-		return arv_gc_enumeration_dup_available_int_values (ARV_GC_ENUMERATION (node), n_values, error);
+		_poll_group (group, FALSE);
 
-	return NULL;
-}
+		group->source = g_timeout_source_new (group->period_ms);
+		g_source_set_callback (group->source, _polling_group_cb, group, NULL);
+		g_source_attach (group->source, polling->context);
+	}
 
-/**
- * arv_device_dup_available_enumeration_feature_values_as_strings:
- * @device: an #ArvDevice
- * @feature: feature name
- * @n_values: placeholder for the number of returned values
- * @error: a #GError placeholder
- *
- * Get all the available values of @feature, as strings.
- *
- * Returns: (array length=n_values) (transfer container): a newly created array of const strings, which must freed after use using g_free,
- * or NULL on error.
- *
- * Since: 0.8.0
- */
+	return TRUE;
+}
 
-const char **
-arv_device_dup_available_enumeration_feature_values_as_strings (ArvDevice *device, const char *feature, guint *n_values, GError **error)
+static void
+_stop_feature_polling (ArvDevice *device)
 {
-	ArvGcNode *node;
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+	ArvDevicePolling *polling = priv->polling;
 
-	if (n_values != NULL)
-		*n_values = 0;
+	if (polling == NULL)
+		return;
 
-	node = _get_feature (device, ARV_TYPE_GC_ENUMERATION, feature, error);
-	if (node != NULL)
-		return arv_gc_enumeration_dup_available_string_values (ARV_GC_ENUMERATION (node), n_values, error);
+	priv->polling = NULL;
 
-	return NULL;
+	polling->is_stopped = TRUE;
+	if (polling->n_running_polls == 0)
+		_polling_free (polling);
 }
 
 /**
- * arv_device_dup_available_enumeration_feature_values_as_display_names:
- * @device: an #ArvDevice
- * @feature: feature name
- * @n_values: placeholder for the number of returned values
- * @error: a #GError placeholder
+ * arv_device_start_feature_polling:
+ * @device: a #ArvDevice
+ * @context: (allow-none): a #GMainContext, %NULL for the thread default context
+ * @error: a #GError placeholder, %NULL to ignore
  *
- * Get display names of all the available entries of @feature.
+ * Starts the periodic reading of the features having a Genicam PollingTime property, and of the features
+ * registered using arv_device_set_feature_polling_time(). Features sharing the same period are read together, using
+ * batched register reads, from a timeout source attached to @context. The #ArvDevice::feature-changed signal is
+ * emitted each time a polled feature value changes.
  *
- * Returns: (array length=n_values) (transfer container): a newly created array of const strings, to be freed after use using g_free, or
- * %NULL on error.
+ * As #ArvDevice is not thread safe, the features must only be accessed from the thread running @context while the
+ * polling is active. The #ArvDevice::feature-changed handlers may stop the polling, or change the polling periods.
  *
- * Since: 0.8.0
+ * Returns: %TRUE on success.
+ *
+ * Since: 0.10.0
  */
 
-const char **
-arv_device_dup_available_enumeration_feature_values_as_display_names (ArvDevice *device, const char *feature, guint *n_values, GError **error)
+gboolean
+arv_device_start_feature_polling (ArvDevice *device, GMainContext *context, GError **error)
 {
-	ArvGcNode *node;
-
-	if (n_values != NULL)
-		*n_values = 0;
-
-	node = _get_feature (device, ARV_TYPE_GC_ENUMERATION, feature, error);
-	if (node != NULL)
-		return arv_gc_enumeration_dup_available_display_names (ARV_GC_ENUMERATION (node), n_values, error);
+	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	return NULL;
+	return _start_feature_polling (device, context, error);
 }
 
 /**
- * arv_device_is_enumeration_entry_available:
- * @device: an #ArvDevice instance
- * @feature: enumeration feature name
- * @entry: entry name
- * @error: a #GError placeholder
+ * arv_device_stop_feature_polling:
+ * @device: a #ArvDevice
  *
- * Returns: %TRUE if the feature and the feature entry are available
+ * Stops the feature polling started by arv_device_start_feature_polling().
  *
- * Since: 0.8.17
+ * Since: 0.10.0
  */
 
-gboolean
-arv_device_is_enumeration_entry_available (ArvDevice *device, const char *feature, const char *entry, GError **error)
+void
+arv_device_stop_feature_polling (ArvDevice *device)
 {
-        GError *local_error = NULL;
-        const char **entries = NULL;
-        guint n_entries = 0;
-        gboolean is_available = FALSE;
-        unsigned int i;
-
-        if (!arv_device_is_feature_available (device, feature, &local_error)) {
-                if (local_error != NULL)
-                        g_propagate_error (error, local_error);
-                return FALSE;
-        }
-
-        entries = arv_device_dup_available_enumeration_feature_values_as_strings (device, feature, &n_entries,
-                                                                                  &local_error);
-
-        if (local_error != NULL) {
-                g_propagate_error (error, local_error);
-                return FALSE;
-        }
-
-        for (i = 0; i < n_entries && !is_available; i++) {
-                if (g_strcmp0 (entry, entries[i]) == 0)
-                        is_available = TRUE;
-        }
-        g_free (entries);
+	g_return_if_fail (ARV_IS_DEVICE (device));
 
-        return is_available;
+	_stop_feature_polling (device);
 }
 
 /**
- * arv_device_set_features_from_string:
+ * arv_device_set_feature_polling_time:
  * @device: a #ArvDevice
- * @string: a space separated list of features assignments
- * @error: a #GError placeholder, %NULL to ignore
- *
- * Set features from a string containing a list of space separated feature assignments or command names. For example:
+ * @feature: feature name
+ * @polling_time: polling period, in milliseconds, 0 to disable
  *
- * |[<!-- language="C" -->
- * arv_device_set_features_from_string (device, "Width=256 Height=256 PixelFormat='Mono8' TriggerStart", &error);
- * ]|
+ * Overrides the Genicam PollingTime property of @feature, or adds a feature without such a property to the polled
+ * features. If the polling is already started, it is restarted with the new settings.
  *
- * Since: 0.8.0
+ * Since: 0.10.0
  */
 
-gboolean
-arv_device_set_features_from_string (ArvDevice *device, const char *string, GError **error)
+void
+arv_device_set_feature_polling_time (ArvDevice *device, const char *feature, guint polling_time)
 {
-	GMatchInfo *match_info = NULL;
-	GError *local_error = NULL;
-	GRegex *regex;
-
-	g_return_val_if_fail (ARV_IS_DEVICE (device), FALSE);
-
-	if (string == NULL)
-		return TRUE;
-
-	regex = g_regex_new ("((?<Key>[^\\s\"'\\=]+)|\"(?<Key>[^\"]*)\"|'(?<Key>[^']*)')"
-			     "(?:\\=((?<Value>[^\\s\"']+)|\"(?<Value>[^\"]*)\"|'(?<Value>[^']*)'))?",
-			     G_REGEX_DUPNAMES, 0, NULL);
-
-	if (g_regex_match (regex, string, 0, &match_info)) {
-		while (g_match_info_matches (match_info) && local_error == NULL) {
-			ArvGcNode *feature;
-			char *key = g_match_info_fetch_named (match_info, "Key");
-			char *value = g_match_info_fetch_named (match_info, "Value");
-                        size_t key_length = key != NULL ? strlen (key) : 0;
-
-                        if (key_length > 4 && key[0] == 'R' && key[1] == '[' && key[key_length - 1] == ']') {
-                                char *end;
-                                gint64 address;
-                                gint64 int_value;
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
 
-                                address = g_ascii_strtoll (&key[2], &end, 0);
-                                if (end == NULL || end != key + key_length -1) {
-                                        g_set_error (&local_error,
-                                                     ARV_DEVICE_ERROR,
-                                                     ARV_DEVICE_ERROR_INVALID_PARAMETER,
-                                                     "Invalid address in %s", key);
-                                } else {
-                                        if (value == NULL || strlen (value) == 0) {
-                                                g_set_error (&local_error,
-                                                             ARV_DEVICE_ERROR,
-                                                             ARV_DEVICE_ERROR_INVALID_PARAMETER,
-                                                             "Value not found for %s", key);
-                                        } else {
-                                                int_value = g_ascii_strtoll (value, &end, 0);
-                                                if (end == NULL || end[0] != '\0') {
-                                                        g_set_error (&local_error,
-                                                                     ARV_DEVICE_ERROR,
-                                                                     ARV_DEVICE_ERROR_INVALID_PARAMETER,
-                                                                     "Invalid %s value for %s", value, key);
-                                                } else {
-                                                        arv_device_write_register (device, address, int_value,
-                                                                                   &local_error);
-                                                }
-                                        }
-                                }
-                        } else {
-                                feature = arv_device_get_feature (device, key);
-                                if (ARV_IS_GC_FEATURE_NODE (feature)) {
-                                        if (ARV_IS_GC_COMMAND (feature)) {
-                                                arv_device_execute_command (device, key, &local_error);
-                                        } else if (value != NULL) {
-                                                arv_gc_feature_node_set_value_from_string (ARV_GC_FEATURE_NODE (feature),
-                                                                                           value, &local_error);
-                                        } else {
-                                                g_set_error (&local_error,
-                                                             ARV_DEVICE_ERROR,
-                                                             ARV_DEVICE_ERROR_INVALID_PARAMETER,
-                                                             "[%s] Require a parameter value to set", key);
-                                        }
-                                } else
-                                        g_set_error (&local_error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND,
-                                                     "[%s] Not found", key);
-                        }
+	g_return_if_fail (ARV_IS_DEVICE (device));
+	g_return_if_fail (feature != NULL);
 
-			g_free (key);
-			g_free (value);
+	g_hash_table_replace (priv->polling_times, g_strdup (feature), GUINT_TO_POINTER (polling_time));
 
-			g_match_info_next (match_info, NULL);
-		}
-		g_match_info_unref (match_info);
-	}
+	if (priv->polling != NULL) {
+		GMainContext *context = g_main_context_ref (priv->polling->context);
 
-	g_regex_unref (regex);
+		_stop_feature_polling (device);
+		_start_feature_polling (device, context, NULL);
 
-	if (local_error != NULL) {
-		g_propagate_error (error, local_error);
-		return FALSE;
+		g_main_context_unref (context);
 	}
-
-	return TRUE;
 }
 
 /**
@@ -1479,6 +3189,30 @@ arv_device_emit_device_event_signal (ArvDevice *device, int event_id)
 }
 #endif
 
+/* Layout of the registers in the device memory, for the register and memory accesses inside transactions. Default to
+ * host order, without multiple register accesses per request. */
+
+void
+arv_device_set_register_byte_order (ArvDevice *device, int byte_order)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+	g_return_if_fail (byte_order == G_BIG_ENDIAN || byte_order == G_LITTLE_ENDIAN);
+
+	priv->register_byte_order = byte_order;
+}
+
+void
+arv_device_set_register_batching (ArvDevice *device, gboolean is_supported)
+{
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
+	g_return_if_fail (ARV_IS_DEVICE (device));
+
+	priv->is_register_batching_supported = is_supported;
+}
+
 void arv_device_take_init_error (ArvDevice *device, GError *error)
 {
 	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
@@ -1492,6 +3226,28 @@ void arv_device_take_init_error (ArvDevice *device, GError *error)
 static void
 arv_device_init (ArvDevice *device)
 {
+	ArvDevicePrivate *priv = arv_device_get_instance_private (device);
+
+	priv->feature_handles = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+						       (GDestroyNotify) arv_feature_handle_free);
+
+	priv->register_byte_order = G_BYTE_ORDER;
+	priv->is_register_batching_supported = FALSE;
+
+	g_rec_mutex_init (&priv->transaction_mutex);
+	priv->staged_writes = g_array_new (FALSE, FALSE, sizeof (ArvDeviceStagedWrite));
+	g_array_set_clear_func (priv->staged_writes, (GDestroyNotify) _staged_write_clear);
+
+	priv->polling_times = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+}
+
+static void
+arv_device_dispose (GObject *object)
+{
+	/* Stopped before the finalization of the derived classes, which closes the device connection */
+	_stop_feature_polling (ARV_DEVICE (object));
+
+	G_OBJECT_CLASS (arv_device_parent_class)->dispose (object);
 }
 
 static void
@@ -1508,6 +3264,11 @@ arv_device_finalize (GObject *object)
         }
         g_slist_free(priv->streams);
 
+	g_clear_pointer (&priv->feature_handles, g_hash_table_unref);
+	g_clear_pointer (&priv->staged_writes, g_array_unref);
+	g_rec_mutex_clear (&priv->transaction_mutex);
+	g_clear_pointer (&priv->polling_times, g_hash_table_unref);
+
 	G_OBJECT_CLASS (arv_device_parent_class)->finalize (object);
 }
 
@@ -1516,8 +3277,12 @@ arv_device_class_init (ArvDeviceClass *device_class)
 {
 	GObjectClass *object_class = G_OBJECT_CLASS (device_class);
 
+	object_class->dispose = arv_device_dispose;
 	object_class->finalize = arv_device_finalize;
 
+	device_class->read_registers = _read_registers;
+	device_class->write_registers = _write_registers;
+
 	/**
 	 * ArvDevice::control-lost:
 	 * @device:a #ArvDevice
@@ -1560,6 +3325,24 @@ arv_device_class_init (ArvDeviceClass *device_class)
 			      NULL, NULL,
 			      g_cclosure_marshal_VOID__INT, G_TYPE_NONE, 1, G_TYPE_INT);
 #endif
+
+	/**
+	 * ArvDevice::feature-changed:
+	 * @device: a #ArvDevice
+	 * @feature: the name of the changed feature
+	 *
+	 * Signal a change of a polled feature value, see arv_device_start_feature_polling().
+	 *
+	 * Since: 0.10.0
+	 */
+
+	arv_device_signals[ARV_DEVICE_SIGNAL_FEATURE_CHANGED] =
+		g_signal_new ("feature-changed",
+			      G_TYPE_FROM_CLASS (device_class),
+			      G_SIGNAL_RUN_LAST,
+			      G_STRUCT_OFFSET (ArvDeviceClass, feature_changed),
+			      NULL, NULL,
+			      g_cclosure_marshal_VOID__STRING, G_TYPE_NONE, 1, G_TYPE_STRING);
 }
 
 static gboolean
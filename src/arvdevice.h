@@ -105,8 +105,15 @@ struct _ArvDeviceClass {
 	void		(*device_event)		(ArvDevice *device);
 #endif
 
+	gboolean	(*write_registers)	(ArvDevice *device, guint n_registers,
+						 const guint64 *addresses, const guint32 *values, GError **error);
+	gboolean	(*read_registers)	(ArvDevice *device, guint n_registers,
+						 const guint64 *addresses, guint32 *values, GError **error);
+
+	void		(*feature_changed)	(ArvDevice *device, const char *feature);
+
         /* Padding for future expansion */
-        gpointer padding[10];
+        gpointer padding[7];
 };
 
 ARV_API ArvStream *	arv_device_create_stream        	(ArvDevice *device,
@@ -120,6 +127,11 @@ ARV_API gboolean	arv_device_read_memory			(ArvDevice *device, guint64 address, g
 ARV_API gboolean	arv_device_write_memory			(ArvDevice *device, guint64 address, guint32 size, const void *buffer, GError **error);
 ARV_API gboolean	arv_device_read_register		(ArvDevice *device, guint64 address, guint32 *value, GError **error);
 ARV_API gboolean	arv_device_write_register		(ArvDevice *device, guint64 address, guint32 value, GError **error);
+
+ARV_API void		arv_device_begin_transaction		(ArvDevice *device);
+ARV_API gboolean	arv_device_commit_transaction		(ArvDevice *device, GError **error);
+ARV_API void		arv_device_abort_transaction		(ArvDevice *device);
+ARV_API gboolean	arv_device_is_in_transaction		(ArvDevice *device);
 #if ARAVIS_HAS_EVENT
 ARV_API gboolean	arv_device_read_event_data		(ArvDevice *device, int event_id,
                                                                  guint64 address, guint32 size, void *buffer,
@@ -136,6 +148,25 @@ ARV_API ArvGcAccessMode	arv_device_get_feature_access_mode	(ArvDevice *device, c
 
 ARV_API ArvGcRepresentation	arv_device_get_feature_representation	(ArvDevice *device, const char *feature);
 
+ARV_API ArvFeatureHandle *	arv_device_get_feature_handle		(ArvDevice *device, const char *feature);
+
+ARV_API const char *	arv_feature_handle_get_name		(ArvFeatureHandle *handle);
+ARV_API ArvGcNode *	arv_feature_handle_get_node		(ArvFeatureHandle *handle);
+ARV_API gboolean	arv_feature_handle_is_available		(ArvFeatureHandle *handle, GError **error);
+
+ARV_API gint64		arv_feature_handle_get_integer_value	(ArvFeatureHandle *handle, GError **error);
+ARV_API void		arv_feature_handle_set_integer_value	(ArvFeatureHandle *handle, gint64 value, GError **error);
+ARV_API void		arv_feature_handle_get_integer_bounds	(ArvFeatureHandle *handle, gint64 *min, gint64 *max,
+								 GError **error);
+ARV_API double		arv_feature_handle_get_float_value	(ArvFeatureHandle *handle, GError **error);
+ARV_API void		arv_feature_handle_set_float_value	(ArvFeatureHandle *handle, double value, GError **error);
+ARV_API void		arv_feature_handle_get_float_bounds	(ArvFeatureHandle *handle, double *min, double *max,
+								 GError **error);
+ARV_API gboolean	arv_feature_handle_get_boolean_value	(ArvFeatureHandle *handle, GError **error);
+ARV_API void		arv_feature_handle_set_boolean_value	(ArvFeatureHandle *handle, gboolean value, GError **error);
+ARV_API const char *	arv_feature_handle_get_string_value	(ArvFeatureHandle *handle, GError **error);
+ARV_API void		arv_feature_handle_set_string_value	(ArvFeatureHandle *handle, const char *value, GError **error);
+
 ARV_API ArvChunkParser *arv_device_create_chunk_parser		(ArvDevice *device);
 
 ARV_API gboolean	arv_device_execute_command		(ArvDevice *device, const char *feature, GError **error);
@@ -175,6 +206,12 @@ ARV_API gboolean	arv_device_is_enumeration_entry_available				(ArvDevice *device
 												 const char *entry, GError **error);
 
 ARV_API gboolean	arv_device_set_features_from_string	(ArvDevice *device, const char *string, GError **error);
+ARV_API char *		arv_device_snapshot_features		(ArvDevice *device, const char **features, GError **error);
+
+ARV_API gboolean	arv_device_start_feature_polling	(ArvDevice *device, GMainContext *context, GError **error);
+ARV_API void		arv_device_stop_feature_polling		(ArvDevice *device);
+ARV_API void		arv_device_set_feature_polling_time	(ArvDevice *device, const char *feature,
+								 guint polling_time);
 
 ARV_API void		arv_device_set_register_cache_policy	(ArvDevice *device, ArvRegisterCachePolicy policy);
 ARV_API void		arv_device_set_range_check_policy	(ArvDevice *device, ArvRangeCheckPolicy policy);
@@ -37,6 +37,9 @@ void 		arv_device_emit_device_event_signal 	(ArvDevice *device, int event_id);
 #endif
 void		arv_device_take_init_error		(ArvDevice *device, GError *error);
 
+void		arv_device_set_register_byte_order	(ArvDevice *device, int byte_order);
+void		arv_device_set_register_batching	(ArvDevice *device, gboolean is_supported);
+
 G_END_DECLS
 
 #endif
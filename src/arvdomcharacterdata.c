@@ -26,12 +26,15 @@
  * @short_description: Base class for DOM character data nodes
  */
 
-#include <arvdomcharacterdata.h>
+#include <arvdomcharacterdataprivate.h>
+#include <arvdomdocumentprivate.h>
 #include <arvdebugprivate.h>
 #include <string.h>
 
 typedef struct {
 	char *data;
+	/* Owner of data when it is interned, NULL otherwise */
+	ArvDomStringPool *string_pool;
 } ArvDomCharacterDataPrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvDomCharacterData, arv_dom_character_data, ARV_TYPE_DOM_NODE, G_ADD_PRIVATE (ArvDomCharacterData))
@@ -66,14 +69,56 @@ void
 arv_dom_character_data_set_data (ArvDomCharacterData* self, const char * value)
 {
 	ArvDomCharacterDataPrivate *priv = arv_dom_character_data_get_instance_private (ARV_DOM_CHARACTER_DATA (self));
+	ArvDomStringPool *string_pool;
+	char *data;
 
 	g_return_if_fail (ARV_IS_DOM_CHARACTER_DATA (self));
 	g_return_if_fail (value != NULL);
 
-	g_free (priv->data);
+	/* @value may point to the current data, which is only released once copied */
+	data = priv->data;
+	string_pool = priv->string_pool;
+
 	priv->data = g_strdup (value);
+	priv->string_pool = NULL;
+
+	if (string_pool == NULL)
+		g_free (data);
+	else
+		arv_dom_string_pool_unref (string_pool);
+
+	arv_debug_dom ("[ArvDomCharacterData::set_data] Value = '%s'", priv->data);
+
+	arv_dom_node_changed (ARV_DOM_NODE (self));
+}
+
+/*
+ * arv_dom_character_data_set_interned_data:
+ * @self: a #ArvDomCharacterData
+ * @pool: a #ArvDomStringPool
+ * @value: a string interned in @pool
+ *
+ * Same as arv_dom_character_data_set_data(), but @value is not copied. Instead, @self holds a reference to @pool,
+ * which keeps @value valid even if @self outlives its owner document.
+ */
+
+void
+arv_dom_character_data_set_interned_data (ArvDomCharacterData *self, ArvDomStringPool *pool, const char *value)
+{
+	ArvDomCharacterDataPrivate *priv = arv_dom_character_data_get_instance_private (ARV_DOM_CHARACTER_DATA (self));
+
+	g_return_if_fail (ARV_IS_DOM_CHARACTER_DATA (self));
+	g_return_if_fail (pool != NULL);
+	g_return_if_fail (value != NULL);
+
+	arv_dom_string_pool_ref (pool);
 
-	arv_debug_dom ("[ArvDomCharacterData::set_data] Value = '%s'", value);
+	if (priv->string_pool == NULL)
+		g_free (priv->data);
+	else
+		arv_dom_string_pool_unref (priv->string_pool);
+	priv->data = (char *) value;
+	priv->string_pool = pool;
 
 	arv_dom_node_changed (ARV_DOM_NODE (self));
 }
@@ -88,7 +133,10 @@ arv_dom_character_data_finalize (GObject *self)
 {
 	ArvDomCharacterDataPrivate *priv = arv_dom_character_data_get_instance_private (ARV_DOM_CHARACTER_DATA (self));
 
-	g_free (priv->data);
+	if (priv->string_pool == NULL)
+		g_free (priv->data);
+	else
+		arv_dom_string_pool_unref (priv->string_pool);
 
 	G_OBJECT_CLASS (arv_dom_character_data_parent_class)->finalize (self);
 }
@@ -26,7 +26,8 @@
  * @short_description: Base class for DOM document nodes
  */
 
-#include <arvdomdocument.h>
+#include <arvdomdocumentprivate.h>
+#include <arvdomcharacterdataprivate.h>
 #include <arvdomelement.h>
 #include <arvstr.h>
 #include <arvdebug.h>
@@ -34,9 +35,13 @@
 #include <gio/gio.h>
 #include <string.h>
 
+#define ARV_DOM_DOCUMENT_STRING_POOL_BLOCK_SIZE		4096
+#define ARV_DOM_DOCUMENT_INTERN_BUFFER_SIZE		256
+
 typedef struct {
 	char *		url;
 
+	ArvDomStringPool *string_pool;
 } ArvDomDocumentPrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvDomDocument, arv_dom_document, ARV_TYPE_DOM_NODE, G_ADD_PRIVATE (ArvDomDocument))
@@ -120,6 +125,176 @@ arv_dom_document_create_text_node (ArvDomDocument *self, const char *data)
 	return ARV_DOM_DOCUMENT_GET_CLASS (self)->create_text_node (self, data);
 }
 
+struct _ArvDomStringPool {
+	gint ref_count;
+
+	GStringChunk *chunk;
+	GHashTable *strings;
+};
+
+static ArvDomStringPool *
+arv_dom_string_pool_new (void)
+{
+	ArvDomStringPool *pool = g_new0 (ArvDomStringPool, 1);
+
+	pool->ref_count = 1;
+	pool->chunk = g_string_chunk_new (ARV_DOM_DOCUMENT_STRING_POOL_BLOCK_SIZE);
+	pool->strings = g_hash_table_new (g_str_hash, g_str_equal);
+
+	return pool;
+}
+
+ArvDomStringPool *
+arv_dom_string_pool_ref (ArvDomStringPool *pool)
+{
+	g_return_val_if_fail (pool != NULL, NULL);
+
+	g_atomic_int_inc (&pool->ref_count);
+
+	return pool;
+}
+
+void
+arv_dom_string_pool_unref (ArvDomStringPool *pool)
+{
+	g_return_if_fail (pool != NULL);
+
+	if (g_atomic_int_dec_and_test (&pool->ref_count)) {
+		g_hash_table_unref (pool->strings);
+		g_string_chunk_free (pool->chunk);
+		g_free (pool);
+	}
+}
+
+/*
+ * arv_dom_string_pool_intern:
+ * @pool: a #ArvDomStringPool
+ * @string: a string
+ * @length: length of @string, or -1 if NUL terminated
+ *
+ * Stores a unique copy of @string in @pool. Pool strings are packed in large blocks, which avoids one allocation per
+ * string, and identical strings share the same storage, which is very common in GenICam documents (enumeration entry
+ * names, register lengths, access modes, endianness...). The returned string is valid as long as a reference to
+ * @pool is held, it must not be modified or freed.
+ *
+ * Returns: (transfer none): the interned string.
+ */
+
+const char *
+arv_dom_string_pool_intern (ArvDomStringPool *pool, const char *string, gssize length)
+{
+	char buffer[ARV_DOM_DOCUMENT_INTERN_BUFFER_SIZE];
+	char *heap_buffer = NULL;
+	const char *interned;
+
+	g_return_val_if_fail (pool != NULL, NULL);
+	g_return_val_if_fail (string != NULL, NULL);
+
+	if (length >= 0) {
+		/* Lookup and insertion need a NUL terminated string */
+		if (length < ARV_DOM_DOCUMENT_INTERN_BUFFER_SIZE) {
+			memcpy (buffer, string, length);
+			buffer[length] = '\0';
+			string = buffer;
+		} else
+			string = heap_buffer = g_strndup (string, length);
+	}
+
+	interned = g_hash_table_lookup (pool->strings, string);
+	if (interned == NULL) {
+		char *copy;
+
+		copy = g_string_chunk_insert (pool->chunk, string);
+		g_hash_table_add (pool->strings, copy);
+
+		interned = copy;
+	}
+
+	g_free (heap_buffer);
+
+	return interned;
+}
+
+/*
+ * arv_dom_document_get_string_pool:
+ * @self: a #ArvDomDocument
+ *
+ * Nodes keeping pointers to interned strings must hold a reference to the returned pool, as they may outlive @self
+ * or be moved to another document.
+ *
+ * Returns: (transfer none): the string pool of @self.
+ */
+
+ArvDomStringPool *
+arv_dom_document_get_string_pool (ArvDomDocument *self)
+{
+	ArvDomDocumentPrivate *priv = arv_dom_document_get_instance_private (ARV_DOM_DOCUMENT (self));
+
+	g_return_val_if_fail (ARV_IS_DOM_DOCUMENT (self), NULL);
+
+	if (priv->string_pool == NULL)
+		priv->string_pool = arv_dom_string_pool_new ();
+
+	return priv->string_pool;
+}
+
+/*
+ * arv_dom_document_intern_string_len:
+ * @self: a #ArvDomDocument
+ * @string: a string
+ * @length: length of @string, or -1 if NUL terminated
+ *
+ * Interns @string in the string pool of @self. The returned string is only guaranteed to be valid until @self is
+ * finalized.
+ *
+ * Returns: (transfer none): the interned string.
+ */
+
+const char *
+arv_dom_document_intern_string_len (ArvDomDocument *self, const char *string, gssize length)
+{
+	g_return_val_if_fail (ARV_IS_DOM_DOCUMENT (self), NULL);
+
+	return arv_dom_string_pool_intern (arv_dom_document_get_string_pool (self), string, length);
+}
+
+/*
+ * arv_dom_document_create_interned_text_node:
+ * @self: a #ArvDomDocument
+ * @data: text content
+ * @length: length of @data, or -1 if NUL terminated
+ *
+ * Same as arv_dom_document_create_text_node(), but the node content is stored in the document string pool. This is
+ * used by the parser, as most of the text nodes of a document are never modified.
+ *
+ * Returns: (transfer full): a new orphan #ArvDomText.
+ */
+
+ArvDomText *
+arv_dom_document_create_interned_text_node (ArvDomDocument *self, const char *data, gssize length)
+{
+	ArvDomStringPool *pool;
+	ArvDomText *text;
+
+	g_return_val_if_fail (ARV_IS_DOM_DOCUMENT (self), NULL);
+
+	if (ARV_DOM_DOCUMENT_GET_CLASS (self)->create_text_node != arv_dom_document_create_text_node_base) {
+		char *copy = length < 0 ? g_strdup (data) : g_strndup (data, length);
+
+		text = arv_dom_document_create_text_node (self, copy);
+		g_free (copy);
+
+		return text;
+	}
+
+	pool = arv_dom_document_get_string_pool (self);
+	text = ARV_DOM_TEXT (g_object_new (ARV_TYPE_DOM_TEXT, NULL));
+	arv_dom_character_data_set_interned_data (ARV_DOM_CHARACTER_DATA (text), pool,
+						  arv_dom_string_pool_intern (pool, data, length));
+
+	return text;
+}
+
 const char *
 arv_dom_document_get_url (ArvDomDocument *self)
 {
@@ -220,6 +395,9 @@ arv_dom_document_finalize (GObject *self)
 
 	g_free (priv->url);
 
+	/* Nodes using interned strings hold their own reference to the pool */
+	g_clear_pointer (&priv->string_pool, arv_dom_string_pool_unref);
+
 	G_OBJECT_CLASS (arv_dom_document_parent_class)->finalize (self);
 }
 
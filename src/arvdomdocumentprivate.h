@@ -0,0 +1,44 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_DOM_DOCUMENT_PRIVATE_H
+#define ARV_DOM_DOCUMENT_PRIVATE_H
+
+#include <arvdomdocument.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ArvDomStringPool ArvDomStringPool;
+
+ArvDomStringPool *	arv_dom_string_pool_ref		(ArvDomStringPool *pool);
+void			arv_dom_string_pool_unref	(ArvDomStringPool *pool);
+const char *		arv_dom_string_pool_intern	(ArvDomStringPool *pool, const char *string, gssize length);
+
+ArvDomStringPool *	arv_dom_document_get_string_pool		(ArvDomDocument *self);
+const char *		arv_dom_document_intern_string_len		(ArvDomDocument *self, const char *string,
+									 gssize length);
+ArvDomText *		arv_dom_document_create_interned_text_node	(ArvDomDocument *self, const char *data,
+									 gssize length);
+
+G_END_DECLS
+
+#endif
@@ -25,7 +25,8 @@
 #include <arvdomimplementation.h>
 #include <arvdomnode.h>
 #include <arvdomelement.h>
-#include <arvdomparser.h>
+#include <arvdomdocumentprivate.h>
+#include <arvdomparserprivate.h>
 #include <arvstr.h>
 #include <libxml/parser.h>
 #include <gio/gio.h>
@@ -145,17 +146,52 @@ arv_dom_parser_characters (void *user_data, const xmlChar *ch, int len)
 
 	if (!state->is_error) {
 		ArvDomNode *node;
-		char *text;
 
-		text = g_strndup ((char *) ch, len);
-		node = ARV_DOM_NODE (arv_dom_document_create_text_node (ARV_DOM_DOCUMENT (state->document), text));
+		node = ARV_DOM_NODE (arv_dom_document_create_interned_text_node (ARV_DOM_DOCUMENT (state->document),
+										 (const char *) ch, len));
 
 		arv_dom_node_append_child (state->current_node, node);
-
-		g_free (text);
 	}
 }
 
+/* Entities declared in the internal subset of the document type definition. They are stored as predefined entities,
+ * in order to have their content reported by the characters callback. */
+
+static void
+arv_dom_parser_declare_entity (void *user_data, const xmlChar *name, int type,
+			       const xmlChar *public_id, const xmlChar *system_id, xmlChar *content)
+{
+	ArvDomSaxParserState *state = user_data;
+	xmlEntity *entity;
+
+	if (content == NULL)
+		return;
+
+	entity = g_new0 (xmlEntity, 1);
+	entity->type = XML_ENTITY_DECL;
+	entity->name = xmlStrdup (name);
+	entity->ExternalID = xmlStrdup (public_id);
+	entity->SystemID = xmlStrdup (system_id);
+	entity->content = xmlStrdup (content);
+	entity->length = xmlStrlen (content);
+	entity->etype = XML_INTERNAL_PREDEFINED_ENTITY;
+
+	g_hash_table_replace (state->entities, (char *) entity->name, entity);
+}
+
+static xmlEntity *
+arv_dom_parser_get_entity (void *user_data, const xmlChar *name)
+{
+	ArvDomSaxParserState *state = user_data;
+	xmlEntity *entity;
+
+	entity = g_hash_table_lookup (state->entities, name);
+	if (entity != NULL)
+		return entity;
+
+	return xmlGetPredefinedEntity (name);
+}
+
 static void arv_dom_parser_warning (void *user_data, const char *msg, ...) G_GNUC_PRINTF(2,3);
 static void arv_dom_parser_error (void *user_data, const char *msg, ...) G_GNUC_PRINTF(2,3);
 static void arv_dom_parser_fatal_error (void *user_data, const char *msg, ...) G_GNUC_PRINTF(2,3);
@@ -207,7 +243,9 @@ static xmlSAXHandler sax_handler = {
 	.endDocument = arv_dom_parser_end_document,
 	.startElement = arv_dom_parser_start_element,
 	.endElement = arv_dom_parser_end_element,
-	.characters = arv_dom_parser_characters
+	.characters = arv_dom_parser_characters,
+	.entityDecl = arv_dom_parser_declare_entity,
+	.getEntity = arv_dom_parser_get_entity
 };
 
 static GQuark
@@ -227,7 +265,7 @@ static ArvDomDocument *
 _parse_memory (ArvDomDocument *document, ArvDomNode *node,
 	       const void *buffer, int size, GError **error)
 {
-	static ArvDomSaxParserState state;
+	ArvDomSaxParserState state = {0};
         xmlParserCtxt *xml_parser_ctxt;
 
 	state.document = document;
@@ -272,7 +310,7 @@ static ArvDomDocument *
 _parse_memory (ArvDomDocument *document, ArvDomNode *node,
 	       const void *buffer, int size, GError **error)
 {
-	static ArvDomSaxParserState state;
+	ArvDomSaxParserState state = {0};
 
 	state.document = document;
 	if (node != NULL)
@@ -300,6 +338,120 @@ _parse_memory (ArvDomDocument *document, ArvDomNode *node,
 }
 #endif
 
+struct _ArvDomParserContext {
+	ArvDomSaxParserState state;
+	xmlParserCtxt *xml_parser_ctxt;
+	gboolean is_error;
+};
+
+/**
+ * arv_dom_parser_context_new:
+ *
+ * Creates a new incremental parser, which builds a document from a sequence of xml data chunks. It allows to
+ * parse a document while the remaining data are still being downloaded or decompressed.
+ *
+ * Returns: (transfer full): a new parser context, NULL on error
+ */
+
+ArvDomParserContext *
+arv_dom_parser_context_new (void)
+{
+	ArvDomParserContext *context;
+
+	context = g_new0 (ArvDomParserContext, 1);
+
+	context->xml_parser_ctxt = xmlCreatePushParserCtxt (&sax_handler, &context->state, NULL, 0, NULL);
+	if (context->xml_parser_ctxt == NULL) {
+		arv_warning_dom ("[DomParser::context_new] Failed to create parser context");
+		g_free (context);
+		return NULL;
+	}
+
+	return context;
+}
+
+/**
+ * arv_dom_parser_context_push:
+ * @context: a parser context
+ * @buffer: a chunk of xml data
+ * @size: size of the chunk, in bytes
+ *
+ * Returns: %FALSE if the data parsed so far are not well formed.
+ */
+
+gboolean
+arv_dom_parser_context_push (ArvDomParserContext *context, const void *buffer, size_t size)
+{
+	g_return_val_if_fail (context != NULL, FALSE);
+
+	if (context->is_error)
+		return FALSE;
+
+	while (size > 0) {
+		int chunk_size = MIN (size, G_MAXINT);
+
+		if (xmlParseChunk (context->xml_parser_ctxt, buffer, chunk_size, 0) != 0) {
+			context->is_error = TRUE;
+			return FALSE;
+		}
+
+		size -= chunk_size;
+		buffer = ((const char *) buffer) + chunk_size;
+	}
+
+	return TRUE;
+}
+
+/**
+ * arv_dom_parser_context_finish:
+ * @context: (transfer full): a parser context
+ * @error: an error placeholder
+ *
+ * Terminates the parsing and frees @context.
+ *
+ * Returns: (transfer full): the parsed document, NULL on error.
+ */
+
+ArvDomDocument *
+arv_dom_parser_context_finish (ArvDomParserContext *context, GError **error)
+{
+	ArvDomDocument *document;
+
+	g_return_val_if_fail (context != NULL, NULL);
+
+	if (!context->is_error)
+		xmlParseChunk (context->xml_parser_ctxt, NULL, 0, 1);
+
+	if (context->is_error || !context->xml_parser_ctxt->wellFormed) {
+		g_clear_object (&context->state.document);
+
+		arv_warning_dom ("[DomParser::context_finish] Invalid document");
+
+		g_set_error (error,
+			     ARV_DOM_DOCUMENT_ERROR,
+			     ARV_DOM_DOCUMENT_ERROR_INVALID_XML,
+			     "Invalid document");
+	}
+
+	document = context->state.document;
+	context->state.document = NULL;
+
+	arv_dom_parser_context_free (context);
+
+	return document;
+}
+
+void
+arv_dom_parser_context_free (ArvDomParserContext *context)
+{
+	if (context == NULL)
+		return;
+
+	g_clear_object (&context->state.document);
+	xmlFreeParserCtxt (context->xml_parser_ctxt);
+	g_free (context);
+}
+
 /**
  * arv_dom_document_append_from_memory:
  * @document: a #ArvDomDocument
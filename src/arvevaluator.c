@@ -25,7 +25,7 @@
  * @short_description: A math expression evaluator with Genicam syntax
  */
 
-#include <arvevaluator.h>
+#include <arvevaluatorprivate.h>
 #include <arvdebugprivate.h>
 #include <arvmiscprivate.h>
 #include <arvstr.h>
@@ -52,11 +52,17 @@ typedef enum {
 	ARV_EVALUATOR_STATUS_FORBIDDEN_RECUSRION
 } ArvEvaluatorStatus;
 
+typedef struct _ArvEvaluatorProgram ArvEvaluatorProgram;
+
 typedef struct {
 	char *expression;
 	GSList *rpn_stack;
 	ArvEvaluatorStatus parsing_status;
-	GHashTable *variables;
+	ArvEvaluatorProgram *int64_program;
+	ArvEvaluatorProgram *double_program;
+	GHashTable *variables;		/* name -> slot index */
+	GPtrArray *variable_names;
+	GArray *variable_values;	/* ArvValue, G_TYPE_INVALID if not set */
 	GHashTable *sub_expressions;
 	GHashTable *constants;
 } ArvEvaluatorPrivate;
@@ -221,6 +227,24 @@ typedef struct {
 	ArvValue value;
 } ArvEvaluatorValuesStackItem;
 
+/* The RPN token list is compiled to a flat instruction array, one per evaluation mode, as constant folding
+ * depends on integer/double semantics. Variables are referenced by their slot index in the variable value
+ * array, and constants are stored as ready to push #ArvValue. */
+
+typedef struct {
+	ArvEvaluatorTokenId	token_id;
+	gint32 parenthesis_level;
+	union {
+		ArvValue	value;
+		guint		slot;
+	} data;
+} ArvEvaluatorInstruction;
+
+struct _ArvEvaluatorProgram {
+	ArvEvaluatorInstruction *instructions;
+	guint n_instructions;
+};
+
 static ArvEvaluatorToken *
 arv_evaluator_token_new (ArvEvaluatorTokenId token_id)
 {
@@ -269,35 +293,40 @@ arv_evaluator_token_free (ArvEvaluatorToken *token)
 }
 
 static void
-arv_evaluator_token_debug (ArvEvaluatorToken *token, GHashTable *variables)
+arv_evaluator_instruction_debug (const ArvEvaluatorInstruction *instruction, GPtrArray *variable_names, ArvValue *variables)
 {
 	ArvValue *value;
+	const char *name;
 
-	g_return_if_fail (token != NULL);
+	g_return_if_fail (instruction != NULL);
 
-	switch (token->token_id) {
+	switch (instruction->token_id) {
 		case ARV_EVALUATOR_TOKEN_VARIABLE:
-			value = g_hash_table_lookup (variables, token->data.name);
-                        if (value != NULL && arv_value_holds_double (value))
+			value = &variables[instruction->data.slot];
+			name = g_ptr_array_index (variable_names, instruction->data.slot);
+                        if (arv_value_holds_double (value))
                                 arv_debug_evaluator ("(var) %s = %g (double)",
-                                                     token->data.name,
+                                                     name,
                                                      arv_value_get_double (value));
-                        else if (value != NULL && arv_value_holds_int64 (value))
+                        else if (arv_value_holds_int64 (value))
                                 arv_debug_evaluator ("(var) %s = 0x%016" G_GINT64_MODIFIER "x %" G_GINT64_FORMAT" (int64)",
-                                                     token->data.name,
+                                                     name,
                                                      arv_value_get_int64 (value),
                                                      arv_value_get_int64 (value));
                         else
-                                arv_debug_evaluator ("(var) %s not found", token->data.name);
+                                arv_debug_evaluator ("(var) %s not found", name);
                         break;
                 case ARV_EVALUATOR_TOKEN_CONSTANT_INT64:
-                        arv_debug_evaluator ("(int64) %" G_GINT64_FORMAT, token->data.v_int64);
-                        break;
                 case ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE:
-                        arv_debug_evaluator ("(double) %g", token->data.v_double);
+                        if (arv_value_holds_int64 ((ArvValue *) &instruction->data.value))
+                                arv_debug_evaluator ("(int64) %" G_GINT64_FORMAT,
+                                                     arv_value_get_int64 ((ArvValue *) &instruction->data.value));
+                        else
+                                arv_debug_evaluator ("(double) %g",
+                                                     arv_value_get_double ((ArvValue *) &instruction->data.value));
                         break;
                 default:
-                        arv_debug_evaluator ("(operator) %s", arv_evaluator_token_infos[token->token_id].tag);
+                        arv_debug_evaluator ("(operator) %s", arv_evaluator_token_infos[instruction->token_id].tag);
         }
 }
 
@@ -554,414 +583,401 @@ get_arguments_count(ArvEvaluatorValuesStackItem * stack, int current_index)
 }
 
 static ArvEvaluatorStatus
-evaluate (GSList *token_stack, GHashTable *variables, gint64 *v_int64, double *v_double)
+execute_instruction (const ArvEvaluatorInstruction *instruction, ArvEvaluatorValuesStackItem *stack, int *index_ptr,
+		     ArvValue *variables, gboolean integer_mode)
 {
-	ArvEvaluatorToken *token;
-	ArvEvaluatorStatus status;
-	GSList *iter;
-	ArvEvaluatorValuesStackItem stack[ARV_EVALUATOR_STACK_SIZE];
 	ArvValue *value;
-	int index = -1;
-	gboolean integer_mode;
-
-	g_assert (v_int64 != NULL || v_double != NULL);
-
-	integer_mode = v_int64 != NULL;
-
-	for (iter = token_stack; iter != NULL; iter = iter->next) {
-		int actual_arguments_count;
-
-		token = iter->data;
-
-		if (index < (arv_evaluator_token_infos[token->token_id].n_args - 1)) {
-			status = ARV_EVALUATOR_STATUS_MISSING_ARGUMENTS;
-			goto CLEANUP;
-		}
-
-		if (arv_evaluator_token_infos[token->token_id].double_only && integer_mode) {
-			status = ARV_EVALUATOR_STATUS_INVALID_DOUBLE_FUNCTION;
-			goto CLEANUP;
-		}
-
-		if (index >= ARV_EVALUATOR_STACK_SIZE - 1) {
-			status = ARV_EVALUATOR_STATUS_STACK_OVERFLOW;
-			goto CLEANUP;
-		}
-
-		arv_evaluator_token_debug (token, variables);
-
-		actual_arguments_count = arv_evaluator_token_infos[token->token_id].n_args;
-
-		switch (token->token_id) {
-			case ARV_EVALUATOR_TOKEN_LOGICAL_AND:
+	int index = *index_ptr;
+	int actual_arguments_count;
+
+	if (index < (arv_evaluator_token_infos[instruction->token_id].n_args - 1))
+		return ARV_EVALUATOR_STATUS_MISSING_ARGUMENTS;
+
+	if (arv_evaluator_token_infos[instruction->token_id].double_only && integer_mode)
+		return ARV_EVALUATOR_STATUS_INVALID_DOUBLE_FUNCTION;
+
+	if (index >= ARV_EVALUATOR_STACK_SIZE - 1)
+		return ARV_EVALUATOR_STATUS_STACK_OVERFLOW;
+
+	actual_arguments_count = arv_evaluator_token_infos[instruction->token_id].n_args;
+
+	switch (instruction->token_id) {
+		case ARV_EVALUATOR_TOKEN_LOGICAL_AND:
+			arv_value_set_int64 (&stack[index-1].value,
+					      arv_value_get_int64 (&stack[index-1].value) &&
+					      arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_LOGICAL_OR:
+			arv_value_set_int64 (&stack[index-1].value,
+					      arv_value_get_int64 (&stack[index-1].value) ||
+					      arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_BITWISE_NOT:
+			arv_value_set_int64 (&stack[index].value,
+					      ~arv_value_get_int64 (&stack[index].value));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_BITWISE_AND:
+			arv_value_set_int64 (&stack[index-1].value,
+					      arv_value_get_int64 (&stack[index-1].value) &
+					      arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_BITWISE_OR:
+			arv_value_set_int64 (&stack[index-1].value,
+					      arv_value_get_int64 (&stack[index-1].value) |
+					      arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_BITWISE_XOR:
+			arv_value_set_int64 (&stack[index-1].value,
+					      arv_value_get_int64 (&stack[index-1].value) ^
+					      arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_EQUAL:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						      arv_value_get_int64 (&stack[index-1].value) &&
-						      arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_LOGICAL_OR:
+						     arv_value_get_int64 (&stack[index-1].value) ==
+						     arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_int64 (&stack[index - 1].value,
+						     arv_value_get_double (&stack[index-1].value) ==
+						     arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_NOT_EQUAL:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						      arv_value_get_int64 (&stack[index-1].value) ||
-						      arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_BITWISE_NOT:
-				arv_value_set_int64 (&stack[index].value,
-						      ~arv_value_get_int64 (&stack[index].value));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_BITWISE_AND:
+						     arv_value_get_int64 (&stack[index-1].value) !=
+						     arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_int64 (&stack[index - 1].value,
+						     arv_value_get_double (&stack[index-1].value) !=
+						     arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_LESS_OR_EQUAL:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						      arv_value_get_int64 (&stack[index-1].value) &
-						      arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_BITWISE_OR:
+						     arv_value_get_int64 (&stack[index-1].value) <=
+						     arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_int64 (&stack[index - 1].value,
+						     arv_value_get_double (&stack[index-1].value) <=
+						     arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_GREATER_OR_EQUAL:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						      arv_value_get_int64 (&stack[index-1].value) |
-						      arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_BITWISE_XOR:
+						     arv_value_get_int64 (&stack[index-1].value) >=
+						     arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_int64 (&stack[index - 1].value,
+						     arv_value_get_double (&stack[index-1].value) >=
+						     arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_LESS:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						      arv_value_get_int64 (&stack[index-1].value) ^
-						      arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_EQUAL:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) ==
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_int64 (&stack[index - 1].value,
-							     arv_value_get_double (&stack[index-1].value) ==
-							     arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_NOT_EQUAL:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) !=
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_int64 (&stack[index - 1].value,
-							     arv_value_get_double (&stack[index-1].value) !=
-							     arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_LESS_OR_EQUAL:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) <=
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_int64 (&stack[index - 1].value,
-							     arv_value_get_double (&stack[index-1].value) <=
-							     arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_GREATER_OR_EQUAL:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) >=
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_int64 (&stack[index - 1].value,
-							     arv_value_get_double (&stack[index-1].value) >=
-							     arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_LESS:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) <
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_int64 (&stack[index - 1].value,
-							     arv_value_get_double (&stack[index-1].value) <
-							     arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_GREATER:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) >
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_int64 (&stack[index - 1].value,
-							     arv_value_get_double (&stack[index-1].value) >
-							     arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_SHIFT_RIGHT:
+						     arv_value_get_int64 (&stack[index-1].value) <
+						     arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_int64 (&stack[index - 1].value,
+						     arv_value_get_double (&stack[index-1].value) <
+						     arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_GREATER:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						     arv_value_get_int64 (&stack[index-1].value) >>
+						     arv_value_get_int64 (&stack[index-1].value) >
 						     arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_SHIFT_LEFT:
+			else
+				arv_value_set_int64 (&stack[index - 1].value,
+						     arv_value_get_double (&stack[index-1].value) >
+						     arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_SHIFT_RIGHT:
+			arv_value_set_int64 (&stack[index-1].value,
+					     arv_value_get_int64 (&stack[index-1].value) >>
+					     arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_SHIFT_LEFT:
+			arv_value_set_int64 (&stack[index-1].value,
+					     arv_value_get_int64 (&stack[index-1].value) <<
+					     arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_SUBSTRACTION:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						     arv_value_get_int64 (&stack[index-1].value) <<
+						     arv_value_get_int64 (&stack[index-1].value) -
 						     arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_SUBSTRACTION:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) -
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_double (&stack[index-1].value,
-							      arv_value_get_double (&stack[index-1].value) -
-							      arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_ADDITION:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) +
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_double (&stack[index-1].value,
-							      arv_value_get_double (&stack[index-1].value) +
-							      arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_REMAINDER:
-				if (arv_value_get_int64 (&stack[index].value) == 0) {
-					status = ARV_EVALUATOR_STATUS_DIVISION_BY_ZERO;
-					goto CLEANUP;
-				}
+			else
+				arv_value_set_double (&stack[index-1].value,
+						      arv_value_get_double (&stack[index-1].value) -
+						      arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_ADDITION:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
 				arv_value_set_int64 (&stack[index-1].value,
-						     arv_value_get_int64 (&stack[index-1].value) %
+						     arv_value_get_int64 (&stack[index-1].value) +
 						     arv_value_get_int64 (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_DIVISION:
-				if (integer_mode) {
-					if (arv_value_get_int64 (&stack[index].value) == 0) {
-						status = ARV_EVALUATOR_STATUS_DIVISION_BY_ZERO;
-						goto CLEANUP;
-					}
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) /
-							     arv_value_get_int64 (&stack[index].value));
-				} else {
-					if (arv_value_get_double (&stack[index].value) == 0.0) {
-						status = ARV_EVALUATOR_STATUS_DIVISION_BY_ZERO;
-						goto CLEANUP;
-					}
-					arv_value_set_double (&stack[index-1].value,
-							      arv_value_get_double (&stack[index-1].value) /
-							      arv_value_get_double (&stack[index].value));
-				}
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_MULTIPLICATION:
-				if (integer_mode ||
-				    (arv_value_holds_int64 (&stack[index-1].value) &&
-				     arv_value_holds_int64 (&stack[index].value)))
-					arv_value_set_int64 (&stack[index-1].value,
-							     arv_value_get_int64 (&stack[index-1].value) *
-							     arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_double (&stack[index-1].value,
-							      arv_value_get_double (&stack[index-1].value) *
-							      arv_value_get_double (&stack[index].value));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_POWER:
-				if (integer_mode)
-					arv_value_set_int64 (&stack[index-1].value,
-							     pow (arv_value_get_int64(&stack[index-1].value),
-								  arv_value_get_int64(&stack[index].value)));
-				else
-					arv_value_set_double (&stack[index-1].value,
-							      pow (arv_value_get_double(&stack[index-1].value),
-								   arv_value_get_double(&stack[index].value)));
-				stack[index-1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_MINUS:
-				if (integer_mode || arv_value_holds_int64 (&stack[index].value))
-					arv_value_set_int64 (&stack[index].value,
-							     -arv_value_get_int64 (&stack[index].value));
-				else
-					arv_value_set_double (&stack[index].value,
-							      -arv_value_get_double (&stack[index].value));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_PLUS:
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_SIN:
-				arv_value_set_double (&stack[index].value, sin (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_COS:
-				arv_value_set_double (&stack[index].value, cos (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_SGN:
-				if (integer_mode || arv_value_holds_int64 (&stack[index].value)) {
-					gint64 int_value = arv_value_get_int64 (&stack[index].value);
-					if (int_value < 0)
-						arv_value_set_int64 (&stack[index].value, -1);
-					else if (int_value > 0)
-						arv_value_set_int64 (&stack[index].value, 1);
-					else
-						arv_value_set_int64 (&stack[index].value, 0);
-				} else {
-					double dbl_value = arv_value_get_double (&stack[index].value);
-					if (dbl_value < 0.0)
-						arv_value_set_int64 (&stack[index].value, -1);
-					else if (dbl_value > 0.0)
-						arv_value_set_int64 (&stack[index].value, 1);
-					else
-						arv_value_set_int64 (&stack[index].value, 0);
-				}
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_NEG:
-				if (integer_mode || arv_value_holds_int64 (&stack[index].value))
-					arv_value_set_int64 (&stack[index].value,
-							     -arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_double (&stack[index-1].value,
+						      arv_value_get_double (&stack[index-1].value) +
+						      arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_REMAINDER:
+			if (arv_value_get_int64 (&stack[index].value) == 0)
+				return ARV_EVALUATOR_STATUS_DIVISION_BY_ZERO;
+			arv_value_set_int64 (&stack[index-1].value,
+					     arv_value_get_int64 (&stack[index-1].value) %
+					     arv_value_get_int64 (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_DIVISION:
+			if (integer_mode) {
+				if (arv_value_get_int64 (&stack[index].value) == 0)
+					return ARV_EVALUATOR_STATUS_DIVISION_BY_ZERO;
+				arv_value_set_int64 (&stack[index-1].value,
+						     arv_value_get_int64 (&stack[index-1].value) /
+						     arv_value_get_int64 (&stack[index].value));
+			} else {
+				if (arv_value_get_double (&stack[index].value) == 0.0)
+					return ARV_EVALUATOR_STATUS_DIVISION_BY_ZERO;
+				arv_value_set_double (&stack[index-1].value,
+						      arv_value_get_double (&stack[index-1].value) /
+						      arv_value_get_double (&stack[index].value));
+			}
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_MULTIPLICATION:
+			if (integer_mode ||
+			    (arv_value_holds_int64 (&stack[index-1].value) &&
+			     arv_value_holds_int64 (&stack[index].value)))
+				arv_value_set_int64 (&stack[index-1].value,
+						     arv_value_get_int64 (&stack[index-1].value) *
+						     arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_double (&stack[index-1].value,
+						      arv_value_get_double (&stack[index-1].value) *
+						      arv_value_get_double (&stack[index].value));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_POWER:
+			if (integer_mode)
+				arv_value_set_int64 (&stack[index-1].value,
+						     pow (arv_value_get_int64(&stack[index-1].value),
+							  arv_value_get_int64(&stack[index].value)));
+			else
+				arv_value_set_double (&stack[index-1].value,
+						      pow (arv_value_get_double(&stack[index-1].value),
+							   arv_value_get_double(&stack[index].value)));
+			stack[index-1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_MINUS:
+			if (integer_mode || arv_value_holds_int64 (&stack[index].value))
+				arv_value_set_int64 (&stack[index].value,
+						     -arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_double (&stack[index].value,
+						      -arv_value_get_double (&stack[index].value));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_PLUS:
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_SIN:
+			arv_value_set_double (&stack[index].value, sin (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_COS:
+			arv_value_set_double (&stack[index].value, cos (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_SGN:
+			if (integer_mode || arv_value_holds_int64 (&stack[index].value)) {
+				gint64 int_value = arv_value_get_int64 (&stack[index].value);
+				if (int_value < 0)
+					arv_value_set_int64 (&stack[index].value, -1);
+				else if (int_value > 0)
+					arv_value_set_int64 (&stack[index].value, 1);
 				else
-					arv_value_set_double (&stack[index].value,
-							      -arv_value_get_double (&stack[index].value));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_ATAN:
-				arv_value_set_double (&stack[index].value, atan (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_TAN:
-				arv_value_set_double (&stack[index].value, tan (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_ABS:
-				if (arv_value_holds_double (&stack[index].value))
-					arv_value_set_double (&stack[index].value,
-							      fabs (arv_value_get_double (&stack[index].value)));
+					arv_value_set_int64 (&stack[index].value, 0);
+			} else {
+				double dbl_value = arv_value_get_double (&stack[index].value);
+				if (dbl_value < 0.0)
+					arv_value_set_int64 (&stack[index].value, -1);
+				else if (dbl_value > 0.0)
+					arv_value_set_int64 (&stack[index].value, 1);
 				else
-					arv_value_set_int64 (&stack[index].value,
-							     llabs (arv_value_get_int64 (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_EXP:
-				arv_value_set_double (&stack[index].value, exp (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_LN:
-				arv_value_set_double (&stack[index].value, log (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_LG:
-				arv_value_set_double (&stack[index].value, log10 (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_SQRT:
-				arv_value_set_double (&stack[index].value, sqrt (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_TRUNC:
-				if (arv_value_get_double (&stack[index].value) > 0.0)
-					arv_value_set_double (&stack[index].value,
-							      floor (arv_value_get_double (&stack[index].value)));
+					arv_value_set_int64 (&stack[index].value, 0);
+			}
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_NEG:
+			if (integer_mode || arv_value_holds_int64 (&stack[index].value))
+				arv_value_set_int64 (&stack[index].value,
+						     -arv_value_get_int64 (&stack[index].value));
+			else
+				arv_value_set_double (&stack[index].value,
+						      -arv_value_get_double (&stack[index].value));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_ATAN:
+			arv_value_set_double (&stack[index].value, atan (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_TAN:
+			arv_value_set_double (&stack[index].value, tan (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_ABS:
+			if (arv_value_holds_double (&stack[index].value))
+				arv_value_set_double (&stack[index].value,
+						      fabs (arv_value_get_double (&stack[index].value)));
+			else
+				arv_value_set_int64 (&stack[index].value,
+						     llabs (arv_value_get_int64 (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_EXP:
+			arv_value_set_double (&stack[index].value, exp (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_LN:
+			arv_value_set_double (&stack[index].value, log (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_LG:
+			arv_value_set_double (&stack[index].value, log10 (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_SQRT:
+			arv_value_set_double (&stack[index].value, sqrt (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_TRUNC:
+			if (arv_value_get_double (&stack[index].value) > 0.0)
+				arv_value_set_double (&stack[index].value,
+						      floor (arv_value_get_double (&stack[index].value)));
+			else
+				arv_value_set_double (&stack[index].value,
+						      ceil (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_ROUND:
+			actual_arguments_count = get_arguments_count(stack, index);
+			if (actual_arguments_count==1) {
+				arv_value_set_double(&stack[index].value, round(arv_value_get_double(&stack[index].value)));
+				stack[index].parenthesis_level = instruction->parenthesis_level;
+			} else if (actual_arguments_count==2) {
+				arv_value_set_double(&stack[index - 1].value,
+									 round_with_precision(arv_value_get_double(&stack[index - 1].value),
+														  arv_value_get_int64(&stack[index].value)));
+				stack[index - 1].parenthesis_level = instruction->parenthesis_level;
+			} else {
+				if (actual_arguments_count<1)
+					return ARV_EVALUATOR_STATUS_MISSING_ARGUMENTS;
 				else
-					arv_value_set_double (&stack[index].value,
-							      ceil (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_ROUND:
-				actual_arguments_count = get_arguments_count(stack, index);
-				if (actual_arguments_count==1) {
-					arv_value_set_double(&stack[index].value, round(arv_value_get_double(&stack[index].value)));
-					stack[index].parenthesis_level = token->parenthesis_level;
-				} else if (actual_arguments_count==2) {
-					arv_value_set_double(&stack[index - 1].value,
-										 round_with_precision(arv_value_get_double(&stack[index - 1].value),
-															  arv_value_get_int64(&stack[index].value)));
-					stack[index - 1].parenthesis_level = token->parenthesis_level;
-				} else {
-					if (actual_arguments_count<1) {
-						status = ARV_EVALUATOR_STATUS_MISSING_ARGUMENTS;
-					} else {
-						status = ARV_EVALUATOR_STATUS_REMAINING_OPERANDS;
-					}
-					goto CLEANUP;
-				}
+					return ARV_EVALUATOR_STATUS_REMAINING_OPERANDS;
+			}
 
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_FLOOR:
-				arv_value_set_double (&stack[index].value, floor (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_CEIL:
-				arv_value_set_double (&stack[index].value, ceil (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_ASIN:
-				arv_value_set_double (&stack[index].value, asin (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_FUNCTION_ACOS:
-				arv_value_set_double (&stack[index].value, acos (arv_value_get_double (&stack[index].value)));
-				stack[index].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_CONSTANT_INT64:
-				arv_value_set_int64 (&stack[index+1].value, token->data.v_int64);
-				stack[index+1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE:
-				if (integer_mode)
-					arv_value_set_int64 (&stack[index+1].value, token->data.v_double);
-				else
-					arv_value_set_double (&stack[index+1].value, token->data.v_double);
-				stack[index+1].parenthesis_level = token->parenthesis_level;
-				break;
-			case ARV_EVALUATOR_TOKEN_VARIABLE:
-				value = g_hash_table_lookup (variables, token->data.name);
-				if (value != NULL) {
-					arv_value_copy (&stack[index+1].value, value);
-					stack[index+1].parenthesis_level = token->parenthesis_level;
-				} else {
-					status = ARV_EVALUATOR_STATUS_UNKNOWN_VARIABLE;
-					goto CLEANUP;
-				}
-				break;
-			case ARV_EVALUATOR_TOKEN_TERNARY_COLON:
-				break;
-			case ARV_EVALUATOR_TOKEN_TERNARY_QUESTION_MARK:
-				if (arv_value_get_int64 (&stack[index-2].value) != 0) {
-					arv_value_copy(&stack[index - 2].value, &stack[index - 1].value);
-					stack[index - 2].parenthesis_level = stack[index - 1].parenthesis_level;
-				} else {
-					arv_value_copy(&stack[index - 2].value, &stack[index].value);
-					stack[index - 2].parenthesis_level = stack[index].parenthesis_level;
-				}
-				break;
-			default:
-				status = ARV_EVALUATOR_STATUS_UNKNOWN_OPERATOR;
-				goto CLEANUP;
-				break;
-		}
-		index = index - actual_arguments_count + 1;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_FLOOR:
+			arv_value_set_double (&stack[index].value, floor (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_CEIL:
+			arv_value_set_double (&stack[index].value, ceil (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_ASIN:
+			arv_value_set_double (&stack[index].value, asin (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_FUNCTION_ACOS:
+			arv_value_set_double (&stack[index].value, acos (arv_value_get_double (&stack[index].value)));
+			stack[index].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_CONSTANT_INT64:
+		case ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE:
+			arv_value_copy (&stack[index+1].value, &instruction->data.value);
+			stack[index+1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_VARIABLE:
+			value = &variables[instruction->data.slot];
+			if (value->type == G_TYPE_INVALID)
+				return ARV_EVALUATOR_STATUS_UNKNOWN_VARIABLE;
+			arv_value_copy (&stack[index+1].value, value);
+			stack[index+1].parenthesis_level = instruction->parenthesis_level;
+			break;
+		case ARV_EVALUATOR_TOKEN_TERNARY_COLON:
+			break;
+		case ARV_EVALUATOR_TOKEN_TERNARY_QUESTION_MARK:
+			if (arv_value_get_int64 (&stack[index-2].value) != 0) {
+				arv_value_copy(&stack[index - 2].value, &stack[index - 1].value);
+				stack[index - 2].parenthesis_level = stack[index - 1].parenthesis_level;
+			} else {
+				arv_value_copy(&stack[index - 2].value, &stack[index].value);
+				stack[index - 2].parenthesis_level = stack[index].parenthesis_level;
+			}
+			break;
+		default:
+			return ARV_EVALUATOR_STATUS_UNKNOWN_OPERATOR;
+	}
+	*index_ptr = index - actual_arguments_count + 1;
+
+	return ARV_EVALUATOR_STATUS_SUCCESS;
+}
+
+static ArvEvaluatorStatus
+evaluate (ArvEvaluatorProgram *program, GPtrArray *variable_names, ArvValue *variables, gint64 *v_int64, double *v_double)
+{
+	ArvEvaluatorStatus status;
+	ArvEvaluatorValuesStackItem stack[ARV_EVALUATOR_STACK_SIZE];
+	gboolean integer_mode;
+	gboolean debug;
+	int index = -1;
+	guint i;
+
+	g_assert (v_int64 != NULL || v_double != NULL);
+
+	integer_mode = v_int64 != NULL;
+	debug = arv_debug_check (ARV_DEBUG_CATEGORY_EVALUATOR, ARV_DEBUG_LEVEL_DEBUG);
+
+	for (i = 0; i < program->n_instructions; i++) {
+		if (G_UNLIKELY (debug))
+			arv_evaluator_instruction_debug (&program->instructions[i], variable_names, variables);
+
+		status = execute_instruction (&program->instructions[i], stack, &index, variables, integer_mode);
+		if (status != ARV_EVALUATOR_STATUS_SUCCESS)
+			goto CLEANUP;
 	}
 
 	if (index != 0) {
@@ -1130,6 +1146,16 @@ CLEANUP:
 	return status;
 }
 
+static void
+arv_evaluator_program_free (ArvEvaluatorProgram *program)
+{
+	if (program == NULL)
+		return;
+
+	g_free (program->instructions);
+	g_free (program);
+}
+
 static void
 free_rpn_stack (ArvEvaluator *evaluator)
 {
@@ -1139,6 +1165,127 @@ free_rpn_stack (ArvEvaluator *evaluator)
 		arv_evaluator_token_free (iter->data);
 	g_slist_free (evaluator->priv->rpn_stack);
 	evaluator->priv->rpn_stack = NULL;
+
+	g_clear_pointer (&evaluator->priv->int64_program, arv_evaluator_program_free);
+	g_clear_pointer (&evaluator->priv->double_program, arv_evaluator_program_free);
+}
+
+static ArvEvaluatorStatus parse_expression (ArvEvaluator *evaluator);
+
+static gboolean
+arv_evaluator_instruction_is_constant (const ArvEvaluatorInstruction *instruction)
+{
+	return (instruction->token_id == ARV_EVALUATOR_TOKEN_CONSTANT_INT64 ||
+		instruction->token_id == ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE);
+}
+
+static ArvEvaluatorProgram *
+compile_program (ArvEvaluator *evaluator, gboolean integer_mode)
+{
+	ArvEvaluatorProgram *program;
+	GSList *iter;
+	guint n_instructions = 0;
+	guint n_folded = 0;
+
+	program = g_new0 (ArvEvaluatorProgram, 1);
+	program->instructions = g_new0 (ArvEvaluatorInstruction, g_slist_length (evaluator->priv->rpn_stack));
+
+	for (iter = evaluator->priv->rpn_stack; iter != NULL; iter = iter->next) {
+		ArvEvaluatorToken *token = iter->data;
+		ArvEvaluatorInstruction *instruction = &program->instructions[n_instructions];
+		int n_args;
+
+		instruction->token_id = token->token_id;
+		instruction->parenthesis_level = token->parenthesis_level;
+
+		switch (token->token_id) {
+			case ARV_EVALUATOR_TOKEN_CONSTANT_INT64:
+				arv_value_set_int64 (&instruction->data.value, token->data.v_int64);
+				break;
+			case ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE:
+				if (integer_mode) {
+					instruction->token_id = ARV_EVALUATOR_TOKEN_CONSTANT_INT64;
+					arv_value_set_int64 (&instruction->data.value, token->data.v_double);
+				} else
+					arv_value_set_double (&instruction->data.value, token->data.v_double);
+				break;
+			case ARV_EVALUATOR_TOKEN_VARIABLE:
+				instruction->data.slot = arv_evaluator_get_variable_slot (evaluator, token->data.name);
+				break;
+			default:
+				/* Constant folding: an operator whose operands are all constants is evaluated once,
+				 * here. Round is excluded, as its argument count depends on the whole stack. If the
+				 * evaluation fails, the instruction is kept in order to report the error at evaluation
+				 * time. */
+				n_args = arv_evaluator_token_infos[token->token_id].n_args;
+				if (n_args > 0 && n_args <= 3 && n_instructions >= (guint) n_args &&
+				    token->token_id != ARV_EVALUATOR_TOKEN_FUNCTION_ROUND) {
+					ArvEvaluatorValuesStackItem stack[4];
+					ArvEvaluatorInstruction *operands = instruction - n_args;
+					gboolean foldable = TRUE;
+					int index = n_args - 1;
+					int i;
+
+					for (i = 0; i < n_args && foldable; i++) {
+						foldable = arv_evaluator_instruction_is_constant (&operands[i]);
+						stack[i].value = operands[i].data.value;
+						stack[i].parenthesis_level = operands[i].parenthesis_level;
+					}
+
+					if (foldable &&
+					    execute_instruction (instruction, stack, &index, NULL, integer_mode) ==
+					    ARV_EVALUATOR_STATUS_SUCCESS) {
+						operands[0].token_id = arv_value_holds_int64 (&stack[0].value) ?
+							ARV_EVALUATOR_TOKEN_CONSTANT_INT64 :
+							ARV_EVALUATOR_TOKEN_CONSTANT_DOUBLE;
+						operands[0].parenthesis_level = stack[0].parenthesis_level;
+						operands[0].data.value = stack[0].value;
+						n_instructions -= n_args - 1;
+						n_folded++;
+						continue;
+					}
+				}
+				break;
+		}
+
+		n_instructions++;
+	}
+
+	program->n_instructions = n_instructions;
+
+	arv_debug_evaluator ("[Evaluator::compile_program] %u instructions (%s mode, %u folded operations)",
+			     n_instructions, integer_mode ? "int64" : "double", n_folded);
+
+	return program;
+}
+
+static ArvEvaluatorStatus
+arv_evaluator_evaluate (ArvEvaluator *evaluator, gint64 *v_int64, double *v_double)
+{
+	ArvEvaluatorProgram **program;
+
+	if (evaluator->priv->parsing_status == ARV_EVALUATOR_STATUS_NOT_PARSED) {
+		evaluator->priv->parsing_status = parse_expression (evaluator);
+		arv_debug_evaluator ("[Evaluator::evaluate] Parsing status = %d",
+				     evaluator->priv->parsing_status);
+	}
+
+	if (evaluator->priv->parsing_status != ARV_EVALUATOR_STATUS_SUCCESS) {
+		if (v_int64 != NULL)
+			*v_int64 = 0;
+		if (v_double != NULL)
+			*v_double = 0.0;
+		return evaluator->priv->parsing_status;
+	}
+
+	program = v_int64 != NULL ? &evaluator->priv->int64_program : &evaluator->priv->double_program;
+	if (*program == NULL)
+		*program = compile_program (evaluator, v_int64 != NULL);
+
+	return evaluate (*program,
+			 evaluator->priv->variable_names,
+			 (ArvValue *) evaluator->priv->variable_values->data,
+			 v_int64, v_double);
 }
 
 static ArvEvaluatorStatus
@@ -1228,18 +1375,7 @@ arv_evaluator_evaluate_as_double (ArvEvaluator *evaluator, GError **error)
 	arv_debug_evaluator ("[Evaluator::evaluate_as_double] Expression = '%s'",
 			   evaluator->priv->expression);
 
-	if (evaluator->priv->parsing_status == ARV_EVALUATOR_STATUS_NOT_PARSED) {
-		evaluator->priv->parsing_status = parse_expression (evaluator);
-		arv_debug_evaluator ("[Evaluator::evaluate_as_double] Parsing status = %d",
-				   evaluator->priv->parsing_status);
-	}
-
-	if (evaluator->priv->parsing_status != ARV_EVALUATOR_STATUS_SUCCESS) {
-		arv_evaluator_set_error (error, evaluator->priv->parsing_status);
-		return 0.0;
-	}
-
-	status = evaluate (evaluator->priv->rpn_stack, evaluator->priv->variables, NULL, &value);
+	status = arv_evaluator_evaluate (evaluator, NULL, &value);
 
 	if (status != ARV_EVALUATOR_STATUS_SUCCESS) {
 		arv_evaluator_set_error (error, status);
@@ -1260,18 +1396,7 @@ arv_evaluator_evaluate_as_int64 (ArvEvaluator *evaluator, GError **error)
 	arv_debug_evaluator ("[Evaluator::evaluate_as_int64] Expression = '%s'",
 			   evaluator->priv->expression);
 
-	if (evaluator->priv->parsing_status == ARV_EVALUATOR_STATUS_NOT_PARSED) {
-		evaluator->priv->parsing_status = parse_expression (evaluator);
-		arv_debug_evaluator ("[Evaluator::evaluate_as_int64] Parsing status = %d",
-				   evaluator->priv->parsing_status);
-	}
-
-	if (evaluator->priv->parsing_status != ARV_EVALUATOR_STATUS_SUCCESS) {
-		arv_evaluator_set_error (error, evaluator->priv->parsing_status);
-		return 0.0;
-	}
-
-	status = evaluate (evaluator->priv->rpn_stack, evaluator->priv->variables, &value, NULL);
+	status = arv_evaluator_evaluate (evaluator, &value, NULL);
 
 	if (status != ARV_EVALUATOR_STATUS_SUCCESS) {
 
@@ -1423,43 +1548,95 @@ arv_evaluator_get_constant (ArvEvaluator *evaluator, const char *name)
 	return g_hash_table_lookup (evaluator->priv->constants, name);
 }
 
+/*
+ * arv_evaluator_get_variable_slot:
+ * @evaluator: a #ArvEvaluator
+ * @name: variable name
+ *
+ * Returns the index of the storage slot of the variable @name, allocating a new, unset one if needed. Slots are
+ * never released, a slot index stays valid during the whole evaluator lifetime, and can be used with
+ * arv_evaluator_set_int64_variable_by_slot() and arv_evaluator_set_double_variable_by_slot() for avoiding the name
+ * lookup.
+ */
+
+guint
+arv_evaluator_get_variable_slot (ArvEvaluator *evaluator, const char *name)
+{
+	ArvValue unset = {0};
+	gpointer slot;
+	char *key;
+
+	g_return_val_if_fail (ARV_IS_EVALUATOR (evaluator), 0);
+	g_return_val_if_fail (name != NULL, 0);
+
+	if (g_hash_table_lookup_extended (evaluator->priv->variables, name, NULL, &slot))
+		return GPOINTER_TO_UINT (slot);
+
+	key = g_strdup (name);
+	g_ptr_array_add (evaluator->priv->variable_names, key);
+	g_array_append_val (evaluator->priv->variable_values, unset);
+	g_hash_table_insert (evaluator->priv->variables, key,
+			     GUINT_TO_POINTER (evaluator->priv->variable_values->len - 1));
+
+	return evaluator->priv->variable_values->len - 1;
+}
+
 void
-arv_evaluator_set_double_variable (ArvEvaluator *evaluator, const char *name, double v_double)
+arv_evaluator_set_double_variable_by_slot (ArvEvaluator *evaluator, guint slot, double v_double)
 {
 	ArvValue *old_value;
 
 	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
-	g_return_if_fail (name != NULL);
+	g_return_if_fail (slot < evaluator->priv->variable_values->len);
 
-	old_value = g_hash_table_lookup (evaluator->priv->variables, name);
-	if (old_value != NULL && (arv_value_get_double (old_value) == v_double))
+	old_value = &g_array_index (evaluator->priv->variable_values, ArvValue, slot);
+	if (old_value->type != G_TYPE_INVALID && (arv_value_get_double (old_value) == v_double))
 		return;
 
-        g_hash_table_replace (evaluator->priv->variables,
-                              g_strdup (name),
-                              arv_value_new_double (v_double));
+	arv_value_set_double (old_value, v_double);
 
 	arv_debug_evaluator ("[Evaluator::set_double_variable] %s = %g",
-			   name, v_double);
+			     (char *) g_ptr_array_index (evaluator->priv->variable_names, slot), v_double);
 }
 
 void
-arv_evaluator_set_int64_variable (ArvEvaluator *evaluator, const char *name, gint64 v_int64)
+arv_evaluator_set_int64_variable_by_slot (ArvEvaluator *evaluator, guint slot, gint64 v_int64)
 {
 	ArvValue *old_value;
 
 	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
-	g_return_if_fail (name != NULL);
+	g_return_if_fail (slot < evaluator->priv->variable_values->len);
 
-	old_value = g_hash_table_lookup (evaluator->priv->variables, name);
-	if (old_value != NULL && (arv_value_get_int64 (old_value) == v_int64))
+	old_value = &g_array_index (evaluator->priv->variable_values, ArvValue, slot);
+	if (old_value->type != G_TYPE_INVALID && (arv_value_get_int64 (old_value) == v_int64))
 		return;
 
-        g_hash_table_replace (evaluator->priv->variables,
-                              g_strdup (name),
-                              arv_value_new_int64 (v_int64));
+	arv_value_set_int64 (old_value, v_int64);
+
+	arv_debug_evaluator ("[Evaluator::set_int64_variable] %s = %" G_GINT64_FORMAT,
+			     (char *) g_ptr_array_index (evaluator->priv->variable_names, slot), v_int64);
+}
+
+void
+arv_evaluator_set_double_variable (ArvEvaluator *evaluator, const char *name, double v_double)
+{
+	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
+	g_return_if_fail (name != NULL);
+
+	arv_evaluator_set_double_variable_by_slot (evaluator,
+						   arv_evaluator_get_variable_slot (evaluator, name),
+						   v_double);
+}
+
+void
+arv_evaluator_set_int64_variable (ArvEvaluator *evaluator, const char *name, gint64 v_int64)
+{
+	g_return_if_fail (ARV_IS_EVALUATOR (evaluator));
+	g_return_if_fail (name != NULL);
 
-	arv_debug_evaluator ("[Evaluator::set_int64_variable] %s = %" G_GINT64_FORMAT, name, v_int64);
+	arv_evaluator_set_int64_variable_by_slot (evaluator,
+						  arv_evaluator_get_variable_slot (evaluator, name),
+						  v_int64);
 }
 
 /**
@@ -1490,7 +1667,11 @@ arv_evaluator_init (ArvEvaluator *evaluator)
 
 	evaluator->priv->expression = NULL;
 	evaluator->priv->rpn_stack = NULL;
-	evaluator->priv->variables = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) arv_value_free);
+	evaluator->priv->int64_program = NULL;
+	evaluator->priv->double_program = NULL;
+	evaluator->priv->variables = g_hash_table_new (g_str_hash, g_str_equal);
+	evaluator->priv->variable_names = g_ptr_array_new_with_free_func (g_free);
+	evaluator->priv->variable_values = g_array_new (FALSE, TRUE, sizeof (ArvValue));
 	evaluator->priv->sub_expressions = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
 	evaluator->priv->constants = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
 
@@ -1505,6 +1686,8 @@ arv_evaluator_finalize (GObject *object)
 
 	arv_evaluator_set_expression (evaluator, NULL);
 	g_hash_table_unref (evaluator->priv->variables);
+	g_ptr_array_unref (evaluator->priv->variable_names);
+	g_array_unref (evaluator->priv->variable_values);
 	g_hash_table_unref (evaluator->priv->sub_expressions);
 	g_hash_table_unref (evaluator->priv->constants);
 	free_rpn_stack (evaluator);
@@ -189,18 +189,76 @@ _get_register (ArvFakeCamera *camera, guint32 address)
 	return GUINT32_FROM_BE (value);
 }
 
-size_t
-arv_fake_camera_get_payload (ArvFakeCamera *camera)
+/* Payload layout. In single part mode, the image is optionally followed by the enabled chunks, each of them being
+ * followed by its id and its size. When the range component is enabled, the payload is made of the intensity part, if
+ * enabled, followed by a 16 bit range part. Chunks are not emitted in multipart mode. To keep in sync with the
+ * PayloadSize formula of arv-fake-camera.xml. */
+
+typedef struct {
+	guint32 id;
+	guint32 size;
+} ArvFakeCameraChunkInfos;
+
+static const struct {
+	guint32 selector;
+	guint32 id;
+} arv_fake_camera_chunks[] = {
+	{ARV_FAKE_CAMERA_CHUNK_SELECTOR_TIMESTAMP,	ARV_FAKE_CAMERA_CHUNK_ID_TIMESTAMP},
+	{ARV_FAKE_CAMERA_CHUNK_SELECTOR_FRAME_ID,	ARV_FAKE_CAMERA_CHUNK_ID_FRAME_ID},
+	{ARV_FAKE_CAMERA_CHUNK_SELECTOR_EXPOSURE_TIME,	ARV_FAKE_CAMERA_CHUNK_ID_EXPOSURE_TIME}
+};
+
+static gboolean
+_is_component_enabled (ArvFakeCamera *camera, guint32 component)
 {
-        guint32 width, height, pixel_format;
+	return _get_register (camera, ARV_FAKE_CAMERA_REGISTER_COMPONENT_ENABLE + 4 * component) != 0;
+}
 
-	g_return_val_if_fail (ARV_IS_FAKE_CAMERA (camera), 0);
+static gboolean
+_is_chunk_enabled (ArvFakeCamera *camera, guint32 selector)
+{
+	return _get_register (camera, ARV_FAKE_CAMERA_REGISTER_CHUNK_ENABLE + 4 * selector) != 0;
+}
+
+static size_t
+_get_payload_layout (ArvFakeCamera *camera, size_t *image_size, size_t *range_size, size_t *chunk_size)
+{
+        guint32 width, height, pixel_format;
+	gboolean is_multipart;
+	guint i;
 
 	width = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH);
 	height = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT);
         pixel_format = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT);
 
-	return width * height * ARV_PIXEL_FORMAT_BIT_PER_PIXEL(pixel_format)/8;
+	is_multipart = _is_component_enabled (camera, ARV_FAKE_CAMERA_COMPONENT_RANGE);
+
+	if (!is_multipart || _is_component_enabled (camera, ARV_FAKE_CAMERA_COMPONENT_INTENSITY))
+		*image_size = width * height * ARV_PIXEL_FORMAT_BIT_PER_PIXEL(pixel_format)/8;
+	else
+		*image_size = 0;
+
+	*range_size = is_multipart ? width * height * sizeof (guint16) : 0;
+
+	*chunk_size = 0;
+	if (!is_multipart && _get_register (camera, ARV_FAKE_CAMERA_REGISTER_CHUNK_MODE_ACTIVE) != 0) {
+		*chunk_size = sizeof (ArvFakeCameraChunkInfos);
+		for (i = 0; i < G_N_ELEMENTS (arv_fake_camera_chunks); i++)
+			if (_is_chunk_enabled (camera, arv_fake_camera_chunks[i].selector))
+				*chunk_size += sizeof (guint64) + sizeof (ArvFakeCameraChunkInfos);
+	}
+
+	return *image_size + *range_size + *chunk_size;
+}
+
+size_t
+arv_fake_camera_get_payload (ArvFakeCamera *camera)
+{
+	size_t image_size, range_size, chunk_size;
+
+	g_return_val_if_fail (ARV_IS_FAKE_CAMERA (camera), 0);
+
+	return _get_payload_layout (camera, &image_size, &range_size, &chunk_size);
 }
 
 /**
@@ -509,209 +567,301 @@ static struct {
    {128,     0,   0},
   };
 
+/* The default test pattern is a diagonal ramp, where the value of a pixel only depends on (x + y + frame_id) modulo a
+ * period, and for the Bayer formats, on the parity of x and y. Each row is then a window of a precomputed strip,
+ * starting at an offset given by (y + frame_id). The strips are computed once per pixel format, width and scale, and
+ * the frame synthesis is reduced to a memcpy per row. */
+
+typedef struct {
+	ArvPixelFormat pixel_format;
+	guint32 width;
+	double scale;
+
+	guint period;
+	size_t pixel_size;
+	size_t strip_size;
+	guint n_strips;
+	guint8 *strips;
+} ArvFakeCameraPatternCache;
+
+static void
+arv_fake_camera_pattern_cache_free (void *data)
+{
+	ArvFakeCameraPatternCache *cache = data;
+
+	if (cache == NULL)
+		return;
+
+	g_free (cache->strips);
+	g_free (cache);
+}
+
+static guint8
+_bayer_value (ArvPixelFormat pixel_format, gboolean x_odd, gboolean y_odd, unsigned int index)
+{
+	/* Colormap component of each position of the 2x2 tile, indexed by 2 * y_odd + x_odd, 0 for red, 1 for green,
+	 * 2 for blue */
+	static const guint8 tiles[4][4] = {
+		{0, 1, 1, 2},	/* BG */
+		{1, 2, 0, 1},	/* GB */
+		{1, 0, 2, 1},	/* GR */
+		{2, 1, 1, 0}	/* RG */
+	};
+	guint tile;
+
+	switch (pixel_format) {
+		case ARV_PIXEL_FORMAT_BAYER_BG_8: tile = 0; break;
+		case ARV_PIXEL_FORMAT_BAYER_GB_8: tile = 1; break;
+		case ARV_PIXEL_FORMAT_BAYER_GR_8: tile = 2; break;
+		default: tile = 3; break;
+	}
+
+	switch (tiles[tile][2 * y_odd + x_odd]) {
+		case 0: return jet_colormap[index].r;
+		case 1: return jet_colormap[index].g;
+		default: return jet_colormap[index].b;
+	}
+}
+
+static gboolean
+arv_fake_camera_pattern_cache_update (ArvFakeCameraPatternCache *cache, ArvPixelFormat pixel_format,
+				      guint32 width, double scale)
+{
+	guint n_pixels;
+	guint strip;
+	guint i;
+
+	if (cache->strips != NULL &&
+	    cache->pixel_format == pixel_format &&
+	    cache->width == width &&
+	    cache->scale == scale)
+		return TRUE;
+
+	g_clear_pointer (&cache->strips, g_free);
+
+	switch (pixel_format) {
+		case ARV_PIXEL_FORMAT_MONO_8:
+			cache->period = 255;
+			cache->pixel_size = 1;
+			cache->n_strips = 1;
+			break;
+		case ARV_PIXEL_FORMAT_MONO_16:
+			cache->period = 65535;
+			cache->pixel_size = 2;
+			cache->n_strips = 1;
+			break;
+		case ARV_PIXEL_FORMAT_BAYER_BG_8:
+		case ARV_PIXEL_FORMAT_BAYER_GB_8:
+		case ARV_PIXEL_FORMAT_BAYER_GR_8:
+		case ARV_PIXEL_FORMAT_BAYER_RG_8:
+			/* One strip per row parity and per offset parity */
+			cache->period = 255;
+			cache->pixel_size = 1;
+			cache->n_strips = 4;
+			break;
+		case ARV_PIXEL_FORMAT_RGB_8_PACKED:
+			cache->period = 255;
+			cache->pixel_size = 3;
+			cache->n_strips = 1;
+			break;
+		default:
+			return FALSE;
+	}
+
+	cache->pixel_format = pixel_format;
+	cache->width = width;
+	cache->scale = scale;
+
+	n_pixels = width + cache->period;
+	cache->strip_size = n_pixels * cache->pixel_size;
+	cache->strips = g_malloc (cache->n_strips * cache->strip_size);
+
+	for (strip = 0; strip < cache->n_strips; strip++) {
+		guint8 *data = cache->strips + strip * cache->strip_size;
+
+		for (i = 0; i < n_pixels; i++) {
+			double pixel_value;
+			unsigned int index;
+
+			if (pixel_format == ARV_PIXEL_FORMAT_MONO_16) {
+				pixel_value = (256 * (i % cache->period)) % 65535;
+				pixel_value *= scale;
+				((guint16 *) data)[i] = CLAMP (pixel_value, 0, 65535);
+				continue;
+			}
+
+			pixel_value = i % cache->period;
+			pixel_value *= scale;
+			index = CLAMP (pixel_value, 0, 255);
+
+			switch (pixel_format) {
+				case ARV_PIXEL_FORMAT_MONO_8:
+					data[i] = index;
+					break;
+				case ARV_PIXEL_FORMAT_RGB_8_PACKED:
+					data[3 * i] = jet_colormap[index].r;
+					data[3 * i + 1] = jet_colormap[index].g;
+					data[3 * i + 2] = jet_colormap[index].b;
+					break;
+				default:
+					/* x = i - offset, hence x and i + offset have the same parity */
+					data[i] = _bayer_value (pixel_format, ((i + strip) & 1) != 0, (strip & 2) != 0,
+								index);
+					break;
+			}
+		}
+	}
+
+	return TRUE;
+}
+
 static void
 arv_fake_camera_diagonal_ramp (ArvBuffer *buffer, void *fill_pattern_data,
 			       guint32 exposure_time_us,
 			       guint32 gain,
 			       ArvPixelFormat pixel_format)
 {
-	double pixel_value;
+	ArvFakeCameraPatternCache *cache = fill_pattern_data;
 	double scale;
-	guint32 x, y;
+	guint32 y;
 	guint32 width;
 	guint32 height;
+	size_t row_size;
 
         g_return_if_fail (buffer != NULL);
-        g_return_if_fail (buffer->priv->n_parts == 1);
+        g_return_if_fail (buffer->priv->n_parts >= 1);
+        g_return_if_fail (cache != NULL);
 
 	width = buffer->priv->parts[0].width;
 	height = buffer->priv->parts[0].height;
 
 	scale = 1.0 + gain + log10 ((double) exposure_time_us / 10000.0);
 
-	switch (pixel_format)
-	{
-		case ARV_PIXEL_FORMAT_MONO_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned char *pixel = &buffer->priv->data [y * width + x];
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-
-						*pixel = CLAMP (pixel_value, 0, 255);
-					}
-				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
+	if (!arv_fake_camera_pattern_cache_update (cache, pixel_format, width, scale)) {
+		g_critical ("Unsupported pixel format");
+		return;
+	}
 
-		case ARV_PIXEL_FORMAT_MONO_16:
-			if (2 * height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned short *pixel = (unsigned short *)&buffer->priv->data [2*y * width + 2*x];
-
-						pixel_value = (256*x + 256*buffer->priv->frame_id + 256*y) % 65535;
-						pixel_value *= scale;
-
-						*pixel = CLAMP (pixel_value, 0, 65535);
-					}
-				}
-                                buffer->priv->received_size = 2 * height * width;
-			}
-			break;
+	row_size = width * cache->pixel_size;
+	if (height * row_size > buffer->priv->allocated_size)
+		return;
 
-		case ARV_PIXEL_FORMAT_BAYER_BG_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// BG
-						// GR
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].b;
-							else
-								*pixel = jet_colormap [index].g;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].r;
-						}
-					}
-				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
+	for (y = 0; y < height; y++) {
+		guint offset = (y + buffer->priv->frame_id) % cache->period;
+		guint strip = cache->n_strips > 1 ? 2 * (y & 1) + (offset & 1) : 0;
 
-		case ARV_PIXEL_FORMAT_BAYER_GB_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// GB
-						// RG
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].b;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].r;
-							else
-								*pixel = jet_colormap [index].g;
-						}
-					}
-				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
+		memcpy (&buffer->priv->data[y * row_size],
+			cache->strips + strip * cache->strip_size + offset * cache->pixel_size,
+			row_size);
+	}
 
-		case ARV_PIXEL_FORMAT_BAYER_GR_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// GR
-						// BG
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].r;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].b;
-							else
-								*pixel = jet_colormap [index].g;
-						}
-					}
-				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
+	buffer->priv->received_size = height * row_size;
+}
 
-		case ARV_PIXEL_FORMAT_BAYER_RG_8:
-			if (height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned int index;
-						unsigned char *pixel;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-						index = CLAMP (pixel_value, 0, 255);
-
-						// RG
-						// GB
-						pixel = &buffer->priv->data [y * width + x];
-						if (x & 1) {
-							if (y & 1)
-								*pixel = jet_colormap [index].r;
-							else
-								*pixel = jet_colormap [index].g;
-						} else {
-							if (y & 1)
-								*pixel = jet_colormap [index].g;
-							else
-								*pixel = jet_colormap [index].b;
-						}
-					}
-				}
-                                buffer->priv->received_size = height * width;
-			}
-			break;
+/* Static image mode: the image data is copied as is in each frame, repeated if it is smaller than the image. A binary
+ * netpbm header (P5 or P6), if present, is skipped. */
 
-		case ARV_PIXEL_FORMAT_RGB_8_PACKED:
-			if (3 * height * width <= buffer->priv->allocated_size) {
-				for (y = 0; y < height; y++) {
-					for (x = 0; x < width; x++) {
-						unsigned char *pixel = &buffer->priv->data [3 * (y * width + x)];
-						unsigned int index;
-
-						pixel_value = (x + buffer->priv->frame_id + y) % 255;
-						pixel_value *= scale;
-
-						index = CLAMP (pixel_value, 0, 255);
-
-						pixel[0] = jet_colormap [index].r;
-						pixel[1] = jet_colormap [index].g;
-						pixel[2] = jet_colormap [index].b;
-					}
-				}
-                                buffer->priv->received_size = 3 * height * width;
-			}
-			break;
+static void
+arv_fake_camera_static_image (ArvBuffer *buffer, void *fill_pattern_data,
+			      guint32 exposure_time_us,
+			      guint32 gain,
+			      ArvPixelFormat pixel_format)
+{
+	GBytes *image = fill_pattern_data;
+	const guint8 *data;
+	size_t image_size;
+	size_t size;
+	size_t offset;
 
-		default:
-			g_critical ("Unsupported pixel format");
-			break;
+        g_return_if_fail (buffer != NULL);
+        g_return_if_fail (buffer->priv->n_parts >= 1);
+
+	size = (size_t) buffer->priv->parts[0].width * buffer->priv->parts[0].height *
+		ARV_PIXEL_FORMAT_BIT_PER_PIXEL (pixel_format) / 8;
+	if (size > buffer->priv->allocated_size)
+		return;
+
+	data = g_bytes_get_data (image, &image_size);
+
+	for (offset = 0; offset < size; offset += image_size)
+		memcpy (&buffer->priv->data[offset], data, MIN (image_size, size - offset));
+
+	buffer->priv->received_size = size;
+}
+
+static size_t
+_get_netpbm_header_size (const guint8 *data, size_t size)
+{
+	size_t offset = 2;
+	guint n_fields = 0;
+
+	if (size < 2 || data[0] != 'P' || (data[1] != '5' && data[1] != '6'))
+		return 0;
+
+	/* Width, height and maximum value, separated by white spaces, with optional comments */
+	while (n_fields < 3 && offset < size) {
+		while (offset < size && (g_ascii_isspace (data[offset]) || data[offset] == '#')) {
+			if (data[offset] == '#')
+				while (offset < size && data[offset] != '\n')
+					offset++;
+			else
+				offset++;
+		}
+		if (offset < size && !g_ascii_isdigit (data[offset]))
+			return 0;
+		while (offset < size && g_ascii_isdigit (data[offset]))
+			offset++;
+		n_fields++;
 	}
+
+	/* A single white space precedes the pixel data */
+	return n_fields == 3 && offset < size ? offset + 1 : 0;
+}
+
+/**
+ * arv_fake_camera_set_static_image:
+ * @camera: a #ArvFakeCamera
+ * @filename: path to the image file
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Uses the content of @filename as the image data of each frame, instead of the default test pattern. The file is
+ * expected to contain raw pixel data matching the current pixel format, optionally preceded by a binary netpbm
+ * header (P5 or P6), and is repeated if it is smaller than the image. Use arv_fake_camera_set_fill_pattern() with a
+ * %NULL callback to restore the default pattern.
+ *
+ * Returns: %TRUE on success
+ *
+ * Since: 0.10.0
+ */
+
+gboolean
+arv_fake_camera_set_static_image (ArvFakeCamera *camera, const char *filename, GError **error)
+{
+	GBytes *image;
+	char *contents;
+	size_t header_size;
+	gsize size;
+
+	g_return_val_if_fail (ARV_IS_FAKE_CAMERA (camera), FALSE);
+	g_return_val_if_fail (filename != NULL, FALSE);
+
+	if (!g_file_get_contents (filename, &contents, &size, error))
+		return FALSE;
+
+	header_size = _get_netpbm_header_size ((guint8 *) contents, size);
+	if (header_size >= size) {
+		g_set_error (error, G_FILE_ERROR, G_FILE_ERROR_INVAL, "No image data in '%s'", filename);
+		g_free (contents);
+		return FALSE;
+	}
+
+	image = g_bytes_new_take (contents, size);
+	arv_fake_camera_set_fill_pattern (camera, arv_fake_camera_static_image,
+					  g_bytes_new_from_bytes (image, header_size, size - header_size),
+					  (GDestroyNotify) g_bytes_unref);
+	g_bytes_unref (image);
+
+	return TRUE;
 }
 
 /**
@@ -744,40 +894,127 @@ arv_fake_camera_set_fill_pattern (ArvFakeCamera *camera,
                 camera->priv->fill_pattern_destroy = destroy;
 	} else {
 		camera->priv->fill_pattern_callback = arv_fake_camera_diagonal_ramp;
-		camera->priv->fill_pattern_data = NULL;
-                camera->priv->fill_pattern_destroy = NULL;
+		camera->priv->fill_pattern_data = g_new0 (ArvFakeCameraPatternCache, 1);
+                camera->priv->fill_pattern_destroy = arv_fake_camera_pattern_cache_free;
 	}
 
 	g_mutex_unlock (&camera->priv->fill_pattern_mutex);
 }
 
+/* Range component: a diagonal ramp moving with the frame id, as little endian 16 bit values. The part may not be
+ * aligned on a 16 bit boundary. */
+
+static void
+_fill_range (guint8 *data, guint32 width, guint32 height, guint64 frame_id)
+{
+	guint32 x, y;
+
+	for (y = 0; y < height; y++) {
+		for (x = 0; x < width; x++) {
+			guint16 value = 1000 + ((x + y + frame_id) & 0x3ff);
+
+			*data++ = value & 0xff;
+			*data++ = value >> 8;
+		}
+	}
+}
+
+static size_t
+_append_chunk (ArvBuffer *buffer, size_t offset, guint32 chunk_id, const void *data, guint32 size)
+{
+	ArvFakeCameraChunkInfos infos;
+
+	/* The data of the image chunk is already in place */
+	if (data != NULL) {
+		memcpy (&buffer->priv->data[offset], data, size);
+		offset += size;
+	}
+
+	infos.id = GUINT32_TO_BE (chunk_id);
+	infos.size = GUINT32_TO_BE (size);
+	memcpy (&buffer->priv->data[offset], &infos, sizeof (infos));
+
+	return offset + sizeof (infos);
+}
+
+static void
+_fill_chunks (ArvFakeCamera *camera, ArvBuffer *buffer, size_t image_size, size_t payload,
+	      guint32 exposure_time_us)
+{
+	size_t offset;
+	guint i;
+
+	offset = _append_chunk (buffer, image_size, ARV_FAKE_CAMERA_CHUNK_ID_IMAGE, NULL, image_size);
+
+	for (i = 0; i < G_N_ELEMENTS (arv_fake_camera_chunks); i++) {
+		union {
+			double exposure_time_us;
+			guint64 value;
+		} chunk;
+
+		if (!_is_chunk_enabled (camera, arv_fake_camera_chunks[i].selector))
+			continue;
+
+		/* The chunk selection may have changed since the payload size computation */
+		if (offset + sizeof (chunk) + sizeof (ArvFakeCameraChunkInfos) > payload)
+			break;
+
+		switch (arv_fake_camera_chunks[i].selector) {
+			case ARV_FAKE_CAMERA_CHUNK_SELECTOR_TIMESTAMP:
+				chunk.value = buffer->priv->timestamp_ns;
+				break;
+			case ARV_FAKE_CAMERA_CHUNK_SELECTOR_FRAME_ID:
+				chunk.value = buffer->priv->frame_id;
+				break;
+			default:
+				chunk.exposure_time_us = exposure_time_us;
+				break;
+		}
+
+		chunk.value = GUINT64_TO_BE (chunk.value);
+		offset = _append_chunk (buffer, offset, arv_fake_camera_chunks[i].id, &chunk, sizeof (chunk));
+	}
+
+	buffer->priv->received_size = offset;
+}
+
 /**
  * arv_fake_camera_fill_buffer:
  * @camera: a #ArvFakeCamera
  * @buffer: the #ArvBuffer to fill
  * @packet_size: (out) (optional): the packet size
  *
- * Fill a buffer with data from the fake camera.
+ * Fill a buffer with data from the fake camera. Depending on the component and chunk settings, the buffer payload is
+ * a single image, an image followed by chunk data, or a multipart payload made of an intensity and a range image.
  */
 
 void
 arv_fake_camera_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *packet_size)
 {
+	ArvBufferPartInfos *part;
 	guint32 width;
 	guint32 height;
-	guint32 exposure_time_us;
+	guint32 exposure_time_us = 0;
 	guint32 gain;
 	guint32 pixel_format;
+	size_t image_size;
+	size_t range_size;
+	size_t chunk_size;
 	size_t payload;
+	gboolean is_multipart;
+	gboolean has_intensity;
 
 	if (camera == NULL || buffer == NULL)
 		return;
 
-        arv_buffer_set_n_parts(buffer, 1);
-
 	width = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_WIDTH);
 	height = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT);
-	payload = arv_fake_camera_get_payload (camera);
+	payload = _get_payload_layout (camera, &image_size, &range_size, &chunk_size);
+
+	is_multipart = _is_component_enabled (camera, ARV_FAKE_CAMERA_COMPONENT_RANGE);
+	has_intensity = !is_multipart || _is_component_enabled (camera, ARV_FAKE_CAMERA_COMPONENT_INTENSITY);
+
+        arv_buffer_set_n_parts (buffer, (has_intensity ? 1 : 0) + (is_multipart ? 1 : 0));
 
 	if (buffer->priv->allocated_size < payload) {
 		buffer->priv->status = ARV_BUFFER_STATUS_SIZE_MISMATCH;
@@ -789,35 +1026,66 @@ arv_fake_camera_fill_buffer (ArvFakeCamera *camera, ArvBuffer *buffer, guint32 *
 	if (camera->priv->frame_id == 0)
 		camera->priv->frame_id = 1;
 
-	buffer->priv->payload_type = ARV_BUFFER_PAYLOAD_TYPE_IMAGE;
+	buffer->priv->payload_type = is_multipart ? ARV_BUFFER_PAYLOAD_TYPE_MULTIPART : ARV_BUFFER_PAYLOAD_TYPE_IMAGE;
+	buffer->priv->has_chunks = chunk_size > 0;
 	buffer->priv->chunk_endianness = G_BIG_ENDIAN;
 	buffer->priv->status = ARV_BUFFER_STATUS_SUCCESS;
 	buffer->priv->timestamp_ns = g_get_real_time () * 1000;
 	buffer->priv->system_timestamp_ns = buffer->priv->timestamp_ns;
 	buffer->priv->frame_id = camera->priv->frame_id;
 
-        buffer->priv->parts[0].data_offset = 0;
-        buffer->priv->parts[0].component_id = 0;
-        buffer->priv->parts[0].data_type = ARV_BUFFER_PART_DATA_TYPE_2D_IMAGE;
-	buffer->priv->parts[0].pixel_format = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT);
-	buffer->priv->parts[0].width = width;
-	buffer->priv->parts[0].height = height;
-        buffer->priv->parts[0].x_offset = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_X_OFFSET);
-        buffer->priv->parts[0].y_offset = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_Y_OFFSET);
-        buffer->priv->parts[0].x_padding = 0;
-        buffer->priv->parts[0].y_padding = 0;
+	part = buffer->priv->parts;
+
+	if (has_intensity) {
+		part->data_offset = 0;
+		part->component_id = ARV_FAKE_CAMERA_COMPONENT_INTENSITY;
+		part->data_type = ARV_BUFFER_PART_DATA_TYPE_2D_IMAGE;
+		part->pixel_format = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT);
+		part->width = width;
+		part->height = height;
+		part->x_offset = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_X_OFFSET);
+		part->y_offset = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_Y_OFFSET);
+		part->x_padding = 0;
+		part->y_padding = 0;
+		part->size = image_size;
+		part++;
+	}
 
-	g_mutex_lock (&camera->priv->fill_pattern_mutex);
+	if (is_multipart) {
+		part->data_offset = image_size;
+		part->component_id = ARV_FAKE_CAMERA_COMPONENT_RANGE;
+		part->data_type = ARV_BUFFER_PART_DATA_TYPE_3D_IMAGE;
+		part->pixel_format = ARV_PIXEL_FORMAT_COORD3D_C_16;
+		part->width = width;
+		part->height = height;
+		part->x_offset = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_X_OFFSET);
+		part->y_offset = _get_register (camera, ARV_FAKE_CAMERA_REGISTER_Y_OFFSET);
+		part->x_padding = 0;
+		part->y_padding = 0;
+		part->size = range_size;
+	}
 
-	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_EXPOSURE_TIME_US, &exposure_time_us);
-	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_GAIN_RAW, &gain);
-	arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT, &pixel_format);
-	camera->priv->fill_pattern_callback (buffer, camera->priv->fill_pattern_data,
-					     exposure_time_us, gain, pixel_format);
+	if (has_intensity) {
+		g_mutex_lock (&camera->priv->fill_pattern_mutex);
 
-	g_mutex_unlock (&camera->priv->fill_pattern_mutex);
+		arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_EXPOSURE_TIME_US, &exposure_time_us);
+		arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_GAIN_RAW, &gain);
+		arv_fake_camera_read_register (camera, ARV_FAKE_CAMERA_REGISTER_PIXEL_FORMAT, &pixel_format);
+		camera->priv->fill_pattern_callback (buffer, camera->priv->fill_pattern_data,
+						     exposure_time_us, gain, pixel_format);
 
-        buffer->priv->parts[0].size = buffer->priv->received_size;
+		g_mutex_unlock (&camera->priv->fill_pattern_mutex);
+
+		if (!is_multipart)
+			buffer->priv->parts[0].size = buffer->priv->received_size;
+	}
+
+	if (is_multipart) {
+		_fill_range (&buffer->priv->data[image_size], width, height, buffer->priv->frame_id);
+		buffer->priv->received_size = image_size + range_size;
+	} else if (chunk_size > 0) {
+		_fill_chunks (camera, buffer, image_size, payload, exposure_time_us);
+	}
 
 	if (packet_size != NULL)
 		*packet_size =
@@ -998,7 +1266,8 @@ arv_fake_camera_new_full (const char *serial_number, const char *genicam_filenam
 
 	g_mutex_init (&fake_camera->priv->fill_pattern_mutex);
 	fake_camera->priv->fill_pattern_callback = arv_fake_camera_diagonal_ramp;
-	fake_camera->priv->fill_pattern_data = NULL;
+	fake_camera->priv->fill_pattern_data = g_new0 (ArvFakeCameraPatternCache, 1);
+	fake_camera->priv->fill_pattern_destroy = arv_fake_camera_pattern_cache_free;
 
 	if (genicam_filename != NULL)
 		filename = g_strdup (genicam_filename);
@@ -1079,10 +1348,19 @@ arv_fake_camera_new_full (const char *serial_number, const char *genicam_filenam
 	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_GAIN_RAW, 0);
 	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_GAIN_MODE, 1);
 
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_CHUNK_MODE_ACTIVE, 0);
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_COMPONENT_ENABLE +
+					4 * ARV_FAKE_CAMERA_COMPONENT_INTENSITY, 1);
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_COMPONENT_ENABLE +
+					4 * ARV_FAKE_CAMERA_COMPONENT_RANGE, 0);
+
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_HEARTBEAT_TIMEOUT_OFFSET, 3000);
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_TIMESTAMP_TICK_FREQUENCY_HIGH_OFFSET, 0);
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_TIMESTAMP_TICK_FREQUENCY_LOW_OFFSET, 1000000000);
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_CONTROL_CHANNEL_PRIVILEGE_OFFSET, 0);
+	arv_fake_camera_write_register (fake_camera, ARV_GVBS_GVCP_CAPABILITY_OFFSET,
+					ARV_GVBS_GVCP_CAPABILITY_CONCATENATION | ARV_GVBS_GVCP_CAPABILITY_WRITE_MEMORY |
+					ARV_GVBS_GVCP_CAPABILITY_PACKET_RESEND);
 
 	arv_fake_camera_write_register (fake_camera, ARV_GVBS_STREAM_CHANNEL_0_PACKET_SIZE_OFFSET, 1400);
 
@@ -86,6 +86,27 @@ ARV_API void			arv_set_fake_camera_genicam_filename (const char *filename);
 #define ARV_FAKE_CAMERA_REGISTER_GAIN_RAW		0x110
 #define ARV_FAKE_CAMERA_REGISTER_GAIN_MODE		0x114
 
+/* Chunk data control */
+
+#define ARV_FAKE_CAMERA_REGISTER_CHUNK_MODE_ACTIVE	0x400
+#define ARV_FAKE_CAMERA_REGISTER_CHUNK_ENABLE		0x404
+
+#define ARV_FAKE_CAMERA_CHUNK_SELECTOR_TIMESTAMP	0
+#define ARV_FAKE_CAMERA_CHUNK_SELECTOR_FRAME_ID		1
+#define ARV_FAKE_CAMERA_CHUNK_SELECTOR_EXPOSURE_TIME	2
+
+#define ARV_FAKE_CAMERA_CHUNK_ID_IMAGE			0xa0000001
+#define ARV_FAKE_CAMERA_CHUNK_ID_TIMESTAMP		0xa0000002
+#define ARV_FAKE_CAMERA_CHUNK_ID_FRAME_ID		0xa0000003
+#define ARV_FAKE_CAMERA_CHUNK_ID_EXPOSURE_TIME		0xa0000004
+
+/* Multipart components */
+
+#define ARV_FAKE_CAMERA_REGISTER_COMPONENT_ENABLE	0x440
+
+#define ARV_FAKE_CAMERA_COMPONENT_INTENSITY		0
+#define ARV_FAKE_CAMERA_COMPONENT_RANGE			1
+
 #define ARV_TYPE_FAKE_CAMERA             (arv_fake_camera_get_type ())
 ARV_API G_DECLARE_FINAL_TYPE (ArvFakeCamera, arv_fake_camera, ARV, FAKE_CAMERA, GObject)
 
@@ -119,6 +140,8 @@ ARV_API void			arv_fake_camera_set_fill_pattern	(ArvFakeCamera *camera,
 									 ArvFakeCameraFillPattern fill_pattern_callback,
 									 void *fill_pattern_data,
                                                                          GDestroyNotify destroy);
+ARV_API gboolean		arv_fake_camera_set_static_image	(ArvFakeCamera *camera, const char *filename,
+									 GError **error);
 ARV_API void			arv_fake_camera_set_trigger_frequency	(ArvFakeCamera *camera, double frequency);
 ARV_API gboolean		arv_fake_camera_is_in_free_running_mode (ArvFakeCamera *camera);
 ARV_API gboolean		arv_fake_camera_is_in_software_trigger_mode (ArvFakeCamera *camera);
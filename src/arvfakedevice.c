@@ -151,6 +151,8 @@ arv_fake_device_new (const char *serial_number, GError **error)
 static void
 arv_fake_device_init (ArvFakeDevice *fake_device)
 {
+	/* As for the GigE Vision fake camera, registers are stored big endian */
+	arv_device_set_register_byte_order (ARV_DEVICE (fake_device), G_BIG_ENDIAN);
 }
 
 static void
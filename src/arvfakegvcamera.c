@@ -36,7 +36,18 @@ set_cancel (int signal)
 static char *arv_option_interface_name = NULL;
 static char *arv_option_serial_number = NULL;
 static char *arv_option_genicam_file = NULL;
+static char *arv_option_image_file = NULL;
 static double arv_option_gvsp_lost_ratio = 0.0;
+static double arv_option_gvsp_burst_ratio = 0.0;
+static double arv_option_gvsp_burst_length = 1.0;
+static double arv_option_gvsp_burst_lost_ratio = 1000.0;
+static double arv_option_gvsp_reorder_ratio = 0.0;
+static int arv_option_gvsp_reorder_distance = 4;
+static double arv_option_gvsp_duplicate_ratio = 0.0;
+static int arv_option_gvsp_delay = 0;
+static int arv_option_gvsp_jitter = 0;
+static double arv_option_gvsp_rate_limit = 0.0;
+static int arv_option_gvsp_seed = 0;
 static char *arv_option_debug_domains = NULL;
 
 static const GOptionEntry arv_option_entries[] =
@@ -47,8 +58,30 @@ static const GOptionEntry arv_option_entries[] =
 	        &arv_option_serial_number, 	"Fake camera serial number", "serial_nbr"},
 	{ "genicam",            'g', 0, G_OPTION_ARG_STRING,
 	        &arv_option_genicam_file, 	"XML Genicam file to use", "genicam_filename"},
+	{ "image",		0, 0, G_OPTION_ARG_FILENAME,
+	        &arv_option_image_file,		"Static image, as raw data or binary netpbm", "image_filename"},
 	{ "gvsp-lost-ratio",    'r', 0, G_OPTION_ARG_DOUBLE,
 	        &arv_option_gvsp_lost_ratio,	"GVSP lost packet ratio", "packet_per_thousand"},
+	{ "gvsp-burst-ratio",	0, 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_burst_ratio,	"GVSP loss burst start probability", "packet_per_thousand"},
+	{ "gvsp-burst-length",	0, 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_burst_length,	"GVSP mean loss burst length", "n_packets"},
+	{ "gvsp-burst-lost-ratio", 0, 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_burst_lost_ratio, "GVSP lost packet ratio during a burst", "packet_per_thousand"},
+	{ "gvsp-reorder-ratio",	0, 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_reorder_ratio,	"GVSP reordered packet ratio", "packet_per_thousand"},
+	{ "gvsp-reorder-distance", 0, 0, G_OPTION_ARG_INT,
+	        &arv_option_gvsp_reorder_distance, "GVSP maximum reordered packet displacement", "n_packets"},
+	{ "gvsp-duplicate-ratio", 0, 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_duplicate_ratio, "GVSP duplicated packet ratio", "packet_per_thousand"},
+	{ "gvsp-delay",		0, 0, G_OPTION_ARG_INT,
+	        &arv_option_gvsp_delay,		"GVSP packet burst delay", "µs"},
+	{ "gvsp-jitter",	0, 0, G_OPTION_ARG_INT,
+	        &arv_option_gvsp_jitter,	"GVSP packet burst jitter", "µs"},
+	{ "gvsp-rate-limit",	0, 0, G_OPTION_ARG_DOUBLE,
+	        &arv_option_gvsp_rate_limit,	"GVSP maximum throughput", "Mbit/s"},
+	{ "gvsp-seed",		0, 0, G_OPTION_ARG_INT,
+	        &arv_option_gvsp_seed,		"GVSP impairment random seed", "seed"},
 	{
 		"debug", 			'd', 0, G_OPTION_ARG_STRING,
 		&arv_option_debug_domains, 	NULL,
@@ -63,11 +96,15 @@ description_content[] =
 "any arbitrary genicam data, as the declared features must match the registers\n"
 "of the fake device.\n"
 "\n"
+"The static image data must match the pixel format and is sent as is in\n"
+"each frame.\n"
+"\n"
 "Examples:\n"
 "\n"
 "arv-fake-gv-camera-" ARAVIS_API_VERSION " -i eth0\n"
 "arv-fake-gv-camera-" ARAVIS_API_VERSION " -i 127.0.0.1\n"
-"arv-fake-gv-camera-" ARAVIS_API_VERSION " -s GV02 -d all\n";
+"arv-fake-gv-camera-" ARAVIS_API_VERSION " -s GV02 -d all\n"
+"arv-fake-gv-camera-" ARAVIS_API_VERSION " --gvsp-burst-ratio 1 --gvsp-burst-length 8 --gvsp-seed 1\n";
 
 int
 main (int argc, char **argv)
@@ -100,7 +137,28 @@ main (int argc, char **argv)
 
 	gv_camera = arv_gv_fake_camera_new_full (arv_option_interface_name, arv_option_serial_number, arv_option_genicam_file);
 
-	g_object_set (gv_camera, "gvsp-lost-ratio", arv_option_gvsp_lost_ratio / 1000.0, NULL);
+	g_object_set (gv_camera,
+		      "gvsp-lost-ratio", arv_option_gvsp_lost_ratio / 1000.0,
+		      "gvsp-burst-ratio", arv_option_gvsp_burst_ratio / 1000.0,
+		      "gvsp-burst-length", arv_option_gvsp_burst_length,
+		      "gvsp-burst-lost-ratio", arv_option_gvsp_burst_lost_ratio / 1000.0,
+		      "gvsp-reorder-ratio", arv_option_gvsp_reorder_ratio / 1000.0,
+		      "gvsp-reorder-distance", (guint) arv_option_gvsp_reorder_distance,
+		      "gvsp-duplicate-ratio", arv_option_gvsp_duplicate_ratio / 1000.0,
+		      "gvsp-delay", (guint) arv_option_gvsp_delay,
+		      "gvsp-jitter", (guint) arv_option_gvsp_jitter,
+		      "gvsp-rate-limit", (guint64) (arv_option_gvsp_rate_limit * 1e6),
+		      "gvsp-seed", (guint) arv_option_gvsp_seed,
+		      NULL);
+
+	if (arv_option_image_file != NULL &&
+	    !arv_fake_camera_set_static_image (arv_gv_fake_camera_get_fake_camera (gv_camera),
+					       arv_option_image_file, &error)) {
+		printf ("Failed to load static image: %s\n", error->message);
+		g_clear_error (&error);
+		g_object_unref (gv_camera);
+		return EXIT_FAILURE;
+	}
 
 	signal (SIGINT, set_cancel);
 
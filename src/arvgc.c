@@ -32,6 +32,7 @@
 #include <arvgcprivate.h>
 #include <arvgcnode.h>
 #include <arvgcpropertynode.h>
+#include <arvgcpropertynodeprivate.h>
 #include <arvgcindexnode.h>
 #include <arvgcvalueindexednode.h>
 #include <arvgcinvalidatornode.h>
@@ -39,10 +40,13 @@
 #include <arvgcgroupnode.h>
 #include <arvgccategory.h>
 #include <arvgcenumeration.h>
+#include <arvgcenumerationprivate.h>
 #include <arvgcenumentry.h>
+#include <arvgcenumentryprivate.h>
 #include <arvgcintegernode.h>
 #include <arvgcfloatnode.h>
 #include <arvgcregisternode.h>
+#include <arvgcregisternodeprivate.h>
 #include <arvgcintregnode.h>
 #include <arvgcmaskedintregnode.h>
 #include <arvgcfloatregnode.h>
@@ -58,10 +62,17 @@
 #include <arvgcintswissknifenode.h>
 #include <arvgcconverternode.h>
 #include <arvgcintconverternode.h>
+#include <arvgcswissknifeprivate.h>
+#include <arvgcconverterprivate.h>
 #include <arvgcport.h>
+#include <arvgcportprivate.h>
 #include <arvbuffer.h>
 #include <arvdebugprivate.h>
-#include <arvdomparser.h>
+#include <arvdomparserprivate.h>
+#include <arvdomdocumentprivate.h>
+#include <arvdevice.h>
+#include <arvmiscprivate.h>
+#include <arvzipprivate.h>
 #include <string.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -76,8 +87,57 @@ typedef struct {
 	ArvAccessCheckPolicy access_check_policy;
 
         unsigned n_register_cache_errors;
+
+	/* Formula memoization */
+	guint64 reset_epoch;
+	guint64 n_uncached_reads;
+
+	/* Reverse dependency graph */
+	GHashTable *dependents;			/* ArvGcFeatureNode -> GPtrArray of direct dependents */
+	GHashTable *transitive_dependents;	/* ArvGcFeatureNode -> GPtrArray, computed on demand */
+	GHashTable *pending_dependencies;	/* Name of a missing node -> GArray of ArvGcPendingDependency */
+	GPtrArray *new_nodes;			/* Nodes registered since the last graph update */
+	gboolean is_dependency_graph_stale;
+
+	/* Lazy loading */
+	GRecMutex lazy_mutex;
+	char *lazy_xml;
+	size_t lazy_prolog_size;
+	GPtrArray *lazy_fragments;
+	GPtrArray *lazy_groups;
+	GHashTable *lazy_index;
+
+	/* Access profiling */
+	gint is_profiling;
+	ArvGcProfileEntry *profile_root;
+	ArvGcProfileEntry *profile_current;
 } ArvGcPrivate;
 
+typedef struct _ArvGcLazyGroup ArvGcLazyGroup;
+
+/* Group element, instantiated with its first materialized descendant */
+struct _ArvGcLazyGroup {
+	size_t start;
+	size_t end;			/* End of the start tag */
+	ArvGcLazyGroup *parent;		/* NULL for children of the root element */
+	ArvDomNode *element;
+};
+
+typedef struct {
+	size_t start;
+	size_t end;
+	ArvGcLazyGroup *group;
+	gboolean is_materialized;
+} ArvGcLazyFragment;
+
+/* Link of a registered node to a node missing from the node table, not yet materialized with lazy loading */
+typedef struct {
+	ArvGcFeatureNode *node;
+	gboolean is_selected;
+} ArvGcPendingDependency;
+
+static gboolean arv_gc_lazy_loading = FALSE;
+
 struct _ArvGc {
 	ArvDomDocument base;
 
@@ -295,13 +355,103 @@ arv_gc_create_element (ArvDomDocument *document, const char *tag_name)
  * Return value: (transfer none): a #ArvGcNode, null if not found.
  */
 
+/* Fragments are parsed after the document prolog, in order to have access to the entities declared in the document
+ * type definition, as when the whole document is parsed at once */
+
+static void
+_lazy_append (ArvGc *genicam, ArvDomNode *parent, size_t start, size_t size, const char *suffix, GError **error)
+{
+	GString *buffer;
+
+	if (genicam->priv->lazy_prolog_size == 0 && suffix == NULL) {
+		arv_dom_document_append_from_memory (ARV_DOM_DOCUMENT (genicam), parent,
+						     genicam->priv->lazy_xml + start, size, error);
+		return;
+	}
+
+	buffer = g_string_new_len (genicam->priv->lazy_xml, genicam->priv->lazy_prolog_size);
+	g_string_append_len (buffer, genicam->priv->lazy_xml + start, size);
+	if (suffix != NULL)
+		g_string_append (buffer, suffix);
+
+	arv_dom_document_append_from_memory (ARV_DOM_DOCUMENT (genicam), parent, buffer->str, buffer->len, error);
+
+	g_string_free (buffer, TRUE);
+}
+
+static ArvDomNode *
+_lazy_get_group_element (ArvGc *genicam, ArvGcLazyGroup *group, GError **error)
+{
+	ArvDomNode *parent;
+
+	if (group == NULL)
+		return ARV_DOM_NODE (arv_dom_document_get_document_element (ARV_DOM_DOCUMENT (genicam)));
+
+	if (group->element != NULL)
+		return group->element;
+
+	parent = _lazy_get_group_element (genicam, group->parent, error);
+	if (parent == NULL)
+		return NULL;
+
+	_lazy_append (genicam, parent, group->start, group->end - group->start, "</Group>", error);
+	if (error != NULL && *error != NULL)
+		return NULL;
+
+	group->element = arv_dom_node_get_last_child (parent);
+
+	return group->element;
+}
+
+static void
+_lazy_materialize (ArvGc *genicam, ArvGcLazyFragment *fragment, const char *name)
+{
+	ArvDomNode *parent;
+	GError *error = NULL;
+
+	/* Set before parsing, as node construction may lookup nodes of the same fragment */
+	fragment->is_materialized = TRUE;
+
+	parent = _lazy_get_group_element (genicam, fragment->group, &error);
+	if (parent != NULL)
+		_lazy_append (genicam, parent, fragment->start, fragment->end - fragment->start, NULL, &error);
+
+	if (error != NULL) {
+		arv_warning_genicam ("[Gc::get_node] Failed to materialize '%s': %s", name, error->message);
+		g_clear_error (&error);
+	}
+
+	arv_debug_genicam ("[Gc::get_node] Materialized '%s' (%" G_GSIZE_FORMAT " bytes)",
+			   name, fragment->end - fragment->start);
+}
+
 ArvGcNode *
 arv_gc_get_node	(ArvGc *genicam, const char *name)
 {
+	ArvGcLazyFragment *fragment;
+	ArvGcNode *node;
+
 	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
 	g_return_val_if_fail (name != NULL, NULL);
 
-	return g_hash_table_lookup (genicam->priv->nodes, name);
+	if (genicam->priv->lazy_index == NULL)
+		return g_hash_table_lookup (genicam->priv->nodes, name);
+
+	g_rec_mutex_lock (&genicam->priv->lazy_mutex);
+
+	node = g_hash_table_lookup (genicam->priv->nodes, name);
+	if (node == NULL) {
+		fragment = g_hash_table_lookup (genicam->priv->lazy_index, name);
+		if (fragment != NULL && !fragment->is_materialized) {
+			_lazy_materialize (genicam, fragment, name);
+
+			node = g_hash_table_lookup (genicam->priv->nodes, name);
+		}
+	}
+
+	g_rec_mutex_unlock (&genicam->priv->lazy_mutex);
+
+	return node;
 }
 
 /**
@@ -336,7 +486,12 @@ arv_gc_register_feature_node (ArvGc *genicam, ArvGcFeatureNode *node)
 
 	g_object_ref (node);
 
-	g_hash_table_remove (genicam->priv->nodes, (char *) name);
+	/* The links of a new node are not parsed yet, they are added to the dependency graph on its next use. A
+	 * replaced node may still be referenced by the graph, which has to be rebuilt. */
+	if (g_hash_table_remove (genicam->priv->nodes, (char *) name))
+		genicam->priv->is_dependency_graph_stale = TRUE;
+	else
+		g_ptr_array_add (genicam->priv->new_nodes, node);
 	g_hash_table_insert (genicam->priv->nodes, (char *) name, node);
 
 	arv_debug_genicam ("[Gc::register_feature_node] Register node '%s' [%s]", name,
@@ -372,6 +527,7 @@ arv_gc_set_register_cache_policy (ArvGc *genicam, ArvRegisterCachePolicy policy)
 	g_return_if_fail (ARV_IS_GC (genicam));
 
 	genicam->priv->cache_policy = policy;
+	genicam->priv->reset_epoch++;
 }
 
 ArvRegisterCachePolicy
@@ -434,6 +590,7 @@ arv_gc_set_buffer (ArvGc *genicam, ArvBuffer *buffer)
 	g_object_weak_ref (G_OBJECT (buffer), _weak_notify_cb, genicam);
 
 	genicam->priv->buffer = buffer;
+	genicam->priv->reset_epoch++;
 }
 
 /**
@@ -463,45 +620,1673 @@ arv_gc_register_cache_error_add (ArvGc *genicam, guint64 n_errors)
         return genicam->priv->n_register_cache_errors;
 }
 
-ArvGc *
-arv_gc_new (ArvDevice *device, const void *xml, size_t size)
+/* The dependency graph is built from the pointer properties of the feature nodes (pValue, pMin, pMax, pIndex,
+ * pVariable, pInvalidator, ...), and from the feature nodes declared inside another one, like enumeration entries.
+ * pSelected links are reversed, as the selected features depend on their selector. pPort, pFeature and the alias
+ * links do not carry values and are ignored.
+ *
+ * The graph only covers the registered nodes. Links to a missing node, which with lazy loading may be a node not
+ * materialized yet, are not resolved, as it would materialize the whole link closure. They are kept aside, and added
+ * to the graph with the node, if it is ever registered. A node not yet materialized has nothing to invalidate. The
+ * nodes registered after a build are added incrementally, on the next use of the graph. */
+
+static gboolean
+_is_dependency_property (ArvGcPropertyNodeType node_type)
 {
-	ArvDomDocument *document;
-	ArvGc *genicam;
+	switch (node_type) {
+		case ARV_GC_PROPERTY_NODE_TYPE_P_FEATURE:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_PORT:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_ALIAS:
+		case ARV_GC_PROPERTY_NODE_TYPE_P_CAST_ALIAS:
+			return FALSE;
+		default:
+			return node_type > ARV_GC_PROPERTY_NODE_TYPE_P_UNKNONW;
+	}
+}
 
-	document = arv_dom_document_new_from_memory (xml, size, NULL);
-	if (!ARV_IS_GC (document)) {
-		if (document != NULL)
-			g_object_unref (document);
-		return NULL;
+static void
+_add_dependent (GHashTable *dependents, ArvGcFeatureNode *node, ArvGcFeatureNode *dependent)
+{
+	GPtrArray *array;
+
+	if (node == dependent)
+		return;
+
+	array = g_hash_table_lookup (dependents, node);
+	if (array == NULL) {
+		array = g_ptr_array_new ();
+		g_hash_table_insert (dependents, node, array);
 	}
 
-	genicam = ARV_GC (document);
-	genicam->priv->device = device;
+	if (!g_ptr_array_find (array, dependent, NULL))
+		g_ptr_array_add (array, dependent);
+}
 
-	return genicam;
+/* Adds the edges from the links of @node. The feature nodes declared inside @node, like the enumeration entries, are
+ * not registered in the node table, their own links are added here. */
+
+static void
+_add_node_dependencies (ArvGc *genicam, ArvGcFeatureNode *node)
+{
+	ArvDomNode *child;
+
+	for (child = arv_dom_node_get_first_child (ARV_DOM_NODE (node));
+	     child != NULL;
+	     child = arv_dom_node_get_next_sibling (child)) {
+		if (ARV_IS_GC_PROPERTY_NODE (child)) {
+			ArvGcPropertyNodeType node_type;
+			ArvGcNode *linked_node;
+			const char *linked_name;
+
+			node_type = arv_gc_property_node_get_node_type (ARV_GC_PROPERTY_NODE (child));
+			if (!_is_dependency_property (node_type))
+				continue;
+
+			linked_name = arv_gc_property_node_get_linked_node_name (ARV_GC_PROPERTY_NODE (child));
+			if (linked_name == NULL)
+				continue;
+
+			linked_node = g_hash_table_lookup (genicam->priv->nodes, linked_name);
+			if (linked_node == NULL) {
+				ArvGcPendingDependency pending;
+				GArray *array;
+
+				array = g_hash_table_lookup (genicam->priv->pending_dependencies, linked_name);
+				if (array == NULL) {
+					array = g_array_new (FALSE, FALSE, sizeof (ArvGcPendingDependency));
+					g_hash_table_insert (genicam->priv->pending_dependencies,
+							     g_strdup (linked_name), array);
+				}
+
+				pending.node = node;
+				pending.is_selected = node_type == ARV_GC_PROPERTY_NODE_TYPE_P_SELECTED;
+				g_array_append_val (array, pending);
+				continue;
+			}
+
+			if (!ARV_IS_GC_FEATURE_NODE (linked_node))
+				continue;
+
+			if (node_type == ARV_GC_PROPERTY_NODE_TYPE_P_SELECTED)
+				_add_dependent (genicam->priv->dependents, node, ARV_GC_FEATURE_NODE (linked_node));
+			else
+				_add_dependent (genicam->priv->dependents, ARV_GC_FEATURE_NODE (linked_node), node);
+		} else if (ARV_IS_GC_FEATURE_NODE (child)) {
+			const char *name = arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (child));
+
+			_add_dependent (genicam->priv->dependents, ARV_GC_FEATURE_NODE (child), node);
+
+			if (name == NULL || g_hash_table_lookup (genicam->priv->nodes, name) != child)
+				_add_node_dependencies (genicam, ARV_GC_FEATURE_NODE (child));
+		}
+	}
 }
 
-G_DEFINE_TYPE_WITH_CODE (ArvGc, arv_gc, ARV_TYPE_DOM_DOCUMENT, G_ADD_PRIVATE (ArvGc))
+/* Adds the links of the nodes registered since the last update, and the links to them kept aside until their
+ * registration */
 
 static void
-arv_gc_init (ArvGc *genicam)
+_update_dependency_graph (ArvGc *genicam)
 {
-	genicam->priv = arv_gc_get_instance_private (genicam);
+	GPtrArray *new_nodes = genicam->priv->new_nodes;
+	guint i, j;
 
-	genicam->priv->nodes = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, g_object_unref);
-	genicam->priv->cache_policy = ARV_REGISTER_CACHE_POLICY_DISABLE;
+	if (new_nodes->len == 0)
+		return;
+
+	for (i = 0; i < new_nodes->len; i++) {
+		ArvGcFeatureNode *node = g_ptr_array_index (new_nodes, i);
+		GArray *pending;
+
+		_add_node_dependencies (genicam, node);
+
+		pending = g_hash_table_lookup (genicam->priv->pending_dependencies,
+					       arv_gc_feature_node_get_name (node));
+		if (pending == NULL)
+			continue;
+
+		for (j = 0; j < pending->len; j++) {
+			ArvGcPendingDependency *dependency = &g_array_index (pending, ArvGcPendingDependency, j);
+
+			if (dependency->is_selected)
+				_add_dependent (genicam->priv->dependents, dependency->node, node);
+			else
+				_add_dependent (genicam->priv->dependents, node, dependency->node);
+		}
+
+		g_hash_table_remove (genicam->priv->pending_dependencies, arv_gc_feature_node_get_name (node));
+	}
+
+	arv_debug_genicam ("[Gc::update_dependency_graph] %u new nodes", new_nodes->len);
+
+	g_ptr_array_set_size (new_nodes, 0);
+	g_hash_table_remove_all (genicam->priv->transitive_dependents);
 }
 
 static void
-arv_gc_finalize (GObject *object)
+_build_dependency_graph (ArvGc *genicam)
 {
-	ArvGc *genicam = ARV_GC (object);
+	GList *nodes;
+	GList *iter;
 
-	if (genicam->priv->buffer != NULL)
-		g_object_weak_unref (G_OBJECT (genicam->priv->buffer), _weak_notify_cb, genicam);
+	genicam->priv->is_dependency_graph_stale = FALSE;
 
-	g_hash_table_unref (genicam->priv->nodes);
+	g_hash_table_remove_all (genicam->priv->dependents);
+	g_hash_table_remove_all (genicam->priv->transitive_dependents);
+	g_hash_table_remove_all (genicam->priv->pending_dependencies);
+	g_ptr_array_set_size (genicam->priv->new_nodes, 0);
+
+	nodes = g_hash_table_get_values (genicam->priv->nodes);
+
+	for (iter = nodes; iter != NULL; iter = iter->next)
+		_add_node_dependencies (genicam, iter->data);
+
+	g_list_free (nodes);
+
+	arv_info_genicam ("[Gc::build_dependency_graph] %u nodes with dependents",
+			  g_hash_table_size (genicam->priv->dependents));
+}
+
+static GPtrArray *
+_get_dependents (ArvGc *genicam, ArvGcFeatureNode *node, gboolean transitive)
+{
+	GPtrArray *dependents;
+	GHashTable *visited;
+	guint i;
+
+	if (genicam->priv->is_dependency_graph_stale)
+		_build_dependency_graph (genicam);
+	else
+		_update_dependency_graph (genicam);
+
+	if (!transitive)
+		return g_hash_table_lookup (genicam->priv->dependents, node);
+
+	dependents = g_hash_table_lookup (genicam->priv->transitive_dependents, node);
+	if (dependents != NULL)
+		return dependents;
+
+	/* Breadth first traversal, using the result array as the queue */
+
+	dependents = g_ptr_array_new ();
+	visited = g_hash_table_new (g_direct_hash, g_direct_equal);
+	g_hash_table_add (visited, node);
+
+	for (i = 0; i <= dependents->len; i++) {
+		GPtrArray *direct_dependents;
+		guint j;
+
+		direct_dependents = g_hash_table_lookup (genicam->priv->dependents,
+							 i == 0 ? node : g_ptr_array_index (dependents, i - 1));
+		if (direct_dependents == NULL)
+			continue;
+
+		for (j = 0; j < direct_dependents->len; j++) {
+			gpointer dependent = g_ptr_array_index (direct_dependents, j);
+
+			if (g_hash_table_add (visited, dependent))
+				g_ptr_array_add (dependents, dependent);
+		}
+	}
+
+	g_hash_table_unref (visited);
+
+	g_hash_table_insert (genicam->priv->transitive_dependents, node, dependents);
+
+	return dependents;
+}
+
+/* Called on each change of a feature node. All the cached registers, memoized formulas and enumeration entry states
+ * depending on it, directly or not, are marked dirty, the other memoized results are kept. The reset epoch
+ * invalidates all the memoized results at once, on changes of the register cache policy or of the chunk data
+ * buffer. */
+
+void
+arv_gc_invalidate_dependents (ArvGc *genicam, ArvGcFeatureNode *node)
+{
+	GPtrArray *dependents;
+	guint i;
+
+	g_return_if_fail (ARV_IS_GC (genicam));
+	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (node));
+
+	dependents = _get_dependents (genicam, node, TRUE);
+
+	for (i = 0; i < dependents->len; i++) {
+		ArvGcFeatureNode *dependent = g_ptr_array_index (dependents, i);
+
+		if (ARV_IS_GC_REGISTER_NODE (dependent))
+			arv_gc_register_node_invalidate_cache (ARV_GC_REGISTER_NODE (dependent));
+		else if (ARV_IS_GC_SWISS_KNIFE (dependent))
+			arv_gc_swiss_knife_invalidate (ARV_GC_SWISS_KNIFE (dependent));
+		else if (ARV_IS_GC_CONVERTER (dependent))
+			arv_gc_converter_invalidate (ARV_GC_CONVERTER (dependent));
+		else if (ARV_IS_GC_ENUM_ENTRY (dependent))
+			arv_gc_enum_entry_invalidate (ARV_GC_ENUM_ENTRY (dependent));
+		else if (ARV_IS_GC_ENUMERATION (dependent))
+			arv_gc_enumeration_invalidate (ARV_GC_ENUMERATION (dependent));
+	}
+}
+
+/* Drops the cached values of all the register nodes and memoized results, when the device state may not match them
+ * anymore, for example after a failed or aborted device transaction */
+
+void
+arv_gc_invalidate_register_caches (ArvGc *genicam)
+{
+	GHashTableIter iter;
+	gpointer node;
+
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	g_hash_table_iter_init (&iter, genicam->priv->nodes);
+	while (g_hash_table_iter_next (&iter, NULL, &node)) {
+		if (ARV_IS_GC_REGISTER_NODE (node))
+			arv_gc_register_node_invalidate_cache (ARV_GC_REGISTER_NODE (node));
+	}
+
+	genicam->priv->reset_epoch++;
+}
+
+/* Lists the register nodes needed for the evaluation of @features, by a depth first walk of the dependency links in
+ * the forward direction. pSelected and pInvalidator links are not followed, as they are not used for the computation
+ * of a value. The register nodes of @features, and the struct registers of their struct entries, are included. */
+
+GPtrArray *
+arv_gc_dup_register_dependencies (ArvGc *genicam, GPtrArray *features)
+{
+	GPtrArray *registers;
+	GPtrArray *stack;
+	GHashTable *visited;
+	guint i;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+	g_return_val_if_fail (features != NULL, NULL);
+
+	registers = g_ptr_array_new ();
+	stack = g_ptr_array_new ();
+	visited = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+	for (i = 0; i < features->len; i++)
+		if (g_hash_table_add (visited, g_ptr_array_index (features, i)))
+			g_ptr_array_add (stack, g_ptr_array_index (features, i));
+
+	while (stack->len > 0) {
+		ArvGcFeatureNode *node = g_ptr_array_steal_index (stack, stack->len - 1);
+		ArvDomNode *child;
+
+		if (ARV_IS_GC_REGISTER_NODE (node))
+			g_ptr_array_add (registers, node);
+
+		/* Struct entries are read through their parent register */
+		if (ARV_IS_GC_STRUCT_ENTRY_NODE (node)) {
+			ArvDomNode *parent = arv_dom_node_get_parent_node (ARV_DOM_NODE (node));
+
+			if (ARV_IS_GC_FEATURE_NODE (parent) && g_hash_table_add (visited, parent))
+				g_ptr_array_add (stack, parent);
+		}
+
+		for (child = arv_dom_node_get_first_child (ARV_DOM_NODE (node));
+		     child != NULL;
+		     child = arv_dom_node_get_next_sibling (child)) {
+			ArvGcNode *linked_node = NULL;
+
+			if (ARV_IS_GC_PROPERTY_NODE (child)) {
+				ArvGcPropertyNodeType node_type;
+
+				node_type = arv_gc_property_node_get_node_type (ARV_GC_PROPERTY_NODE (child));
+				if (!_is_dependency_property (node_type) ||
+				    node_type == ARV_GC_PROPERTY_NODE_TYPE_P_SELECTED ||
+				    node_type == ARV_GC_PROPERTY_NODE_TYPE_P_INVALIDATOR)
+					continue;
+
+				linked_node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (child));
+			} else if (ARV_IS_GC_FEATURE_NODE (child)) {
+				linked_node = ARV_GC_NODE (child);
+			}
+
+			if (ARV_IS_GC_FEATURE_NODE (linked_node) && g_hash_table_add (visited, linked_node))
+				g_ptr_array_add (stack, linked_node);
+		}
+	}
+
+	g_ptr_array_unref (stack);
+	g_hash_table_unref (visited);
+
+	return registers;
+}
+
+/* With lazy loading, materializes the fragments accepted by @filter, which is given the XML text of each fragment */
+
+static void
+_materialize_lazy_fragments (ArvGc *genicam, gboolean (*filter) (const char *xml, size_t size))
+{
+	GPtrArray *names;
+	GHashTableIter iter;
+	gpointer key, value;
+	guint i;
+
+	if (genicam->priv->lazy_index == NULL)
+		return;
+
+	names = g_ptr_array_new ();
+
+	g_rec_mutex_lock (&genicam->priv->lazy_mutex);
+
+	g_hash_table_iter_init (&iter, genicam->priv->lazy_index);
+	while (g_hash_table_iter_next (&iter, &key, &value)) {
+		ArvGcLazyFragment *fragment = value;
+
+		if (!fragment->is_materialized &&
+		    filter (genicam->priv->lazy_xml + fragment->start, fragment->end - fragment->start))
+			g_ptr_array_add (names, key);
+	}
+
+	for (i = 0; i < names->len; i++)
+		arv_gc_get_node (genicam, g_ptr_array_index (names, i));
+
+	g_rec_mutex_unlock (&genicam->priv->lazy_mutex);
+
+	g_ptr_array_unref (names);
+}
+
+static gboolean
+_has_polling_time (const char *xml, size_t size)
+{
+	return g_strstr_len (xml, size, "<PollingTime") != NULL;
+}
+
+/* Lists the feature nodes with a PollingTime property. With lazy loading, the fragments declaring a PollingTime are
+ * materialized first. */
+
+GPtrArray *
+arv_gc_dup_polled_features (ArvGc *genicam)
+{
+	GPtrArray *features;
+	GHashTableIter iter;
+	gpointer value;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+
+	_materialize_lazy_fragments (genicam, _has_polling_time);
+
+	features = g_ptr_array_new ();
+
+	g_hash_table_iter_init (&iter, genicam->priv->nodes);
+	while (g_hash_table_iter_next (&iter, NULL, &value)) {
+		if (ARV_IS_GC_FEATURE_NODE (value) &&
+		    arv_gc_feature_node_get_polling_time (ARV_GC_FEATURE_NODE (value)) > 0)
+			g_ptr_array_add (features, value);
+	}
+
+	return features;
+}
+
+/* Register cache warmup */
+
+#define ARV_GC_WARMUP_BLOCK_SIZE_MAX	65536
+
+typedef struct {
+	ArvGcRegisterNode *node;
+	ArvGcPort *port;
+	gint64 address;
+	gint64 length;
+	gboolean is_barrier;
+} ArvGcWarmupRange;
+
+static int
+_compare_warmup_ranges (gconstpointer a, gconstpointer b)
+{
+	const ArvGcWarmupRange *range_a = a;
+	const ArvGcWarmupRange *range_b = b;
+
+	if (range_a->port != range_b->port)
+		return range_a->port < range_b->port ? -1 : 1;
+	if (range_a->address != range_b->address)
+		return range_a->address < range_b->address ? -1 : 1;
+	/* Barriers first, a register at the same address is not used as the start of a read over a barrier */
+	if (range_a->is_barrier != range_b->is_barrier)
+		return range_a->is_barrier ? -1 : 1;
+
+	return 0;
+}
+
+static gboolean
+_is_register_fragment (const char *xml, size_t size)
+{
+	static const char *tags[] = {"<IntReg", "<MaskedIntReg", "<FloatReg", "<StringReg", "<Register", "<StructReg"};
+	guint i;
+
+	for (i = 0; i < G_N_ELEMENTS (tags); i++) {
+		size_t length = strlen (tags[i]);
+
+		if (size > length && strncmp (xml, tags[i], length) == 0 &&
+		    (g_ascii_isspace (xml[length]) || xml[length] == '>' || xml[length] == '/'))
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+/**
+ * arv_gc_warmup_register_cache:
+ * @genicam: a #ArvGc object
+ * @gap_tolerance: maximum number of unused bytes between two registers read in the same request
+ * @n_registers: (out) (optional): placeholder for the number of seeded register caches
+ * @n_reads: (out) (optional): placeholder for the number of device reads
+ *
+ * Fills the caches of the cachable register nodes with a constant address, using as few device reads as possible.
+ * The registers are grouped by port into contiguous address ranges, two registers separated by at most
+ * @gap_tolerance bytes being read in the same request. A gap is never bridged over a NoCache or write only register
+ * with a constant address, as reading it may have side effects on the device. Registers whose address depends on
+ * other nodes are not known to this function, and @gap_tolerance should be left to 0 for devices where such
+ * registers exist in the gaps. Ranges that can not be read are skipped, their registers being read one by one on
+ * their first access. Legacy GigE Vision registers, read using the register command, are not included.
+ *
+ * The seeded values are only used by the %ARV_REGISTER_CACHE_POLICY_ENABLE and %ARV_REGISTER_CACHE_POLICY_DEBUG
+ * register cache policies, set using arv_gc_set_register_cache_policy(). This function does nothing under
+ * %ARV_REGISTER_CACHE_POLICY_DISABLE, which is the default policy.
+ *
+ * With lazy loading, all the register nodes are materialized by this function. The difference between @n_registers
+ * and @n_reads is the number of device round trips avoided, compared to the lazy filling of the caches.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gc_warmup_register_cache (ArvGc *genicam, guint64 gap_tolerance, guint *n_registers, guint *n_reads)
+{
+	GHashTableIter iter;
+	GPtrArray *nodes;
+	GArray *ranges;
+	gpointer value;
+	guint n_seeded = 0;
+	guint n_requests = 0;
+	guint i, j, k;
+
+	if (n_registers != NULL)
+		*n_registers = 0;
+	if (n_reads != NULL)
+		*n_reads = 0;
+
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	if (genicam->priv->cache_policy == ARV_REGISTER_CACHE_POLICY_DISABLE) {
+		arv_info_genicam ("[Gc::warmup_register_cache] Register cache disabled, nothing to seed");
+		return;
+	}
+
+	_materialize_lazy_fragments (genicam, _is_register_fragment);
+
+	/* The port lookup may materialize nodes, the register nodes are listed before */
+	nodes = g_ptr_array_new ();
+	g_hash_table_iter_init (&iter, genicam->priv->nodes);
+	while (g_hash_table_iter_next (&iter, NULL, &value)) {
+		if (ARV_IS_GC_REGISTER_NODE (value))
+			g_ptr_array_add (nodes, value);
+	}
+
+	ranges = g_array_new (FALSE, FALSE, sizeof (ArvGcWarmupRange));
+
+	for (i = 0; i < nodes->len; i++) {
+		ArvGcWarmupRange range;
+		gboolean use_register;
+
+		range.node = g_ptr_array_index (nodes, i);
+		if (!arv_gc_register_node_get_warmup_range (range.node, &range.port, &range.address, &range.length,
+							    &range.is_barrier))
+			continue;
+
+		if (range.is_barrier ||
+		    (range.length <= ARV_GC_WARMUP_BLOCK_SIZE_MAX &&
+		     arv_gc_port_get_device_access (range.port, range.length, &use_register) &&
+		     !use_register))
+			g_array_append_val (ranges, range);
+	}
+
+	g_ptr_array_unref (nodes);
+
+	g_array_sort (ranges, _compare_warmup_ranges);
+
+	for (i = 0; i < ranges->len; i = j) {
+		ArvGcWarmupRange *first = &g_array_index (ranges, ArvGcWarmupRange, i);
+		GError *local_error = NULL;
+		gint64 end = first->address + first->length;
+		guint8 *data;
+
+		if (first->is_barrier) {
+			j = i + 1;
+			continue;
+		}
+
+		for (j = i + 1; j < ranges->len; j++) {
+			ArvGcWarmupRange *range = &g_array_index (ranges, ArvGcWarmupRange, j);
+
+			/* A barrier is only acceptable inside the bytes already read for the previous registers */
+			if (range->is_barrier) {
+				if (range->port != first->port ||
+				    range->address + range->length > end)
+					break;
+				continue;
+			}
+
+			if (range->port != first->port ||
+			    range->address > end + (gint64) gap_tolerance ||
+			    range->address + range->length - first->address > ARV_GC_WARMUP_BLOCK_SIZE_MAX)
+				break;
+
+			end = MAX (end, range->address + range->length);
+		}
+
+		data = g_malloc (end - first->address);
+
+		n_requests++;
+		arv_gc_port_read (first->port, data, first->address, end - first->address, &local_error);
+		if (local_error == NULL) {
+			for (k = i; k < j; k++) {
+				ArvGcWarmupRange *range = &g_array_index (ranges, ArvGcWarmupRange, k);
+
+				if (range->is_barrier)
+					continue;
+
+				arv_gc_register_node_seed_cache (range->node, data + (range->address - first->address));
+				n_seeded++;
+			}
+		} else {
+			arv_debug_genicam ("[Gc::warmup_register_cache] Failed to read 0x%" G_GINT64_MODIFIER "x-0x%"
+					   G_GINT64_MODIFIER "x: %s", first->address, end, local_error->message);
+			g_clear_error (&local_error);
+		}
+
+		g_free (data);
+	}
+
+	arv_info_genicam ("[Gc::warmup_register_cache] %u register caches seeded in %u reads (%d avoided)",
+			  n_seeded, n_requests, (int) n_seeded - (int) n_requests);
+
+	g_array_unref (ranges);
+
+	if (n_registers != NULL)
+		*n_registers = n_seeded;
+	if (n_reads != NULL)
+		*n_reads = n_requests;
+}
+
+/* Access profiling */
+
+struct _ArvGcProfileEntry {
+	char *label;
+	gboolean is_transport;
+	gboolean is_register;
+	gint64 start_time;
+	gint64 duration;
+	guint n_cache_hits;
+	guint n_cache_misses;
+	ArvGcProfileEntry *parent;
+	GPtrArray *children;
+};
+
+typedef struct {
+	guint n_evaluations;
+	guint n_cache_hits;
+	guint n_cache_misses;
+	guint n_transport_calls;
+	guint n_transport_errors;
+	gint64 transport_time;
+} ArvGcProfileTotals;
+
+static void
+_profile_entry_free (ArvGcProfileEntry *entry)
+{
+	g_free (entry->label);
+	g_clear_pointer (&entry->children, g_ptr_array_unref);
+	g_free (entry);
+}
+
+static ArvGcProfileEntry *
+_profile_entry_new (ArvGcProfileEntry *parent, char *label)
+{
+	ArvGcProfileEntry *entry = g_new0 (ArvGcProfileEntry, 1);
+
+	entry->label = label;
+	entry->parent = parent;
+
+	if (parent != NULL) {
+		if (parent->children == NULL)
+			parent->children = g_ptr_array_new_with_free_func ((GDestroyNotify) _profile_entry_free);
+		g_ptr_array_add (parent->children, entry);
+	}
+
+	return entry;
+}
+
+/* Number of documents being profiled in the process. The hooks check it before resolving the document of the node,
+ * which walks the DOM tree, in order to keep them down to a single atomic read when no profiling is running. */
+static gint arv_gc_n_profiled_documents = 0;
+
+static ArvGc *
+_get_profiled_genicam (ArvGcFeatureNode *node)
+{
+	ArvGc *genicam;
+
+	if (G_LIKELY (g_atomic_int_get (&arv_gc_n_profiled_documents) == 0))
+		return NULL;
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (node));
+	if (!arv_gc_is_profiling (genicam))
+		return NULL;
+
+	return genicam;
+}
+
+gboolean
+arv_gc_is_profiling (ArvGc *genicam)
+{
+	if (G_LIKELY (g_atomic_int_get (&arv_gc_n_profiled_documents) == 0))
+		return FALSE;
+
+	return genicam != NULL && g_atomic_int_get (&genicam->priv->is_profiling);
+}
+
+/* Called around each evaluation of a node, in order to build the call tree */
+
+void
+arv_gc_profile_enter (ArvGcFeatureNode *node, const char *operation)
+{
+	ArvGc *genicam = _get_profiled_genicam (node);
+	ArvGcProfileEntry *entry;
+
+	if (genicam == NULL)
+		return;
+
+	entry = _profile_entry_new (genicam->priv->profile_current,
+				    g_strdup_printf ("%s.%s", arv_gc_feature_node_get_name (node), operation));
+
+	if (ARV_IS_GC_REGISTER_NODE (node)) {
+		entry->is_register = TRUE;
+		arv_gc_register_node_get_cache_statistics (ARV_GC_REGISTER_NODE (node),
+							   &entry->n_cache_hits, &entry->n_cache_misses);
+	}
+
+	genicam->priv->profile_current = entry;
+	entry->start_time = g_get_monotonic_time ();
+}
+
+void
+arv_gc_profile_leave (ArvGcFeatureNode *node)
+{
+	ArvGc *genicam = _get_profiled_genicam (node);
+	ArvGcProfileEntry *entry;
+
+	if (genicam == NULL)
+		return;
+
+	entry = genicam->priv->profile_current;
+
+	/* Evaluation started before the beginning of the profiling */
+	if (entry->parent == NULL)
+		return;
+
+	entry->duration = g_get_monotonic_time () - entry->start_time;
+
+	if (entry->is_register) {
+		guint n_cache_hits, n_cache_misses;
+
+		arv_gc_register_node_get_cache_statistics (ARV_GC_REGISTER_NODE (node), &n_cache_hits, &n_cache_misses);
+		entry->n_cache_hits = n_cache_hits - entry->n_cache_hits;
+		entry->n_cache_misses = n_cache_misses - entry->n_cache_misses;
+	}
+
+	genicam->priv->profile_current = entry->parent;
+}
+
+/* Called by the device for each request sent through the transport layer */
+
+void
+arv_gc_profile_transport (ArvGc *genicam, const char *operation, guint64 address, guint64 size,
+			  gint64 duration, gboolean success)
+{
+	ArvGcProfileEntry *entry;
+
+	if (!arv_gc_is_profiling (genicam))
+		return;
+
+	entry = _profile_entry_new (genicam->priv->profile_current,
+				    g_strdup_printf ("%s 0x%08" G_GINT64_MODIFIER "x (%" G_GUINT64_FORMAT " bytes)%s",
+						     operation, address, size, success ? "" : " failed"));
+	entry->is_transport = TRUE;
+	entry->duration = duration;
+}
+
+static void
+_profile_entry_report (ArvGcProfileEntry *entry, int level, GString *string, ArvGcProfileTotals *totals)
+{
+	guint i;
+
+	if (entry->label != NULL) {
+		g_string_append_printf (string, "%*s%-*s %9.3f ms", 2 * level, "", MAX (1, 56 - 2 * level),
+					entry->label, entry->duration / 1000.0);
+
+		if (entry->is_register)
+			g_string_append_printf (string, "  cache %u hit%s, %u miss%s",
+						entry->n_cache_hits, entry->n_cache_hits > 1 ? "s" : "",
+						entry->n_cache_misses, entry->n_cache_misses > 1 ? "es" : "");
+
+		g_string_append_c (string, '\n');
+
+		if (entry->is_transport) {
+			totals->n_transport_calls++;
+			totals->transport_time += entry->duration;
+			if (g_str_has_suffix (entry->label, " failed"))
+				totals->n_transport_errors++;
+		} else {
+			totals->n_evaluations++;
+			totals->n_cache_hits += entry->n_cache_hits;
+			totals->n_cache_misses += entry->n_cache_misses;
+		}
+	}
+
+	if (entry->children != NULL)
+		for (i = 0; i < entry->children->len; i++)
+			_profile_entry_report (g_ptr_array_index (entry->children, i), level + 1, string, totals);
+}
+
+/**
+ * arv_gc_start_profiling:
+ * @genicam: a #ArvGc object
+ *
+ * Starts the recording of the feature accesses. For each public feature access, the tree of the evaluated nodes is
+ * recorded, with the register cache hits and misses, and the duration of each transport request. The report is
+ * retrieved using arv_gc_stop_profiling().
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gc_start_profiling (ArvGc *genicam)
+{
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	if (genicam->priv->profile_root != NULL)
+		return;
+
+	genicam->priv->profile_root = _profile_entry_new (NULL, NULL);
+	genicam->priv->profile_current = genicam->priv->profile_root;
+
+	g_atomic_int_set (&genicam->priv->is_profiling, TRUE);
+	g_atomic_int_inc (&arv_gc_n_profiled_documents);
+}
+
+static void
+_clear_profile (ArvGc *genicam)
+{
+	if (genicam->priv->profile_root == NULL)
+		return;
+
+	g_atomic_int_set (&genicam->priv->is_profiling, FALSE);
+	g_atomic_int_add (&arv_gc_n_profiled_documents, -1);
+
+	g_clear_pointer (&genicam->priv->profile_root, _profile_entry_free);
+	genicam->priv->profile_current = NULL;
+}
+
+/**
+ * arv_gc_stop_profiling:
+ * @genicam: a #ArvGc object
+ *
+ * Stops the recording started by arv_gc_start_profiling(), and returns a human readable report, with the call tree of
+ * each feature access, followed by the totals.
+ *
+ * Returns: (transfer full) (nullable): a newly allocated string, %NULL if the profiling was not started.
+ *
+ * Since: 0.10.0
+ */
+
+char *
+arv_gc_stop_profiling (ArvGc *genicam)
+{
+	ArvGcProfileTotals totals = {0};
+	GString *string;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+
+	if (genicam->priv->profile_root == NULL)
+		return NULL;
+
+	string = g_string_new (NULL);
+
+	_profile_entry_report (genicam->priv->profile_root, -1, string, &totals);
+
+	g_string_append_printf (string,
+				"%u node evaluations, register cache %u hits, %u misses\n"
+				"%u transport requests (%u failed) in %.3f ms\n",
+				totals.n_evaluations, totals.n_cache_hits, totals.n_cache_misses,
+				totals.n_transport_calls, totals.n_transport_errors, totals.transport_time / 1000.0);
+
+	_clear_profile (genicam);
+
+	return g_string_free (string, FALSE);
+}
+
+/**
+ * arv_gc_dup_feature_dependents:
+ * @genicam: a #ArvGc object
+ * @feature: feature name
+ * @transitive: %TRUE to include the indirect dependents
+ * @n_dependents: (out) (optional): placeholder for the number of returned names
+ * @error: a #GError placeholder
+ *
+ * Lists the features whose value depends on @feature, either directly through a pValue, pMin, pMax, pIndex,
+ * pSelected, pVariable or pInvalidator link, or indirectly if @transitive is %TRUE. Indirect dependents are sorted
+ * by distance to @feature.
+ *
+ * Returns: (array length=n_dependents zero-terminated=1) (transfer container): a newly allocated array of feature
+ * names, which must be freed after use using g_free, or %NULL on error.
+ *
+ * Since: 0.10.0
+ */
+
+const char **
+arv_gc_dup_feature_dependents (ArvGc *genicam, const char *feature, gboolean transitive,
+			       guint *n_dependents, GError **error)
+{
+	ArvGcNode *node;
+	GPtrArray *dependents;
+	const char **names;
+	guint n_names;
+	guint i;
+
+	if (n_dependents != NULL)
+		*n_dependents = 0;
+
+	g_return_val_if_fail (ARV_IS_GC (genicam), NULL);
+	g_return_val_if_fail (feature != NULL, NULL);
+
+	node = arv_gc_get_node (genicam, feature);
+	if (!ARV_IS_GC_FEATURE_NODE (node)) {
+		g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_NODE_NOT_FOUND,
+			     "[%s] Feature not found", feature);
+		return NULL;
+	}
+
+	dependents = _get_dependents (genicam, ARV_GC_FEATURE_NODE (node), transitive);
+	n_names = dependents != NULL ? dependents->len : 0;
+
+	names = g_new0 (const char *, n_names + 1);
+	for (i = 0; i < n_names; i++)
+		names[i] = arv_gc_feature_node_get_name (g_ptr_array_index (dependents, i));
+
+	if (n_dependents != NULL)
+		*n_dependents = n_names;
+
+	return names;
+}
+
+void
+arv_gc_increment_n_uncached_reads (ArvGc *genicam)
+{
+	g_return_if_fail (ARV_IS_GC (genicam));
+
+	genicam->priv->n_uncached_reads++;
+}
+
+void
+arv_gc_memo_begin (ArvGc *genicam, ArvGcMemo *memo)
+{
+	g_return_if_fail (ARV_IS_GC (genicam));
+	g_return_if_fail (memo != NULL);
+
+	memo->is_valid = FALSE;
+	memo->is_dirty = FALSE;
+	memo->reset_epoch = genicam->priv->reset_epoch;
+	memo->n_uncached_reads = genicam->priv->n_uncached_reads;
+}
+
+void
+arv_gc_memo_end (ArvGc *genicam, ArvGcMemo *memo, gboolean success)
+{
+	g_return_if_fail (ARV_IS_GC (genicam));
+	g_return_if_fail (memo != NULL);
+
+	memo->is_valid = success &&
+		!memo->is_dirty &&
+		memo->reset_epoch == genicam->priv->reset_epoch &&
+		memo->n_uncached_reads == genicam->priv->n_uncached_reads;
+}
+
+gboolean
+arv_gc_memo_is_valid (ArvGc *genicam, ArvGcMemo *memo)
+{
+	if (genicam == NULL || memo == NULL)
+		return FALSE;
+
+	return memo->is_valid && memo->reset_epoch == genicam->priv->reset_epoch;
+}
+
+/* Called when one of the inputs of the memoized result changes, possibly during its evaluation */
+
+void
+arv_gc_memo_invalidate (ArvGcMemo *memo)
+{
+	g_return_if_fail (memo != NULL);
+
+	memo->is_valid = FALSE;
+	memo->is_dirty = TRUE;
+}
+
+/**
+ * arv_gc_new_from_document: (skip)
+ * @device: a #ArvDevice
+ * @document: (transfer full): a parsed genicam document
+ *
+ * Return value: (transfer full): a new #ArvGc, or NULL if @document is not a genicam document.
+ */
+
+ArvGc *
+arv_gc_new_from_document (ArvDevice *device, ArvDomDocument *document)
+{
+	ArvGc *genicam;
+
+	if (!ARV_IS_GC (document)) {
+		if (document != NULL)
+			g_object_unref (document);
+		return NULL;
+	}
+
+	genicam = ARV_GC (document);
+	genicam->priv->device = device;
+
+	return genicam;
+}
+
+static gboolean
+_lazy_has_prefix (const char *xml, size_t size, size_t position, const char *prefix)
+{
+	size_t length = strlen (prefix);
+
+	return position + length <= size && memcmp (xml + position, prefix, length) == 0;
+}
+
+static size_t
+_lazy_skip_to (const char *xml, size_t size, size_t position, const char *end)
+{
+	size_t length = strlen (end);
+
+	for (; position + length <= size; position++)
+		if (memcmp (xml + position, end, length) == 0)
+			return position + length;
+
+	return size;
+}
+
+static gboolean
+_lazy_is_space (char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+#define ARV_GC_LAZY_MAX_DEPTH	64
+
+/*
+ * Builds the index of top level nodes, without instantiating anything. This is a minimal xml tokenizer, which only
+ * knows about tags, attributes, comments, CDATA sections, processing instructions and document type declarations.
+ * The children of the root element and of Group elements are top level nodes. Each of them is indexed by its name
+ * and by the names of the nodes it contains, except for EnumEntry, which are not registered in ArvGc. @prolog_size
+ * is set to the size of the data preceding the root element if they contain a document type declaration, 0
+ * otherwise.
+ */
+
+static gboolean
+_lazy_scan (ArvGc *genicam, const char *xml, size_t size, size_t *root_start, size_t *root_end, size_t *root_name_length,
+	    size_t *prolog_size)
+{
+	gboolean is_container[ARV_GC_LAZY_MAX_DEPTH];
+	ArvGcLazyGroup *groups[ARV_GC_LAZY_MAX_DEPTH];
+	gboolean has_doctype = FALSE;
+	ArvGcLazyFragment scan_fragment;
+	ArvGcLazyFragment *fragment = NULL;
+	gboolean root_found = FALSE;
+	int fragment_depth = -1;
+	int depth = 0;
+	size_t i = 0;
+
+	while (i < size) {
+		const char *next;
+		size_t tag_start;
+		size_t name_start;
+		size_t name_length;
+		size_t value_start = 0;
+		size_t value_length = 0;
+		gboolean is_self_closing = FALSE;
+
+		next = memchr (xml + i, '<', size - i);
+		if (next == NULL)
+			break;
+
+		i = tag_start = next - xml;
+
+		if (_lazy_has_prefix (xml, size, i, "<?")) {
+			i = _lazy_skip_to (xml, size, i, "?>");
+			continue;
+		}
+		if (_lazy_has_prefix (xml, size, i, "<!--")) {
+			i = _lazy_skip_to (xml, size, i, "-->");
+			continue;
+		}
+		if (_lazy_has_prefix (xml, size, i, "<![CDATA[")) {
+			i = _lazy_skip_to (xml, size, i, "]]>");
+			continue;
+		}
+		if (_lazy_has_prefix (xml, size, i, "<!")) {
+			int bracket_depth = 0;
+
+			if (depth == 0 && _lazy_has_prefix (xml, size, i, "<!DOCTYPE"))
+				has_doctype = TRUE;
+
+			/* Document type declaration, with an optional internal subset */
+			for (i += 2; i < size && (xml[i] != '>' || bracket_depth > 0); i++) {
+				if (xml[i] == '[')
+					bracket_depth++;
+				else if (xml[i] == ']')
+					bracket_depth--;
+			}
+			i++;
+			continue;
+		}
+		if (_lazy_has_prefix (xml, size, i, "</")) {
+			next = memchr (xml + i, '>', size - i);
+			if (next == NULL || depth == 0)
+				return FALSE;
+			i = next - xml + 1;
+			depth--;
+
+			if (depth == fragment_depth) {
+				fragment->end = i;
+				fragment_depth = -1;
+			}
+			if (depth == 0)
+				break;
+			continue;
+		}
+
+		/* Start tag */
+		name_start = ++i;
+		while (i < size && !_lazy_is_space (xml[i]) && xml[i] != '/' && xml[i] != '>')
+			i++;
+		name_length = i - name_start;
+		if (name_length == 0)
+			return FALSE;
+
+		/* Attributes */
+		while (i < size) {
+			size_t attribute_start;
+			size_t attribute_length;
+			char quote;
+
+			while (i < size && _lazy_is_space (xml[i]))
+				i++;
+			if (i >= size)
+				return FALSE;
+			if (xml[i] == '>')
+				break;
+			if (xml[i] == '/') {
+				is_self_closing = TRUE;
+				i++;
+				continue;
+			}
+
+			attribute_start = i;
+			while (i < size && !_lazy_is_space (xml[i]) && xml[i] != '=' && xml[i] != '>')
+				i++;
+			attribute_length = i - attribute_start;
+			while (i < size && _lazy_is_space (xml[i]))
+				i++;
+			if (i >= size || xml[i] != '=')
+				return FALSE;
+			i++;
+			while (i < size && _lazy_is_space (xml[i]))
+				i++;
+			if (i >= size || (xml[i] != '"' && xml[i] != '\''))
+				return FALSE;
+			quote = xml[i++];
+			next = memchr (xml + i, quote, size - i);
+			if (next == NULL)
+				return FALSE;
+
+			if (attribute_length == 4 && memcmp (xml + attribute_start, "Name", 4) == 0) {
+				value_start = i;
+				value_length = next - xml - i;
+			}
+
+			i = next - xml + 1;
+		}
+		if (i >= size)
+			return FALSE;
+		i++;
+
+		if (depth == 0) {
+			if (root_found)
+				return FALSE;
+
+			root_found = TRUE;
+			*root_start = tag_start;
+			*root_end = i;
+			*root_name_length = name_length;
+			*prolog_size = has_doctype ? tag_start : 0;
+
+			if (is_self_closing)
+				break;
+
+			is_container[0] = TRUE;
+			groups[0] = NULL;
+			depth = 1;
+			continue;
+		}
+
+		if (fragment_depth < 0) {
+			fragment = NULL;
+
+			if (depth < ARV_GC_LAZY_MAX_DEPTH && is_container[depth - 1]) {
+				is_container[depth] = name_length == 5 && memcmp (xml + name_start, "Group", 5) == 0;
+				groups[depth] = NULL;
+
+				if (is_container[depth] && genicam != NULL && !is_self_closing) {
+					ArvGcLazyGroup *group = g_new0 (ArvGcLazyGroup, 1);
+
+					group->start = tag_start;
+					group->end = i;
+					group->parent = groups[depth - 1];
+					g_ptr_array_add (genicam->priv->lazy_groups, group);
+
+					groups[depth] = group;
+				}
+
+				if (!is_container[depth]) {
+					if (genicam != NULL) {
+						fragment = g_new0 (ArvGcLazyFragment, 1);
+						g_ptr_array_add (genicam->priv->lazy_fragments, fragment);
+					} else
+						fragment = &scan_fragment;
+
+					fragment->start = tag_start;
+					fragment->end = i;
+					fragment->group = groups[depth - 1];
+					fragment_depth = depth;
+				}
+			}
+		}
+
+		if (genicam != NULL && fragment != NULL && value_length > 0 &&
+		    !(name_length == 9 && memcmp (xml + name_start, "EnumEntry", 9) == 0))
+			g_hash_table_insert (genicam->priv->lazy_index,
+					     (char *) arv_dom_document_intern_string_len (ARV_DOM_DOCUMENT (genicam),
+											  xml + value_start,
+											  value_length),
+					     fragment);
+
+		if (is_self_closing) {
+			if (fragment_depth == depth)
+				fragment_depth = -1;
+		} else
+			depth++;
+	}
+
+	return root_found && depth == 0;
+}
+
+static ArvGc *
+_new_lazy (ArvDevice *device, const char *xml, size_t size)
+{
+	ArvDomDocument *document;
+	ArvGc *genicam;
+	GString *skeleton;
+	size_t root_start = 0;
+	size_t root_end = 0;
+	size_t root_name_length = 0;
+	size_t prolog_size = 0;
+
+	/* Scan a first time to retrieve the root element */
+	if (!_lazy_scan (NULL, xml, size, &root_start, &root_end, &root_name_length, &prolog_size))
+		return NULL;
+
+	skeleton = g_string_new_len (xml, prolog_size);
+	g_string_append_len (skeleton, xml + root_start, root_end - root_start);
+	if (skeleton->len < 2 || skeleton->str[skeleton->len - 2] != '/') {
+		g_string_append (skeleton, "</");
+		g_string_append_len (skeleton, xml + root_start + 1, root_name_length);
+		g_string_append (skeleton, ">");
+	}
+
+	document = arv_dom_document_new_from_memory (skeleton->str, skeleton->len, NULL);
+	g_string_free (skeleton, TRUE);
+
+	genicam = arv_gc_new_from_document (device, document);
+	if (genicam == NULL)
+		return NULL;
+
+	genicam->priv->lazy_xml = g_malloc (size);
+	memcpy (genicam->priv->lazy_xml, xml, size);
+	genicam->priv->lazy_prolog_size = prolog_size;
+	genicam->priv->lazy_fragments = g_ptr_array_new_with_free_func (g_free);
+	genicam->priv->lazy_groups = g_ptr_array_new_with_free_func (g_free);
+	genicam->priv->lazy_index = g_hash_table_new (g_str_hash, g_str_equal);
+
+	_lazy_scan (genicam, genicam->priv->lazy_xml, size, &root_start, &root_end, &root_name_length, &prolog_size);
+
+	arv_info_genicam ("[Gc::new] Lazy loading, %u top level nodes, %u names",
+			  genicam->priv->lazy_fragments->len, g_hash_table_size (genicam->priv->lazy_index));
+
+	return genicam;
+}
+
+/**
+ * arv_gc_new:
+ * @device: (allow-none): a #ArvDevice
+ * @xml: genicam xml data
+ * @size: size of @xml, in bytes
+ *
+ * Parses the genicam data, and builds the corresponding node tree. If lazy loading was enabled using
+ * arv_set_genicam_lazy_loading(), the nodes are only instantiated on their first lookup by arv_gc_get_node().
+ *
+ * Return value: (transfer full): a new #ArvGc, NULL on error.
+ */
+
+ArvGc *
+arv_gc_new (ArvDevice *device, const void *xml, size_t size)
+{
+	if (g_atomic_int_get (&arv_gc_lazy_loading)) {
+		ArvGc *genicam = arv_gc_new_lazy (device, xml, size);
+
+		if (genicam != NULL)
+			return genicam;
+	}
+
+	return arv_gc_new_from_document (device, arv_dom_document_new_from_memory (xml, size, NULL));
+}
+
+/**
+ * arv_gc_new_lazy:
+ * @device: (allow-none): a #ArvDevice
+ * @xml: genicam xml data
+ * @size: size of @xml, in bytes
+ *
+ * Creates a genicam document whose nodes are instantiated on demand. At creation, the xml data are only scanned for
+ * node names, and a node is built the first time it is looked up using arv_gc_get_node(), along with the nodes it
+ * contains. The nodes it references, via pValue, pAddress, pIndex, pSelected..., are in turn built when they are
+ * accessed. Startup time and memory usage thus depend on the number of features actually used, rather than on the
+ * size of the genicam data.
+ *
+ * With lazy loading, the document tree only contains the nodes that were looked up, along with the Group elements
+ * containing them.
+ *
+ * Return value: (transfer full): a new #ArvGc, NULL if @xml is not a valid genicam document.
+ *
+ * Since: 0.10.0
+ */
+
+ArvGc *
+arv_gc_new_lazy (ArvDevice *device, const void *xml, size_t size)
+{
+	g_return_val_if_fail (xml != NULL, NULL);
+
+	return _new_lazy (device, xml, size);
+}
+
+/**
+ * arv_set_genicam_lazy_loading:
+ * @enable: enable lazy loading
+ *
+ * Sets whether the genicam documents created by arv_gc_new(), which include the ones of the devices, are lazily
+ * loaded. See arv_gc_new_lazy(). Lazy loading is disabled by default.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_set_genicam_lazy_loading (gboolean enable)
+{
+	g_atomic_int_set (&arv_gc_lazy_loading, enable ? TRUE : FALSE);
+}
+
+#define ARV_GC_ZIP_TAIL_SIZE	4096
+#define ARV_GC_ZIP_CHUNK_SIZE	65536
+
+typedef struct {
+	GAsyncQueue *queue;
+	ArvInflater *inflater;
+	ArvDomParserContext *parser;
+	GByteArray *stored_xml;
+	gint is_error;
+} ArvGcZipLoader;
+
+static gboolean
+_zip_loader_parse_cb (const void *data, size_t size, void *user_data)
+{
+	ArvGcZipLoader *loader = user_data;
+
+	/* Parsing errors are reported by arv_dom_parser_context_finish, the data must still be fully inflated */
+	if (loader->parser != NULL)
+		arv_dom_parser_context_push (loader->parser, data, size);
+
+	return TRUE;
+}
+
+static gpointer
+_zip_loader_thread (gpointer user_data)
+{
+	ArvGcZipLoader *loader = user_data;
+	GBytes *chunk;
+
+	/* An empty chunk marks the end of the compressed data */
+	while ((chunk = g_async_queue_pop (loader->queue)) != NULL) {
+		gsize size;
+		const void *data = g_bytes_get_data (chunk, &size);
+		gboolean success = TRUE;
+
+		if (size == 0) {
+			g_bytes_unref (chunk);
+			break;
+		}
+
+		if (!g_atomic_int_get (&loader->is_error)) {
+			if (loader->inflater != NULL) {
+				success = arv_inflater_push (loader->inflater, data, size, _zip_loader_parse_cb, loader);
+			} else {
+				g_byte_array_append (loader->stored_xml, data, size);
+				_zip_loader_parse_cb (data, size, loader);
+			}
+		}
+
+		if (!success)
+			g_atomic_int_set (&loader->is_error, TRUE);
+
+		g_bytes_unref (chunk);
+	}
+
+	return NULL;
+}
+
+/**
+ * arv_gc_new_from_device_zip: (skip)
+ * @device: a #ArvDevice
+ * @address: address of the zipped genicam data in the device memory
+ * @size: size of the zipped genicam data
+ * @xml: (out) (transfer full): placeholder for the uncompressed genicam data
+ * @xml_size: (out): placeholder for the size of the uncompressed genicam data
+ * @error: a #GError placeholder
+ *
+ * Downloads, inflates and parses a zipped genicam file, the three stages being run concurrently. The file
+ * sizes are first retrieved from the zip central directory, at the end of the archive, which allows to
+ * allocate the output buffer only once. The rest of the archive is then read by chunks, which are inflated and
+ * parsed in a worker thread while the next chunk is being read from the device.
+ *
+ * If the genicam data are successfully inflated but not well formed, @xml is set and %NULL is returned
+ * without setting @error.
+ *
+ * Return value: (transfer full): a new #ArvGc, %NULL on error.
+ */
+
+ArvGc *
+arv_gc_new_from_device_zip (ArvDevice *device, guint64 address, guint64 size,
+			    char **xml, size_t *xml_size, GError **error)
+{
+	ArvGcZipLoader loader = {0};
+	ArvZip *zip;
+	ArvZipFile *zip_file;
+	GThread *thread;
+	GError *local_error = NULL;
+	ArvDomDocument *document;
+	const GSList *zip_files;
+	guint8 *buffer;
+	size_t tail_size;
+	size_t compressed_size;
+	size_t uncompressed_size;
+	guint16 compression_method;
+	guint64 position;
+	guint64 data_start;
+	guint64 data_end;
+	ptrdiff_t header_offset;
+
+	g_return_val_if_fail (ARV_IS_DEVICE (device), NULL);
+	g_return_val_if_fail (xml != NULL, NULL);
+	g_return_val_if_fail (xml_size != NULL, NULL);
+
+	*xml = NULL;
+	*xml_size = 0;
+
+	if (size == 0)
+		return NULL;
+
+	/* Central directory */
+
+	tail_size = MIN (size, ARV_GC_ZIP_TAIL_SIZE);
+	buffer = g_malloc (MAX (tail_size, ARV_GC_ZIP_CHUNK_SIZE));
+
+	if (!arv_device_read_memory (device, address + size - tail_size, tail_size, buffer, error)) {
+		g_free (buffer);
+		return NULL;
+	}
+
+	zip = arv_zip_new_partial (buffer, tail_size, size - tail_size);
+	zip_files = arv_zip_get_file_list (zip);
+	if (zip_files == NULL) {
+		arv_zip_free (zip);
+
+		if (tail_size == size) {
+			g_free (buffer);
+			return NULL;
+		}
+
+		/* Central directory larger than the tail, fallback to a complete download */
+
+		arv_info_genicam ("[Gc::new_from_device_zip] Central directory not found in archive tail");
+
+		buffer = g_realloc (buffer, size);
+		if (!arv_device_read_memory (device, address, size, buffer, error)) {
+			g_free (buffer);
+			return NULL;
+		}
+
+		zip = arv_zip_new (buffer, size);
+		zip_files = arv_zip_get_file_list (zip);
+		if (zip_files != NULL)
+			*xml = arv_zip_get_file (zip, arv_zip_file_get_name (zip_files->data), xml_size);
+		arv_zip_free (zip);
+		g_free (buffer);
+
+		return *xml != NULL ? arv_gc_new (device, *xml, *xml_size) : NULL;
+	}
+
+	zip_file = zip_files->data;
+	compressed_size = arv_zip_file_get_compressed_size (zip_file);
+	uncompressed_size = arv_zip_file_get_uncompressed_size (zip_file);
+	header_offset = arv_zip_get_file_header_offset (zip, zip_file);
+	compression_method = arv_zip_file_get_compression_method (zip_file);
+
+	arv_info_genicam ("[Gc::new_from_device_zip] %s: %" G_GSIZE_FORMAT " bytes, %" G_GSIZE_FORMAT
+			  " bytes compressed", arv_zip_file_get_name (zip_file), uncompressed_size, compressed_size);
+
+	arv_zip_free (zip);
+
+	if (header_offset < 0 || header_offset + 30 > size) {
+		arv_warning_genicam ("[Gc::new_from_device_zip] Invalid local header offset");
+		g_free (buffer);
+		return NULL;
+	}
+
+	if (compression_method != ARV_ZIP_COMPRESSION_METHOD_STORED &&
+	    compression_method != ARV_ZIP_COMPRESSION_METHOD_DEFLATED) {
+		arv_warning_genicam ("[Gc::new_from_device_zip] Unsupported compression method (%d)",
+				     compression_method);
+		g_free (buffer);
+		return NULL;
+	}
+
+	/* Streaming, the document is only parsed on the fly if lazy loading is disabled */
+
+	if (!g_atomic_int_get (&arv_gc_lazy_loading)) {
+		loader.parser = arv_dom_parser_context_new ();
+		if (loader.parser == NULL) {
+			g_free (buffer);
+			return NULL;
+		}
+	}
+
+	if (compression_method == ARV_ZIP_COMPRESSION_METHOD_DEFLATED) {
+		loader.inflater = arv_inflater_new (uncompressed_size);
+		if (loader.inflater == NULL) {
+			arv_dom_parser_context_free (loader.parser);
+			g_free (buffer);
+			return NULL;
+		}
+	} else {
+		loader.stored_xml = g_byte_array_sized_new (uncompressed_size);
+	}
+
+	loader.queue = g_async_queue_new_full ((GDestroyNotify) g_bytes_unref);
+	thread = g_thread_new ("arv_gc_zip", _zip_loader_thread, &loader);
+
+	position = header_offset;
+	data_start = 0;
+	data_end = 0;
+
+	while (data_start == 0 || position < data_end) {
+		size_t chunk_size;
+		size_t chunk_start = 0;
+
+		if (g_atomic_int_get (&loader.is_error))
+			break;
+
+		chunk_size = MIN (size - position, ARV_GC_ZIP_CHUNK_SIZE);
+		if (data_end > 0)
+			chunk_size = MIN (chunk_size, data_end - position);
+
+		if (!arv_device_read_memory (device, address + position, chunk_size, buffer, &local_error))
+			break;
+
+		if (data_start == 0) {
+			/* First chunk, which starts with the local file header */
+			if (chunk_size < 30 ||
+			    ARV_GUINT32_FROM_LE_PTR ((char *) buffer, 0) != 0x04034b50) {
+				arv_warning_genicam ("[Gc::new_from_device_zip] Magic number for file header "
+						     "not found (0x04034b50)");
+				g_atomic_int_set (&loader.is_error, TRUE);
+				break;
+			}
+
+			if (ARV_GUINT16_FROM_LE_PTR ((char *) buffer, 8) != compression_method) {
+				arv_warning_genicam ("[Gc::new_from_device_zip] Compression method mismatch "
+						     "between local header and central directory");
+				g_atomic_int_set (&loader.is_error, TRUE);
+				break;
+			}
+
+			data_start = header_offset + 30 +
+				ARV_GUINT16_FROM_LE_PTR ((char *) buffer, 26) +
+				ARV_GUINT16_FROM_LE_PTR ((char *) buffer, 28);
+			data_end = data_start + compressed_size;
+
+			if (data_end > size || data_start - position > chunk_size) {
+				arv_warning_genicam ("[Gc::new_from_device_zip] Invalid file header");
+				g_atomic_int_set (&loader.is_error, TRUE);
+				break;
+			}
+
+			chunk_start = data_start - position;
+			chunk_size = MIN (chunk_size, data_end - position);
+		}
+
+		if (chunk_size > chunk_start)
+			g_async_queue_push (loader.queue, g_bytes_new (buffer + chunk_start, chunk_size - chunk_start));
+
+		position += chunk_size;
+	}
+
+	g_async_queue_push (loader.queue, g_bytes_new (NULL, 0));
+	g_thread_join (thread);
+	g_async_queue_unref (loader.queue);
+	g_free (buffer);
+
+	if (local_error == NULL && !g_atomic_int_get (&loader.is_error)) {
+		if (loader.inflater != NULL) {
+			*xml = arv_inflater_finish (loader.inflater, _zip_loader_parse_cb, &loader, xml_size);
+			loader.inflater = NULL;
+		} else {
+			*xml_size = loader.stored_xml->len;
+			*xml = (char *) g_byte_array_free (loader.stored_xml, FALSE);
+			loader.stored_xml = NULL;
+		}
+	}
+
+	arv_inflater_free (loader.inflater);
+	if (loader.stored_xml != NULL)
+		g_byte_array_free (loader.stored_xml, TRUE);
+
+	if (*xml == NULL) {
+		arv_dom_parser_context_free (loader.parser);
+		if (local_error != NULL)
+			g_propagate_error (error, local_error);
+		else
+			arv_warning_genicam ("[Gc::new_from_device_zip] Invalid zipped data");
+		return NULL;
+	}
+
+	if (*xml_size != uncompressed_size)
+		arv_warning_genicam ("[Gc::new_from_device_zip] Unexpected uncompressed size "
+				     "(%" G_GSIZE_FORMAT " instead of %" G_GSIZE_FORMAT ")",
+				     *xml_size, uncompressed_size);
+
+	if (loader.parser == NULL)
+		return arv_gc_new (device, *xml, *xml_size);
+
+	document = arv_dom_parser_context_finish (loader.parser, NULL);
+
+	return arv_gc_new_from_document (device, document);
+}
+
+G_DEFINE_TYPE_WITH_CODE (ArvGc, arv_gc, ARV_TYPE_DOM_DOCUMENT, G_ADD_PRIVATE (ArvGc))
+
+static void
+arv_gc_init (ArvGc *genicam)
+{
+	genicam->priv = arv_gc_get_instance_private (genicam);
+
+	genicam->priv->nodes = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, g_object_unref);
+	genicam->priv->cache_policy = ARV_REGISTER_CACHE_POLICY_DISABLE;
+
+	genicam->priv->dependents = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
+							   (GDestroyNotify) g_ptr_array_unref);
+	genicam->priv->transitive_dependents = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
+								      (GDestroyNotify) g_ptr_array_unref);
+	genicam->priv->pending_dependencies = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+								     (GDestroyNotify) g_array_unref);
+	genicam->priv->new_nodes = g_ptr_array_new ();
+	genicam->priv->is_dependency_graph_stale = TRUE;
+
+	g_rec_mutex_init (&genicam->priv->lazy_mutex);
+}
+
+static void
+arv_gc_finalize (GObject *object)
+{
+	ArvGc *genicam = ARV_GC (object);
+
+	if (genicam->priv->buffer != NULL)
+		g_object_weak_unref (G_OBJECT (genicam->priv->buffer), _weak_notify_cb, genicam);
+
+	g_hash_table_unref (genicam->priv->dependents);
+	g_hash_table_unref (genicam->priv->transitive_dependents);
+	g_hash_table_unref (genicam->priv->pending_dependencies);
+	g_ptr_array_unref (genicam->priv->new_nodes);
+	g_hash_table_unref (genicam->priv->nodes);
+
+	g_clear_pointer (&genicam->priv->lazy_index, g_hash_table_unref);
+	g_clear_pointer (&genicam->priv->lazy_fragments, g_ptr_array_unref);
+	g_clear_pointer (&genicam->priv->lazy_groups, g_ptr_array_unref);
+	g_clear_pointer (&genicam->priv->lazy_xml, g_free);
+	g_rec_mutex_clear (&genicam->priv->lazy_mutex);
+
+	_clear_profile (genicam);
 
 	G_OBJECT_CLASS (arv_gc_parent_class)->finalize (object);
 }
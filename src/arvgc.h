@@ -108,6 +108,7 @@ typedef enum {
 ARV_API G_DECLARE_FINAL_TYPE (ArvGc, arv_gc, ARV, GC, ArvDomDocument)
 
 ARV_API ArvGc *				arv_gc_new				(ArvDevice *device, const void *xml, size_t size);
+ARV_API ArvGc *				arv_gc_new_lazy				(ArvDevice *device, const void *xml, size_t size);
 ARV_API void				arv_gc_register_feature_node		(ArvGc *genicam, ArvGcFeatureNode *node);
 ARV_API void				arv_gc_set_register_cache_policy	(ArvGc *genicam, ArvRegisterCachePolicy policy);
 ARV_API ArvRegisterCachePolicy		arv_gc_get_register_cache_policy	(ArvGc *genicam);
@@ -122,6 +123,18 @@ ARV_API ArvDevice *			arv_gc_get_device			(ArvGc *genicam);
 ARV_API void				arv_gc_set_buffer			(ArvGc *genicam, ArvBuffer *buffer);
 ARV_API ArvBuffer *			arv_gc_get_buffer			(ArvGc *genicam);
 
+ARV_API void				arv_gc_warmup_register_cache		(ArvGc *genicam, guint64 gap_tolerance,
+										 guint *n_registers, guint *n_reads);
+
+ARV_API void				arv_gc_start_profiling			(ArvGc *genicam);
+ARV_API char *				arv_gc_stop_profiling			(ArvGc *genicam);
+
+ARV_API const char **			arv_gc_dup_feature_dependents		(ArvGc *genicam, const char *feature,
+										 gboolean transitive, guint *n_dependents,
+										 GError **error);
+
+ARV_API void				arv_set_genicam_lazy_loading		(gboolean enable);
+
 G_END_DECLS
 
 #endif
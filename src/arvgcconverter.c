@@ -27,11 +27,12 @@
 
 #include <arvgcfeaturenodeprivate.h>
 #include <arvgcconverterprivate.h>
-#include <arvevaluator.h>
+#include <arvevaluatorprivate.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcdefaultsprivate.h>
 #include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvdebugprivate.h>
 #include <string.h>
 
@@ -52,6 +53,16 @@ typedef struct {
 
 	ArvEvaluator *formula_to;
 	ArvEvaluator *formula_from;
+
+	/* Evaluator slots of the variables list, and of the TO and FROM variables */
+	guint *formula_to_slots;
+	guint *formula_from_slots;
+	guint from_slot;
+	guint to_slot;
+
+	/* Memoized results, indexed by ArvGcConverterNodeType */
+	ArvGcMemo double_memos[ARV_GC_CONVERTER_NODE_TYPE_INC + 1];
+	ArvGcMemo int64_memos[ARV_GC_CONVERTER_NODE_TYPE_INC + 1];
 } ArvGcConverterPrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvGcConverter, arv_gc_converter, ARV_TYPE_GC_FEATURE_NODE,
@@ -64,12 +75,16 @@ arv_gc_converter_post_new_child (ArvDomNode *self, ArvDomNode *child)
 {
 	ArvGcConverterPrivate *priv = arv_gc_converter_get_instance_private (ARV_GC_CONVERTER (self));
 
+	arv_gc_converter_invalidate (ARV_GC_CONVERTER (self));
+
 	if (ARV_IS_GC_PROPERTY_NODE (child)) {
 		ArvGcPropertyNode *property_node = ARV_GC_PROPERTY_NODE (child);
 
 		switch (arv_gc_property_node_get_node_type (property_node)) {
 			case ARV_GC_PROPERTY_NODE_TYPE_P_VARIABLE:
 				priv->variables = g_slist_prepend (priv->variables, property_node);
+				g_clear_pointer (&priv->formula_to_slots, g_free);
+				g_clear_pointer (&priv->formula_from_slots, g_free);
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_P_VALUE:
 				priv->value = property_node;
@@ -126,6 +141,8 @@ arv_gc_converter_init (ArvGcConverter *self)
 
 	priv->formula_to = arv_evaluator_new (NULL);
 	priv->formula_from = arv_evaluator_new (NULL);
+	priv->from_slot = arv_evaluator_get_variable_slot (priv->formula_to, "FROM");
+	priv->to_slot = arv_evaluator_get_variable_slot (priv->formula_from, "TO");
 	priv->value = NULL;
 }
 
@@ -156,6 +173,8 @@ arv_gc_converter_finalize (GObject *object)
 
 	g_object_unref (priv->formula_to);
 	g_object_unref (priv->formula_from);
+	g_free (priv->formula_to_slots);
+	g_free (priv->formula_from_slots);
 
 	G_OBJECT_CLASS (arv_gc_converter_parent_class)->finalize (object);
 }
@@ -175,6 +194,22 @@ arv_gc_converter_class_init (ArvGcConverterClass *this_class)
 
 /* ArvGcInteger interface implementation */
 
+static guint *
+_get_variable_slots (GSList *variables, ArvEvaluator *evaluator, guint **slots)
+{
+	if (*slots == NULL && variables != NULL) {
+		GSList *iter;
+		guint i;
+
+		*slots = g_new (guint, g_slist_length (variables));
+		for (iter = variables, i = 0; iter != NULL; iter = iter->next, i++)
+			(*slots)[i] = arv_evaluator_get_variable_slot (evaluator,
+								       arv_gc_property_node_get_name (iter->data));
+	}
+
+	return *slots;
+}
+
 ArvGcIsLinear
 arv_gc_converter_get_is_linear (ArvGcConverter *gc_converter, GError **error)
 {
@@ -207,6 +242,8 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 	GError *local_error = NULL;
 	GSList *iter;
 	const char *expression;
+	guint *variable_slots;
+	guint i;
 
 	if (priv->formula_from_node != NULL)
 		expression = arv_gc_property_node_get_string (priv->formula_from_node, &local_error);
@@ -250,7 +287,9 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 		arv_evaluator_set_constant (priv->formula_from, name, constant);
 	}
 
-	for (iter = priv->variables; iter != NULL; iter = iter->next) {
+	variable_slots = _get_variable_slots (priv->variables, priv->formula_from, &priv->formula_from_slots);
+
+	for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++) {
 		ArvGcPropertyNode *variable_node = iter->data;
 
 		node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (variable_node));
@@ -264,9 +303,7 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
                                 return FALSE;
                         }
 
-			arv_evaluator_set_int64_variable (priv->formula_from,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula_from, variable_slots[i], value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -277,9 +314,7 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 				return FALSE;
 			}
 
-			arv_evaluator_set_double_variable (priv->formula_from,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula_from, variable_slots[i], value);
 		}
 	}
 
@@ -315,7 +350,7 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
 				return FALSE;
 			}
 
-			arv_evaluator_set_int64_variable (priv->formula_from, "TO", value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula_from, priv->to_slot, value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -348,7 +383,7 @@ arv_gc_converter_update_from_variables (ArvGcConverter *gc_converter, ArvGcConve
                                 return FALSE;
                         }
 
-			arv_evaluator_set_double_variable (priv->formula_from, "TO", value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula_from, priv->to_slot, value);
 		} else {
 			arv_warning_genicam ("[GcConverter::set_value] Invalid pValue node '%s'",
 					     arv_gc_property_node_get_string (priv->value, NULL));
@@ -371,10 +406,20 @@ arv_gc_converter_convert_to_double (ArvGcConverter *gc_converter, ArvGcConverter
 {
 	ArvGcConverterPrivate *priv = arv_gc_converter_get_instance_private (gc_converter);
 	GError *local_error = NULL;
+	ArvGcMemo *memo = NULL;
+	ArvGc *genicam;
         double value;
 
 	g_return_val_if_fail (ARV_IS_GC_CONVERTER (gc_converter), 0.0);
 
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (gc_converter));
+	if (genicam != NULL && node_type < G_N_ELEMENTS (priv->double_memos)) {
+		memo = &priv->double_memos[node_type];
+		if (arv_gc_memo_is_valid (genicam, memo))
+			return memo->value.v_double;
+		arv_gc_memo_begin (genicam, memo);
+	}
+
 	if (!arv_gc_converter_update_from_variables (gc_converter, node_type, &local_error)) {
 		if (local_error != NULL)
                         g_propagate_prefixed_error (error, local_error, "[%s] ",
@@ -392,6 +437,11 @@ arv_gc_converter_convert_to_double (ArvGcConverter *gc_converter, ArvGcConverter
 
 	value = arv_evaluator_evaluate_as_double (priv->formula_from, &local_error);
 
+	if (memo != NULL) {
+		memo->value.v_double = value;
+		arv_gc_memo_end (genicam, memo, local_error == NULL);
+	}
+
         if (local_error != NULL)
                 g_propagate_prefixed_error (error, local_error, "[%s] ",
                                             arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_converter)));
@@ -404,10 +454,20 @@ arv_gc_converter_convert_to_int64 (ArvGcConverter *gc_converter, ArvGcConverterN
 {
 	ArvGcConverterPrivate *priv = arv_gc_converter_get_instance_private (gc_converter);
 	GError *local_error = NULL;
+	ArvGcMemo *memo = NULL;
+	ArvGc *genicam;
         gint64 value;
 
 	g_return_val_if_fail (ARV_IS_GC_CONVERTER (gc_converter), 0);
 
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (gc_converter));
+	if (genicam != NULL && node_type < G_N_ELEMENTS (priv->int64_memos)) {
+		memo = &priv->int64_memos[node_type];
+		if (arv_gc_memo_is_valid (genicam, memo))
+			return memo->value.v_int64;
+		arv_gc_memo_begin (genicam, memo);
+	}
+
 	if (!arv_gc_converter_update_from_variables (gc_converter, node_type, &local_error)) {
 		if (local_error != NULL)
                         g_propagate_prefixed_error (error, local_error, "[%s] ",
@@ -425,6 +485,11 @@ arv_gc_converter_convert_to_int64 (ArvGcConverter *gc_converter, ArvGcConverterN
 
 	value = arv_evaluator_evaluate_as_double (priv->formula_from, &local_error);
 
+	if (memo != NULL) {
+		memo->value.v_int64 = value;
+		arv_gc_memo_end (genicam, memo, local_error == NULL);
+	}
+
         if (local_error != NULL)
                 g_propagate_prefixed_error (error, local_error, "[%s] ",
                                             arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_converter)));
@@ -440,6 +505,8 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 	GError *local_error = NULL;
 	GSList *iter;
 	const char *expression;
+	guint *variable_slots;
+	guint i;
 
 	if (priv->formula_to_node != NULL)
 		expression = arv_gc_property_node_get_string (priv->formula_to_node, &local_error);
@@ -483,7 +550,9 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 		arv_evaluator_set_constant (priv->formula_to, name, constant);
 	}
 
-	for (iter = priv->variables; iter != NULL; iter = iter->next) {
+	variable_slots = _get_variable_slots (priv->variables, priv->formula_to, &priv->formula_to_slots);
+
+	for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++) {
 		ArvGcPropertyNode *variable_node = iter->data;
 
 		node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (variable_node));
@@ -497,9 +566,7 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 				return;
 			}
 
-			arv_evaluator_set_int64_variable (priv->formula_to,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula_to, variable_slots[i], value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -510,9 +577,7 @@ arv_gc_converter_update_to_variables (ArvGcConverter *gc_converter, GError **err
 				return;
 			}
 
-			arv_evaluator_set_double_variable (priv->formula_to,
-							   arv_gc_property_node_get_name (variable_node),
-							   value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula_to, variable_slots[i], value);
 		}
 	}
 
@@ -552,7 +617,7 @@ arv_gc_converter_convert_from_double (ArvGcConverter *gc_converter, double value
 	g_return_if_fail (ARV_IS_GC_CONVERTER (gc_converter));
 
 	arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (gc_converter));
-	arv_evaluator_set_double_variable (priv->formula_to, "FROM", value);
+	arv_evaluator_set_double_variable_by_slot (priv->formula_to, priv->from_slot, value);
 	arv_gc_converter_update_to_variables (gc_converter, &local_error);
 
         if (local_error != NULL)
@@ -569,7 +634,7 @@ arv_gc_converter_convert_from_int64 (ArvGcConverter *gc_converter, gint64 value,
 	g_return_if_fail (ARV_IS_GC_CONVERTER (gc_converter));
 
 	arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (gc_converter));
-	arv_evaluator_set_int64_variable (priv->formula_to, "FROM", value);
+	arv_evaluator_set_int64_variable_by_slot (priv->formula_to, priv->from_slot, value);
 	arv_gc_converter_update_to_variables (gc_converter, &local_error);
 
         if (local_error != NULL)
@@ -577,6 +642,20 @@ arv_gc_converter_convert_from_int64 (ArvGcConverter *gc_converter, gint64 value,
                                             arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_converter)));
 }
 
+void
+arv_gc_converter_invalidate (ArvGcConverter *gc_converter)
+{
+	ArvGcConverterPrivate *priv = arv_gc_converter_get_instance_private (gc_converter);
+	unsigned int i;
+
+	g_return_if_fail (ARV_IS_GC_CONVERTER (gc_converter));
+
+	for (i = 0; i < G_N_ELEMENTS (priv->double_memos); i++) {
+		arv_gc_memo_invalidate (&priv->double_memos[i]);
+		arv_gc_memo_invalidate (&priv->int64_memos[i]);
+	}
+}
+
 ArvGcRepresentation
 arv_gc_converter_get_representation (ArvGcConverter *gc_converter)
 {
@@ -47,6 +47,7 @@ double 			arv_gc_converter_convert_to_double 	(ArvGcConverter *gc_converter, Arv
 								 GError **error);
 void 			arv_gc_converter_convert_from_int64 	(ArvGcConverter *gc_converter, gint64 value, GError **error);
 void			arv_gc_converter_convert_from_double 	(ArvGcConverter *gc_converter, double value, GError **error);
+void			arv_gc_converter_invalidate		(ArvGcConverter *gc_converter);
 
 G_END_DECLS
 
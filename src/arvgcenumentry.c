@@ -25,7 +25,8 @@
  * @short_description: Class for EnumEntry nodes
  */
 
-#include <arvgcenumentry.h>
+#include <arvgcenumentryprivate.h>
+#include <arvgcprivate.h>
 #include <arvgc.h>
 #include <string.h>
 
@@ -33,6 +34,8 @@ struct _ArvGcEnumEntry {
 	ArvGcFeatureNode base;
 
 	ArvGcPropertyNode *value;
+
+	ArvGcMemo selectable_memo;
 };
 
 struct _ArvGcEnumEntryClass {
@@ -54,6 +57,8 @@ arv_gc_enum_entry_post_new_child (ArvDomNode *self, ArvDomNode *child)
 {
 	ArvGcEnumEntry *node = ARV_GC_ENUM_ENTRY (self);
 
+	arv_gc_enum_entry_invalidate (node);
+
 	if (ARV_IS_GC_PROPERTY_NODE (child)) {
 		ArvGcPropertyNode *property_node = ARV_GC_PROPERTY_NODE (child);
 
@@ -102,6 +107,51 @@ arv_gc_enum_entry_get_value (ArvGcEnumEntry *entry, GError **error)
 	return value;
 }
 
+/* An entry is selectable if it is both available and implemented. The result is memoized until one of the
+ * pIsAvailable or pIsImplemented dependencies is changed. */
+
+gboolean
+arv_gc_enum_entry_is_selectable (ArvGcEnumEntry *entry, GError **error)
+{
+	ArvGc *genicam;
+	GError *local_error = NULL;
+	gboolean is_selectable;
+
+	g_return_val_if_fail (ARV_IS_GC_ENUM_ENTRY (entry), FALSE);
+	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (entry));
+	if (arv_gc_memo_is_valid (genicam, &entry->selectable_memo))
+		return entry->selectable_memo.value.v_int64 != 0;
+
+	if (genicam != NULL)
+		arv_gc_memo_begin (genicam, &entry->selectable_memo);
+
+	is_selectable = arv_gc_feature_node_is_available (ARV_GC_FEATURE_NODE (entry), &local_error);
+	if (is_selectable && local_error == NULL)
+		is_selectable = arv_gc_feature_node_is_implemented (ARV_GC_FEATURE_NODE (entry), &local_error);
+
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		return FALSE;
+	}
+
+	if (genicam != NULL) {
+		entry->selectable_memo.value.v_int64 = is_selectable;
+		arv_gc_memo_end (genicam, &entry->selectable_memo, TRUE);
+	}
+
+	return is_selectable;
+}
+
+void
+arv_gc_enum_entry_invalidate (ArvGcEnumEntry *entry)
+{
+	g_return_if_fail (ARV_IS_GC_ENUM_ENTRY (entry));
+
+	arv_gc_memo_invalidate (&entry->selectable_memo);
+}
+
 ArvGcNode *
 arv_gc_enum_entry_new (void)
 {
@@ -25,13 +25,14 @@
  * @short_description: Class for Enumeration nodes
  */
 
-#include <arvgcenumeration.h>
-#include <arvgcenumentry.h>
+#include <arvgcenumerationprivate.h>
+#include <arvgcenumentryprivate.h>
 #include <arvgcinteger.h>
 #include <arvgcselector.h>
 #include <arvgcstring.h>
 #include <arvgcfeaturenodeprivate.h>
 #include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvmisc.h>
 #include <arvdebugprivate.h>
 #include <string.h>
@@ -44,6 +45,10 @@ struct _ArvGcEnumeration {
 
 	GSList *selecteds;		/* #ArvGcPropertyNode */
 	GSList *selected_features;	/* #ArvGcFeatureNode */
+
+	GHashTable *entries_by_name;	/* name -> #ArvGcEnumEntry */
+	GHashTable *entries_by_value;	/* gint64 -> #ArvGcEnumEntry */
+	ArvGcMemo entries_by_value_memo;
 };
 
 struct _ArvGcEnumerationClass {
@@ -93,8 +98,11 @@ arv_gc_enumeration_post_new_child (ArvDomNode *self, ArvDomNode *child)
 				ARV_DOM_NODE_CLASS (arv_gc_enumeration_parent_class)->post_new_child (self, child);
 				break;
 		}
-	} else if (ARV_IS_GC_ENUM_ENTRY (child))
+	} else if (ARV_IS_GC_ENUM_ENTRY (child)) {
 		node->entries = g_slist_prepend (node->entries, child);
+		g_clear_pointer (&node->entries_by_name, g_hash_table_unref);
+		arv_gc_enumeration_invalidate (node);
+	}
 }
 
 static void
@@ -137,9 +145,9 @@ arv_gc_enumeration_dup_available_int_values (ArvGcEnumeration *enumeration, guin
 
 	*n_values = 0;
 	for (iter = entries; iter != NULL; iter = iter->next) {
-		gboolean is_available;
+		gboolean is_selectable;
 
-		is_available = arv_gc_feature_node_is_available (iter->data, &local_error);
+		is_selectable = arv_gc_enum_entry_is_selectable (iter->data, &local_error);
 
 		if (local_error != NULL) {
 			g_propagate_prefixed_error (error, local_error, "[%s] ",
@@ -150,24 +158,9 @@ arv_gc_enumeration_dup_available_int_values (ArvGcEnumeration *enumeration, guin
 			return NULL;
 		}
 
-		if (is_available) {
-			gboolean is_implemented;
-
-			is_implemented = arv_gc_feature_node_is_implemented (iter->data, &local_error);
-
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                                *n_values = 0;
-                                g_slist_free (available_entries);
-
-				return NULL;
-			}
-
-			if (is_implemented) {
-				(*n_values)++;
-				available_entries = g_slist_prepend (available_entries, iter->data);
-			}
+		if (is_selectable) {
+			(*n_values)++;
+			available_entries = g_slist_prepend (available_entries, iter->data);
 		}
 	}
 
@@ -218,12 +211,12 @@ _dup_available_string_values (ArvGcEnumeration *enumeration, gboolean display_na
 
 	*n_values = 0;
 	for (iter = entries; iter != NULL; iter = iter->next) {
-		gboolean is_available;
+		gboolean is_selectable;
 
-		is_available = arv_gc_feature_node_is_available (iter->data, &local_error);
+		is_selectable = arv_gc_enum_entry_is_selectable (iter->data, &local_error);
 
 		if (local_error != NULL) {
-                        g_propagate_prefixed_error (error, local_error, "[%s] ",
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
                                                     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
 			*n_values = 0;
 			g_slist_free (available_entries);
@@ -231,24 +224,9 @@ _dup_available_string_values (ArvGcEnumeration *enumeration, gboolean display_na
 			return NULL;
 		}
 
-		if (is_available) {
-			gboolean is_implemented;
-
-			is_implemented = arv_gc_feature_node_is_implemented (iter->data, &local_error);
-
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                                *n_values = 0;
-                                g_slist_free (available_entries);
-
-				return NULL;
-			}
-
-			if (is_implemented) {
-				(*n_values)++;
-				available_entries = g_slist_prepend (available_entries, iter->data);
-			}
+		if (is_selectable) {
+			(*n_values)++;
+			available_entries = g_slist_prepend (available_entries, iter->data);
 		}
 	}
 
@@ -312,6 +290,111 @@ arv_gc_enumeration_dup_available_display_names (ArvGcEnumeration *enumeration, g
 	return _dup_available_string_values (enumeration, TRUE, n_values, error);
 }
 
+/* Entry indexes. The name index is built once, as entry names can't change. The value index is invalidated through the
+ * dependency graph when an entry value changes, and is not kept if entry values were read from the device without
+ * being cached. When several entries have the same name or value, the index returns the first one in the entry list,
+ * as the former linear lookups did. */
+
+static ArvGcEnumEntry *
+_get_entry_by_name (ArvGcEnumeration *enumeration, const char *name)
+{
+	if (name == NULL)
+		return NULL;
+
+	if (enumeration->entries_by_name == NULL) {
+		const GSList *iter;
+
+		enumeration->entries_by_name = g_hash_table_new (g_str_hash, g_str_equal);
+
+		for (iter = enumeration->entries; iter != NULL; iter = iter->next) {
+			const char *entry_name = arv_gc_feature_node_get_name (iter->data);
+
+			if (entry_name != NULL && !g_hash_table_contains (enumeration->entries_by_name, entry_name))
+				g_hash_table_insert (enumeration->entries_by_name, (char *) entry_name, iter->data);
+		}
+	}
+
+	return g_hash_table_lookup (enumeration->entries_by_name, name);
+}
+
+static ArvGcEnumEntry *
+_get_entry_by_value (ArvGcEnumeration *enumeration, gint64 value, GError **error)
+{
+	ArvGc *genicam;
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (enumeration));
+
+	if (enumeration->entries_by_value == NULL)
+		enumeration->entries_by_value = g_hash_table_new_full (g_int64_hash, g_int64_equal, g_free, NULL);
+	else if (arv_gc_memo_is_valid (genicam, &enumeration->entries_by_value_memo))
+		return g_hash_table_lookup (enumeration->entries_by_value, &value);
+
+	g_hash_table_remove_all (enumeration->entries_by_value);
+
+	if (genicam != NULL)
+		arv_gc_memo_begin (genicam, &enumeration->entries_by_value_memo);
+
+	{
+		const GSList *iter;
+
+		for (iter = enumeration->entries; iter != NULL; iter = iter->next) {
+			GError *local_error = NULL;
+			gint64 entry_value;
+
+			entry_value = arv_gc_enum_entry_get_value (iter->data, &local_error);
+
+			if (local_error != NULL) {
+				g_propagate_error (error, local_error);
+				g_hash_table_remove_all (enumeration->entries_by_value);
+				return NULL;
+			}
+
+			if (!g_hash_table_contains (enumeration->entries_by_value, &entry_value)) {
+				gint64 *key = g_new (gint64, 1);
+
+				*key = entry_value;
+				g_hash_table_insert (enumeration->entries_by_value, key, iter->data);
+			}
+		}
+	}
+
+	if (genicam != NULL)
+		arv_gc_memo_end (genicam, &enumeration->entries_by_value_memo, TRUE);
+
+	return g_hash_table_lookup (enumeration->entries_by_value, &value);
+}
+
+void
+arv_gc_enumeration_invalidate (ArvGcEnumeration *enumeration)
+{
+	g_return_if_fail (ARV_IS_GC_ENUMERATION (enumeration));
+
+	arv_gc_memo_invalidate (&enumeration->entries_by_value_memo);
+}
+
+static gboolean
+_has_selectable_entry (ArvGcEnumeration *enumeration, GError **error)
+{
+	const GSList *iter;
+
+	for (iter = enumeration->entries; iter != NULL; iter = iter->next) {
+		GError *local_error = NULL;
+		gboolean is_selectable;
+
+		is_selectable = arv_gc_enum_entry_is_selectable (iter->data, &local_error);
+
+		if (local_error != NULL) {
+			g_propagate_error (error, local_error);
+			return FALSE;
+		}
+
+		if (is_selectable)
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
 static gint64
 _get_int_value (ArvGcEnumeration *enumeration, GError **error)
 {
@@ -353,40 +436,47 @@ _set_int_value (ArvGcEnumeration *enumeration, gint64 value, GError **error)
 
 	if (enumeration->value) {
 		GError *local_error = NULL;
-
-		{
-			gint64 *available_values;
-			unsigned n_values;
-			unsigned i;
-			gboolean found = FALSE;
-
-			available_values = arv_gc_enumeration_dup_available_int_values (enumeration, &n_values, &local_error);
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-				return FALSE;
-			}
-
-			if (available_values == NULL) {
-				g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_EMPTY_ENUMERATION,
-					     "[%s] No available entry found",
-					     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-				return FALSE;
+		ArvGcEnumEntry *entry;
+		gboolean is_selectable = FALSE;
+
+		entry = _get_entry_by_value (enumeration, value, &local_error);
+		if (entry != NULL && local_error == NULL)
+			is_selectable = arv_gc_enum_entry_is_selectable (entry, &local_error);
+
+		/* The value index only holds the first entry of a given value. Any selectable entry sharing this
+		 * value makes it valid, as with the scan of the available values. */
+		if (entry != NULL && !is_selectable && local_error == NULL) {
+			const GSList *iter;
+
+			for (iter = g_slist_find (enumeration->entries, entry)->next;
+			     iter != NULL && !is_selectable && local_error == NULL;
+			     iter = iter->next) {
+				if (arv_gc_enum_entry_get_value (iter->data, &local_error) == value && local_error == NULL)
+					is_selectable = arv_gc_enum_entry_is_selectable (iter->data, &local_error);
 			}
+		}
 
-			for (i = 0; i < n_values; i++)
-				if (available_values[i] == value)
-					found = TRUE;
+		/* Only look at the other entries on failure, for the error report */
+		if (!is_selectable && local_error == NULL &&
+		    !_has_selectable_entry (enumeration, &local_error) && local_error == NULL) {
+			g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_EMPTY_ENUMERATION,
+				     "[%s] No available entry found",
+				     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
+		}
 
-			g_free (available_values);
+		if (local_error != NULL) {
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
+		}
 
-			if (!found) {
-				g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE,
-					     "[%s] Value %" G_GINT64_FORMAT " not found",
-					     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)),
-                                             value);
-				return FALSE;
-			}
+		if (!is_selectable) {
+			g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE,
+				     "[%s] Value %" G_GINT64_FORMAT " not found",
+				     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)),
+				     value);
+			return FALSE;
 		}
 
 		arv_gc_feature_node_increment_change_count (ARV_GC_FEATURE_NODE (enumeration));
@@ -419,7 +509,7 @@ arv_gc_enumeration_set_int_value (ArvGcEnumeration *enumeration, gint64 value, G
 static const char *
 _get_string_value (ArvGcEnumeration *enumeration, GError **error)
 {
-	const GSList *iter;
+	ArvGcEnumEntry *entry;
 	GError *local_error = NULL;
 	gint64 value;
 
@@ -434,25 +524,21 @@ _get_string_value (ArvGcEnumeration *enumeration, GError **error)
 		return NULL;
 	}
 
-	for (iter = enumeration->entries; iter != NULL; iter = iter->next) {
-		gint64 enum_value;
-
-		enum_value = arv_gc_enum_entry_get_value (iter->data, &local_error);
+	entry = _get_entry_by_value (enumeration, value, &local_error);
 
-		if (local_error != NULL) {
-                        g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                        return NULL;
-                }
+	if (local_error != NULL) {
+		g_propagate_prefixed_error (error, local_error, "[%s] ",
+					    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+		return NULL;
+	}
 
-		if (enum_value == value) {
-			const char *string;
+	if (entry != NULL) {
+		const char *string;
 
-			string = arv_gc_feature_node_get_name (iter->data);
-			arv_debug_genicam ("[GcEnumeration::get_string_value] value = %" G_GINT64_FORMAT " - string = %s",
-					 value, string);
-			return string;
-		}
+		string = arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (entry));
+		arv_debug_genicam ("[GcEnumeration::get_string_value] value = %" G_GINT64_FORMAT " - string = %s",
+				 value, string);
+		return string;
 	}
 
 	arv_warning_genicam ("[GcEnumeration::get_string_value] value = %" G_GINT64_FORMAT " not found for node %s",
@@ -473,38 +559,38 @@ arv_gc_enumeration_get_string_value (ArvGcEnumeration *enumeration, GError **err
 static gboolean
 _set_string_value (ArvGcEnumeration *enumeration, const char *value, GError **error)
 {
-	const GSList *iter;
+	ArvGcEnumEntry *entry;
 
 	g_return_val_if_fail (ARV_IS_GC_ENUMERATION (enumeration), FALSE);
 	g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-	for (iter = enumeration->entries; iter != NULL; iter = iter->next)
-		if (g_strcmp0 (arv_gc_feature_node_get_name (iter->data), value) == 0) {
-			GError *local_error = NULL;
-			gint64 enum_value;
-
-			enum_value = arv_gc_enum_entry_get_value (iter->data, &local_error);
+	entry = _get_entry_by_name (enumeration, value);
+	if (entry != NULL) {
+		GError *local_error = NULL;
+		gint64 enum_value;
 
-			arv_debug_genicam ("[GcEnumeration::set_string_value] value = %" G_GINT64_FORMAT " - string = %s",
-					 enum_value, value);
+		enum_value = arv_gc_enum_entry_get_value (entry, &local_error);
 
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-                                return FALSE;
-                        }
+		arv_debug_genicam ("[GcEnumeration::set_string_value] value = %" G_GINT64_FORMAT " - string = %s",
+				 enum_value, value);
 
-			_set_int_value (enumeration, enum_value, &local_error);
+		if (local_error != NULL) {
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
+		}
 
-			if (local_error != NULL) {
-                                g_propagate_prefixed_error (error, local_error, "[%s] ",
-                                                            arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
-				return FALSE;
-			}
+		_set_int_value (enumeration, enum_value, &local_error);
 
-			return TRUE;
+		if (local_error != NULL) {
+			g_propagate_prefixed_error (error, local_error, "[%s] ",
+						    arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (enumeration)));
+			return FALSE;
 		}
 
+		return TRUE;
+	}
+
 	arv_warning_genicam ("[GcEnumeration::set_string_value] entry %s not found", value);
 
 	g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_ENUM_ENTRY_NOT_FOUND, "[%s] '%s' not an entry",
@@ -576,6 +662,8 @@ arv_gc_enumeration_finalize (GObject *object)
 	g_clear_pointer (&enumeration->entries, g_slist_free);
 	g_clear_pointer (&enumeration->selecteds, g_slist_free);
 	g_clear_pointer (&enumeration->selected_features, g_slist_free);
+	g_clear_pointer (&enumeration->entries_by_name, g_hash_table_unref);
+	g_clear_pointer (&enumeration->entries_by_value, g_hash_table_unref);
 
 	G_OBJECT_CLASS (arv_gc_enumeration_parent_class)->finalize (object);
 }
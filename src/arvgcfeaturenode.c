@@ -29,8 +29,10 @@
  */
 
 #include <arvgcfeaturenodeprivate.h>
+#include <arvdomdocumentprivate.h>
 #include <arvgcpropertynode.h>
 #include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvgcboolean.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
@@ -46,6 +48,10 @@ typedef struct {
 	char *name;
 	ArvGcNameSpace name_space;
         char *comment;
+	gboolean name_is_interned;
+	gboolean comment_is_interned;
+	/* Keeps the interned name and comment valid, even if the node outlives its document */
+	ArvDomStringPool *string_pool;
 
 	ArvGcPropertyNode *tooltip;
 	ArvGcPropertyNode *description;
@@ -55,6 +61,7 @@ typedef struct {
 	ArvGcPropertyNode *is_available;
 	ArvGcPropertyNode *is_locked;
 	ArvGcPropertyNode *imposed_access_mode;
+	ArvGcPropertyNode *polling_time;
 	ArvGcPropertyNode *streamable;
         ArvGcPropertyNode *is_deprecated;
         ArvGcPropertyNode *alias;
@@ -108,6 +115,9 @@ arv_gc_feature_node_post_new_child (ArvDomNode *self, ArvDomNode *child)
 			case ARV_GC_PROPERTY_NODE_TYPE_IMPOSED_ACCESS_MODE:
 				priv->imposed_access_mode = property_node;
 				break;
+			case ARV_GC_PROPERTY_NODE_TYPE_POLLING_TIME:
+				priv->polling_time = property_node;
+				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_STREAMABLE:
 				priv->streamable = property_node;       	/* TODO */
 				break;
@@ -159,6 +169,9 @@ arv_gc_feature_node_pre_remove_child (ArvDomNode *self, ArvDomNode *child)
 			case ARV_GC_PROPERTY_NODE_TYPE_IMPOSED_ACCESS_MODE:
 				priv->imposed_access_mode =  NULL;
 				break;
+			case ARV_GC_PROPERTY_NODE_TYPE_POLLING_TIME:
+				priv->polling_time = NULL;
+				break;
 			default:
 				break;
 		}
@@ -167,6 +180,32 @@ arv_gc_feature_node_pre_remove_child (ArvDomNode *self, ArvDomNode *child)
 
 /* ArvDomNode implementation */
 
+/* Attribute values are stored in the string pool of the owner document when there is one, in order to save one
+ * allocation per node, and to share the storage of identical comments and enumeration entry names */
+
+static void
+_set_string (ArvGcFeatureNode *self, char **string, gboolean *is_interned, const char *value)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
+	ArvDomDocument *document = arv_dom_node_get_owner_document (ARV_DOM_NODE (self));
+	ArvDomStringPool *pool = document != NULL ? arv_dom_document_get_string_pool (document) : NULL;
+
+	if (!*is_interned)
+		g_free (*string);
+
+	if (priv->string_pool == NULL && pool != NULL)
+		priv->string_pool = arv_dom_string_pool_ref (pool);
+
+	/* Only the pool of the first owner document is referenced */
+	if (pool != NULL && pool == priv->string_pool && value != NULL) {
+		*string = (char *) arv_dom_string_pool_intern (pool, value, -1);
+		*is_interned = TRUE;
+	} else {
+		*string = g_strdup (value);
+		*is_interned = FALSE;
+	}
+}
+
 static void
 arv_gc_feature_node_set_attribute (ArvDomElement *self, const char *name, const char *value)
 {
@@ -175,8 +214,7 @@ arv_gc_feature_node_set_attribute (ArvDomElement *self, const char *name, const
 	if (strcmp (name, "Name") == 0) {
 		ArvGc *genicam;
 
-		g_free (priv->name);
-		priv->name = g_strdup (value);
+		_set_string (ARV_GC_FEATURE_NODE (self), &priv->name, &priv->name_is_interned, value);
 
 		genicam = arv_gc_node_get_genicam (ARV_GC_NODE (self));
 		/* Kludge around ugly Genicam specification (Really, pre-parsing for EnumEntry Name substitution ?) */
@@ -188,8 +226,7 @@ arv_gc_feature_node_set_attribute (ArvDomElement *self, const char *name, const
 		else
 			priv->name_space = ARV_GC_NAME_SPACE_CUSTOM;
 	} else if (strcmp (name, "Comment") == 0) {
-                g_free (priv->comment);
-                priv->comment = g_strdup (value);
+                _set_string (ARV_GC_FEATURE_NODE (self), &priv->comment, &priv->comment_is_interned, value);
 	} else
 		arv_info_dom ("[GcFeature::set_attribute] Unknown attribute '%s'", name);
 }
@@ -447,6 +484,34 @@ arv_gc_feature_node_get_actual_access_mode (ArvGcFeatureNode *gc_feature_node)
 	return imposed_access_mode;
 }
 
+/**
+ * arv_gc_feature_node_get_polling_time:
+ * @gc_feature_node: a #ArvGcFeatureNode
+ *
+ * Gets the PollingTime property of the feature, which is the period at which the feature value should be read again
+ * in order to follow its changes, for example for a temperature or a status.
+ *
+ * Returns: the polling period in milliseconds, 0 if the feature doesn't need to be polled.
+ *
+ * Since: 0.10.0
+ */
+
+gint64
+arv_gc_feature_node_get_polling_time (ArvGcFeatureNode *gc_feature_node)
+{
+	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (gc_feature_node);
+	gint64 polling_time;
+
+	g_return_val_if_fail (ARV_IS_GC_FEATURE_NODE (gc_feature_node), 0);
+
+	if (priv->polling_time == NULL)
+		return 0;
+
+	polling_time = arv_gc_property_node_get_int64 (priv->polling_time, NULL);
+
+	return MAX (polling_time, 0);
+}
+
 /**
  * arv_gc_feature_node_set_value_from_string:
  * @gc_feature_node: a #ArvGcFeatureNode
@@ -569,9 +634,15 @@ arv_gc_feature_node_increment_change_count (ArvGcFeatureNode *self)
 {
 	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (self);
 
+	ArvGc *genicam;
+
 	g_return_if_fail (ARV_IS_GC_FEATURE_NODE (self));
 
 	priv->change_count++;
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (self));
+	if (genicam != NULL)
+		arv_gc_invalidate_dependents (genicam, self);
 }
 
 guint64
@@ -597,8 +668,11 @@ arv_gc_feature_node_finalize (GObject *object)
 {
 	ArvGcFeatureNodePrivate *priv = arv_gc_feature_node_get_instance_private (ARV_GC_FEATURE_NODE(object));
 
-	g_clear_pointer (&priv->name, g_free);
-        g_clear_pointer (&priv->comment, g_free);
+	if (!priv->name_is_interned)
+		g_clear_pointer (&priv->name, g_free);
+	if (!priv->comment_is_interned)
+		g_clear_pointer (&priv->comment, g_free);
+	g_clear_pointer (&priv->string_pool, arv_dom_string_pool_unref);
 	g_clear_pointer (&priv->string_buffer, g_free);
 
 	G_OBJECT_CLASS (arv_gc_feature_node_parent_class)->finalize (object);
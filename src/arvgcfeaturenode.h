@@ -64,6 +64,8 @@ ARV_API gboolean		arv_gc_feature_node_is_locked			(ArvGcFeatureNode *gc_feature_
 ARV_API ArvGcAccessMode		arv_gc_feature_node_get_imposed_access_mode	(ArvGcFeatureNode *gc_feature_node);
 ARV_API ArvGcAccessMode		arv_gc_feature_node_get_actual_access_mode	(ArvGcFeatureNode *gc_feature_node);
 
+ARV_API gint64			arv_gc_feature_node_get_polling_time		(ArvGcFeatureNode *gc_feature_node);
+
 ARV_API void			arv_gc_feature_node_set_value_from_string	(ArvGcFeatureNode *gc_feature_node, const char *string,
 										 GError **error);
 ARV_API const char *		arv_gc_feature_node_get_value_as_string		(ArvGcFeatureNode *gc_feature_node, GError **error);
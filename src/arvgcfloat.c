@@ -27,6 +27,7 @@
 
 #include <arvgcfloat.h>
 #include <arvgcfeaturenodeprivate.h>
+#include <arvgcprivate.h>
 #include <arvgcdefaultsprivate.h>
 #include <arvgc.h>
 #include <arvmisc.h>
@@ -43,13 +44,19 @@ G_DEFINE_INTERFACE (ArvGcFloat, arv_gc_float, G_TYPE_OBJECT)
 double
 arv_gc_float_get_value (ArvGcFloat *gc_float, GError **error)
 {
+	double value;
+
 	g_return_val_if_fail (ARV_IS_GC_FLOAT (gc_float), 0.0);
 	g_return_val_if_fail (error == NULL || *error == NULL, 0.0);
 
         if (!arv_gc_feature_node_check_read_access (ARV_GC_FEATURE_NODE (gc_float), error))
                 return 0.0;
 
-	return ARV_GC_FLOAT_GET_IFACE (gc_float)->get_value (gc_float, error);
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_float, "get_value");
+	value = ARV_GC_FLOAT_GET_IFACE (gc_float)->get_value (gc_float, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_float);
+
+	return value;
 }
 
 void
@@ -68,6 +75,8 @@ arv_gc_float_set_value (ArvGcFloat *gc_float, double value, GError **error)
 	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (gc_float));
 	g_return_if_fail (ARV_IS_GC (genicam));
 
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_float, "set_value");
+
 	policy = arv_gc_get_range_check_policy (genicam);
 
 	if (policy != ARV_RANGE_CHECK_POLICY_DISABLE) {
@@ -98,6 +107,7 @@ arv_gc_float_set_value (ArvGcFloat *gc_float, double value, GError **error)
 				arv_warning_policies ("Range check (%s) ignored", local_error->message);
 			} else if (policy == ARV_RANGE_CHECK_POLICY_ENABLE) {
 				g_propagate_error (error, local_error);
+				arv_gc_profile_leave ((ArvGcFeatureNode *) gc_float);
 				return;
 			}
 			g_clear_error (&local_error);
@@ -105,6 +115,8 @@ arv_gc_float_set_value (ArvGcFloat *gc_float, double value, GError **error)
 	}
 
 	ARV_GC_FLOAT_GET_IFACE (gc_float)->set_value (gc_float, value, error);
+
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_float);
 }
 
 /**
@@ -125,8 +137,15 @@ arv_gc_float_get_min (ArvGcFloat *gc_float, GError **error)
 
 	float_interface = ARV_GC_FLOAT_GET_IFACE (gc_float);
 
-	if (float_interface->get_min != NULL)
-		return float_interface->get_min (gc_float, error);
+	if (float_interface->get_min != NULL) {
+		double value;
+
+		arv_gc_profile_enter ((ArvGcFeatureNode *) gc_float, "get_min");
+		value = float_interface->get_min (gc_float, error);
+		arv_gc_profile_leave ((ArvGcFeatureNode *) gc_float);
+
+		return value;
+	}
 
 	g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_PROPERTY_NOT_DEFINED, "[%s] <Min> node not found",
 		     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_float)));
@@ -152,8 +171,15 @@ arv_gc_float_get_max (ArvGcFloat *gc_float, GError **error)
 
 	float_interface = ARV_GC_FLOAT_GET_IFACE (gc_float);
 
-	if (float_interface->get_max != NULL)
-		return float_interface->get_max (gc_float, error);
+	if (float_interface->get_max != NULL) {
+		double value;
+
+		arv_gc_profile_enter ((ArvGcFeatureNode *) gc_float, "get_max");
+		value = float_interface->get_max (gc_float, error);
+		arv_gc_profile_leave ((ArvGcFeatureNode *) gc_float);
+
+		return value;
+	}
 
 	g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_PROPERTY_NOT_DEFINED, "[%s] <Max> node not found",
 		     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_float)));
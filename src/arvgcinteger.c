@@ -27,6 +27,7 @@
 
 #include <arvgcinteger.h>
 #include <arvgcfeaturenodeprivate.h>
+#include <arvgcprivate.h>
 #include <arvgc.h>
 #include <arvmisc.h>
 #include <arvdebugprivate.h>
@@ -41,13 +42,19 @@ G_DEFINE_INTERFACE (ArvGcInteger, arv_gc_integer, G_TYPE_OBJECT)
 gint64
 arv_gc_integer_get_value (ArvGcInteger *gc_integer, GError **error)
 {
+	gint64 value;
+
 	g_return_val_if_fail (ARV_IS_GC_INTEGER (gc_integer), 0);
 	g_return_val_if_fail (error == NULL || *error == NULL, 0);
 
         if (!arv_gc_feature_node_check_read_access (ARV_GC_FEATURE_NODE (gc_integer), error))
                 return 0;
 
-	return ARV_GC_INTEGER_GET_IFACE (gc_integer)->get_value (gc_integer, error);
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_integer, "get_value");
+	value = ARV_GC_INTEGER_GET_IFACE (gc_integer)->get_value (gc_integer, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_integer);
+
+	return value;
 }
 
 void
@@ -66,6 +73,8 @@ arv_gc_integer_set_value (ArvGcInteger *gc_integer, gint64 value, GError **error
 	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (gc_integer));
 	g_return_if_fail (ARV_IS_GC (genicam));
 
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_integer, "set_value");
+
 	policy = arv_gc_get_range_check_policy (genicam);
 
 	if (policy != ARV_RANGE_CHECK_POLICY_DISABLE) {
@@ -98,6 +107,7 @@ arv_gc_integer_set_value (ArvGcInteger *gc_integer, gint64 value, GError **error
 				arv_warning_policies ("Range check (%s) ignored", local_error->message);
 			} else if (policy == ARV_RANGE_CHECK_POLICY_ENABLE) {
 				g_propagate_error (error, local_error);
+				arv_gc_profile_leave ((ArvGcFeatureNode *) gc_integer);
 				return;
 			}
 			g_clear_error (&local_error);
@@ -105,6 +115,8 @@ arv_gc_integer_set_value (ArvGcInteger *gc_integer, gint64 value, GError **error
 	}
 
 	ARV_GC_INTEGER_GET_IFACE (gc_integer)->set_value (gc_integer, value, error);
+
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_integer);
 }
 
 gint64
@@ -117,8 +129,15 @@ arv_gc_integer_get_min (ArvGcInteger *gc_integer, GError **error)
 
 	integer_interface = ARV_GC_INTEGER_GET_IFACE (gc_integer);
 
-	if (integer_interface->get_min != NULL)
-		return integer_interface->get_min (gc_integer, error);
+	if (integer_interface->get_min != NULL) {
+		gint64 value;
+
+		arv_gc_profile_enter ((ArvGcFeatureNode *) gc_integer, "get_min");
+		value = integer_interface->get_min (gc_integer, error);
+		arv_gc_profile_leave ((ArvGcFeatureNode *) gc_integer);
+
+		return value;
+	}
 
 	g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_PROPERTY_NOT_DEFINED, "[%s] <Min> node not found",
 		     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_integer)));
@@ -136,8 +155,15 @@ arv_gc_integer_get_max (ArvGcInteger *gc_integer, GError **error)
 
 	integer_interface = ARV_GC_INTEGER_GET_IFACE (gc_integer);
 
-	if (integer_interface->get_max != NULL)
-		return integer_interface->get_max (gc_integer, error);
+	if (integer_interface->get_max != NULL) {
+		gint64 value;
+
+		arv_gc_profile_enter ((ArvGcFeatureNode *) gc_integer, "get_max");
+		value = integer_interface->get_max (gc_integer, error);
+		arv_gc_profile_leave ((ArvGcFeatureNode *) gc_integer);
+
+		return value;
+	}
 
 	g_set_error (error, ARV_GC_ERROR, ARV_GC_ERROR_PROPERTY_NOT_DEFINED, "[%s] <Max> node not found",
 		     arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (gc_integer)));
@@ -25,7 +25,7 @@
  * @short_description: Class for Port nodes
  */
 
-#include <arvgcport.h>
+#include <arvgcportprivate.h>
 #include <arvgcregisterdescriptionnode.h>
 #include <arvgcfeaturenodeprivate.h>
 #include <arvdevice.h>
@@ -168,6 +168,32 @@ _use_legacy_endianness_mechanism (ArvGcPort *port, guint64 length)
 	return length == 4 && port->priv->has_legacy_infos;
 }
 
+/* Tells how a read of @length bytes is forwarded to the device: FALSE for the chunk data and event ports, which don't
+ * access the device memory space, otherwise @use_register is set to TRUE for a register read, FALSE for a memory
+ * read. */
+
+gboolean
+arv_gc_port_get_device_access (ArvGcPort *port, guint64 length, gboolean *use_register)
+{
+	ArvDevice *device;
+
+	g_return_val_if_fail (ARV_IS_GC_PORT (port), FALSE);
+	g_return_val_if_fail (use_register != NULL, FALSE);
+
+	*use_register = FALSE;
+
+	if (port->priv->chunk_id != NULL || port->priv->event_id != NULL)
+		return FALSE;
+
+	device = arv_gc_get_device (arv_gc_node_get_genicam (ARV_GC_NODE (port)));
+	if (!ARV_IS_DEVICE (device))
+		return FALSE;
+
+	*use_register = ARV_IS_GV_DEVICE (device) && _use_legacy_endianness_mechanism (port, length);
+
+	return TRUE;
+}
+
 void
 arv_gc_port_read (ArvGcPort *port, void *buffer, guint64 address, guint64 length, GError **error)
 {
@@ -25,6 +25,42 @@
 
 #include <arvgc.h>
 
+/* Memoized result of a formula node, valid until one of its own dependencies is changed, or the reset epoch of the
+ * genicam document is incremented */
+
+typedef struct {
+	gboolean is_valid;
+	gboolean is_dirty;		/* Invalidated during the current evaluation */
+	guint64 reset_epoch;
+	guint64 n_uncached_reads;
+	union {
+		gint64 v_int64;
+		double v_double;
+	} value;
+} ArvGcMemo;
+
 ARV_API guint64            arv_gc_register_cache_error_add         (ArvGc *genicam, guint64 n_errors);
+ArvGc *                    arv_gc_new_from_document                (ArvDevice *device, ArvDomDocument *document);
+ArvGc *                    arv_gc_new_from_device_zip              (ArvDevice *device, guint64 address, guint64 size,
+                                                                    char **xml, size_t *xml_size, GError **error);
+
+void                       arv_gc_invalidate_dependents            (ArvGc *genicam, ArvGcFeatureNode *node);
+void                       arv_gc_invalidate_register_caches       (ArvGc *genicam);
+GPtrArray *                arv_gc_dup_register_dependencies        (ArvGc *genicam, GPtrArray *features);
+GPtrArray *                arv_gc_dup_polled_features              (ArvGc *genicam);
+
+typedef struct _ArvGcProfileEntry ArvGcProfileEntry;
+
+gboolean                   arv_gc_is_profiling                     (ArvGc *genicam);
+void                       arv_gc_profile_enter                    (ArvGcFeatureNode *node, const char *operation);
+void                       arv_gc_profile_leave                    (ArvGcFeatureNode *node);
+void                       arv_gc_profile_transport                (ArvGc *genicam, const char *operation,
+                                                                    guint64 address, guint64 size,
+                                                                    gint64 duration, gboolean success);
+void                       arv_gc_increment_n_uncached_reads       (ArvGc *genicam);
+void                       arv_gc_memo_begin                       (ArvGc *genicam, ArvGcMemo *memo);
+void                       arv_gc_memo_end                         (ArvGc *genicam, ArvGcMemo *memo, gboolean success);
+gboolean                   arv_gc_memo_is_valid                    (ArvGc *genicam, ArvGcMemo *memo);
+void                       arv_gc_memo_invalidate                  (ArvGcMemo *memo);
 
 #endif
@@ -29,6 +29,7 @@
  */
 
 #include <arvgcpropertynode.h>
+#include <arvgcpropertynodeprivate.h>
 #include <arvgcfeaturenode.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
@@ -234,18 +235,31 @@ _get_value_data (ArvGcPropertyNode *property_node)
 	ArvDomNode *dom_node = ARV_DOM_NODE (property_node);
 
 	if (!priv->value_data_up_to_date) {
-		ArvDomNode *iter;
-		GString *string = g_string_new (NULL);
-
-		for (iter = arv_dom_node_get_first_child (dom_node);
-		     iter != NULL;
-		     iter = arv_dom_node_get_next_sibling (iter))
-			g_string_append (string, arv_dom_character_data_get_data (ARV_DOM_CHARACTER_DATA (iter)));
-		g_free (priv->value_data);
-		priv->value_data = arv_g_string_free_and_steal(string);
+		ArvDomNode *first_child = arv_dom_node_get_first_child (dom_node);
+
+		g_clear_pointer (&priv->value_data, g_free);
+
+		/* The usual case is a property with a single text child, whose data is used directly instead of being
+		 * duplicated for each property node */
+		if (first_child != NULL && arv_dom_node_get_next_sibling (first_child) != NULL) {
+			ArvDomNode *iter;
+			GString *string = g_string_new (NULL);
+
+			for (iter = first_child;
+			     iter != NULL;
+			     iter = arv_dom_node_get_next_sibling (iter))
+				g_string_append (string, arv_dom_character_data_get_data (ARV_DOM_CHARACTER_DATA (iter)));
+			priv->value_data = arv_g_string_free_and_steal(string);
+		}
 		priv->value_data_up_to_date = TRUE;
 	}
 
+	if (priv->value_data == NULL) {
+		ArvDomNode *first_child = arv_dom_node_get_first_child (dom_node);
+
+		return first_child != NULL ? arv_dom_character_data_get_data (ARV_DOM_CHARACTER_DATA (first_child)) : "";
+	}
+
 	return priv->value_data;
 }
 
@@ -506,6 +520,19 @@ arv_gc_property_node_get_linked_node (ArvGcPropertyNode *node)
 	return arv_gc_get_node (genicam, _get_value_data (node));
 }
 
+/* Name of the node @node points to, without any node lookup, which would materialize the node with lazy loading */
+
+const char *
+arv_gc_property_node_get_linked_node_name (ArvGcPropertyNode *node)
+{
+	g_return_val_if_fail (ARV_IS_GC_PROPERTY_NODE (node), NULL);
+
+	if (arv_gc_property_node_get_node_type (node) <= ARV_GC_PROPERTY_NODE_TYPE_P_UNKNONW)
+		return NULL;
+
+	return _get_value_data (node);
+}
+
 static ArvGcNode *
 arv_gc_property_node_new (ArvGcPropertyNodeType type)
 {
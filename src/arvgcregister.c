@@ -27,6 +27,7 @@
 
 #include <arvgcregister.h>
 #include <arvmisc.h>
+#include <arvgcprivate.h>
 
 static void
 arv_gc_register_default_init (ArvGcRegisterInterface *gc_register_iface)
@@ -43,7 +44,9 @@ arv_gc_register_get (ArvGcRegister *gc_register, void *buffer, guint64 length, G
 	g_return_if_fail (length > 0);
 	g_return_if_fail (error == NULL || *error == NULL);
 
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_register, "get");
 	ARV_GC_REGISTER_GET_IFACE (gc_register)->get (gc_register, buffer, length, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_register);
 }
 
 void
@@ -54,7 +57,9 @@ arv_gc_register_set (ArvGcRegister *gc_register, const void *buffer, guint64 len
 	g_return_if_fail (length > 0);
 	g_return_if_fail (error == NULL || *error == NULL);
 
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_register, "set");
 	ARV_GC_REGISTER_GET_IFACE (gc_register)->set (gc_register, buffer, length, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_register);
 }
 
 guint64
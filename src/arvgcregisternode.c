@@ -382,6 +382,11 @@ _read_from_port (ArvGcRegisterNode *self, gint64 address, gint64 length, void *b
 		priv->cached = TRUE;
 	else
 		priv->cached = FALSE;
+
+	/* Values read from the device prevent the memoization of the formulas depending on them, only the values served
+	 * from the register cache, under the enable policy, can be trusted until an invalidation */
+	if (!cached || cache_policy != ARV_REGISTER_CACHE_POLICY_ENABLE)
+		arv_gc_increment_n_uncached_reads (arv_gc_node_get_genicam (ARV_GC_NODE (self)));
 }
 
 static void
@@ -781,3 +786,129 @@ arv_gc_register_node_get_endianness  (ArvGcRegisterNode *register_node)
 	return _get_endianness (register_node);
 }
 
+void
+arv_gc_register_node_invalidate_cache (ArvGcRegisterNode *register_node)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (register_node);
+
+	g_return_if_fail (ARV_IS_GC_REGISTER_NODE (register_node));
+
+	priv->cached = FALSE;
+}
+
+/* TRUE if the next read will use the cached value without accessing the device. Registers with invalidators are
+ * considered as not cached, as checking the invalidators has side effects. */
+
+gboolean
+arv_gc_register_node_is_cached (ArvGcRegisterNode *register_node)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (register_node);
+	ArvGc *genicam;
+
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (register_node), FALSE);
+
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (register_node));
+
+	return priv->cached &&
+		priv->invalidators == NULL &&
+		arv_gc_get_register_cache_policy (genicam) == ARV_REGISTER_CACHE_POLICY_ENABLE;
+}
+
+ArvGcPort *
+arv_gc_register_node_get_port (ArvGcRegisterNode *register_node)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (register_node);
+	ArvGcNode *port;
+
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (register_node), NULL);
+
+	if (priv->port == NULL)
+		return NULL;
+
+	port = arv_gc_property_node_get_linked_node (priv->port);
+
+	return ARV_IS_GC_PORT (port) ? ARV_GC_PORT (port) : NULL;
+}
+
+void
+arv_gc_register_node_get_cache_statistics (ArvGcRegisterNode *register_node, guint *n_cache_hits, guint *n_cache_misses)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (register_node);
+
+	g_return_if_fail (ARV_IS_GC_REGISTER_NODE (register_node));
+
+	if (n_cache_hits != NULL)
+		*n_cache_hits = priv->n_cache_hits;
+	if (n_cache_misses != NULL)
+		*n_cache_misses = priv->n_cache_misses;
+}
+
+/* Gives the device range of a register node relevant to the cache warmup, which must have a constant address and
+ * length. The address and length of the other registers depend on other nodes, whose evaluation may access the
+ * device. The range is either a cachable register not yet cached, to be seeded, or a barrier: a NoCache or write only
+ * register, whose read may have side effects on the device, and which must not be read to fill a gap between two
+ * other registers. */
+
+gboolean
+arv_gc_register_node_get_warmup_range (ArvGcRegisterNode *register_node, ArvGcPort **port,
+				       gint64 *address, gint64 *length, gboolean *is_barrier)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (register_node);
+	GSList *iter;
+
+	g_return_val_if_fail (ARV_IS_GC_REGISTER_NODE (register_node), FALSE);
+	g_return_val_if_fail (port != NULL && address != NULL && length != NULL && is_barrier != NULL, FALSE);
+
+	if (priv->indexes != NULL ||
+	    priv->swiss_knives != NULL)
+		return FALSE;
+
+	*is_barrier = _get_cachable (register_node) == ARV_GC_CACHABLE_NO_CACHE ||
+		arv_gc_register_node_get_access_mode (ARV_GC_FEATURE_NODE (register_node)) == ARV_GC_ACCESS_MODE_WO;
+
+	if (priv->cached && !*is_barrier)
+		return FALSE;
+
+	for (iter = priv->addresses; iter != NULL; iter = iter->next)
+		if (arv_gc_property_node_get_node_type (iter->data) != ARV_GC_PROPERTY_NODE_TYPE_ADDRESS)
+			return FALSE;
+
+	if (priv->length != NULL &&
+	    arv_gc_property_node_get_node_type (priv->length) != ARV_GC_PROPERTY_NODE_TYPE_LENGTH)
+		return FALSE;
+
+	*port = arv_gc_register_node_get_port (register_node);
+	if (*port == NULL)
+		return FALSE;
+
+	*address = _get_address (register_node, NULL);
+	*length = _get_length (register_node, NULL);
+
+	return *length > 0;
+}
+
+/* Fills the cache of a register node with @data, read from the device by the cache warmup. The invalidators are
+ * synchronized with the current state of the nodes they watch, in order to keep the seeded value. */
+
+void
+arv_gc_register_node_seed_cache (ArvGcRegisterNode *register_node, const void *data)
+{
+	ArvGcRegisterNodePrivate *priv = arv_gc_register_node_get_instance_private (register_node);
+	GSList *iter;
+	gint64 length;
+	void *cache;
+
+	g_return_if_fail (ARV_IS_GC_REGISTER_NODE (register_node));
+	g_return_if_fail (data != NULL);
+
+	cache = _get_cache (register_node, NULL, &length, NULL);
+	if (cache == NULL)
+		return;
+
+	memcpy (cache, data, length);
+
+	for (iter = priv->invalidators; iter != NULL; iter = iter->next)
+		arv_gc_invalidator_has_changed (iter->data);
+
+	priv->cached = TRUE;
+}
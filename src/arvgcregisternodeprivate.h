@@ -37,6 +37,14 @@ void 		arv_gc_register_node_set_masked_integer_value 	(ArvGcRegisterNode *gc_reg
 								 gboolean is_masked,
 								 gint64 value, GError **error);
 guint 		arv_gc_register_node_get_endianness 		(ArvGcRegisterNode *register_node);
+void		arv_gc_register_node_invalidate_cache		(ArvGcRegisterNode *register_node);
+gboolean	arv_gc_register_node_is_cached			(ArvGcRegisterNode *register_node);
+ArvGcPort *	arv_gc_register_node_get_port			(ArvGcRegisterNode *register_node);
+void		arv_gc_register_node_get_cache_statistics	(ArvGcRegisterNode *register_node,
+								 guint *n_cache_hits, guint *n_cache_misses);
+gboolean	arv_gc_register_node_get_warmup_range		(ArvGcRegisterNode *register_node, ArvGcPort **port,
+								 gint64 *address, gint64 *length, gboolean *is_barrier);
+void		arv_gc_register_node_seed_cache			(ArvGcRegisterNode *register_node, const void *data);
 
 
 #endif
@@ -28,6 +28,7 @@
 #include <arvgcstring.h>
 #include <arvmisc.h>
 #include <arvgcfeaturenodeprivate.h>
+#include <arvgcprivate.h>
 
 static void
 arv_gc_string_default_init (ArvGcStringInterface *gc_string_iface)
@@ -49,13 +50,19 @@ G_DEFINE_INTERFACE (ArvGcString, arv_gc_string, G_TYPE_OBJECT)
 const char *
 arv_gc_string_get_value (ArvGcString *gc_string, GError **error)
 {
+	const char *value;
+
 	g_return_val_if_fail (ARV_IS_GC_STRING (gc_string), NULL);
 	g_return_val_if_fail (error == NULL || *error == NULL, NULL);
 
         if (!arv_gc_feature_node_check_read_access (ARV_GC_FEATURE_NODE (gc_string), error))
                 return NULL;
 
-	return ARV_GC_STRING_GET_IFACE (gc_string)->get_value (gc_string, error);
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_string, "get_value");
+	value = ARV_GC_STRING_GET_IFACE (gc_string)->get_value (gc_string, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_string);
+
+	return value;
 }
 
 /**
@@ -76,7 +83,9 @@ arv_gc_string_set_value (ArvGcString *gc_string, const char *value, GError **err
         if (!arv_gc_feature_node_check_write_access (ARV_GC_FEATURE_NODE (gc_string), error))
                 return;
 
+	arv_gc_profile_enter ((ArvGcFeatureNode *) gc_string, "set_value");
 	ARV_GC_STRING_GET_IFACE (gc_string)->set_value (gc_string, value, error);
+	arv_gc_profile_leave ((ArvGcFeatureNode *) gc_string);
 }
 
 /**
@@ -26,11 +26,12 @@
  */
 
 #include <arvgcswissknifeprivate.h>
-#include <arvevaluator.h>
+#include <arvevaluatorprivate.h>
 #include <arvgcinteger.h>
 #include <arvgcfloat.h>
 #include <arvgcport.h>
 #include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvdebug.h>
 #include <string.h>
 
@@ -45,6 +46,10 @@ typedef struct {
 	ArvGcPropertyNode *representation;
 
 	ArvEvaluator *formula;
+	guint *variable_slots;	/* Evaluator slots of the variables list */
+
+	ArvGcMemo int64_memo;
+	ArvGcMemo double_memo;
 } ArvGcSwissKnifePrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvGcSwissKnife, arv_gc_swiss_knife, ARV_TYPE_GC_FEATURE_NODE, G_ADD_PRIVATE (ArvGcSwissKnife))
@@ -56,12 +61,15 @@ arv_gc_swiss_knife_post_new_child (ArvDomNode *self, ArvDomNode *child)
 {
 	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (ARV_GC_SWISS_KNIFE (self));
 
+	arv_gc_swiss_knife_invalidate (ARV_GC_SWISS_KNIFE (self));
+
 	if (ARV_IS_GC_PROPERTY_NODE (child)) {
 		ArvGcPropertyNode *property_node = ARV_GC_PROPERTY_NODE (child);
 
 		switch (arv_gc_property_node_get_node_type (property_node)) {
 			case ARV_GC_PROPERTY_NODE_TYPE_P_VARIABLE:
 				priv->variables = g_slist_prepend (priv->variables, property_node);
+				g_clear_pointer (&priv->variable_slots, g_free);
 				break;
 			case ARV_GC_PROPERTY_NODE_TYPE_FORMULA:
 				priv->formula_node = property_node;
@@ -117,6 +125,7 @@ arv_gc_swiss_knife_finalize (GObject *object)
 	g_slist_free (priv->constants);
 
 	g_clear_object (&priv->formula);
+	g_clear_pointer (&priv->variable_slots, g_free);
 
 	G_OBJECT_CLASS (arv_gc_swiss_knife_parent_class)->finalize (object);
 }
@@ -136,6 +145,25 @@ arv_gc_swiss_knife_class_init (ArvGcSwissKnifeClass *this_class)
 
 /* ArvGcInteger interface implementation */
 
+static guint *
+_get_variable_slots (ArvGcSwissKnife *self)
+{
+	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (self);
+
+	if (priv->variable_slots == NULL && priv->variables != NULL) {
+		GSList *iter;
+		guint i;
+
+		priv->variable_slots = g_new (guint, g_slist_length (priv->variables));
+		for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++)
+			priv->variable_slots[i] =
+				arv_evaluator_get_variable_slot (priv->formula,
+								 arv_gc_property_node_get_name (iter->data));
+	}
+
+	return priv->variable_slots;
+}
+
 static void
 _update_variables (ArvGcSwissKnife *self, GError **error)
 {
@@ -144,6 +172,8 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
 	GError *local_error = NULL;
 	GSList *iter;
 	const char *expression;
+	guint *variable_slots;
+	guint i;
 
 	if (priv->formula_node != NULL)
 		expression = arv_gc_property_node_get_string (priv->formula_node, &local_error);
@@ -190,7 +220,9 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
 		arv_evaluator_set_constant (priv->formula, name, constant);
 	}
 
-	for (iter = priv->variables; iter != NULL; iter = iter->next) {
+	variable_slots = _get_variable_slots (self);
+
+	for (iter = priv->variables, i = 0; iter != NULL; iter = iter->next, i++) {
 		ArvGcPropertyNode *variable_node = iter->data;
 
 		node = arv_gc_property_node_get_linked_node (ARV_GC_PROPERTY_NODE (variable_node));
@@ -205,9 +237,7 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
                                 return;
                         }
 
-			arv_evaluator_set_int64_variable (priv->formula,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_int64_variable_by_slot (priv->formula, variable_slots[i], value);
 		} else if (ARV_IS_GC_FLOAT (node)) {
 			double value;
 
@@ -219,9 +249,7 @@ _update_variables (ArvGcSwissKnife *self, GError **error)
 				return;
 			}
 
-			arv_evaluator_set_double_variable (priv->formula,
-							  arv_gc_property_node_get_name (variable_node),
-							  value);
+			arv_evaluator_set_double_variable_by_slot (priv->formula, variable_slots[i], value);
 		}
 	}
 }
@@ -231,9 +259,18 @@ arv_gc_swiss_knife_get_integer_value (ArvGcSwissKnife *self, GError **error)
 {
 	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (self);
 	GError *local_error = NULL;
+	ArvGc *genicam;
+	gint64 value;
 
 	g_return_val_if_fail (ARV_IS_GC_SWISS_KNIFE (self), 0);
 
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (self));
+	if (arv_gc_memo_is_valid (genicam, &priv->int64_memo))
+		return priv->int64_memo.value.v_int64;
+
+	if (genicam != NULL)
+		arv_gc_memo_begin (genicam, &priv->int64_memo);
+
 	_update_variables (self, &local_error);
 
 	if (local_error != NULL) {
@@ -242,7 +279,16 @@ arv_gc_swiss_knife_get_integer_value (ArvGcSwissKnife *self, GError **error)
                 return 0;
         }
 
-	return arv_evaluator_evaluate_as_int64 (priv->formula, NULL);
+	value = arv_evaluator_evaluate_as_int64 (priv->formula, &local_error);
+
+	if (genicam != NULL) {
+		priv->int64_memo.value.v_int64 = value;
+		arv_gc_memo_end (genicam, &priv->int64_memo, local_error == NULL);
+	}
+
+	g_clear_error (&local_error);
+
+	return value;
 }
 
 double
@@ -250,9 +296,18 @@ arv_gc_swiss_knife_get_float_value (ArvGcSwissKnife *self, GError **error)
 {
 	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (self);
 	GError *local_error = NULL;
+	ArvGc *genicam;
+	double value;
 
 	g_return_val_if_fail (ARV_IS_GC_SWISS_KNIFE (self), 0.0);
 
+	genicam = arv_gc_node_get_genicam (ARV_GC_NODE (self));
+	if (arv_gc_memo_is_valid (genicam, &priv->double_memo))
+		return priv->double_memo.value.v_double;
+
+	if (genicam != NULL)
+		arv_gc_memo_begin (genicam, &priv->double_memo);
+
 	_update_variables (self, &local_error);
 
 	if (local_error != NULL) {
@@ -261,7 +316,27 @@ arv_gc_swiss_knife_get_float_value (ArvGcSwissKnife *self, GError **error)
 		return 0.0;
 	}
 
-	return arv_evaluator_evaluate_as_double (priv->formula, NULL);
+	value = arv_evaluator_evaluate_as_double (priv->formula, &local_error);
+
+	if (genicam != NULL) {
+		priv->double_memo.value.v_double = value;
+		arv_gc_memo_end (genicam, &priv->double_memo, local_error == NULL);
+	}
+
+	g_clear_error (&local_error);
+
+	return value;
+}
+
+void
+arv_gc_swiss_knife_invalidate (ArvGcSwissKnife *self)
+{
+	ArvGcSwissKnifePrivate *priv = arv_gc_swiss_knife_get_instance_private (self);
+
+	g_return_if_fail (ARV_IS_GC_SWISS_KNIFE (self));
+
+	arv_gc_memo_invalidate (&priv->int64_memo);
+	arv_gc_memo_invalidate (&priv->double_memo);
 }
 
 ArvGcRepresentation
@@ -30,5 +30,6 @@ const char *		arv_gc_swiss_knife_get_unit		(ArvGcSwissKnife *self);
 
 gint64			arv_gc_swiss_knife_get_integer_value	(ArvGcSwissKnife *self, GError **error);
 double			arv_gc_swiss_knife_get_float_value	(ArvGcSwissKnife *self, GError **error);
+void			arv_gc_swiss_knife_invalidate		(ArvGcSwissKnife *self);
 
 #endif
@@ -117,6 +117,7 @@ arv_gentl_interface_device_infos_unref (ArvGenTLInterfaceDeviceInfos *infos)
 
 typedef struct {
 	GHashTable *devices;
+	GMutex devices_mutex;
 } ArvGenTLInterfacePrivate;
 
 struct _ArvGenTLInterface {
@@ -281,10 +282,13 @@ static void
 arv_gentl_interface_update_device_list (ArvInterface *interface, GArray *device_ids)
 {
 	ArvGenTLInterface *gentl_interface = ARV_GENTL_INTERFACE (interface);
+	ArvGenTLInterfacePrivate *priv = arv_gentl_interface_get_instance_private (gentl_interface);
 
 	g_assert (device_ids->len == 0);
 
+	g_mutex_lock (&priv->devices_mutex);
 	_discover(gentl_interface, device_ids);
+	g_mutex_unlock (&priv->devices_mutex);
 }
 
 static ArvDevice *
@@ -294,6 +298,8 @@ arv_gentl_interface_open_device (ArvInterface *interface, const char *device_id,
 	ArvDevice *device = NULL;
 	ArvGenTLInterfaceDeviceInfos *device_infos = NULL;
 
+	g_mutex_lock (&priv->devices_mutex);
+
         if (device_id == NULL) {
 		GList *device_list;
 
@@ -317,9 +323,16 @@ arv_gentl_interface_open_device (ArvInterface *interface, const char *device_id,
                         device_infos = g_hash_table_lookup (priv->devices, device_id);
         }
 
-	if (device_infos)
+	if (device_infos != NULL)
+		arv_gentl_interface_device_infos_ref (device_infos);
+
+	g_mutex_unlock (&priv->devices_mutex);
+
+	if (device_infos) {
 		device = arv_gentl_device_new (device_infos->system, device_infos->interface,
                                                device_infos->id, error);
+		arv_gentl_interface_device_infos_unref (device_infos);
+	}
 
 	return device;
 }
@@ -365,6 +378,7 @@ arv_gentl_interface_init (ArvGenTLInterface *gentl_interface)
 
         priv->devices = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
                                                (GDestroyNotify) arv_gentl_interface_device_infos_unref);
+	g_mutex_init (&priv->devices_mutex);
 }
 
 static void
@@ -376,6 +390,7 @@ arv_gentl_interface_finalize (GObject *object)
 	GList *gentl_systems_iter;
 
 	g_hash_table_unref (priv->devices);
+	g_mutex_clear (&priv->devices_mutex);
 
 	for ( gentl_systems_iter = gentl_systems; gentl_systems_iter; gentl_systems_iter = g_list_next(gentl_systems_iter) ) {
 		g_object_unref(gentl_systems_iter->data);
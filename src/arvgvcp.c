@@ -185,6 +185,42 @@ arv_gvcp_packet_new_write_memory_ack (guint32 address,
 	return packet;
 }
 
+/**
+ * arv_gvcp_packet_new_pending_ack: (skip)
+ * @timeout_ms: time needed by the device to complete the command, in ms
+ * @packet_id: packet id of the pending command
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a pending acknowledge, telling the controller that the answer to the command will be sent
+ * later.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_pending_ack (guint16 timeout_ms,
+				 guint16 packet_id,
+				 size_t *packet_size)
+{
+	ArvGvcpPacket *packet;
+	guint32 n_timeout = g_htonl (timeout_ms);
+
+	g_return_val_if_fail (packet_size != NULL, NULL);
+
+	*packet_size = sizeof (ArvGvcpHeader) + sizeof (guint32);
+
+	packet = g_malloc (*packet_size);
+
+	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_ACK;
+	packet->header.packet_flags = 0;
+	packet->header.command = g_htons (ARV_GVCP_COMMAND_PENDING_ACK);
+	packet->header.size = g_htons (sizeof (guint32));
+	packet->header.id = g_htons (packet_id);
+
+	memcpy (&packet->data, &n_timeout, sizeof (guint32));
+
+	return packet;
+}
+
 /**
  * arv_gvcp_packet_new_read_register_cmd: (skip)
  * @address: write address
@@ -199,23 +235,50 @@ ArvGvcpPacket *
 arv_gvcp_packet_new_read_register_cmd (guint32 address,
 				       guint16 packet_id,
 				       size_t *packet_size)
+{
+	return arv_gvcp_packet_new_read_registers_cmd (&address, 1, packet_id, packet_size);
+}
+
+/**
+ * arv_gvcp_packet_new_read_registers_cmd: (skip)
+ * @addresses: (array length=n_registers): register addresses
+ * @n_registers: number of registers to read
+ * @packet_id: packet id
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a multiple register read command. This requires the concatenation capability, except for a
+ * single register.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_read_registers_cmd (const guint32 *addresses,
+					guint n_registers,
+					guint16 packet_id,
+					size_t *packet_size)
 {
 	ArvGvcpPacket *packet;
-	guint32 n_address = g_htonl (address);
+	guint i;
 
+	g_return_val_if_fail (addresses != NULL, NULL);
+	g_return_val_if_fail (n_registers > 0 && n_registers <= ARV_GVCP_READ_REGISTER_N_MAX, NULL);
 	g_return_val_if_fail (packet_size != NULL, NULL);
 
-	*packet_size = sizeof (ArvGvcpHeader) + sizeof (guint32);
+	*packet_size = sizeof (ArvGvcpHeader) + n_registers * sizeof (guint32);
 
 	packet = g_malloc (*packet_size);
 
 	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_CMD;
 	packet->header.packet_flags = ARV_GVCP_CMD_PACKET_FLAGS_ACK_REQUIRED;
 	packet->header.command = g_htons (ARV_GVCP_COMMAND_READ_REGISTER_CMD);
-	packet->header.size = g_htons (sizeof (guint32));
+	packet->header.size = g_htons (n_registers * sizeof (guint32));
 	packet->header.id = g_htons (packet_id);
 
-	memcpy (&packet->data, &n_address, sizeof (guint32));
+	for (i = 0; i < n_registers; i++) {
+		guint32 n_address = g_htonl (addresses[i]);
+
+		memcpy (&packet->data[i * sizeof (guint32)], &n_address, sizeof (guint32));
+	}
 
 	return packet;
 }
@@ -234,23 +297,49 @@ ArvGvcpPacket *
 arv_gvcp_packet_new_read_register_ack (guint32 value,
 				       guint16 packet_id,
 				       size_t *packet_size)
+{
+	return arv_gvcp_packet_new_read_registers_ack (&value, 1, packet_id, packet_size);
+}
+
+/**
+ * arv_gvcp_packet_new_read_registers_ack: (skip)
+ * @values: (array length=n_registers): read values
+ * @n_registers: number of read registers
+ * @packet_id: packet id
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a multiple register read acknowledge.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_read_registers_ack (const guint32 *values,
+					guint n_registers,
+					guint16 packet_id,
+					size_t *packet_size)
 {
 	ArvGvcpPacket *packet;
-	guint32 n_value = g_htonl (value);
+	guint i;
 
+	g_return_val_if_fail (values != NULL, NULL);
+	g_return_val_if_fail (n_registers > 0 && n_registers <= ARV_GVCP_READ_REGISTER_N_MAX, NULL);
 	g_return_val_if_fail (packet_size != NULL, NULL);
 
-	*packet_size = arv_gvcp_packet_get_read_register_ack_size ();
+	*packet_size = arv_gvcp_packet_get_read_registers_ack_size (n_registers);
 
 	packet = g_malloc (*packet_size);
 
 	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_ACK;
 	packet->header.packet_flags = 0;
 	packet->header.command = g_htons (ARV_GVCP_COMMAND_READ_REGISTER_ACK);
-	packet->header.size = g_htons (sizeof (guint32));
+	packet->header.size = g_htons (n_registers * sizeof (guint32));
 	packet->header.id = g_htons (packet_id);
 
-	memcpy (&packet->data, &n_value, sizeof (guint32));
+	for (i = 0; i < n_registers; i++) {
+		guint32 n_value = g_htonl (values[i]);
+
+		memcpy (&packet->data[i * sizeof (guint32)], &n_value, sizeof (guint32));
+	}
 
 	return packet;
 }
@@ -271,25 +360,52 @@ arv_gvcp_packet_new_write_register_cmd (guint32 address,
 					guint32 value,
 					guint16 packet_id,
 					size_t *packet_size)
+{
+	guint32 registers[2] = {address, value};
+
+	return arv_gvcp_packet_new_write_registers_cmd (registers, 1, packet_id, packet_size);
+}
+
+/**
+ * arv_gvcp_packet_new_write_registers_cmd: (skip)
+ * @registers: (array): address and value pairs
+ * @n_registers: number of registers to write
+ * @packet_id: packet id
+ * @packet_size: (out): packet size, in bytes
+ * Return value: (transfer full): a new #ArvGvcpPacket
+ *
+ * Create a gvcp packet for a multiple register write command. The device writes the registers in the given order, and
+ * stops on the first error. This requires the concatenation capability, except for a single register.
+ */
+
+ArvGvcpPacket *
+arv_gvcp_packet_new_write_registers_cmd (const guint32 *registers,
+					 guint n_registers,
+					 guint16 packet_id,
+					 size_t *packet_size)
 {
 	ArvGvcpPacket *packet;
-	guint32 n_address = g_htonl (address);
-	guint32 n_value = g_htonl (value);
+	guint i;
 
+	g_return_val_if_fail (registers != NULL, NULL);
+	g_return_val_if_fail (n_registers > 0 && n_registers <= ARV_GVCP_WRITE_REGISTER_N_MAX, NULL);
 	g_return_val_if_fail (packet_size != NULL, NULL);
 
-	*packet_size = sizeof (ArvGvcpHeader) + 2 * sizeof (guint32);
+	*packet_size = sizeof (ArvGvcpHeader) + 2 * n_registers * sizeof (guint32);
 
 	packet = g_malloc (*packet_size);
 
 	packet->header.packet_type = ARV_GVCP_PACKET_TYPE_CMD;
 	packet->header.packet_flags = ARV_GVCP_CMD_PACKET_FLAGS_ACK_REQUIRED;
 	packet->header.command = g_htons (ARV_GVCP_COMMAND_WRITE_REGISTER_CMD);
-	packet->header.size = g_htons (2 * sizeof (guint32));
+	packet->header.size = g_htons (2 * n_registers * sizeof (guint32));
 	packet->header.id = g_htons (packet_id);
 
-	memcpy (&packet->data, &n_address, sizeof (guint32));
-	memcpy (&packet->data[sizeof (guint32)], &n_value, sizeof (guint32));
+	for (i = 0; i < 2 * n_registers; i++) {
+		guint32 n_value = g_htonl (registers[i]);
+
+		memcpy (&packet->data[i * sizeof (guint32)], &n_value, sizeof (guint32));
+	}
 
 	return packet;
 }
@@ -617,12 +733,19 @@ arv_gvcp_packet_to_string (const ArvGvcpPacket *packet)
 						data[ARV_GVBS_CURRENT_IP_ADDRESS_OFFSET + 3] & 0xff);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-			value = g_ntohl (*((guint32 *) &data[0]));
-			g_string_append_printf (string, "address      = %10u (0x%08x)\n",
-						value, value);
-			value = g_ntohl (*((guint32 *) &data[4]));
-			g_string_append_printf (string, "value        = %10u (0x%08x)\n",
-						value, value);
+			{
+				guint n_registers = CLAMP (g_ntohs (packet->header.size) / 8, 1, ARV_GVCP_WRITE_REGISTER_N_MAX);
+				guint i;
+
+				for (i = 0; i < n_registers; i++) {
+					value = g_ntohl (*((guint32 *) &data[8 * i]));
+					g_string_append_printf (string, "address      = %10u (0x%08x)\n",
+								value, value);
+					value = g_ntohl (*((guint32 *) &data[8 * i + 4]));
+					g_string_append_printf (string, "value        = %10u (0x%08x)\n",
+								value, value);
+				}
+			}
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_ACK:
 			value = g_ntohl (*((guint32 *) &data[0]));
@@ -630,14 +753,19 @@ arv_gvcp_packet_to_string (const ArvGvcpPacket *packet)
 						value, value);
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			value = g_ntohl (*((guint32 *) &data[0]));
-			g_string_append_printf (string, "address      = %10u (0x%08x)\n",
-						value, value);
-			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_ACK:
-			value = g_ntohl (*((guint32 *) &data[0]));
-			g_string_append_printf (string, "value        = %10u (0x%08x)\n",
-						value, value);
+			{
+				guint n_registers = CLAMP (g_ntohs (packet->header.size) / 4, 1, ARV_GVCP_READ_REGISTER_N_MAX);
+				guint i;
+
+				for (i = 0; i < n_registers; i++) {
+					value = g_ntohl (*((guint32 *) &data[4 * i]));
+					g_string_append_printf (string, "%s= %10u (0x%08x)\n",
+								packet->header.packet_type == ARV_GVCP_PACKET_TYPE_CMD ?
+								"address      " : "value        ",
+								value, value);
+				}
+			}
 			break;
 		case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
 			value = g_ntohl (*((guint32 *) &data[0]));
@@ -137,6 +137,8 @@ G_BEGIN_DECLS
 #define ARV_GVBS_STREAM_CHANNEL_0_IP_ADDRESS_OFFSET		0x00000d18
 
 #define ARV_GVCP_DATA_SIZE_MAX				512
+#define ARV_GVCP_READ_REGISTER_N_MAX			(ARV_GVCP_DATA_SIZE_MAX / sizeof (guint32))
+#define ARV_GVCP_WRITE_REGISTER_N_MAX			(ARV_GVCP_DATA_SIZE_MAX / (2 * sizeof (guint32)))
 
 /**
  * ArvGvcpPacketType:
@@ -326,12 +328,20 @@ ArvGvcpPacket * 	arv_gvcp_packet_new_write_memory_cmd	(guint32 address, guint32
 								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_write_memory_ack	(guint32 address,
 								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_pending_ack		(guint16 timeout_ms,
+								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_read_register_cmd 	(guint32 address,
 								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_read_register_ack 	(guint32 value,
 								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_read_registers_cmd	(const guint32 *addresses, guint n_registers,
+								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_read_registers_ack	(const guint32 *values, guint n_registers,
+								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_write_register_cmd 	(guint32 address, guint32 value,
 								 guint16 packet_id, size_t *packet_size);
+ArvGvcpPacket * 	arv_gvcp_packet_new_write_registers_cmd	(const guint32 *registers, guint n_registers,
+								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_write_register_ack 	(guint32 data_index,
 								 guint16 packet_id, size_t *packet_size);
 ArvGvcpPacket * 	arv_gvcp_packet_new_discovery_cmd 	(gboolean allow_broadcast_discovery_ack, size_t *packet_size);
@@ -488,19 +498,49 @@ arv_gvcp_packet_get_read_register_cmd_infos (const ArvGvcpPacket *packet, size_t
 		*address = g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket))));
 }
 
+static inline guint
+arv_gvcp_packet_get_read_register_cmd_n_registers (const ArvGvcpPacket *packet, size_t packet_size)
+{
+	if G_UNLIKELY(packet == NULL || packet_size < sizeof (ArvGvcpPacket))
+		return 0;
+
+	return MIN (g_ntohs (packet->header.size), packet_size - sizeof (ArvGvcpPacket)) / sizeof (guint32);
+}
+
+static inline guint32
+arv_gvcp_packet_get_read_registers_cmd_address (const ArvGvcpPacket *packet, size_t packet_size, guint index)
+{
+	if G_UNLIKELY(index >= arv_gvcp_packet_get_read_register_cmd_n_registers (packet, packet_size))
+		return 0;
+
+	return g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) + index * sizeof (guint32))));
+}
+
+static inline size_t
+arv_gvcp_packet_get_read_registers_ack_size (guint n_registers)
+{
+	return sizeof (ArvGvcpHeader) + n_registers * sizeof (guint32);
+}
+
 static inline size_t
 arv_gvcp_packet_get_read_register_ack_size (void)
 {
-	return sizeof (ArvGvcpHeader) + sizeof (guint32);
+	return arv_gvcp_packet_get_read_registers_ack_size (1);
 }
 
 static inline guint32
-arv_gvcp_packet_get_read_register_ack_value (const ArvGvcpPacket *packet, size_t packet_size)
+arv_gvcp_packet_get_read_registers_ack_value (const ArvGvcpPacket *packet, size_t packet_size, guint index)
 {
-	if G_UNLIKELY(packet == NULL || packet_size < arv_gvcp_packet_get_read_register_ack_size())
+	if G_UNLIKELY(packet == NULL || packet_size < arv_gvcp_packet_get_read_registers_ack_size (index + 1))
 		return 0;
 
-	return g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket))));
+	return g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) + index * sizeof (guint32))));
+}
+
+static inline guint32
+arv_gvcp_packet_get_read_register_ack_value (const ArvGvcpPacket *packet, size_t packet_size)
+{
+	return arv_gvcp_packet_get_read_registers_ack_value (packet, packet_size, 0);
 }
 
 static inline void
@@ -521,12 +561,90 @@ arv_gvcp_packet_get_write_register_cmd_infos (const ArvGvcpPacket *packet, size_
 		*value = g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) + sizeof (guint32))));
 }
 
+static inline guint
+arv_gvcp_packet_get_write_register_cmd_n_registers (const ArvGvcpPacket *packet, size_t packet_size)
+{
+	if G_UNLIKELY(packet == NULL || packet_size < sizeof (ArvGvcpPacket))
+		return 0;
+
+	return MIN (g_ntohs (packet->header.size), packet_size - sizeof (ArvGvcpPacket)) / (2 * sizeof (guint32));
+}
+
+static inline void
+arv_gvcp_packet_get_write_registers_cmd_infos (const ArvGvcpPacket *packet, size_t packet_size, guint index,
+					       guint32 *address, guint32 *value)
+{
+	if G_UNLIKELY(index >= arv_gvcp_packet_get_write_register_cmd_n_registers (packet, packet_size)) {
+		if (address != NULL)
+			*address = 0;
+		if (value != NULL)
+			*value = 0;
+		return;
+	}
+
+	if (address != NULL)
+		*address = g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) +
+						   2 * index * sizeof (guint32))));
+	if (value != NULL)
+		*value = g_ntohl (*((guint32 *) ((char *) packet + sizeof (ArvGvcpPacket) +
+						 (2 * index + 1) * sizeof (guint32))));
+}
+
 static inline size_t
 arv_gvcp_packet_get_write_register_ack_size (void)
 {
 	return sizeof (ArvGvcpHeader) + sizeof (guint32);
 }
 
+static inline gboolean
+arv_gvcp_packet_get_packet_resend_cmd_infos (const ArvGvcpPacket *packet, size_t packet_size,
+					     guint64 *frame_id, guint32 *first_block, guint32 *last_block,
+					     gboolean *extended_ids)
+{
+	const guint32 *data;
+	gboolean extended;
+
+	extended = packet != NULL && (packet->header.packet_flags & ARV_GVCP_CMD_PACKET_FLAGS_EXTENDED_IDS) != 0;
+
+	if G_UNLIKELY(packet == NULL ||
+		      packet_size < sizeof (ArvGvcpPacket) + (extended ? 5 : 3) * sizeof (guint32)) {
+		if (frame_id != NULL)
+			*frame_id = 0;
+		if (first_block != NULL)
+			*first_block = 0;
+		if (last_block != NULL)
+			*last_block = 0;
+		if (extended_ids != NULL)
+			*extended_ids = FALSE;
+		return FALSE;
+	}
+
+	data = (const guint32 *) ((const char *) packet + sizeof (ArvGvcpPacket));
+
+	if (extended) {
+		if (frame_id != NULL)
+			*frame_id = ((guint64) g_ntohl (data[3]) << 32) | g_ntohl (data[4]);
+		if (first_block != NULL)
+			*first_block = g_ntohl (data[1]);
+		if (last_block != NULL)
+			*last_block = g_ntohl (data[2]);
+	} else {
+		/* The upper 16 bits of the first word are the stream channel index, and only 24 bits of the packet
+		 * ids are valid */
+		if (frame_id != NULL)
+			*frame_id = g_ntohl (data[0]) & 0xffff;
+		if (first_block != NULL)
+			*first_block = g_ntohl (data[1]) & 0x00ffffff;
+		if (last_block != NULL)
+			*last_block = g_ntohl (data[2]) & 0x00ffffff;
+	}
+
+	if (extended_ids != NULL)
+		*extended_ids = extended;
+
+	return TRUE;
+}
+
 static inline guint16
 arv_gvcp_next_packet_id (guint16 packet_id)
 {
@@ -27,7 +27,7 @@
 
 #include <arvgvdeviceprivate.h>
 #include <arvdeviceprivate.h>
-#include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvgccommand.h>
 #include <arvgcboolean.h>
 #include <arvgcregisterdescriptionnode.h>
@@ -69,6 +69,16 @@ typedef struct {
 	unsigned int gvcp_n_retries;
 	unsigned int gvcp_timeout_ms;
 
+	/* Round trip time estimation, in µs */
+	gboolean adaptive_timeout;
+	gint64 srtt;
+	gint64 rttvar;
+	gint64 rtt_min;
+	gint64 rtt_max;
+	guint64 n_rtt_samples;
+	guint64 n_retransmissions;
+	ArvHistogram *rtt_histogram;
+
 	gboolean is_controller;
 } ArvGvDeviceIOData;
 
@@ -90,6 +100,7 @@ typedef struct {
 
 	gboolean is_packet_resend_supported;
 	gboolean is_write_memory_supported;
+	gboolean is_concatenation_supported;
 
 	ArvGvStreamOption stream_options;
 	ArvGvPacketSizeAdjustment packet_size_adjustment;
@@ -134,6 +145,51 @@ arv_gvcp_error_to_device_error (ArvGvcpError code)
         return ARV_DEVICE_ERROR_PROTOCOL_ERROR;
 }
 
+/* Round trip time estimation, following the TCP retransmission timer computation (RFC 6298). Only the answers to
+ * commands sent once are sampled, as the answer to a retransmitted command can't be matched to a specific emission. A
+ * pending acknowledge counts as an answer. */
+
+static void
+_update_rtt (ArvGvDeviceIOData *io_data, gint64 rtt)
+{
+	if (io_data->n_rtt_samples == 0) {
+		io_data->srtt = rtt;
+		io_data->rttvar = rtt / 2;
+		io_data->rtt_min = rtt;
+		io_data->rtt_max = rtt;
+	} else {
+		io_data->rttvar = (3 * io_data->rttvar + ABS (io_data->srtt - rtt)) / 4;
+		io_data->srtt = (7 * io_data->srtt + rtt) / 8;
+		io_data->rtt_min = MIN (io_data->rtt_min, rtt);
+		io_data->rtt_max = MAX (io_data->rtt_max, rtt);
+	}
+
+	io_data->n_rtt_samples++;
+
+	arv_histogram_fill (io_data->rtt_histogram, 0, MIN (rtt, G_MAXINT));
+}
+
+/* The read retransmission timeout is derived from the round trip time estimation, between a minimum and the
+ * configured GVCP timeout. Until the first sample, or if the adaptive timeout is disabled, the configured GVCP timeout
+ * is used. Writes always wait for the configured timeout, as a device may take longer to apply a write, and a
+ * retransmitted write may be executed twice. */
+
+static gint64
+_get_retransmission_timeout_ms (ArvGvDeviceIOData *io_data, ArvGvcpCommand command)
+{
+	gint64 timeout_ms;
+
+	if (!io_data->adaptive_timeout || io_data->n_rtt_samples == 0 ||
+	    command == ARV_GVCP_COMMAND_WRITE_MEMORY_CMD ||
+	    command == ARV_GVCP_COMMAND_WRITE_REGISTER_CMD)
+		return io_data->gvcp_timeout_ms;
+
+	timeout_ms = (io_data->srtt + MAX (1000, 4 * io_data->rttvar) + 999) / 1000;
+
+	return CLAMP (timeout_ms, MIN (ARV_GV_DEVICE_GVCP_READ_TIMEOUT_MS_MIN, io_data->gvcp_timeout_ms),
+		      io_data->gvcp_timeout_ms);
+}
+
 static gboolean
 _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 			   guint64 address, size_t size, void *buffer, GError **error)
@@ -147,6 +203,8 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 	unsigned int n_retries = 0;
 	gboolean success = FALSE;
 	ArvGvcpError command_error = ARV_GVCP_ERROR_NONE;
+	gint64 retransmission_timeout_ms;
+	gint64 pending_ack_timeout_ms = 0;
 	int count;
 
 	switch (command) {
@@ -163,7 +221,7 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
 			operation = "read_register";
 			expected_ack_command = ARV_GVCP_COMMAND_READ_REGISTER_ACK;
-			ack_size = arv_gvcp_packet_get_read_register_ack_size ();
+			ack_size = arv_gvcp_packet_get_read_registers_ack_size (size / sizeof (guint32));
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
 			operation = "write_register";
@@ -190,22 +248,30 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 								       io_data->packet_id, &packet_size);
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			packet = arv_gvcp_packet_new_read_register_cmd (address,
-									io_data->packet_id, &packet_size);
+			/* buffer contains the register addresses, replaced by the values on success */
+			packet = arv_gvcp_packet_new_read_registers_cmd (buffer, size / sizeof (guint32),
+									 io_data->packet_id, &packet_size);
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
-			packet = arv_gvcp_packet_new_write_register_cmd (address, *((guint32 *) buffer),
-									 io_data->packet_id, &packet_size);
+			/* buffer contains address and value pairs */
+			packet = arv_gvcp_packet_new_write_registers_cmd (buffer, size / (2 * sizeof (guint32)),
+									  io_data->packet_id, &packet_size);
 			break;
 		default:
 			g_assert_not_reached ();
 	}
 
+	retransmission_timeout_ms = _get_retransmission_timeout_ms (io_data, command);
+
 	do {
 		GError *local_error = NULL;
+		gint64 send_time_us;
+		gboolean rtt_sampled = n_retries > 0;
 
 		arv_gvcp_packet_debug (packet, ARV_DEBUG_LEVEL_TRACE);
 
+		send_time_us = g_get_monotonic_time ();
+
 		success = g_socket_send_to (io_data->socket, io_data->device_address,
 					    (const char *) packet, packet_size,
 					    NULL, &local_error) >= 0;
@@ -216,7 +282,16 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 			gboolean pending_ack;
 			gboolean expected_answer;
 
-			timeout_stop_ms = g_get_monotonic_time () / 1000 + io_data->gvcp_timeout_ms;
+			/* The last attempt waits for the configured timeout. With the adaptive timeout, the attempts
+			 * following a pending acknowledge give the device at least the announced time to answer. */
+			if (n_retries + 1 >= io_data->gvcp_n_retries)
+				timeout_ms = io_data->gvcp_timeout_ms;
+			else
+				timeout_ms = retransmission_timeout_ms;
+			if (io_data->adaptive_timeout)
+				timeout_ms = MAX (timeout_ms, pending_ack_timeout_ms + retransmission_timeout_ms);
+
+			timeout_stop_ms = send_time_us / 1000 + timeout_ms;
 
 			do {
 				pending_ack = FALSE;
@@ -249,12 +324,21 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 
 					if (ack_command == ARV_GVCP_COMMAND_PENDING_ACK &&
 					    count >= arv_gvcp_packet_get_pending_ack_size ()) {
-						gint64 pending_ack_timeout_ms =
+						pending_ack_timeout_ms =
                                                         arv_gvcp_packet_get_pending_ack_timeout (ack_packet, count);
 						pending_ack = TRUE;
 						expected_answer = FALSE;
 
+						if (!rtt_sampled) {
+							_update_rtt (io_data, g_get_monotonic_time () - send_time_us);
+							rtt_sampled = TRUE;
+						}
+
+						/* Without the adaptive timeout, the device is only given the announced
+						 * time */
 						timeout_stop_ms = g_get_monotonic_time () / 1000 + pending_ack_timeout_ms;
+						if (io_data->adaptive_timeout)
+							timeout_stop_ms += retransmission_timeout_ms;
 
 						arv_debug_device ("[GvDevice::%s] Pending ack timeout = %"
                                                                   G_GINT64_FORMAT,
@@ -279,6 +363,11 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
                                                                          operation, packet_type);
                                                 }
                                         }
+
+                                        if (expected_answer && !rtt_sampled) {
+                                                _update_rtt (io_data, g_get_monotonic_time () - send_time_us);
+                                                rtt_sampled = TRUE;
+                                        }
                                 } else {
                                         expected_answer = FALSE;
                                         if (local_error != NULL)
@@ -302,8 +391,14 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 					case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
 						break;
 					case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-						*((gint32 *) buffer) =
-                                                        arv_gvcp_packet_get_read_register_ack_value (ack_packet, count);
+						{
+							guint i;
+
+							for (i = 0; i < size / sizeof (guint32); i++)
+								((guint32 *) buffer)[i] =
+									arv_gvcp_packet_get_read_registers_ack_value
+									(ack_packet, count, i);
+						}
 						break;
 					case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
 						break;
@@ -318,6 +413,11 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 		}
 
 		n_retries++;
+
+		if (!success && n_retries < io_data->gvcp_n_retries) {
+			io_data->n_retransmissions++;
+			retransmission_timeout_ms = MIN (2 * retransmission_timeout_ms, io_data->gvcp_timeout_ms);
+		}
 	} while (!success && n_retries < io_data->gvcp_n_retries);
 
 	arv_gvcp_packet_free (packet);
@@ -334,7 +434,7 @@ _send_cmd_and_receive_ack (ArvGvDeviceIOData *io_data, ArvGvcpCommand command,
 			case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
 				break;
 			case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-				*((guint32 *) buffer) = 0;
+				memset (buffer, 0, size);
 				break;
 			case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
 				break;
@@ -371,15 +471,33 @@ _write_memory (ArvGvDeviceIOData *io_data, guint64 address, guint32 size, void *
 static gboolean
 _read_register (ArvGvDeviceIOData *io_data, guint32 address, guint32 *value_placeholder, GError **error)
 {
+	*value_placeholder = address;
+
 	return _send_cmd_and_receive_ack (io_data, ARV_GVCP_COMMAND_READ_REGISTER_CMD,
 					  address, sizeof (guint32), value_placeholder, error);
 }
 
+static gboolean
+_read_registers (ArvGvDeviceIOData *io_data, guint32 *addresses_values, guint n_registers, GError **error)
+{
+	return _send_cmd_and_receive_ack (io_data, ARV_GVCP_COMMAND_READ_REGISTER_CMD,
+					  addresses_values[0], n_registers * sizeof (guint32), addresses_values, error);
+}
+
 static gboolean
 _write_register (ArvGvDeviceIOData *io_data, guint32 address, guint32 value, GError **error)
 {
+	guint32 registers[2] = {address, value};
+
 	return _send_cmd_and_receive_ack (io_data, ARV_GVCP_COMMAND_WRITE_REGISTER_CMD,
-					  address, sizeof (guint32), &value, error);
+					  address, sizeof (registers), registers, error);
+}
+
+static gboolean
+_write_registers (ArvGvDeviceIOData *io_data, guint32 *registers, guint n_registers, GError **error)
+{
+	return _send_cmd_and_receive_ack (io_data, ARV_GVCP_COMMAND_WRITE_REGISTER_CMD,
+					  registers[0], 2 * n_registers * sizeof (guint32), registers, error);
 }
 
 static gboolean
@@ -434,6 +552,67 @@ arv_gv_device_write_register (ArvDevice *device, guint64 address, guint32 value,
 	return _write_register (priv->io_data, address, value, error);
 }
 
+static gboolean
+arv_gv_device_read_registers (ArvDevice *device, guint n_registers, const guint64 *addresses, guint32 *values,
+			      GError **error)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	guint i, j;
+
+	if (!priv->is_concatenation_supported) {
+		for (i = 0; i < n_registers; i++)
+			if (!_read_register (priv->io_data, addresses[i], &values[i], error))
+				return FALSE;
+
+		return TRUE;
+	}
+
+	/* Multiple registers per READREG command, the values replacing the addresses in place */
+	for (i = 0; i < n_registers; i += ARV_GVCP_READ_REGISTER_N_MAX) {
+		guint n = MIN (ARV_GVCP_READ_REGISTER_N_MAX, n_registers - i);
+
+		for (j = 0; j < n; j++)
+			values[i + j] = addresses[i + j];
+
+		if (!_read_registers (priv->io_data, &values[i], n, error))
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+static gboolean
+arv_gv_device_write_registers (ArvDevice *device, guint n_registers, const guint64 *addresses, const guint32 *values,
+			       GError **error)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (ARV_GV_DEVICE (device));
+	guint32 registers[2 * ARV_GVCP_WRITE_REGISTER_N_MAX];
+	guint i, j;
+
+	if (!priv->is_concatenation_supported) {
+		for (i = 0; i < n_registers; i++)
+			if (!_write_register (priv->io_data, addresses[i], values[i], error))
+				return FALSE;
+
+		return TRUE;
+	}
+
+	/* Multiple registers per WRITEREG command, which the device writes in order */
+	for (i = 0; i < n_registers; i += ARV_GVCP_WRITE_REGISTER_N_MAX) {
+		guint n = MIN (ARV_GVCP_WRITE_REGISTER_N_MAX, n_registers - i);
+
+		for (j = 0; j < n; j++) {
+			registers[2 * j] = addresses[i + j];
+			registers[2 * j + 1] = values[i + j];
+		}
+
+		if (!_write_registers (priv->io_data, registers, n, error))
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
 /* Heartbeat thread */
 
 typedef struct {
@@ -1263,7 +1442,8 @@ arv_gv_device_is_controller (ArvGvDevice *gv_device)
 }
 
 static char *
-_load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **url, GError **error)
+_load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **url, ArvGc **genicam_document,
+               GError **error)
 {
         GError *local_error = NULL;
 	char filename[ARV_GVBS_XML_URL_SIZE];
@@ -1275,9 +1455,11 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
 
 	g_return_val_if_fail (size != NULL, NULL);
         g_return_val_if_fail (url != NULL, NULL);
+        g_return_val_if_fail (genicam_document != NULL, NULL);
 
 	*size = 0;
         *url = NULL;
+        *genicam_document = NULL;
 
 	if (!arv_gv_device_read_memory (ARV_DEVICE (gv_device), address, ARV_GVBS_XML_URL_SIZE, filename, error))
 		return NULL;
@@ -1302,7 +1484,21 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
                         arv_info_device ("[GvDevice::load_genicam] Xml address = 0x%" G_GINT64_MODIFIER "x - "
                                          "size = 0x%" G_GINT64_MODIFIER "x - %s", file_address, file_size, path);
 
-                        if (file_size > 0) {
+                        if (file_size > 0 && g_str_has_suffix (path, ".zip")) {
+                                arv_info_device ("[GvDevice::load_genicam] Zipped xml data");
+
+                                /* Download, decompression and parsing are overlapped */
+                                *genicam_document = arv_gc_new_from_device_zip (ARV_DEVICE (gv_device),
+                                                                                file_address, file_size,
+                                                                                &genicam, size, &local_error);
+                                if (genicam == NULL && local_error == NULL)
+                                        arv_warning_device ("[GvDevice::load_genicam] Invalid format");
+
+                                if (genicam != NULL)
+                                        *url = g_strdup_printf ("%s:///%s;%" G_GINT64_MODIFIER "x;%"
+                                                                G_GINT64_MODIFIER "x", scheme, path,
+                                                                file_address, file_size);
+                        } else if (file_size > 0) {
                                 genicam = g_malloc (file_size);
                                 if (arv_gv_device_read_memory (ARV_DEVICE (gv_device), file_address, file_size,
                                                                genicam, &local_error)) {
@@ -1320,40 +1516,10 @@ _load_genicam (ArvGvDevice *gv_device, guint32 address, size_t  *size, char **ur
                                                 g_string_free (string, TRUE);
                                         }
 
-                                        if (g_str_has_suffix (path, ".zip")) {
-                                                ArvZip *zip;
-                                                const GSList *zip_files;
-
-                                                arv_info_device ("[GvDevice::load_genicam] Zipped xml data");
-
-                                                zip = arv_zip_new (genicam, file_size);
-                                                zip_files = arv_zip_get_file_list (zip);
-
-                                                if (zip_files != NULL) {
-                                                        const char *zip_filename;
-                                                        void *tmp_buffer;
-                                                        size_t tmp_buffer_size;
-
-                                                        zip_filename = arv_zip_file_get_name (zip_files->data);
-                                                        tmp_buffer = arv_zip_get_file (zip, zip_filename,
-                                                                                       &tmp_buffer_size);
-
-                                                        g_free (genicam);
-                                                        *size = tmp_buffer_size;
-                                                        genicam = tmp_buffer;
-                                                } else {
-                                                        arv_warning_device ("[GvDevice::load_genicam] Invalid format");
-                                                        g_clear_pointer (&genicam, g_free);
-                                                }
-                                                arv_zip_free (zip);
-                                        } else {
-                                                *size = file_size;
-                                        }
-
-                                        if (genicam != NULL)
-                                                *url = g_strdup_printf ("%s:///%s;%" G_GINT64_MODIFIER "x;%"
-                                                                        G_GINT64_MODIFIER "x", scheme, path,
-                                                                        file_address, file_size);
+                                        *size = file_size;
+                                        *url = g_strdup_printf ("%s:///%s;%" G_GINT64_MODIFIER "x;%"
+                                                                G_GINT64_MODIFIER "x", scheme, path,
+                                                                file_address, file_size);
                                 } else {
                                         g_clear_pointer (&genicam, g_free);
                                 }
@@ -1824,17 +1990,19 @@ arv_gv_device_load_genicam (ArvGvDevice *gv_device, GError **error)
 	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (gv_device);
         GError *local_error = NULL;
         char *url = NULL;
+	ArvGc *genicam = NULL;
 	char *xml;
 	size_t size;
 
 	size = 0;
 
-	xml = _load_genicam (gv_device, ARV_GVBS_XML_URL_0_OFFSET, &size, &url, &local_error);
+	xml = _load_genicam (gv_device, ARV_GVBS_XML_URL_0_OFFSET, &size, &url, &genicam, &local_error);
 	if (xml == NULL && local_error == NULL)
-		xml = _load_genicam (gv_device, ARV_GVBS_XML_URL_1_OFFSET, &size, &url, &local_error);
+		xml = _load_genicam (gv_device, ARV_GVBS_XML_URL_1_OFFSET, &size, &url, &genicam, &local_error);
 
 	if (local_error != NULL) {
 		g_propagate_error (error, local_error);
+                g_clear_object (&genicam);
                 g_free (xml);
                 g_free (url);
 		return;
@@ -1842,7 +2010,7 @@ arv_gv_device_load_genicam (ArvGvDevice *gv_device, GError **error)
 
 	priv->genicam_xml = xml;
 	priv->genicam_xml_size = size;
-        priv->genicam = arv_gc_new (ARV_DEVICE (gv_device), xml, size);
+        priv->genicam = genicam != NULL ? genicam : arv_gc_new (ARV_DEVICE (gv_device), xml, size);
         if (priv->genicam == NULL) {
 		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_GENICAM_NOT_FOUND,
 			     "Invalid Genicam data");
@@ -1956,6 +2124,80 @@ arv_gv_device_set_stream_options (ArvGvDevice *gv_device, ArvGvStreamOption opti
 	priv->stream_options = options;
 }
 
+/**
+ * arv_gv_device_set_adaptive_gvcp_timeout:
+ * @gv_device: a #ArvGvDevice
+ * @enable: %TRUE to derive the GVCP read retransmission timeouts from the measured round trip time
+ *
+ * When enabled, a GVCP read command is sent again after a timeout derived from the smoothed round trip time and its
+ * variation, doubled after each retransmission. The last attempt always waits for the full GVCP timeout, and write
+ * commands are never sent again before the full GVCP timeout. When disabled, which is the default, every attempt waits
+ * for the full GVCP timeout.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gv_device_set_adaptive_gvcp_timeout (ArvGvDevice *gv_device, gboolean enable)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (gv_device);
+
+	g_return_if_fail (ARV_IS_GV_DEVICE (gv_device));
+	g_return_if_fail (priv->io_data != NULL);
+
+	g_mutex_lock (&priv->io_data->mutex);
+	priv->io_data->adaptive_timeout = enable;
+	g_mutex_unlock (&priv->io_data->mutex);
+}
+
+/**
+ * arv_gv_device_get_gvcp_statistics:
+ * @gv_device: a #ArvGvDevice
+ * @n_round_trips: (out) (optional): number of round trip time measurements
+ * @n_retransmissions: (out) (optional): number of commands sent again after a timeout
+ * @srtt_ms: (out) (optional): smoothed round trip time, in milliseconds
+ * @rttvar_ms: (out) (optional): round trip time variation, in milliseconds
+ * @rtt_min_ms: (out) (optional): minimum round trip time, in milliseconds
+ * @rtt_max_ms: (out) (optional): maximum round trip time, in milliseconds
+ *
+ * Retrieves the round trip time statistics of the GVCP control channel. The round trip time is measured for the
+ * commands acknowledged without retransmission.
+ *
+ * Since: 0.10.0
+ */
+
+void
+arv_gv_device_get_gvcp_statistics (ArvGvDevice *gv_device,
+				   guint64 *n_round_trips, guint64 *n_retransmissions,
+				   double *srtt_ms, double *rttvar_ms,
+				   double *rtt_min_ms, double *rtt_max_ms)
+{
+	ArvGvDevicePrivate *priv = arv_gv_device_get_instance_private (gv_device);
+	ArvGvDeviceIOData *io_data;
+
+	g_return_if_fail (ARV_IS_GV_DEVICE (gv_device));
+	g_return_if_fail (priv->io_data != NULL);
+
+	io_data = priv->io_data;
+
+	g_mutex_lock (&io_data->mutex);
+
+	if (n_round_trips != NULL)
+		*n_round_trips = io_data->n_rtt_samples;
+	if (n_retransmissions != NULL)
+		*n_retransmissions = io_data->n_retransmissions;
+	if (srtt_ms != NULL)
+		*srtt_ms = io_data->srtt / 1000.0;
+	if (rttvar_ms != NULL)
+		*rttvar_ms = io_data->rttvar / 1000.0;
+	if (rtt_min_ms != NULL)
+		*rtt_min_ms = io_data->rtt_min / 1000.0;
+	if (rtt_max_ms != NULL)
+		*rtt_max_ms = io_data->rtt_max / 1000.0;
+
+	g_mutex_unlock (&io_data->mutex);
+}
+
 /**
  * arv_gv_device_new:
  * @interface_address: address of the interface connected to the device
@@ -2031,6 +2273,9 @@ arv_gv_device_constructed (GObject *object)
 	io_data->buffer = g_malloc (ARV_GV_DEVICE_BUFFER_SIZE);
 	io_data->gvcp_n_retries = ARV_GV_DEVICE_GVCP_N_RETRIES_DEFAULT;
 	io_data->gvcp_timeout_ms = ARV_GV_DEVICE_GVCP_TIMEOUT_MS_DEFAULT;
+	io_data->adaptive_timeout = FALSE;
+	io_data->rtt_histogram = arv_histogram_new (1, 100, 100, 0);
+	arv_histogram_set_variable_name (io_data->rtt_histogram, 0, "gvcp_rtt");
 	io_data->poll_in_event.fd = g_socket_get_fd (io_data->socket);
 	io_data->poll_in_event.events =  G_IO_IN;
 	io_data->poll_in_event.revents = 0;
@@ -2071,10 +2316,16 @@ arv_gv_device_constructed (GObject *object)
 	arv_gv_device_read_register (ARV_DEVICE (gv_device), ARV_GVBS_GVCP_CAPABILITY_OFFSET, &capabilities, NULL);
 	priv->is_packet_resend_supported = (capabilities & ARV_GVBS_GVCP_CAPABILITY_PACKET_RESEND) != 0;
 	priv->is_write_memory_supported = (capabilities & ARV_GVBS_GVCP_CAPABILITY_WRITE_MEMORY) != 0;
+	priv->is_concatenation_supported = (capabilities & ARV_GVBS_GVCP_CAPABILITY_CONCATENATION) != 0;
+
+	/* Registers are stored big endian in the device memory */
+	arv_device_set_register_byte_order (ARV_DEVICE (gv_device), G_BIG_ENDIAN);
+	arv_device_set_register_batching (ARV_DEVICE (gv_device), priv->is_concatenation_supported);
 
 	arv_info_device ("[GvDevice::new] Device endianness = %s", priv->is_big_endian_device ? "big" : "little");
 	arv_info_device ("[GvDevice::new] Packet resend     = %s", priv->is_packet_resend_supported ? "yes" : "no");
 	arv_info_device ("[GvDevice::new] Write memory      = %s", priv->is_write_memory_supported ? "yes" : "no");
+	arv_info_device ("[GvDevice::new] Concatenation     = %s", priv->is_concatenation_supported ? "yes" : "no");
 
 	document = ARV_DOM_DOCUMENT (priv->genicam);
 	register_description = ARV_GC_REGISTER_DESCRIPTION_NODE (arv_dom_document_get_document_element (document));
@@ -2129,6 +2380,20 @@ arv_gv_device_finalize (GObject *object)
 		g_clear_pointer (&io_data->buffer, g_free);
 		g_mutex_clear (&io_data->mutex);
 
+		if (io_data->rtt_histogram != NULL) {
+			char *histogram_string;
+
+			arv_info_device ("[GvDevice::finalize] %" G_GUINT64_FORMAT " GVCP round trips, %"
+					 G_GUINT64_FORMAT " retransmissions", io_data->n_rtt_samples,
+					 io_data->n_retransmissions);
+
+			histogram_string = arv_histogram_to_string (io_data->rtt_histogram);
+			arv_info_device ("%s", histogram_string);
+			g_free (histogram_string);
+
+			arv_histogram_unref (io_data->rtt_histogram);
+		}
+
 		arv_gpollfd_finish_all (&io_data->poll_in_event, 1);
 
 		g_clear_pointer (&io_data, g_free);
@@ -2232,6 +2497,8 @@ arv_gv_device_class_init (ArvGvDeviceClass *gv_device_class)
 	device_class->write_memory = arv_gv_device_write_memory;
 	device_class->read_register = arv_gv_device_read_register;
 	device_class->write_register = arv_gv_device_write_register;
+	device_class->read_registers = arv_gv_device_read_registers;
+	device_class->write_registers = arv_gv_device_write_registers;
 
 	g_object_class_install_property
 		(object_class,
@@ -91,6 +91,13 @@ ARV_API ArvGvStreamOption	arv_gv_device_get_stream_options		(ArvGvDevice *gv_dev
 ARV_API void			arv_gv_device_set_stream_options		(ArvGvDevice *gv_device,
                                                                                  ArvGvStreamOption options);
 
+ARV_API void			arv_gv_device_set_adaptive_gvcp_timeout		(ArvGvDevice *gv_device, gboolean enable);
+ARV_API void			arv_gv_device_get_gvcp_statistics		(ArvGvDevice *gv_device,
+										 guint64 *n_round_trips,
+										 guint64 *n_retransmissions,
+										 double *srtt_ms, double *rttvar_ms,
+										 double *rtt_min_ms, double *rtt_max_ms);
+
 ARV_API gboolean		arv_gv_device_get_current_ip			(ArvGvDevice *gv_device,
                                                                                  GInetAddress **ip,
                                                                                  GInetAddressMask **mask,
@@ -45,6 +45,9 @@ G_BEGIN_DECLS
     #define ARV_GV_DEVICE_HEARTBEAT_RETRY_TIMEOUT_S 5.0		/* FIXME */
 #endif
 
+/* Lower bound of the adaptive GVCP read retransmission timeout */
+#define ARV_GV_DEVICE_GVCP_READ_TIMEOUT_MS_MIN	5
+
 #define ARV_GV_DEVICE_GVSP_PACKET_SIZE_DEFAULT	1500
 
 #define ARV_GV_DEVICE_BUFFER_SIZE	1024
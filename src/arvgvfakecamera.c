@@ -20,7 +20,7 @@
  * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
  */
 
-#include <arvgvfakecamera.h>
+#include <arvgvfakecameraprivate.h>
 #include <arvfakecamera.h>
 #include <arvbufferprivate.h>
 #include <arvgvcpprivate.h>
@@ -28,6 +28,15 @@
 #include <arvmisc.h>
 #include <arvmiscprivate.h>
 #include <arvnetworkprivate.h>
+#include <arvfeatures.h>
+#include <arvparamsprivate.h>
+#include <string.h>
+#include <errno.h>
+
+#if ARAVIS_HAS_UDP_SEGMENT
+#include <sys/socket.h>
+#include <netinet/udp.h>
+#endif
 
 /**
  * SECTION: arvgvfakecamera
@@ -37,6 +46,8 @@
  */
 
 #define ARV_GV_FAKE_CAMERA_BUFFER_SIZE	65536
+#define ARV_GV_FAKE_CAMERA_DEFAULT_N_RETAINED_FRAMES	4
+#define ARV_GV_FAKE_CAMERA_N_RETAINED_FRAMES_MAX	64
 
 enum {
 	ARV_GV_FAKE_CAMERA_INPUT_SOCKET_GVCP = 0,
@@ -52,9 +63,44 @@ enum
   PROP_SERIAL_NUMBER,
   PROP_GENICAM_FILENAME,
   PROP_GVSP_LOST_PACKET_RATIO,
+  PROP_GVSP_BURST_RATIO,
+  PROP_GVSP_BURST_LENGTH,
+  PROP_GVSP_BURST_LOST_RATIO,
+  PROP_GVSP_REORDER_RATIO,
+  PROP_GVSP_REORDER_DISTANCE,
+  PROP_GVSP_DUPLICATE_RATIO,
+  PROP_GVSP_DELAY,
+  PROP_GVSP_JITTER,
+  PROP_GVSP_RATE_LIMIT,
+  PROP_GVSP_SEED,
+  PROP_GVSP_N_RETAINED_FRAMES,
   PROP_CM_DOMAIN
 };
 
+typedef struct _ArvGvFakeCameraBatch ArvGvFakeCameraBatch;
+
+/* Network impairments applied to the emitted GVSP packets */
+
+typedef struct {
+	double lost_ratio;		/* Loss probability, outside of a burst */
+	double burst_ratio;		/* Probability of a burst start */
+	double burst_length;		/* Mean burst length, in packets */
+	double burst_lost_ratio;	/* Loss probability, during a burst */
+	double reorder_ratio;
+	guint reorder_distance;		/* Maximum displacement of a reordered packet */
+	double duplicate_ratio;
+	guint delay_us;			/* Delay of each packet */
+	guint jitter_us;		/* Maximum random additional delay */
+	guint64 rate_limit;		/* bits per second, 0 for no limit */
+	guint32 seed;			/* Random generator seed, 0 for a random seed */
+} ArvGvFakeCameraImpairment;
+
+typedef struct {
+	ArvBuffer *buffer;
+	guint32 gv_packet_size;
+	gboolean is_sent;
+} ArvGvFakeCameraRetainedFrame;
+
 typedef struct {
 	char *interface_name;
 	char *serial_number;
@@ -77,7 +123,20 @@ typedef struct {
 	GThread *thread;
 	gboolean cancel;
 
-	double gvsp_lost_packet_ratio;
+	GMutex command_mutex;
+	ArvGvFakeCameraCommandCallback command_callback;
+	void *command_callback_data;
+	GSocket *command_socket;
+	GSocketAddress *command_address;
+
+	ArvGvFakeCameraImpairment impairment;
+	guint gvsp_n_retained_frames;
+
+	/* Stream state, only accessed from the camera thread */
+	ArvGvFakeCameraBatch *batch;
+	ArvGvFakeCameraRetainedFrame *retained_frames;
+	guint n_retained_frames;
+	guint last_retained_frame;
 } ArvGvFakeCameraPrivate;
 
 struct _ArvGvFakeCamera {
@@ -106,6 +165,8 @@ _g_inet_socket_address_is_equal (GInetSocketAddress *a, GInetSocketAddress *b)
 				     g_inet_socket_address_get_address (b));
 }
 
+static void _handle_packet_resend (ArvGvFakeCamera *gv_fake_camera, ArvGvcpPacket *packet, size_t size);
+
 static gboolean
 _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 			GSocketAddress *remote_address,
@@ -154,6 +215,26 @@ _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 		return FALSE;
 	}
 
+	{
+		gboolean is_dropped = FALSE;
+
+		g_mutex_lock (&gv_fake_camera->priv->command_mutex);
+		if (gv_fake_camera->priv->command_callback != NULL) {
+			gv_fake_camera->priv->command_socket = socket;
+			gv_fake_camera->priv->command_address = remote_address;
+			is_dropped = !gv_fake_camera->priv->command_callback (gv_fake_camera, packet, size,
+									      gv_fake_camera->priv->command_callback_data);
+			gv_fake_camera->priv->command_socket = NULL;
+			gv_fake_camera->priv->command_address = NULL;
+		}
+		g_mutex_unlock (&gv_fake_camera->priv->command_mutex);
+
+		if (is_dropped) {
+			arv_info_device ("[GvFakeCamera::handle_control_packet] Command dropped");
+			return FALSE;
+		}
+	}
+
 	switch (g_ntohs (packet->header.command)) {
 		case ARV_GVCP_COMMAND_DISCOVERY_CMD:
 			ack_packet = arv_gvcp_packet_new_discovery_ack (packet_id, &ack_packet_size);
@@ -187,16 +268,32 @@ _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 									   &ack_packet_size);
 			break;
 		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
-			arv_gvcp_packet_get_read_register_cmd_infos (packet, size, &register_address);
-			arv_fake_camera_read_register (gv_fake_camera->priv->camera, register_address, &register_value);
-			arv_info_device ("[GvFakeCamera::handle_control_packet] Read register command %d -> %d",
-					  register_address, register_value);
-			ack_packet = arv_gvcp_packet_new_read_register_ack (register_value, packet_id,
-									    &ack_packet_size);
-
-			if (register_address == ARV_GVBS_CONTROL_CHANNEL_PRIVILEGE_OFFSET)
-				gv_fake_camera->priv->controller_time = g_get_real_time ();
+			{
+				guint32 values[ARV_GVCP_READ_REGISTER_N_MAX];
+				guint n_registers;
+				guint i;
+
+				/* Multiple address read, using the concatenation capability */
+				n_registers = MIN (arv_gvcp_packet_get_read_register_cmd_n_registers (packet, size),
+						   ARV_GVCP_READ_REGISTER_N_MAX);
+				if (n_registers < 1)
+					break;
+
+				for (i = 0; i < n_registers; i++) {
+					register_address = arv_gvcp_packet_get_read_registers_cmd_address (packet, size, i);
+					arv_fake_camera_read_register (gv_fake_camera->priv->camera, register_address,
+								       &values[i]);
+					arv_info_device ("[GvFakeCamera::handle_control_packet]"
+							 " Read register command %d -> %d",
+							 register_address, values[i]);
+
+					if (register_address == ARV_GVBS_CONTROL_CHANNEL_PRIVILEGE_OFFSET)
+						gv_fake_camera->priv->controller_time = g_get_real_time ();
+				}
 
+				ack_packet = arv_gvcp_packet_new_read_registers_ack (values, n_registers, packet_id,
+										     &ack_packet_size);
+			}
 			break;
 		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
 			arv_gvcp_packet_get_write_register_cmd_infos (packet, size, &register_address, &register_value);
@@ -207,11 +304,31 @@ _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 				break;
 			}
 
-			arv_fake_camera_write_register (gv_fake_camera->priv->camera, register_address, register_value);
-			arv_info_device ("[GvFakeCamera::handle_control_packet] Write register command %d -> %d",
-					  register_address, register_value);
-			ack_packet = arv_gvcp_packet_new_write_register_ack (1, packet_id,
-									     &ack_packet_size);
+			{
+				guint n_registers;
+				guint i;
+
+				/* Multiple address write, using the concatenation capability */
+				n_registers = arv_gvcp_packet_get_write_register_cmd_n_registers (packet, size);
+				for (i = 0; i < n_registers; i++) {
+					arv_gvcp_packet_get_write_registers_cmd_infos (packet, size, i,
+										       &register_address,
+										       &register_value);
+					arv_fake_camera_write_register (gv_fake_camera->priv->camera,
+									register_address, register_value);
+					arv_info_device ("[GvFakeCamera::handle_control_packet]"
+							 " Write register command %d -> %d",
+							 register_address, register_value);
+				}
+
+				ack_packet = arv_gvcp_packet_new_write_register_ack (n_registers, packet_id,
+										     &ack_packet_size);
+			}
+			break;
+		case ARV_GVCP_COMMAND_PACKET_RESEND_CMD:
+			/* No acknowledge, the requested packets are sent on the stream channel */
+			_handle_packet_resend (gv_fake_camera, packet, size);
+			success = TRUE;
 			break;
 		default:
 			arv_warning_device ("[GvFakeCamera::handle_control_packet] Unknown command");
@@ -243,19 +360,715 @@ _handle_control_packet (ArvGvFakeCamera *gv_fake_camera, GSocket *socket,
 	return success;
 }
 
+/* GVSP emission. The packets of a frame are sent in batches, using a single system call per batch (sendmmsg, when
+ * available), with the payload data sent directly from the image buffer. On Linux, runs of packets of the same size
+ * are sent using UDP segmentation offload, the kernel splitting a single large datagram in packets. When an inter
+ * packet delay is set in the stream channel packet delay register (SCPD), the batches are shortened and spread over
+ * time in order to match the requested packet rate.
+ *
+ * The network impairments are emulated in the same path: packets are dropped when queued, following a Gilbert-Elliott
+ * model, and duplicated when queued. When a delay, a jitter, a rate limit or a reordering is set, the flushed packets
+ * are copied in an emission queue, each with its own emission time: the end of its transmission at the limited rate,
+ * plus the delay and a random jitter. The jitter never reorders the packets. A reordered packet is held back until
+ * the emission of up to reorder distance later packets, whatever the batch or frame they belong to, or at most
+ * ARV_GV_FAKE_CAMERA_REORDER_HOLD_US. The queue is serviced from the camera thread main loop, which allows a delay
+ * longer than the frame period. All the random draws use a generator owned by the batch, which makes a run
+ * reproducible when a seed is given. */
+
+#define ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS	64
+#define ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX	256
+/* Maximum size of a segmented datagram: 65535 minus IP and UDP headers */
+#define ARV_GV_FAKE_CAMERA_GSO_SIZE_MAX		65507
+/* Period of the packet bursts, when the packets are paced */
+#define ARV_GV_FAKE_CAMERA_PACING_PERIOD_NS	100000
+/* Maximum time a reordered packet is held back, when no later packet is emitted */
+#define ARV_GV_FAKE_CAMERA_REORDER_HOLD_US	10000
+
+/* Packet of the emission queue, copied as the image buffer may be reused before its emission */
+
+typedef struct {
+	gint64 emission_time_us;	/* Release deadline, once held back */
+	guint n_holds;			/* Number of later packets to let pass, for a reordered packet */
+	size_t size;
+	guint8 data[];
+} ArvGvFakeCameraTimedPacket;
+
+struct _ArvGvFakeCameraBatch {
+	GSocket *socket;
+	GSocketAddress *address;
+	gboolean use_gso;
+
+	ArvGvFakeCameraImpairment impairment;
+	GRand *rand;
+	gboolean is_in_burst;
+	gint64 link_free_time_us;
+	gint64 last_emission_time_us;
+	GQueue timed_packets;		/* Sorted by emission time */
+	GQueue held_packets;		/* Reordered packets, sorted by release deadline */
+
+	guint64 n_lost_packets;
+	guint64 n_duplicated_packets;
+	guint64 n_reordered_packets;
+
+	GOutputMessage messages[ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS];
+	GOutputVector vectors[2 * ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS];
+	guint8 headers[ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS][ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX];
+
+	guint n_packets;
+	size_t n_bytes;
+	size_t segment_size;
+};
+
+#if ARAVIS_HAS_UDP_SEGMENT
+
+static gboolean
+_send_segmented_batch (ArvGvFakeCameraBatch *batch)
+{
+	struct sockaddr_storage address;
+	struct iovec iov[2 * ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS];
+	struct msghdr message = {0};
+	struct cmsghdr *cmsg;
+	char control[CMSG_SPACE (sizeof (guint16))] = {0};
+	guint n_iov = 0;
+	guint i, j;
+
+	if (!g_socket_address_to_native (batch->address, &address, sizeof (address), NULL))
+		return FALSE;
+
+	for (i = 0; i < batch->n_packets; i++) {
+		for (j = 0; j < batch->messages[i].num_vectors; j++) {
+			iov[n_iov].iov_base = (void *) batch->messages[i].vectors[j].buffer;
+			iov[n_iov].iov_len = batch->messages[i].vectors[j].size;
+			n_iov++;
+		}
+	}
+
+	message.msg_name = &address;
+	message.msg_namelen = g_socket_address_get_native_size (batch->address);
+	message.msg_iov = iov;
+	message.msg_iovlen = n_iov;
+	message.msg_control = control;
+	message.msg_controllen = sizeof (control);
+
+	cmsg = CMSG_FIRSTHDR (&message);
+	cmsg->cmsg_level = SOL_UDP;
+	cmsg->cmsg_type = UDP_SEGMENT;
+	cmsg->cmsg_len = CMSG_LEN (sizeof (guint16));
+	*((guint16 *) CMSG_DATA (cmsg)) = batch->segment_size;
+
+	return sendmsg (g_socket_get_fd (batch->socket), &message, 0) >= 0;
+}
+
+#endif
+
+static gboolean
+_is_timed (ArvGvFakeCameraBatch *batch)
+{
+	return batch->impairment.delay_us > 0 ||
+		batch->impairment.jitter_us > 0 ||
+		batch->impairment.rate_limit > 0 ||
+		batch->impairment.reorder_ratio > 0.0 ||
+		!g_queue_is_empty (&batch->timed_packets) ||
+		!g_queue_is_empty (&batch->held_packets);
+}
+
+/* Moves the packets of the batch to the emission queue */
+
+static void
+_enqueue_batch (ArvGvFakeCameraBatch *batch)
+{
+	ArvGvFakeCameraImpairment *impairment = &batch->impairment;
+	guint i, j;
+
+	for (i = 0; i < batch->n_packets; i++) {
+		ArvGvFakeCameraTimedPacket *packet;
+		GOutputMessage *message = &batch->messages[i];
+		size_t size = 0;
+		gint64 time_us;
+
+		for (j = 0; j < message->num_vectors; j++)
+			size += message->vectors[j].size;
+
+		packet = g_malloc (sizeof (ArvGvFakeCameraTimedPacket) + size);
+		packet->size = 0;
+		for (j = 0; j < message->num_vectors; j++) {
+			memcpy (packet->data + packet->size, message->vectors[j].buffer, message->vectors[j].size);
+			packet->size += message->vectors[j].size;
+		}
+
+		time_us = g_get_monotonic_time ();
+
+		/* Token bucket without burst allowance: a packet leaves the link once the previous ones are drained
+		 * at the nominal rate */
+		if (impairment->rate_limit > 0) {
+			batch->link_free_time_us = MAX (time_us, batch->link_free_time_us) +
+				(gint64) (8 * size * G_USEC_PER_SEC / impairment->rate_limit);
+			time_us = batch->link_free_time_us;
+		}
+
+		time_us += impairment->delay_us;
+		if (impairment->jitter_us > 0)
+			time_us += g_rand_int_range (batch->rand, 0, impairment->jitter_us + 1);
+
+		packet->emission_time_us = MAX (time_us, batch->last_emission_time_us);
+		batch->last_emission_time_us = packet->emission_time_us;
+
+		packet->n_holds = 0;
+		if (impairment->reorder_ratio > 0.0 &&
+		    g_rand_double (batch->rand) < impairment->reorder_ratio) {
+			packet->n_holds = g_rand_int_range (batch->rand, 1, impairment->reorder_distance + 1);
+			batch->n_reordered_packets++;
+		}
+
+		g_queue_push_tail (&batch->timed_packets, packet);
+	}
+
+	batch->n_packets = 0;
+	batch->n_bytes = 0;
+}
+
+static void
+_send_timed_packet (ArvGvFakeCameraBatch *batch, ArvGvFakeCameraTimedPacket *packet)
+{
+	if (batch->address != NULL)
+		g_socket_send_to (batch->socket, batch->address, (const char *) packet->data, packet->size,
+				  NULL, NULL);
+	g_free (packet);
+}
+
+/* Sends the queued packets whose emission time is reached, and the held back packets that can be released */
+
+static void
+_emit_due_packets (ArvGvFakeCameraBatch *batch)
+{
+	ArvGvFakeCameraTimedPacket *packet;
+	gint64 time_us = g_get_monotonic_time ();
+
+	while ((packet = g_queue_peek_head (&batch->timed_packets)) != NULL &&
+	       packet->emission_time_us <= time_us) {
+		GList *iter;
+
+		g_queue_pop_head (&batch->timed_packets);
+
+		if (packet->n_holds > 0) {
+			packet->emission_time_us += ARV_GV_FAKE_CAMERA_REORDER_HOLD_US;
+			g_queue_push_tail (&batch->held_packets, packet);
+			continue;
+		}
+
+		_send_timed_packet (batch, packet);
+
+		for (iter = batch->held_packets.head; iter != NULL; ) {
+			GList *next = iter->next;
+			ArvGvFakeCameraTimedPacket *held_packet = iter->data;
+
+			if (--held_packet->n_holds == 0) {
+				g_queue_delete_link (&batch->held_packets, iter);
+				_send_timed_packet (batch, held_packet);
+			}
+
+			iter = next;
+		}
+	}
+
+	while ((packet = g_queue_peek_head (&batch->held_packets)) != NULL &&
+	       packet->emission_time_us <= time_us)
+		_send_timed_packet (batch, g_queue_pop_head (&batch->held_packets));
+}
+
+/* Returns the monotonic time of the next emission, G_MAXINT64 if no packet is waiting */
+
+static gint64
+_get_next_emission_time (ArvGvFakeCameraBatch *batch)
+{
+	ArvGvFakeCameraTimedPacket *packet;
+	gint64 time_us = G_MAXINT64;
+
+	packet = g_queue_peek_head (&batch->timed_packets);
+	if (packet != NULL)
+		time_us = packet->emission_time_us;
+
+	packet = g_queue_peek_head (&batch->held_packets);
+	if (packet != NULL)
+		time_us = MIN (time_us, packet->emission_time_us);
+
+	return time_us;
+}
+
+static void
+_clear_timed_packets (ArvGvFakeCameraBatch *batch)
+{
+	ArvGvFakeCameraTimedPacket *packet;
+
+	while ((packet = g_queue_pop_head (&batch->timed_packets)) != NULL)
+		g_free (packet);
+	while ((packet = g_queue_pop_head (&batch->held_packets)) != NULL)
+		g_free (packet);
+
+	batch->link_free_time_us = 0;
+	batch->last_emission_time_us = 0;
+}
+
+static void
+_flush_batch (ArvGvFakeCameraBatch *batch)
+{
+	guint n_sent = 0;
+
+	if (batch->n_packets == 0)
+		return;
+
+	if (_is_timed (batch)) {
+		_enqueue_batch (batch);
+		_emit_due_packets (batch);
+		return;
+	}
+
+#if ARAVIS_HAS_UDP_SEGMENT
+	/* The segments of a datagram are sent in order. On failure, the packets of the batch are sent one by one. The
+	 * segmentation is only abandoned if it is not supported by the kernel or the interface, not on transient errors
+	 * like a full socket buffer. */
+	if (batch->use_gso && batch->n_packets > 1) {
+		if (_send_segmented_batch (batch))
+			n_sent = batch->n_packets;
+		else if (errno == EIO || errno == EINVAL || errno == ENOPROTOOPT) {
+			arv_info_stream_thread ("[GvFakeCamera::flush_batch] UDP segmentation offload not available (%s)",
+						g_strerror (errno));
+			batch->use_gso = FALSE;
+		} else
+			arv_debug_stream_thread ("[GvFakeCamera::flush_batch] Failed to send a segmented datagram (%s)",
+						 g_strerror (errno));
+	}
+#endif
+
+	while (n_sent < batch->n_packets) {
+		GError *error = NULL;
+		int n_messages;
+
+		n_messages = g_socket_send_messages (batch->socket, batch->messages + n_sent, batch->n_packets - n_sent,
+						     0, NULL, &error);
+		if (n_messages <= 0) {
+			arv_warning_stream_thread ("[GvFakeCamera::flush_batch] Failed to send %u packets: %s",
+						   batch->n_packets - n_sent,
+						   error != NULL ? error->message : "unknown error");
+			g_clear_error (&error);
+			break;
+		}
+
+		n_sent += n_messages;
+	}
+
+	batch->n_packets = 0;
+	batch->n_bytes = 0;
+}
+
+/* Returns a placeholder for the header of a new packet, or NULL if the packet is dropped in order to simulate a packet
+ * loss. */
+
+static void *
+_new_packet (ArvGvFakeCameraBatch *batch)
+{
+	ArvGvFakeCameraImpairment *impairment = &batch->impairment;
+	double lost_ratio = impairment->lost_ratio;
+
+	/* Gilbert-Elliott model: the link switches between a good and a bad state, with a specific loss probability
+	 * in each state */
+	if (impairment->burst_ratio > 0.0) {
+		if (batch->is_in_burst)
+			batch->is_in_burst = g_rand_double (batch->rand) >= 1.0 / impairment->burst_length;
+		else
+			batch->is_in_burst = g_rand_double (batch->rand) < impairment->burst_ratio;
+
+		if (batch->is_in_burst)
+			lost_ratio = impairment->burst_lost_ratio;
+	}
+
+	if (lost_ratio > 0.0 && g_rand_double (batch->rand) < lost_ratio) {
+		batch->n_lost_packets++;
+		return NULL;
+	}
+
+	if (batch->n_packets >= ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS)
+		_flush_batch (batch);
+
+	return batch->headers[batch->n_packets];
+}
+
+static void
+_queue_packet (ArvGvFakeCameraBatch *batch, size_t header_size, const void *data, size_t data_size)
+{
+	GOutputMessage *message;
+	GOutputVector *vectors;
+	size_t size = header_size + data_size;
+
+	/* A segmented datagram is made of packets of the same size, except the last one which may be shorter */
+	if (batch->use_gso && batch->n_packets > 0 &&
+	    (size > batch->segment_size ||
+	     batch->n_bytes % batch->segment_size != 0 ||
+	     batch->n_bytes + size > ARV_GV_FAKE_CAMERA_GSO_SIZE_MAX)) {
+		guint8 header[ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX];
+
+		memcpy (header, batch->headers[batch->n_packets], header_size);
+		_flush_batch (batch);
+		memcpy (batch->headers[0], header, header_size);
+	}
+
+	if (batch->n_packets == 0)
+		batch->segment_size = size;
+
+	vectors = &batch->vectors[2 * batch->n_packets];
+	vectors[0].buffer = batch->headers[batch->n_packets];
+	vectors[0].size = header_size;
+	vectors[1].buffer = data;
+	vectors[1].size = data_size;
+
+	message = &batch->messages[batch->n_packets];
+	message->address = batch->address;
+	message->vectors = vectors;
+	message->num_vectors = data_size > 0 ? 2 : 1;
+	message->bytes_sent = 0;
+	message->control_messages = NULL;
+	message->num_control_messages = 0;
+
+	batch->n_packets++;
+	batch->n_bytes += size;
+}
+
+/* Queues the packet whose header was written in the placeholder returned by _new_packet */
+
+static void
+_add_packet (ArvGvFakeCameraBatch *batch, size_t header_size, const void *data, size_t data_size)
+{
+	_queue_packet (batch, header_size, data, data_size);
+
+	if (batch->impairment.duplicate_ratio > 0.0 &&
+	    g_rand_double (batch->rand) < batch->impairment.duplicate_ratio) {
+		guint8 header[ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX];
+
+		memcpy (header, batch->headers[batch->n_packets - 1], header_size);
+		if (batch->n_packets >= ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS)
+			_flush_batch (batch);
+		memcpy (batch->headers[batch->n_packets], header, header_size);
+
+		_queue_packet (batch, header_size, data, data_size);
+
+		batch->n_duplicated_packets++;
+	}
+}
+
+/* Multipart frames are emitted in extended id mode, and their data blocks do not span over parts */
+
+static guint32
+_get_n_data_blocks (ArvBuffer *image_buffer, guint32 gv_packet_size)
+{
+	size_t data_size_max;
+	guint32 n_data_blocks = 0;
+	guint i;
+
+	if (image_buffer->priv->payload_type != ARV_BUFFER_PAYLOAD_TYPE_MULTIPART) {
+		data_size_max = gv_packet_size - ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE);
+
+		return (image_buffer->priv->received_size + data_size_max - 1) / data_size_max;
+	}
+
+	data_size_max = gv_packet_size - ARV_GVSP_MULTIPART_PACKET_PROTOCOL_OVERHEAD (TRUE);
+
+	for (i = 0; i < image_buffer->priv->n_parts; i++)
+		n_data_blocks += (image_buffer->priv->parts[i].size + data_size_max - 1) / data_size_max;
+
+	return n_data_blocks;
+}
+
+static ArvGvspPacket *
+_new_multipart_leader (ArvBuffer *image_buffer, void *packet, size_t *packet_size)
+{
+	ArvGvspPacket *leader;
+	guint i;
+
+	leader = arv_gvsp_packet_new_multipart_leader (image_buffer->priv->frame_id, 0,
+						       arv_buffer_get_timestamp (image_buffer),
+						       image_buffer->priv->n_parts,
+						       packet, ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX,
+						       packet_size);
+	if (leader == NULL)
+		return NULL;
+
+	for (i = 0; i < image_buffer->priv->n_parts; i++) {
+		ArvBufferPartInfos *part = &image_buffer->priv->parts[i];
+
+		arv_gvsp_multipart_leader_packet_set_part_infos (leader, *packet_size, i,
+								 part->component_id, part->data_type, part->size,
+								 part->pixel_format, part->width, part->height,
+								 part->x_offset, part->y_offset,
+								 part->x_padding, part->y_padding);
+	}
+
+	return leader;
+}
+
+static void
+_queue_multipart_block (ArvGvFakeCameraBatch *batch, ArvBuffer *image_buffer, guint32 gv_packet_size,
+			guint32 block_id, void *packet)
+{
+	ArvBufferPartInfos *part = NULL;
+	size_t data_size_max;
+	size_t packet_size;
+	size_t offset;
+	guint32 part_block_id = block_id - 1;
+	guint part_id;
+
+	data_size_max = gv_packet_size - ARV_GVSP_MULTIPART_PACKET_PROTOCOL_OVERHEAD (TRUE);
+
+	for (part_id = 0; part_id < image_buffer->priv->n_parts; part_id++) {
+		guint32 n_part_blocks;
+
+		part = &image_buffer->priv->parts[part_id];
+		n_part_blocks = (part->size + data_size_max - 1) / data_size_max;
+		if (part_block_id < n_part_blocks)
+			break;
+		part_block_id -= n_part_blocks;
+	}
+
+	g_return_if_fail (part_id < image_buffer->priv->n_parts);
+
+	offset = part_block_id * data_size_max;
+
+	arv_gvsp_packet_new_multipart_header (image_buffer->priv->frame_id, block_id,
+					      part_id, part->data_offset + offset,
+					      packet, ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX,
+					      &packet_size);
+	_add_packet (batch, packet_size, ((char *) image_buffer->priv->data) + part->data_offset + offset,
+		     MIN (data_size_max, part->size - offset));
+}
+
+/* Queues the packet of a given block id. Block 0 is the leader, the data blocks follow, and the trailer closes the
+ * frame. */
+
+static void
+_queue_block (ArvGvFakeCameraBatch *batch, ArvBuffer *image_buffer, guint32 gv_packet_size, guint32 block_id)
+{
+	ArvGvspPacket *packet;
+	guint32 n_data_blocks;
+	size_t data_size_max;
+	size_t packet_size;
+	gboolean is_multipart;
+
+	packet = _new_packet (batch);
+	if (packet == NULL) {
+		arv_info_stream_thread ("Drop GVSP packet frame:%" G_GUINT64_FORMAT ", block:%u",
+					image_buffer->priv->frame_id, block_id);
+		return;
+	}
+
+	data_size_max = gv_packet_size - ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE);
+	n_data_blocks = _get_n_data_blocks (image_buffer, gv_packet_size);
+	is_multipart = image_buffer->priv->payload_type == ARV_BUFFER_PAYLOAD_TYPE_MULTIPART;
+
+	if (block_id == 0) {
+		if (is_multipart) {
+			if (_new_multipart_leader (image_buffer, packet, &packet_size) == NULL) {
+				arv_warning_stream_thread ("[GvFakeCamera::queue_block] Too many parts (%u)",
+							   image_buffer->priv->n_parts);
+				return;
+			}
+		} else
+			arv_gvsp_packet_new_image_leader (image_buffer->priv->frame_id,
+							  block_id,
+							  arv_buffer_get_timestamp (image_buffer),
+							  image_buffer->priv->has_chunks,
+							  arv_buffer_get_image_pixel_format (image_buffer),
+							  arv_buffer_get_image_width (image_buffer),
+							  arv_buffer_get_image_height (image_buffer),
+							  arv_buffer_get_image_x (image_buffer),
+							  arv_buffer_get_image_y (image_buffer),
+							  0, 0,
+							  packet, ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX,
+							  &packet_size);
+		_add_packet (batch, packet_size, NULL, 0);
+	} else if (block_id > n_data_blocks) {
+		arv_gvsp_packet_new_data_trailer (image_buffer->priv->frame_id, block_id, is_multipart,
+						  is_multipart ?
+						  ARV_BUFFER_PAYLOAD_TYPE_MULTIPART :
+						  ARV_BUFFER_PAYLOAD_TYPE_IMAGE,
+						  is_multipart ? 0 : arv_buffer_get_image_height (image_buffer),
+						  packet, ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX,
+						  &packet_size);
+		_add_packet (batch, packet_size, NULL, 0);
+	} else if (is_multipart) {
+		_queue_multipart_block (batch, image_buffer, gv_packet_size, block_id, packet);
+	} else {
+		size_t offset = (block_id - 1) * data_size_max;
+
+		arv_gvsp_packet_new_payload_header (image_buffer->priv->frame_id, block_id,
+						    packet, ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX,
+						    &packet_size);
+		_add_packet (batch, packet_size, ((char *) image_buffer->priv->data) + offset,
+			     MIN (data_size_max, image_buffer->priv->received_size - offset));
+	}
+}
+
+static void
+_send_frame (ArvGvFakeCamera *gv_fake_camera, ArvGvFakeCameraBatch *batch, ArvBuffer *image_buffer,
+	     guint32 gv_packet_size)
+{
+	guint32 packet_delay_ns = 0;
+	guint n_burst_packets = G_MAXUINT;
+	guint32 n_blocks;
+	guint32 block_id;
+	gint64 start_time_us;
+
+	arv_fake_camera_read_register (gv_fake_camera->priv->camera, ARV_GVBS_STREAM_CHANNEL_0_PACKET_DELAY_OFFSET,
+				       &packet_delay_ns);
+	if (packet_delay_ns > 0)
+		n_burst_packets = MAX (1, ARV_GV_FAKE_CAMERA_PACING_PERIOD_NS / packet_delay_ns);
+
+	batch->impairment = gv_fake_camera->priv->impairment;
+
+	start_time_us = g_get_monotonic_time ();
+
+	/* Leader, data blocks and trailer */
+	n_blocks = _get_n_data_blocks (image_buffer, gv_packet_size) + 2;
+
+	for (block_id = 0; block_id < n_blocks; block_id++) {
+		_queue_block (batch, image_buffer, gv_packet_size, block_id);
+
+		if ((block_id + 1) % n_burst_packets == 0) {
+			gint64 delay_us;
+
+			_flush_batch (batch);
+
+			delay_us = start_time_us + (gint64) (block_id + 1) * packet_delay_ns / 1000 -
+				g_get_monotonic_time ();
+			if (delay_us > 0)
+				g_usleep (delay_us);
+		}
+	}
+
+	_flush_batch (batch);
+}
+
+/* Packet resend. The last emitted frames are kept in a ring, in which the requested blocks are retrieved. Requests
+ * for frames that have left the ring, or for blocks outside of the frame, are answered by an error packet on the
+ * stream channel, which allows the receiver to stop asking. */
+
+static void
+_send_error_packet (ArvGvFakeCameraBatch *batch, guint16 frame_id, guint32 block_id, ArvGvspPacketStatus status)
+{
+	ArvGvspPacket *packet;
+	size_t packet_size;
+
+	_flush_batch (batch);
+
+	packet = arv_gvsp_packet_new_payload_header (frame_id, block_id,
+						     batch->headers[0], ARV_GV_FAKE_CAMERA_HEADER_SIZE_MAX,
+						     &packet_size);
+	packet->status = g_htons (status);
+
+	g_socket_send_to (batch->socket, batch->address, (const char *) packet, packet_size, NULL, NULL);
+}
+
+static void
+_handle_packet_resend (ArvGvFakeCamera *gv_fake_camera, ArvGvcpPacket *packet, size_t size)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	ArvGvFakeCameraRetainedFrame *retained_frame = NULL;
+	guint64 frame_id;
+	guint32 first_block;
+	guint32 last_block;
+	guint32 n_blocks;
+	guint32 block_id;
+	gboolean extended_ids;
+	guint i;
+
+	if (!arv_gvcp_packet_get_packet_resend_cmd_infos (packet, size, &frame_id, &first_block, &last_block,
+							  &extended_ids)) {
+		arv_warning_device ("[GvFakeCamera::handle_packet_resend] Invalid packet resend command");
+		return;
+	}
+
+	if (priv->batch == NULL || priv->batch->address == NULL) {
+		arv_info_device ("[GvFakeCamera::handle_packet_resend] Ignore packet resend command, not streaming");
+		return;
+	}
+
+	/* The frame ids are emitted as 16 bit values */
+	if (extended_ids && frame_id > G_MAXUINT16) {
+		_send_error_packet (priv->batch, frame_id, first_block, ARV_GVSP_PACKET_STATUS_PACKET_UNAVAILABLE);
+		return;
+	}
+
+	for (i = 0; i < priv->n_retained_frames && retained_frame == NULL; i++)
+		if (priv->retained_frames[i].is_sent &&
+		    priv->retained_frames[i].buffer->priv->frame_id == frame_id)
+			retained_frame = &priv->retained_frames[i];
+
+	if (retained_frame == NULL) {
+		ArvBuffer *last_buffer = priv->retained_frames[priv->last_retained_frame].buffer;
+		gint16 age = (gint16) (last_buffer->priv->frame_id - frame_id);
+
+		arv_info_device ("[GvFakeCamera::handle_packet_resend] Frame %" G_GUINT64_FORMAT " not available",
+				 frame_id);
+
+		_send_error_packet (priv->batch, frame_id, first_block,
+				    age > 0 ?
+				    ARV_GVSP_PACKET_STATUS_PACKET_REMOVED_FROM_MEMORY :
+				    ARV_GVSP_PACKET_STATUS_PACKET_UNAVAILABLE);
+		return;
+	}
+
+	n_blocks = _get_n_data_blocks (retained_frame->buffer, retained_frame->gv_packet_size) + 2;
+
+	if (first_block > last_block || first_block >= n_blocks) {
+		arv_info_device ("[GvFakeCamera::handle_packet_resend] Invalid block range %u-%u for frame %"
+				 G_GUINT64_FORMAT, first_block, last_block, frame_id);
+		_send_error_packet (priv->batch, frame_id, first_block, ARV_GVSP_PACKET_STATUS_PACKET_UNAVAILABLE);
+		return;
+	}
+
+	last_block = MIN (last_block, n_blocks - 1);
+
+	arv_info_device ("[GvFakeCamera::handle_packet_resend] Resend blocks %u-%u of frame %" G_GUINT64_FORMAT,
+			 first_block, last_block, frame_id);
+
+	priv->batch->impairment = priv->impairment;
+
+	for (block_id = first_block; block_id <= last_block; block_id++)
+		_queue_block (priv->batch, retained_frame->buffer, retained_frame->gv_packet_size, block_id);
+
+	_flush_batch (priv->batch);
+}
+
+static void
+_allocate_retained_frames (ArvGvFakeCamera *gv_fake_camera, size_t payload)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	guint i;
+
+	priv->n_retained_frames = MAX (1, priv->gvsp_n_retained_frames);
+	priv->retained_frames = g_new0 (ArvGvFakeCameraRetainedFrame, priv->n_retained_frames);
+	for (i = 0; i < priv->n_retained_frames; i++)
+		priv->retained_frames[i].buffer = arv_buffer_new (payload, NULL);
+	priv->last_retained_frame = 0;
+}
+
+static void
+_free_retained_frames (ArvGvFakeCamera *gv_fake_camera)
+{
+	ArvGvFakeCameraPrivate *priv = gv_fake_camera->priv;
+	guint i;
+
+	for (i = 0; i < priv->n_retained_frames; i++)
+		g_clear_object (&priv->retained_frames[i].buffer);
+	g_clear_pointer (&priv->retained_frames, g_free);
+	priv->n_retained_frames = 0;
+}
+
 static void *
 _thread (void *user_data)
 {
 	ArvGvFakeCamera *gv_fake_camera = user_data;
-	ArvBuffer *image_buffer = NULL;
-	GError *error = NULL;
+	ArvGvFakeCameraBatch *batch;
 	GSocketAddress *stream_address = NULL;
-	void *packet_buffer;
-	size_t packet_size;
 	size_t payload = 0;
-	guint16 block_id;
-	ptrdiff_t offset;
-	guint32 gv_packet_size;
 	GInputVector input_vector;
 	int n_events;
 	gboolean is_streaming = FALSE;
@@ -263,7 +1076,13 @@ _thread (void *user_data)
 	input_vector.buffer = g_malloc0 (ARV_GV_FAKE_CAMERA_BUFFER_SIZE);
 	input_vector.size = ARV_GV_FAKE_CAMERA_BUFFER_SIZE;
 
-	packet_buffer = g_malloc (ARV_GV_FAKE_CAMERA_BUFFER_SIZE);
+	batch = g_new0 (ArvGvFakeCameraBatch, 1);
+	batch->socket = gv_fake_camera->priv->gvsp_socket;
+	batch->rand = g_rand_new ();
+#if ARAVIS_HAS_UDP_SEGMENT
+	batch->use_gso = TRUE;
+#endif
+	gv_fake_camera->priv->batch = batch;
 
 	do {
 		guint64 next_timestamp_us;
@@ -277,12 +1096,20 @@ _thread (void *user_data)
 		do {
 			gint timeout_ms;
 
+			gint64 emission_time_us;
+
 			timeout_ms =  (next_timestamp_us - g_get_real_time ()) / 1000LL;
 			if (timeout_ms < 0)
 				timeout_ms = 0;
 			else if (timeout_ms > 100)
 				timeout_ms = 100;
 
+			/* Wake up for the next packet of the emission queue */
+			emission_time_us = _get_next_emission_time (batch);
+			if (emission_time_us != G_MAXINT64)
+				timeout_ms = CLAMP ((emission_time_us - g_get_monotonic_time () + 999) / 1000,
+						    0, timeout_ms);
+
 			n_events = g_poll (gv_fake_camera->priv->socket_fds, gv_fake_camera->priv->n_socket_fds, timeout_ms);
 			if (n_events > 0) {
 				unsigned int i;
@@ -315,13 +1142,22 @@ _thread (void *user_data)
 					if (stream_address != NULL) {
 						g_object_unref (stream_address);
 						stream_address = NULL;
-						g_object_unref (image_buffer);
-						image_buffer = NULL;
-						arv_info_stream_thread ("[GvFakeCamera::thread] Stop stream");
+						batch->address = NULL;
+						_clear_timed_packets (batch);
+						_free_retained_frames (gv_fake_camera);
+						arv_info_stream_thread ("[GvFakeCamera::thread] Stop stream"
+									" (%" G_GUINT64_FORMAT " lost, %"
+									G_GUINT64_FORMAT " duplicated, %"
+									G_GUINT64_FORMAT " reordered packets)",
+									batch->n_lost_packets,
+									batch->n_duplicated_packets,
+									batch->n_reordered_packets);
 					}
 					is_streaming = FALSE;
 				}
 			}
+
+			_emit_due_packets (batch);
 		} while (!g_atomic_int_get (&gv_fake_camera->priv->cancel) && g_get_real_time () < next_timestamp_us);
 
 		if (arv_fake_camera_get_control_channel_privilege (gv_fake_camera->priv->camera) != 0 &&
@@ -341,99 +1177,42 @@ _thread (void *user_data)
 				g_free (inet_address_string);
 
 				payload = arv_fake_camera_get_payload (gv_fake_camera->priv->camera);
-				image_buffer = arv_buffer_new (payload, NULL);
+				_allocate_retained_frames (gv_fake_camera, payload);
+
+				batch->address = stream_address;
+
+				/* A given seed reproduces the same impairment sequence for each stream */
+				if (gv_fake_camera->priv->impairment.seed != 0)
+					g_rand_set_seed (batch->rand, gv_fake_camera->priv->impairment.seed);
+				batch->is_in_burst = FALSE;
+				_clear_timed_packets (batch);
+				batch->n_lost_packets = 0;
+				batch->n_duplicated_packets = 0;
+				batch->n_reordered_packets = 0;
 			}
 
 			if (arv_fake_camera_is_in_free_running_mode (gv_fake_camera->priv->camera) ||
 			    (arv_fake_camera_is_in_software_trigger_mode (gv_fake_camera->priv->camera) &&
 			     arv_fake_camera_check_and_acknowledge_software_trigger (gv_fake_camera->priv->camera))) {
-				arv_fake_camera_fill_buffer (gv_fake_camera->priv->camera, image_buffer,
-                                                             &gv_packet_size);
+				ArvGvFakeCameraRetainedFrame *frame;
+				guint index;
 
-				arv_info_stream_thread ("[GvFakeCamera::thread] Send frame %" G_GUINT64_FORMAT,
-                                                        image_buffer->priv->frame_id);
-
-				block_id = 0;
-
-                                arv_gvsp_packet_new_image_leader (image_buffer->priv->frame_id,
-                                                                  block_id,
-                                                                  arv_buffer_get_timestamp(image_buffer),
-                                                                  arv_buffer_get_image_pixel_format(image_buffer),
-                                                                  arv_buffer_get_image_width(image_buffer),
-                                                                  arv_buffer_get_image_height(image_buffer),
-                                                                  arv_buffer_get_image_x(image_buffer),
-                                                                  arv_buffer_get_image_y(image_buffer),
-                                                                  0, 0,
-                                                                  packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
-                                                                  &packet_size);
-
-				if (g_random_double () >= gv_fake_camera->priv->gvsp_lost_packet_ratio)
-					g_socket_send_to (gv_fake_camera->priv->gvsp_socket, stream_address,
-							packet_buffer, packet_size, NULL, &error);
-				else
-					arv_info_stream_thread
-                                                ("Drop GVSP leader packet frame: %" G_GUINT64_FORMAT,
-                                                 image_buffer->priv->frame_id);
-
-				if (error != NULL) {
-					arv_warning_stream_thread
-                                                ("[GvFakeCamera::thread] Failed to send leader for frame %"
-                                                 G_GUINT64_FORMAT ": %s", image_buffer->priv->frame_id, error->message);
-                                        g_clear_error (&error);
-                                }
-
-				block_id++;
-
-				offset = 0;
-				while (offset < payload) {
-					size_t data_size;
-
-					data_size = MIN (gv_packet_size - ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE),
-							payload - offset);
-
-                                        arv_gvsp_packet_new_payload (image_buffer->priv->frame_id, block_id,
-                                                                     data_size,
-                                                                     ((char *) image_buffer->priv->data) + offset,
-                                                                     packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
-                                                                     &packet_size);
-
-					if (g_random_double () >= gv_fake_camera->priv->gvsp_lost_packet_ratio)
-						g_socket_send_to (gv_fake_camera->priv->gvsp_socket, stream_address,
-								packet_buffer, packet_size, NULL, &error);
-					else
-						arv_info_stream_thread
-                                                        ("Drop GVSP data packet frame:%" G_GUINT64_FORMAT
-                                                         ", block:%u", image_buffer->priv->frame_id, block_id);
-
-					if (error != NULL) {
-						arv_info_stream_thread
-                                                        ("[GvFakeCamera::thread] Failed to send frame block %d for frame"
-                                                         " %" G_GUINT64_FORMAT ": %s",
-                                                         block_id, image_buffer->priv->frame_id, error->message);
-                                                g_clear_error (&error);
-                                        }
-
-					offset += data_size;
-					block_id++;
-				}
+				/* Overwrite the oldest retained frame */
+				index = (gv_fake_camera->priv->last_retained_frame + 1) %
+					gv_fake_camera->priv->n_retained_frames;
+				frame = &gv_fake_camera->priv->retained_frames[index];
+				frame->is_sent = FALSE;
 
-                                arv_gvsp_packet_new_data_trailer (image_buffer->priv->frame_id, block_id, arv_buffer_get_image_height(image_buffer) ,
-                                                                  packet_buffer, ARV_GV_FAKE_CAMERA_BUFFER_SIZE,
-                                                                  &packet_size);
+				arv_fake_camera_fill_buffer (gv_fake_camera->priv->camera, frame->buffer,
+                                                             &frame->gv_packet_size);
 
-				if (g_random_double () >= gv_fake_camera->priv->gvsp_lost_packet_ratio)
-					g_socket_send_to (gv_fake_camera->priv->gvsp_socket, stream_address,
-							packet_buffer, packet_size, NULL, &error);
-				else
-					arv_info_stream_thread ("Drop GVSP trailer packet frame: %" G_GUINT64_FORMAT,
-								image_buffer->priv->frame_id);
+				arv_info_stream_thread ("[GvFakeCamera::thread] Send frame %" G_GUINT64_FORMAT,
+                                                        frame->buffer->priv->frame_id);
+
+				_send_frame (gv_fake_camera, batch, frame->buffer, frame->gv_packet_size);
 
-				if (error != NULL) {
-					arv_info_stream_thread
-                                                ("[GvFakeCamera::thread] Failed to send trailer for frame %"
-                                                 G_GUINT64_FORMAT ": %s", image_buffer->priv->frame_id, error->message);
-                                        g_clear_error (&error);
-                                }
+				frame->is_sent = TRUE;
+				gv_fake_camera->priv->last_retained_frame = index;
 
 				is_streaming = TRUE;
 			}
@@ -443,10 +1222,12 @@ _thread (void *user_data)
 
 	if (stream_address != NULL)
 		g_object_unref (stream_address);
-	if (image_buffer != NULL)
-		g_object_unref (image_buffer);
+	_free_retained_frames (gv_fake_camera);
 
-	g_free (packet_buffer);
+	gv_fake_camera->priv->batch = NULL;
+	_clear_timed_packets (batch);
+	g_rand_free (batch->rand);
+	g_free (batch);
 	g_free (input_vector.buffer);
 
 	return NULL;
@@ -662,7 +1443,40 @@ _set_property (GObject *object, guint prop_id, const GValue *value, GParamSpec *
 			gv_fake_camera->priv->genicam_filename = g_value_dup_string (value);
 			break;
 		case PROP_GVSP_LOST_PACKET_RATIO:
-			gv_fake_camera->priv->gvsp_lost_packet_ratio = g_value_get_double (value);
+			gv_fake_camera->priv->impairment.lost_ratio = g_value_get_double (value);
+			break;
+		case PROP_GVSP_BURST_RATIO:
+			gv_fake_camera->priv->impairment.burst_ratio = g_value_get_double (value);
+			break;
+		case PROP_GVSP_BURST_LENGTH:
+			gv_fake_camera->priv->impairment.burst_length = g_value_get_double (value);
+			break;
+		case PROP_GVSP_BURST_LOST_RATIO:
+			gv_fake_camera->priv->impairment.burst_lost_ratio = g_value_get_double (value);
+			break;
+		case PROP_GVSP_REORDER_RATIO:
+			gv_fake_camera->priv->impairment.reorder_ratio = g_value_get_double (value);
+			break;
+		case PROP_GVSP_REORDER_DISTANCE:
+			gv_fake_camera->priv->impairment.reorder_distance = g_value_get_uint (value);
+			break;
+		case PROP_GVSP_DUPLICATE_RATIO:
+			gv_fake_camera->priv->impairment.duplicate_ratio = g_value_get_double (value);
+			break;
+		case PROP_GVSP_DELAY:
+			gv_fake_camera->priv->impairment.delay_us = g_value_get_uint (value);
+			break;
+		case PROP_GVSP_JITTER:
+			gv_fake_camera->priv->impairment.jitter_us = g_value_get_uint (value);
+			break;
+		case PROP_GVSP_RATE_LIMIT:
+			gv_fake_camera->priv->impairment.rate_limit = g_value_get_uint64 (value);
+			break;
+		case PROP_GVSP_SEED:
+			gv_fake_camera->priv->impairment.seed = g_value_get_uint (value);
+			break;
+		case PROP_GVSP_N_RETAINED_FRAMES:
+			gv_fake_camera->priv->gvsp_n_retained_frames = g_value_get_uint (value);
 			break;
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -706,10 +1520,46 @@ arv_gv_fake_camera_is_running (ArvGvFakeCamera *gv_fake_camera)
 	return gv_fake_camera->priv->is_running;
 }
 
+/* For the tests, which inspect the commands sent by ArvGvDevice, or emulate their loss */
+
+void
+arv_gv_fake_camera_set_command_callback (ArvGvFakeCamera *gv_fake_camera,
+					 ArvGvFakeCameraCommandCallback callback, void *user_data)
+{
+	g_return_if_fail (ARV_IS_GV_FAKE_CAMERA (gv_fake_camera));
+
+	g_mutex_lock (&gv_fake_camera->priv->command_mutex);
+	gv_fake_camera->priv->command_callback = callback;
+	gv_fake_camera->priv->command_callback_data = user_data;
+	g_mutex_unlock (&gv_fake_camera->priv->command_mutex);
+}
+
+/* Only valid from the command callback, for the command being handled */
+
+void
+arv_gv_fake_camera_send_pending_ack (ArvGvFakeCamera *gv_fake_camera, const ArvGvcpPacket *packet,
+				     guint16 timeout_ms)
+{
+	ArvGvcpPacket *ack_packet;
+	size_t ack_packet_size;
+
+	g_return_if_fail (ARV_IS_GV_FAKE_CAMERA (gv_fake_camera));
+	g_return_if_fail (packet != NULL);
+	g_return_if_fail (gv_fake_camera->priv->command_socket != NULL);
+
+	ack_packet = arv_gvcp_packet_new_pending_ack (timeout_ms, g_ntohs (packet->header.id), &ack_packet_size);
+	g_socket_send_to (gv_fake_camera->priv->command_socket, gv_fake_camera->priv->command_address,
+			  (char *) ack_packet, ack_packet_size, NULL, NULL);
+	arv_gvcp_packet_debug (ack_packet, ARV_DEBUG_LEVEL_DEBUG);
+	g_free (ack_packet);
+}
+
 static void
 arv_gv_fake_camera_init (ArvGvFakeCamera *gv_fake_camera)
 {
 	gv_fake_camera->priv = arv_gv_fake_camera_get_instance_private (gv_fake_camera);
+
+	g_mutex_init (&gv_fake_camera->priv->command_mutex);
 }
 
 static void
@@ -738,6 +1588,8 @@ _finalize (GObject *object)
 	g_clear_pointer (&gv_fake_camera->priv->serial_number, g_free);
 	g_clear_pointer (&gv_fake_camera->priv->genicam_filename, g_free);
 
+	g_mutex_clear (&gv_fake_camera->priv->command_mutex);
+
 	G_OBJECT_CLASS (arv_gv_fake_camera_parent_class)->finalize (object);
 }
 
@@ -786,4 +1638,186 @@ arv_gv_fake_camera_class_init (ArvGvFakeCameraClass *this_class)
 							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
 							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
 							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-burst-ratio:
+	 *
+	 * Probability for a packet to start a loss burst. During a burst, packets are lost with the
+	 * #ArvGvFakeCamera:gvsp-burst-lost-ratio probability instead of #ArvGvFakeCamera:gvsp-lost-ratio (Gilbert-Elliott
+	 * model).
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_BURST_RATIO,
+					 g_param_spec_double ("gvsp-burst-ratio",
+							      "GVSP burst ratio",
+							      "GVSP loss burst start probability",
+							      0.0, 1.0, 0.0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-burst-length:
+	 *
+	 * Mean length of a loss burst, in packets.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_BURST_LENGTH,
+					 g_param_spec_double ("gvsp-burst-length",
+							      "GVSP burst length",
+							      "GVSP mean loss burst length",
+							      1.0, G_MAXUINT32, 1.0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-burst-lost-ratio:
+	 *
+	 * Packet loss probability during a loss burst.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_BURST_LOST_RATIO,
+					 g_param_spec_double ("gvsp-burst-lost-ratio",
+							      "GVSP burst lost ratio",
+							      "GVSP lost packet ratio during a burst",
+							      0.0, 1.0, 1.0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-reorder-ratio:
+	 *
+	 * Probability for a packet to be held back, until the emission of up to #ArvGvFakeCamera:gvsp-reorder-distance
+	 * later packets, including packets of the next frames. A packet is not held back for more than 10 ms.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_REORDER_RATIO,
+					 g_param_spec_double ("gvsp-reorder-ratio",
+							      "GVSP reorder ratio",
+							      "GVSP reordered packet ratio",
+							      0.0, 1.0, 0.0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-reorder-distance:
+	 *
+	 * Maximum displacement of a reordered packet, in packets.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_REORDER_DISTANCE,
+					 g_param_spec_uint ("gvsp-reorder-distance",
+							    "GVSP reorder distance",
+							    "GVSP maximum reordered packet displacement",
+							    1, ARV_GV_FAKE_CAMERA_N_BATCH_PACKETS - 1, 4,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-duplicate-ratio:
+	 *
+	 * Probability for a packet to be sent twice.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_DUPLICATE_RATIO,
+					 g_param_spec_double ("gvsp-duplicate-ratio",
+							      "GVSP duplicate ratio",
+							      "GVSP duplicated packet ratio",
+							      0.0, 1.0, 0.0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-delay:
+	 *
+	 * Delay added to the emission time of each packet, in µs.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_DELAY,
+					 g_param_spec_uint ("gvsp-delay",
+							    "GVSP delay",
+							    "GVSP packet delay (µs)",
+							    0, G_USEC_PER_SEC, 0,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-jitter:
+	 *
+	 * Maximum random delay added to #ArvGvFakeCamera:gvsp-delay, in µs. The jitter does not reorder the packets.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_JITTER,
+					 g_param_spec_uint ("gvsp-jitter",
+							    "GVSP jitter",
+							    "GVSP packet jitter (µs)",
+							    0, G_USEC_PER_SEC, 0,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-rate-limit:
+	 *
+	 * Maximum GVSP throughput, in bits per second. 0 disables the limit.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_RATE_LIMIT,
+					 g_param_spec_uint64 ("gvsp-rate-limit",
+							      "GVSP rate limit",
+							      "GVSP maximum throughput (bit/s)",
+							      0, G_MAXUINT64, 0,
+							      G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							      G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							      G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-seed:
+	 *
+	 * Seed of the random generator used for the network impairments, taken into account at each stream start. 0
+	 * means a random seed.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_SEED,
+					 g_param_spec_uint ("gvsp-seed",
+							    "GVSP seed",
+							    "GVSP impairment random seed",
+							    0, G_MAXUINT32, 0,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
+	/**
+	 * ArvGvFakeCamera:gvsp-retained-frames:
+	 *
+	 * Number of emitted frames kept for the answer to packet resend requests. The new value is used at the next
+	 * stream start.
+	 *
+	 * Since: 0.10.0
+	 */
+	g_object_class_install_property (object_class,
+					 PROP_GVSP_N_RETAINED_FRAMES,
+					 g_param_spec_uint ("gvsp-retained-frames",
+							    "GVSP retained frames",
+							    "Number of frames kept for packet resend",
+							    1, ARV_GV_FAKE_CAMERA_N_RETAINED_FRAMES_MAX,
+							    ARV_GV_FAKE_CAMERA_DEFAULT_N_RETAINED_FRAMES,
+							    G_PARAM_WRITABLE | G_PARAM_CONSTRUCT |
+							    G_PARAM_STATIC_NAME | G_PARAM_STATIC_NICK |
+							    G_PARAM_STATIC_BLURB));
 }
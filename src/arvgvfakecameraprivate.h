@@ -0,0 +1,47 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_GV_FAKE_CAMERA_PRIVATE_H
+#define ARV_GV_FAKE_CAMERA_PRIVATE_H
+
+#include <arvapi.h>
+#include <arvgvfakecamera.h>
+#include <arvgvcpprivate.h>
+
+G_BEGIN_DECLS
+
+/* Called from the camera thread for each received GVCP command, before its handling. Returning %FALSE drops the
+ * command, without acknowledge. The callback may delay the handling of the command, after having announced it using
+ * arv_gv_fake_camera_send_pending_ack(). */
+
+typedef gboolean (*ArvGvFakeCameraCommandCallback) (ArvGvFakeCamera *gv_fake_camera,
+						    const ArvGvcpPacket *packet, size_t size,
+						    void *user_data);
+
+ARV_API void	arv_gv_fake_camera_set_command_callback	(ArvGvFakeCamera *gv_fake_camera,
+							 ArvGvFakeCameraCommandCallback callback, void *user_data);
+ARV_API void	arv_gv_fake_camera_send_pending_ack	(ArvGvFakeCamera *gv_fake_camera, const ArvGvcpPacket *packet,
+							 guint16 timeout_ms);
+
+G_END_DECLS
+
+#endif
@@ -35,14 +35,16 @@
 
 static ArvGvspPacket *
 arv_gvsp_packet_new (ArvGvspContentType content_type,
-		     guint16 frame_id, guint32 packet_id, size_t data_size, void *buffer, size_t buffer_size,
+		     guint64 frame_id, guint32 packet_id, gboolean extended_ids,
+		     size_t data_size, void *buffer, size_t buffer_size,
                      size_t *packet_size)
 {
 	ArvGvspPacket *packet;
-	ArvGvspHeader *header;
 	size_t size;
 
-	size = sizeof (ArvGvspPacket) + sizeof (ArvGvspHeader) + data_size;
+	size = sizeof (ArvGvspPacket) +
+		(extended_ids ? sizeof (ArvGvspExtendedHeader) : sizeof (ArvGvspHeader)) +
+		data_size;
 	if (buffer != NULL && size > buffer_size) {
                 if (packet_size != NULL)
                         *packet_size = 0;
@@ -59,18 +61,30 @@ arv_gvsp_packet_new (ArvGvspContentType content_type,
 
 	packet->status = ARV_GVSP_PACKET_STATUS_SUCCESS;
 
-	header = (void *) &packet->header;
-	header->frame_id = g_htons (frame_id);
-	header->packet_infos = g_htonl ((packet_id & ARV_GVSP_PACKET_ID_MASK) |
-					((content_type << ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_POS) &
-					 ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_MASK));
+	if (extended_ids) {
+		ArvGvspExtendedHeader *header = (void *) &packet->header;
+
+		header->flags = 0;
+		header->packet_infos = g_htonl (ARV_GVSP_PACKET_EXTENDED_ID_MODE_MASK |
+						((content_type << ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_POS) &
+						 ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_MASK));
+		header->frame_id = GUINT64_TO_BE (frame_id);
+		header->packet_id = g_htonl (packet_id);
+	} else {
+		ArvGvspHeader *header = (void *) &packet->header;
+
+		header->frame_id = g_htons (frame_id);
+		header->packet_infos = g_htonl ((packet_id & ARV_GVSP_PACKET_ID_MASK) |
+						((content_type << ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_POS) &
+						 ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_MASK));
+	}
 
 	return packet;
 }
 
 ArvGvspPacket *
 arv_gvsp_packet_new_image_leader (guint16 frame_id, guint32 packet_id,
-                                  guint64 timestamp, ArvPixelFormat pixel_format,
+                                  guint64 timestamp, gboolean has_chunks, ArvPixelFormat pixel_format,
                                   guint32 width, guint32 height,
                                   guint32 x_offset, guint32 y_offset,
                                   guint32 x_padding, guint32 y_padding,
@@ -81,7 +95,7 @@ arv_gvsp_packet_new_image_leader (guint16 frame_id, guint32 packet_id,
         size_t size;
 
 	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_LEADER,
-				      frame_id, packet_id, sizeof (ArvGvspImageLeader), buffer, buffer_size, &size);
+				      frame_id, packet_id, FALSE, sizeof (ArvGvspImageLeader), buffer, buffer_size, &size);
 
         if (packet_size != NULL)
                 *packet_size = size;
@@ -91,7 +105,8 @@ arv_gvsp_packet_new_image_leader (guint16 frame_id, guint32 packet_id,
 
 		leader = arv_gvsp_packet_get_data (packet, size);
 		leader->flags = 0;
-		leader->payload_type = g_htons (ARV_BUFFER_PAYLOAD_TYPE_IMAGE);
+		leader->payload_type = g_htons (ARV_BUFFER_PAYLOAD_TYPE_IMAGE |
+						(has_chunks ? ARV_GVSP_PAYLOAD_TYPE_CHUNK_FLAG : 0));
 		leader->timestamp_high = g_htonl (((guint64) timestamp >> 32));
 		leader->timestamp_low  = g_htonl ((guint64) timestamp & 0xffffffff);
 		leader->infos.pixel_format = g_htonl (pixel_format);
@@ -106,8 +121,84 @@ arv_gvsp_packet_new_image_leader (guint16 frame_id, guint32 packet_id,
 	return packet;
 }
 
+/* Multipart packets use the extended id mode, as the number of parts is stored in the packet header. The part
+ * informations are written afterwards, using arv_gvsp_multipart_leader_packet_set_part_infos(). */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_multipart_leader (guint64 frame_id, guint32 packet_id,
+                                      guint64 timestamp, guint n_parts,
+                                      void *buffer, size_t buffer_size,
+                                      size_t *packet_size)
+{
+        ArvGvspPacket *packet;
+        size_t size;
+
+	g_return_val_if_fail (n_parts <= ARV_GVSP_PACKET_INFOS_N_PARTS_MASK, NULL);
+
+	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_LEADER,
+				      frame_id, packet_id, TRUE,
+				      sizeof (ArvGvspMultipartLeader) + n_parts * sizeof (ArvGvspPartInfos),
+				      buffer, buffer_size, &size);
+
+        if (packet_size != NULL)
+                *packet_size = size;
+
+	if (packet != NULL) {
+		ArvGvspExtendedHeader *header = (void *) &packet->header;
+		ArvGvspMultipartLeader *leader;
+
+		header->packet_infos = g_htonl ((g_ntohl (header->packet_infos) &
+						 ~ARV_GVSP_PACKET_INFOS_N_PARTS_MASK) | n_parts);
+
+		leader = arv_gvsp_packet_get_data (packet, size);
+		leader->flags = 0;
+		leader->payload_type = g_htons (ARV_BUFFER_PAYLOAD_TYPE_MULTIPART);
+		leader->timestamp_high = g_htonl (((guint64) timestamp >> 32));
+		leader->timestamp_low  = g_htonl ((guint64) timestamp & 0xffffffff);
+		memset (leader->parts, 0, n_parts * sizeof (ArvGvspPartInfos));
+	}
+
+	return packet;
+}
+
+gboolean
+arv_gvsp_multipart_leader_packet_set_part_infos (ArvGvspPacket *packet, size_t packet_size,
+                                                 guint part_id, guint purpose_id,
+                                                 ArvBufferPartDataType data_type, guint64 size,
+                                                 ArvPixelFormat pixel_format,
+                                                 guint32 width, guint32 height,
+                                                 guint32 x_offset, guint32 y_offset,
+                                                 guint32 x_padding, guint32 y_padding)
+{
+	ArvGvspMultipartLeader *leader;
+	ArvGvspPartInfos *infos;
+
+	if (part_id >= arv_gvsp_leader_packet_get_multipart_n_parts (packet, packet_size))
+		return FALSE;
+
+	leader = arv_gvsp_packet_get_data (packet, packet_size);
+	if (leader == NULL)
+		return FALSE;
+
+	infos = &leader->parts[part_id];
+	infos->data_type = g_htons (data_type);
+	infos->part_length_high = g_htons (size >> 32);
+	infos->part_length_low = g_htonl (size & 0xffffffff);
+	infos->pixel_format = g_htonl (pixel_format);
+	infos->data_purpose_id = g_htons (purpose_id);
+	infos->width = g_htonl (width);
+	infos->height = g_htonl (height);
+	infos->x_offset = g_htonl (x_offset);
+	infos->y_offset = g_htonl (y_offset);
+	infos->x_padding = g_htons (x_padding);
+	infos->y_padding = g_htons (y_padding);
+
+	return TRUE;
+}
+
 ArvGvspPacket *
-arv_gvsp_packet_new_data_trailer (guint16 frame_id, guint32 packet_id, guint32 height,
+arv_gvsp_packet_new_data_trailer (guint64 frame_id, guint32 packet_id, gboolean extended_ids,
+                                  ArvBufferPayloadType payload_type, guint32 height,
 				  void *buffer, size_t buffer_size,
                                   size_t *packet_size)
 {
@@ -115,7 +206,7 @@ arv_gvsp_packet_new_data_trailer (guint16 frame_id, guint32 packet_id, guint32 h
         size_t size;
 
 	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_TRAILER,
-				      frame_id, packet_id, sizeof (ArvGvspTrailer), buffer, buffer_size, &size);
+				      frame_id, packet_id, extended_ids, sizeof (ArvGvspTrailer), buffer, buffer_size, &size);
 
         if (packet_size != NULL)
                 *packet_size = size;
@@ -124,7 +215,7 @@ arv_gvsp_packet_new_data_trailer (guint16 frame_id, guint32 packet_id, guint32 h
 		ArvGvspTrailer *trailer;
 
 		trailer = arv_gvsp_packet_get_data (packet, size);
-		trailer->payload_type = g_htonl (ARV_BUFFER_PAYLOAD_TYPE_IMAGE);
+		trailer->payload_type = g_htonl (payload_type);
 		trailer->data0 = g_htonl (height);
 	}
 
@@ -141,7 +232,7 @@ arv_gvsp_packet_new_payload (guint16 frame_id, guint32 packet_id,
         size_t size;
 
 	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_PAYLOAD,
-				      frame_id, packet_id, payload_size, buffer, buffer_size, &size);
+				      frame_id, packet_id, FALSE, payload_size, buffer, buffer_size, &size);
 
         if (packet_size != NULL)
                 *packet_size = size;
@@ -152,6 +243,48 @@ arv_gvsp_packet_new_payload (guint16 frame_id, guint32 packet_id,
 	return packet;
 }
 
+/* Builds only the header of a payload packet, for a scatter-gather emission of the header and of the data */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_payload_header (guint16 frame_id, guint32 packet_id,
+                                    void *buffer, size_t buffer_size,
+                                    size_t *packet_size)
+{
+	return arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_PAYLOAD,
+				    frame_id, packet_id, FALSE, 0, buffer, buffer_size, packet_size);
+}
+
+/* Builds the header of a multipart data packet, for a scatter-gather emission. The offset is the position of the
+ * packet data in the buffer, as expected by the receiver. */
+
+ArvGvspPacket *
+arv_gvsp_packet_new_multipart_header (guint64 frame_id, guint32 packet_id,
+                                      guint part_id, guint64 offset,
+                                      void *buffer, size_t buffer_size,
+                                      size_t *packet_size)
+{
+        ArvGvspPacket *packet;
+        size_t size;
+
+	packet = arv_gvsp_packet_new (ARV_GVSP_CONTENT_TYPE_MULTIPART,
+				      frame_id, packet_id, TRUE, sizeof (ArvGvspMultipart), buffer, buffer_size, &size);
+
+        if (packet_size != NULL)
+                *packet_size = size;
+
+	if (packet != NULL) {
+		ArvGvspMultipart *multipart;
+
+		multipart = arv_gvsp_packet_get_data (packet, size);
+		multipart->part_id = part_id;
+		multipart->zone_info = 0;
+		multipart->offset_high = g_htons (offset >> 32);
+		multipart->offset_low = g_htonl (offset & 0xffffffff);
+	}
+
+	return packet;
+}
+
 static const char *
 arv_enum_to_string (GType type,
 		    guint enum_value)
@@ -0,0 +1,570 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+/*
+ * SECTION: arvgvspcapture
+ * @short_description: GVSP packet capture reader
+ *
+ * Reads the GVSP packets of a pcap or pcapng capture file, as written by tcpdump, dumpcap or wireshark, for their
+ * replay by an #ArvGvStream. Only unfragmented IPv4 UDP datagrams are considered, over Ethernet, Linux cooked, raw
+ * IP or BSD loopback links.
+ */
+
+#include <arvgvspcaptureprivate.h>
+#include <arvgvcpprivate.h>
+#include <arvdebugprivate.h>
+#include <string.h>
+
+#define ARV_GVSP_CAPTURE_PCAP_MAGIC_US			0xa1b2c3d4
+#define ARV_GVSP_CAPTURE_PCAP_MAGIC_NS			0xa1b23c4d
+#define ARV_GVSP_CAPTURE_PCAP_HEADER_SIZE		24
+#define ARV_GVSP_CAPTURE_PCAP_RECORD_HEADER_SIZE	16
+
+#define ARV_GVSP_CAPTURE_PCAPNG_SECTION_HEADER_BLOCK	0x0a0d0d0a
+#define ARV_GVSP_CAPTURE_PCAPNG_INTERFACE_BLOCK		0x00000001
+#define ARV_GVSP_CAPTURE_PCAPNG_SIMPLE_PACKET_BLOCK	0x00000003
+#define ARV_GVSP_CAPTURE_PCAPNG_ENHANCED_PACKET_BLOCK	0x00000006
+#define ARV_GVSP_CAPTURE_PCAPNG_BYTE_ORDER_MAGIC	0x1a2b3c4d
+#define ARV_GVSP_CAPTURE_PCAPNG_OPTION_END		0
+#define ARV_GVSP_CAPTURE_PCAPNG_OPTION_IF_TSRESOL	9
+
+#define ARV_GVSP_CAPTURE_LINKTYPE_NULL			0
+#define ARV_GVSP_CAPTURE_LINKTYPE_ETHERNET		1
+#define ARV_GVSP_CAPTURE_LINKTYPE_RAW			101
+#define ARV_GVSP_CAPTURE_LINKTYPE_LINUX_SLL		113
+#define ARV_GVSP_CAPTURE_LINKTYPE_IPV4			228
+#define ARV_GVSP_CAPTURE_LINKTYPE_LINUX_SLL2		276
+
+#define ARV_GVSP_CAPTURE_ETHERTYPE_IPV4			0x0800
+#define ARV_GVSP_CAPTURE_ETHERTYPE_VLAN			0x8100
+#define ARV_GVSP_CAPTURE_ETHERTYPE_QINQ			0x88a8
+
+#define ARV_GVSP_CAPTURE_IP_PROTOCOL_UDP		17
+#define ARV_GVSP_CAPTURE_IP_HEADER_SIZE			20
+#define ARV_GVSP_CAPTURE_UDP_HEADER_SIZE		8
+
+typedef struct {
+	guint16 link_type;
+	guint64 ticks_per_second;
+} ArvGvspCaptureInterface;
+
+struct _ArvGvspCapture {
+	GMappedFile *file;
+	const guint8 *data;
+	size_t size;
+
+	gboolean is_pcapng;
+	gboolean is_swapped;
+	size_t offset;
+
+	/* Interfaces of the current section, a single one for the pcap format */
+	GArray *interfaces;
+
+	guint64 last_timestamp_us;
+
+	guint16 port;
+
+	guint n_packets;
+	guint packet_size;
+	size_t payload_size_max;
+};
+
+static guint16
+_read_u16 (ArvGvspCapture *capture, size_t offset)
+{
+	guint16 value;
+
+	memcpy (&value, capture->data + offset, sizeof (value));
+
+	return capture->is_swapped ? GUINT16_SWAP_LE_BE (value) : value;
+}
+
+static guint32
+_read_u32 (ArvGvspCapture *capture, size_t offset)
+{
+	guint32 value;
+
+	memcpy (&value, capture->data + offset, sizeof (value));
+
+	return capture->is_swapped ? GUINT32_SWAP_LE_BE (value) : value;
+}
+
+static guint16
+_read_be16 (const guint8 *data)
+{
+	return (data[0] << 8) | data[1];
+}
+
+static guint64
+_ticks_to_us (guint64 ticks, guint64 ticks_per_second)
+{
+	return (ticks / ticks_per_second) * 1000000 + ((ticks % ticks_per_second) * 1000000) / ticks_per_second;
+}
+
+/* Returns the UDP payload of a captured frame, or NULL if it is not a complete and unfragmented IPv4 UDP datagram */
+
+static const guint8 *
+_get_udp_payload (guint16 link_type, const guint8 *frame, size_t frame_size,
+		  guint16 *source_port, guint16 *destination_port, size_t *payload_size)
+{
+	const guint8 *ip;
+	const guint8 *udp;
+	size_t offset = 0;
+	size_t ip_size;
+	size_t header_size;
+	size_t udp_size;
+	guint16 ethertype = ARV_GVSP_CAPTURE_ETHERTYPE_IPV4;
+
+	switch (link_type) {
+		case ARV_GVSP_CAPTURE_LINKTYPE_NULL:
+			/* Address family, in the byte order of the capturing host */
+			if (frame_size < 4 || (frame[0] != 2 && frame[3] != 2))
+				return NULL;
+			offset = 4;
+			break;
+		case ARV_GVSP_CAPTURE_LINKTYPE_ETHERNET:
+			if (frame_size < 14)
+				return NULL;
+			ethertype = _read_be16 (frame + 12);
+			offset = 14;
+			while (ethertype == ARV_GVSP_CAPTURE_ETHERTYPE_VLAN ||
+			       ethertype == ARV_GVSP_CAPTURE_ETHERTYPE_QINQ) {
+				if (frame_size < offset + 4)
+					return NULL;
+				ethertype = _read_be16 (frame + offset + 2);
+				offset += 4;
+			}
+			break;
+		case ARV_GVSP_CAPTURE_LINKTYPE_LINUX_SLL:
+			if (frame_size < 16)
+				return NULL;
+			ethertype = _read_be16 (frame + 14);
+			offset = 16;
+			break;
+		case ARV_GVSP_CAPTURE_LINKTYPE_LINUX_SLL2:
+			if (frame_size < 20)
+				return NULL;
+			ethertype = _read_be16 (frame);
+			offset = 20;
+			break;
+		case ARV_GVSP_CAPTURE_LINKTYPE_RAW:
+		case ARV_GVSP_CAPTURE_LINKTYPE_IPV4:
+			break;
+		default:
+			return NULL;
+	}
+
+	if (ethertype != ARV_GVSP_CAPTURE_ETHERTYPE_IPV4 ||
+	    frame_size < offset + ARV_GVSP_CAPTURE_IP_HEADER_SIZE)
+		return NULL;
+
+	ip = frame + offset;
+	ip_size = frame_size - offset;
+	header_size = (ip[0] & 0x0f) * 4;
+
+	if ((ip[0] >> 4) != 4 ||
+	    ip[9] != ARV_GVSP_CAPTURE_IP_PROTOCOL_UDP ||
+	    header_size < ARV_GVSP_CAPTURE_IP_HEADER_SIZE ||
+	    /* More fragments flag, or fragment offset */
+	    (_read_be16 (ip + 6) & 0x3fff) != 0 ||
+	    _read_be16 (ip + 2) > ip_size ||
+	    _read_be16 (ip + 2) < header_size + ARV_GVSP_CAPTURE_UDP_HEADER_SIZE)
+		return NULL;
+
+	ip_size = _read_be16 (ip + 2);
+	udp = ip + header_size;
+	udp_size = _read_be16 (udp + 4);
+
+	if (udp_size < ARV_GVSP_CAPTURE_UDP_HEADER_SIZE ||
+	    udp_size > ip_size - header_size)
+		return NULL;
+
+	*source_port = _read_be16 (udp);
+	*destination_port = _read_be16 (udp + 2);
+	*payload_size = udp_size - ARV_GVSP_CAPTURE_UDP_HEADER_SIZE;
+
+	return udp + ARV_GVSP_CAPTURE_UDP_HEADER_SIZE;
+}
+
+static void
+_read_pcapng_interface (ArvGvspCapture *capture, size_t offset, size_t block_size)
+{
+	ArvGvspCaptureInterface interface;
+	size_t end = offset + block_size - 4;
+
+	interface.link_type = _read_u16 (capture, offset + 8);
+	interface.ticks_per_second = 1000000;
+
+	for (offset += 16; offset + 4 <= end;) {
+		guint16 code = _read_u16 (capture, offset);
+		guint16 length = _read_u16 (capture, offset + 2);
+
+		if (code == ARV_GVSP_CAPTURE_PCAPNG_OPTION_END || offset + 4 + length > end)
+			break;
+
+		if (code == ARV_GVSP_CAPTURE_PCAPNG_OPTION_IF_TSRESOL && length >= 1) {
+			guint8 resolution = capture->data[offset + 4];
+			unsigned i;
+
+			if (resolution & 0x80)
+				interface.ticks_per_second = G_GUINT64_CONSTANT (1) << MIN (resolution & 0x7f, 63);
+			else
+				for (interface.ticks_per_second = 1, i = 0; i < MIN (resolution, 19); i++)
+					interface.ticks_per_second *= 10;
+		}
+
+		offset += 4 + ((length + 3) & ~3);
+	}
+
+	g_array_append_val (capture->interfaces, interface);
+}
+
+/* Returns the next captured frame, and FALSE at the end of the capture */
+
+static gboolean
+_next_frame (ArvGvspCapture *capture, guint16 *link_type,
+	     const guint8 **frame, size_t *frame_size, guint64 *timestamp_us)
+{
+	if (!capture->is_pcapng) {
+		ArvGvspCaptureInterface *interface;
+		size_t offset = capture->offset;
+		guint32 captured_size;
+
+		if (offset + ARV_GVSP_CAPTURE_PCAP_RECORD_HEADER_SIZE > capture->size)
+			return FALSE;
+
+		captured_size = _read_u32 (capture, offset + 8);
+		if (offset + ARV_GVSP_CAPTURE_PCAP_RECORD_HEADER_SIZE + captured_size > capture->size) {
+			arv_warning_stream ("[GvspCapture::next_frame] Truncated capture file");
+			return FALSE;
+		}
+
+		interface = &g_array_index (capture->interfaces, ArvGvspCaptureInterface, 0);
+
+		*link_type = interface->link_type;
+		*frame = capture->data + offset + ARV_GVSP_CAPTURE_PCAP_RECORD_HEADER_SIZE;
+		*frame_size = captured_size;
+		*timestamp_us = (guint64) _read_u32 (capture, offset) * 1000000 +
+			_ticks_to_us (_read_u32 (capture, offset + 4), interface->ticks_per_second);
+
+		capture->offset = offset + ARV_GVSP_CAPTURE_PCAP_RECORD_HEADER_SIZE + captured_size;
+
+		return TRUE;
+	}
+
+	for (;;) {
+		size_t offset = capture->offset;
+		guint32 block_type;
+		guint32 block_size;
+
+		if (offset + 12 > capture->size)
+			return FALSE;
+
+		block_type = _read_u32 (capture, offset);
+
+		/* The byte order may change at each section */
+		if (block_type == ARV_GVSP_CAPTURE_PCAPNG_SECTION_HEADER_BLOCK) {
+			guint32 magic;
+
+			memcpy (&magic, capture->data + offset + 8, sizeof (magic));
+			capture->is_swapped = magic != ARV_GVSP_CAPTURE_PCAPNG_BYTE_ORDER_MAGIC;
+			g_array_set_size (capture->interfaces, 0);
+		}
+
+		block_size = _read_u32 (capture, offset + 4);
+		if (block_size < 12 || (block_size & 3) != 0 || offset + block_size > capture->size) {
+			arv_warning_stream ("[GvspCapture::next_frame] Invalid or truncated block");
+			return FALSE;
+		}
+
+		capture->offset = offset + block_size;
+
+		switch (block_type) {
+			case ARV_GVSP_CAPTURE_PCAPNG_INTERFACE_BLOCK:
+				if (block_size >= 20)
+					_read_pcapng_interface (capture, offset, block_size);
+				break;
+			case ARV_GVSP_CAPTURE_PCAPNG_ENHANCED_PACKET_BLOCK:
+				{
+					ArvGvspCaptureInterface *interface;
+					guint32 interface_id;
+					guint32 captured_size;
+
+					if (block_size < 32)
+						break;
+
+					interface_id = _read_u32 (capture, offset + 8);
+					captured_size = _read_u32 (capture, offset + 20);
+					if (interface_id >= capture->interfaces->len ||
+					    28 + (size_t) captured_size > block_size - 4)
+						break;
+
+					interface = &g_array_index (capture->interfaces, ArvGvspCaptureInterface,
+								    interface_id);
+
+					*link_type = interface->link_type;
+					*frame = capture->data + offset + 28;
+					*frame_size = captured_size;
+					*timestamp_us = _ticks_to_us (((guint64) _read_u32 (capture, offset + 12) << 32) |
+								      _read_u32 (capture, offset + 16),
+								      interface->ticks_per_second);
+					return TRUE;
+				}
+			case ARV_GVSP_CAPTURE_PCAPNG_SIMPLE_PACKET_BLOCK:
+				/* No timestamp, the packet is considered as received along the previous one */
+				if (capture->interfaces->len > 0 && block_size >= 16) {
+					*link_type = g_array_index (capture->interfaces, ArvGvspCaptureInterface,
+								    0).link_type;
+					*frame = capture->data + offset + 12;
+					*frame_size = MIN (_read_u32 (capture, offset + 8), block_size - 16);
+					*timestamp_us = capture->last_timestamp_us;
+					return TRUE;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/**
+ * arv_gvsp_capture_next_packet:
+ * @capture: a #ArvGvspCapture
+ * @packet: (out): the next GVSP packet
+ * @packet_size: (out): the size of @packet, in bytes
+ * @timestamp_us: (out): capture timestamp, in µs
+ *
+ * Returns the next GVSP packet of the capture. The returned packet points directly into the capture data, and is
+ * valid until the capture is freed.
+ *
+ * Returns: %TRUE if a packet was found, %FALSE at the end of the capture.
+ */
+
+gboolean
+arv_gvsp_capture_next_packet (ArvGvspCapture *capture,
+			      const ArvGvspPacket **packet, size_t *packet_size,
+			      guint64 *timestamp_us)
+{
+	const guint8 *frame;
+	size_t frame_size;
+	guint16 link_type;
+	guint64 frame_timestamp_us;
+
+	g_return_val_if_fail (capture != NULL, FALSE);
+
+	while (_next_frame (capture, &link_type, &frame, &frame_size, &frame_timestamp_us)) {
+		const guint8 *payload;
+		size_t payload_size;
+		guint16 source_port;
+		guint16 destination_port;
+
+		capture->last_timestamp_us = frame_timestamp_us;
+
+		payload = _get_udp_payload (link_type, frame, frame_size,
+					    &source_port, &destination_port, &payload_size);
+		if (payload == NULL ||
+		    payload_size < sizeof (ArvGvspPacket) + sizeof (ArvGvspHeader))
+			continue;
+
+		if (capture->port != 0 ?
+		    destination_port != capture->port :
+		    source_port == ARV_GVCP_PORT || destination_port == ARV_GVCP_PORT)
+			continue;
+
+		if (packet != NULL)
+			*packet = (const ArvGvspPacket *) payload;
+		if (packet_size != NULL)
+			*packet_size = payload_size;
+		if (timestamp_us != NULL)
+			*timestamp_us = frame_timestamp_us;
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/**
+ * arv_gvsp_capture_rewind:
+ * @capture: a #ArvGvspCapture
+ *
+ * Restarts the packet iteration from the beginning of the capture.
+ */
+
+void
+arv_gvsp_capture_rewind (ArvGvspCapture *capture)
+{
+	g_return_if_fail (capture != NULL);
+
+	capture->last_timestamp_us = 0;
+
+	if (capture->is_pcapng) {
+		capture->offset = 0;
+		g_array_set_size (capture->interfaces, 0);
+	} else
+		capture->offset = ARV_GVSP_CAPTURE_PCAP_HEADER_SIZE;
+}
+
+/**
+ * arv_gvsp_capture_get_n_packets:
+ * @capture: a #ArvGvspCapture
+ *
+ * Returns: the number of GVSP packets in the capture.
+ */
+
+guint
+arv_gvsp_capture_get_n_packets (ArvGvspCapture *capture)
+{
+	g_return_val_if_fail (capture != NULL, 0);
+
+	return capture->n_packets;
+}
+
+/**
+ * arv_gvsp_capture_get_packet_size:
+ * @capture: a #ArvGvspCapture
+ *
+ * Returns: the GVSP packet size used by the device during the capture, including the IP and UDP headers, as
+ * GevSCPSPacketSize, deduced from the largest captured packet.
+ */
+
+guint
+arv_gvsp_capture_get_packet_size (ArvGvspCapture *capture)
+{
+	g_return_val_if_fail (capture != NULL, 0);
+
+	return capture->packet_size;
+}
+
+/**
+ * arv_gvsp_capture_get_payload_size_max:
+ * @capture: a #ArvGvspCapture
+ *
+ * Returns: an upper bound of the payload size of the captured frames, deduced from the largest packet id.
+ */
+
+size_t
+arv_gvsp_capture_get_payload_size_max (ArvGvspCapture *capture)
+{
+	g_return_val_if_fail (capture != NULL, 0);
+
+	return capture->payload_size_max;
+}
+
+/**
+ * arv_gvsp_capture_new:
+ * @filename: a pcap or pcapng file
+ * @port: UDP destination port of the stream packets, 0 for any port other than the GVCP one
+ * @error: a #GError placeholder
+ *
+ * Returns: (transfer full): a new #ArvGvspCapture, %NULL on error.
+ */
+
+ArvGvspCapture *
+arv_gvsp_capture_new (const char *filename, guint16 port, GError **error)
+{
+	ArvGvspCapture *capture;
+	GMappedFile *file;
+	const ArvGvspPacket *packet;
+	size_t packet_size;
+	size_t packet_size_max = 0;
+	guint32 packet_id_max = 0;
+	guint32 magic;
+
+	g_return_val_if_fail (filename != NULL, NULL);
+
+	file = g_mapped_file_new (filename, FALSE, error);
+	if (file == NULL)
+		return NULL;
+
+	capture = g_new0 (ArvGvspCapture, 1);
+	capture->file = file;
+	capture->data = (const guint8 *) g_mapped_file_get_contents (file);
+	capture->size = g_mapped_file_get_length (file);
+	capture->port = port;
+	capture->interfaces = g_array_new (FALSE, FALSE, sizeof (ArvGvspCaptureInterface));
+
+	if (capture->size >= 4)
+		memcpy (&magic, capture->data, sizeof (magic));
+	else
+		magic = 0;
+
+	if (magic == ARV_GVSP_CAPTURE_PCAPNG_SECTION_HEADER_BLOCK) {
+		capture->is_pcapng = TRUE;
+	} else if ((magic == ARV_GVSP_CAPTURE_PCAP_MAGIC_US ||
+		    magic == ARV_GVSP_CAPTURE_PCAP_MAGIC_NS ||
+		    GUINT32_SWAP_LE_BE (magic) == ARV_GVSP_CAPTURE_PCAP_MAGIC_US ||
+		    GUINT32_SWAP_LE_BE (magic) == ARV_GVSP_CAPTURE_PCAP_MAGIC_NS) &&
+		   capture->size >= ARV_GVSP_CAPTURE_PCAP_HEADER_SIZE) {
+		ArvGvspCaptureInterface interface;
+
+		capture->is_swapped = magic != ARV_GVSP_CAPTURE_PCAP_MAGIC_US &&
+			magic != ARV_GVSP_CAPTURE_PCAP_MAGIC_NS;
+
+		/* The upper bits of the link type may contain FCS informations */
+		interface.link_type = _read_u32 (capture, 20) & 0xffff;
+		interface.ticks_per_second = _read_u32 (capture, 0) == ARV_GVSP_CAPTURE_PCAP_MAGIC_NS ?
+			1000000000 : 1000000;
+		g_array_append_val (capture->interfaces, interface);
+	} else {
+		g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+			     "%s is not a pcap or pcapng capture file", filename);
+		arv_gvsp_capture_free (capture);
+		return NULL;
+	}
+
+	arv_gvsp_capture_rewind (capture);
+
+	while (arv_gvsp_capture_next_packet (capture, &packet, &packet_size, NULL)) {
+		capture->n_packets++;
+		packet_size_max = MAX (packet_size_max, packet_size);
+		packet_id_max = MAX (packet_id_max, arv_gvsp_packet_get_packet_id (packet, packet_size));
+	}
+
+	arv_gvsp_capture_rewind (capture);
+
+	capture->packet_size = packet_size_max + ARV_GVSP_PACKET_UDP_OVERHEAD;
+	if (packet_id_max > 1 && capture->packet_size > ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (FALSE))
+		capture->payload_size_max = (size_t) (packet_id_max - 1) *
+			(capture->packet_size - ARV_GVSP_PAYLOAD_PACKET_PROTOCOL_OVERHEAD (FALSE));
+
+	arv_info_stream ("[GvspCapture::new] %u GVSP packets in %s, packet size = %u, payload size <= %" G_GSIZE_FORMAT,
+			 capture->n_packets, filename, capture->packet_size, capture->payload_size_max);
+
+	return capture;
+}
+
+/**
+ * arv_gvsp_capture_free:
+ * @capture: (transfer full): a #ArvGvspCapture
+ */
+
+void
+arv_gvsp_capture_free (ArvGvspCapture *capture)
+{
+	if (capture == NULL)
+		return;
+
+	g_array_unref (capture->interfaces);
+	g_mapped_file_unref (capture->file);
+	g_free (capture);
+}
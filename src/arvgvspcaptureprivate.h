@@ -0,0 +1,48 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_GVSP_CAPTURE_PRIVATE_H
+#define ARV_GVSP_CAPTURE_PRIVATE_H
+
+#include <arvapi.h>
+#include <arvgvspprivate.h>
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+typedef struct _ArvGvspCapture ArvGvspCapture;
+
+ARV_API ArvGvspCapture *	arv_gvsp_capture_new			(const char *filename, guint16 port, GError **error);
+ARV_API void			arv_gvsp_capture_free			(ArvGvspCapture *capture);
+
+ARV_API gboolean		arv_gvsp_capture_next_packet		(ArvGvspCapture *capture,
+									 const ArvGvspPacket **packet, size_t *packet_size,
+									 guint64 *timestamp_us);
+ARV_API void			arv_gvsp_capture_rewind			(ArvGvspCapture *capture);
+
+ARV_API guint			arv_gvsp_capture_get_n_packets		(ArvGvspCapture *capture);
+ARV_API guint			arv_gvsp_capture_get_packet_size	(ArvGvspCapture *capture);
+ARV_API size_t			arv_gvsp_capture_get_payload_size_max	(ArvGvspCapture *capture);
+
+G_END_DECLS
+
+#endif
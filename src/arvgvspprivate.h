@@ -35,6 +35,8 @@ G_BEGIN_DECLS
 #define ARV_GVSP_PACKET_INFOS_CONTENT_TYPE_POS	24
 #define ARV_GVSP_PACKET_INFOS_N_PARTS_MASK   	0x000000ff
 
+#define ARV_GVSP_PAYLOAD_TYPE_CHUNK_FLAG	0x4000
+
 /**
  * ArvGvspPacketStatus:
  * @ARV_GVSP_PACKET_STATUS_SUCCESS: valid packet
@@ -282,19 +284,40 @@ typedef struct {
 #pragma pack(pop)
 
 ArvGvspPacket *		arv_gvsp_packet_new_image_leader	(guint16 frame_id, guint32 packet_id,
-								 guint64 timestamp, ArvPixelFormat pixel_format,
+								 guint64 timestamp, gboolean has_chunks,
+								 ArvPixelFormat pixel_format,
 								 guint32 width, guint32 height,
 								 guint32 x_offset, guint32 y_offset,
 								 guint32 x_padding, guint32 y_padding,
 								 void *buffer, size_t buffer_size,
                                                                  size_t *packet_size);
-ArvGvspPacket *		arv_gvsp_packet_new_data_trailer	(guint16 frame_id, guint32 packet_id, guint32 height,
+ArvGvspPacket *		arv_gvsp_packet_new_multipart_leader	(guint64 frame_id, guint32 packet_id,
+								 guint64 timestamp, guint n_parts,
+								 void *buffer, size_t buffer_size,
+                                                                 size_t *packet_size);
+gboolean		arv_gvsp_multipart_leader_packet_set_part_infos	(ArvGvspPacket *packet, size_t packet_size,
+									 guint part_id, guint purpose_id,
+									 ArvBufferPartDataType data_type, guint64 size,
+									 ArvPixelFormat pixel_format,
+									 guint32 width, guint32 height,
+									 guint32 x_offset, guint32 y_offset,
+									 guint32 x_padding, guint32 y_padding);
+ArvGvspPacket *		arv_gvsp_packet_new_data_trailer	(guint64 frame_id, guint32 packet_id,
+								 gboolean extended_ids,
+								 ArvBufferPayloadType payload_type, guint32 height,
 								 void *buffer, size_t buffer_size,
                                                                  size_t *packet_size);
 ArvGvspPacket *		arv_gvsp_packet_new_payload		(guint16 frame_id, guint32 packet_id,
 								 size_t payload_size, void *data,
 								 void *buffer, size_t buffer_size,
                                                                  size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_payload_header	(guint16 frame_id, guint32 packet_id,
+								 void *buffer, size_t buffer_size,
+                                                                 size_t *packet_size);
+ArvGvspPacket *		arv_gvsp_packet_new_multipart_header	(guint64 frame_id, guint32 packet_id,
+								 guint part_id, guint64 offset,
+								 void *buffer, size_t buffer_size,
+                                                                 size_t *packet_size);
 char * 			arv_gvsp_packet_to_string 		(const ArvGvspPacket *packet, size_t packet_size);
 void 			arv_gvsp_packet_debug 			(const ArvGvspPacket *packet, size_t packet_size,
 								 ArvDebugLevel level);
@@ -437,7 +460,7 @@ arv_gvsp_leader_packet_get_buffer_payload_type (const ArvGvspPacket *packet, siz
                         payload_type = g_ntohs (leader->payload_type);
 
                         if (has_chunks != NULL)
-                                *has_chunks = ((payload_type & 0x4000) != 0 ||
+                                *has_chunks = ((payload_type & ARV_GVSP_PAYLOAD_TYPE_CHUNK_FLAG) != 0 ||
                                                (payload_type == ARV_BUFFER_PAYLOAD_TYPE_CHUNK_DATA) ||
                                                (payload_type == ARV_BUFFER_PAYLOAD_TYPE_EXTENDED_CHUNK_DATA));
 
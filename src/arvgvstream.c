@@ -33,6 +33,7 @@
 #include <arvfeatures.h>
 #include <arvparamsprivate.h>
 #include <arvgvspprivate.h>
+#include <arvgvspcaptureprivate.h>
 #include <arvgvcpprivate.h>
 #include <arvdebug.h>
 #include <arvmisc.h>
@@ -161,6 +162,7 @@ struct _ArvGvStreamThreadData {
 	guint64 last_frame_id;
 
 	gboolean use_packet_socket;
+	gboolean is_replaying;
 
 	/* Statistics */
 
@@ -215,8 +217,10 @@ _send_packet_request (ArvGvStreamThreadData *thread_data,
 
 	arv_gvcp_packet_debug (packet, ARV_DEBUG_LEVEL_DEBUG);
 
-	g_socket_send_to (thread_data->socket, thread_data->device_socket_address, (const char *) packet, packet_size,
-			  NULL, NULL);
+	/* A replayed capture already contains the device answers, if any */
+	if (!thread_data->is_replaying)
+		g_socket_send_to (thread_data->socket, thread_data->device_socket_address,
+				  (const char *) packet, packet_size, NULL, NULL);
 
 	arv_gvcp_packet_free (packet);
 }
@@ -1455,6 +1459,130 @@ arv_gv_stream_stop_acquisition (ArvStream *stream, GError **error)
         return TRUE;
 }
 
+/* Emulates the receive poll timeouts of the acquisition loop between two replayed packets */
+
+static void
+_replay_timeouts (ArvGvStreamThreadData *thread_data, guint64 last_time_us, guint64 time_us)
+{
+	for (;;) {
+		guint64 timeout_us;
+
+		timeout_us = thread_data->frames != NULL ? thread_data->packet_timeout_us : ARV_GV_STREAM_POLL_TIMEOUT_US;
+		/* Poll timeout has a millisecond resolution */
+		timeout_us = MAX (timeout_us / 1000 * 1000, 1000);
+
+		if (last_time_us + timeout_us > time_us)
+			return;
+
+		last_time_us += timeout_us;
+		_check_frame_completion (thread_data, last_time_us, NULL);
+	}
+}
+
+/**
+ * arv_gv_stream_replay_capture:
+ * @gv_stream: a #ArvGvStream
+ * @capture: a #ArvGvspCapture
+ * @realtime: honour the capture timestamps, instead of replaying the packets as fast as possible
+ * @error: a #GError placeholder
+ *
+ * Feeds the GVSP packets of @capture to the stream packet processing, in the calling thread, as if they were received
+ * from the device. The capture timestamps drive the packet and frame timeouts, whatever the replay speed. Packet
+ * resend requests are accounted for in the stream statistics, but not sent. The stream callback is called as during
+ * a normal acquisition, which must not be running.
+ *
+ * Returns: %TRUE on success.
+ */
+
+gboolean
+arv_gv_stream_replay_capture (ArvGvStream *gv_stream, ArvGvspCapture *capture, gboolean realtime, GError **error)
+{
+	ArvGvStreamPrivate *priv = arv_gv_stream_get_instance_private (gv_stream);
+	ArvGvStreamThreadData *thread_data;
+	ArvGvStreamFrameData *frame;
+	const ArvGvspPacket *packet;
+	size_t packet_size;
+	guint64 timestamp_us;
+	guint64 first_timestamp_us = 0;
+	guint64 start_time_us;
+	guint64 last_time_us;
+	guint64 time_us;
+	guint scps_packet_size;
+	gboolean is_first = TRUE;
+
+	g_return_val_if_fail (ARV_IS_GV_STREAM (gv_stream), FALSE);
+	g_return_val_if_fail (capture != NULL, FALSE);
+	g_return_val_if_fail (priv->thread_data != NULL, FALSE);
+
+	if (priv->thread != NULL) {
+		g_set_error (error, G_IO_ERROR, G_IO_ERROR_BUSY, "Can't replay a capture during acquisition");
+		return FALSE;
+	}
+
+	thread_data = priv->thread_data;
+
+	thread_data->frames = NULL;
+	thread_data->last_frame_id = 0;
+	thread_data->first_packet = TRUE;
+	thread_data->is_replaying = TRUE;
+
+	scps_packet_size = thread_data->scps_packet_size;
+	if (arv_gvsp_capture_get_packet_size (capture) > ARV_GVSP_PACKET_PROTOCOL_OVERHEAD (FALSE))
+		thread_data->scps_packet_size = arv_gvsp_capture_get_packet_size (capture);
+
+	arv_info_stream ("[GvStream::replay_capture] Replay %u packets%s, packet size = %u",
+			 arv_gvsp_capture_get_n_packets (capture), realtime ? " in real time" : "",
+			 thread_data->scps_packet_size);
+
+	if (thread_data->callback != NULL)
+		thread_data->callback (thread_data->callback_data, ARV_STREAM_CALLBACK_TYPE_INIT, NULL);
+
+	start_time_us = g_get_monotonic_time ();
+	last_time_us = start_time_us;
+
+	arv_gvsp_capture_rewind (capture);
+
+	while (arv_gvsp_capture_next_packet (capture, &packet, &packet_size, &timestamp_us)) {
+		if (is_first) {
+			first_timestamp_us = timestamp_us;
+			is_first = FALSE;
+		}
+
+		/* Captured packets may be slightly out of order */
+		time_us = start_time_us + (timestamp_us > first_timestamp_us ? timestamp_us - first_timestamp_us : 0);
+		time_us = MAX (time_us, last_time_us);
+
+		if (realtime) {
+			gint64 delay_us = (gint64) time_us - g_get_monotonic_time ();
+
+			if (delay_us > 0)
+				g_usleep (delay_us);
+		}
+
+		_replay_timeouts (thread_data, last_time_us, time_us);
+
+		frame = _process_packet (thread_data, packet, packet_size, time_us);
+		_check_frame_completion (thread_data, time_us, frame);
+
+		last_time_us = time_us;
+	}
+
+	/* Let the pending frames complete or timeout as if the device stopped sending */
+	time_us = last_time_us + thread_data->frame_retention_us;
+	_replay_timeouts (thread_data, last_time_us, time_us);
+	_check_frame_completion (thread_data, time_us, NULL);
+
+	_flush_frames (thread_data, time_us);
+
+	if (thread_data->callback != NULL)
+		thread_data->callback (thread_data->callback_data, ARV_STREAM_CALLBACK_TYPE_EXIT, NULL);
+
+	thread_data->scps_packet_size = scps_packet_size;
+	thread_data->is_replaying = FALSE;
+
+	return TRUE;
+}
+
 /**
  * arv_gv_stream_new: (skip)
  * @gv_device: a #ArvGvDevice
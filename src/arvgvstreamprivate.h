@@ -25,6 +25,7 @@
 
 #include <arvgvstream.h>
 #include <arvstream.h>
+#include <arvgvspcaptureprivate.h>
 #include <gio/gio.h>
 
 G_BEGIN_DECLS
@@ -37,6 +38,9 @@ G_BEGIN_DECLS
 
 ArvStream * 	arv_gv_stream_new		(ArvGvDevice *gv_device, ArvStreamCallback callback, void *callback_data, GDestroyNotify destroy, GError **error);
 
+ARV_API gboolean	arv_gv_stream_replay_capture	(ArvGvStream *gv_stream, ArvGvspCapture *capture, gboolean realtime,
+							 GError **error);
+
 G_END_DECLS
 
 #endif
@@ -36,6 +36,8 @@
 typedef struct {
 	GArray *device_ids;
         int flags;
+
+	GRWLock device_list_lock;
 } ArvInterfacePrivate;
 
 G_DEFINE_ABSTRACT_TYPE_WITH_CODE (ArvInterface, arv_interface, G_TYPE_OBJECT, G_ADD_PRIVATE (ArvInterface))
@@ -86,11 +88,15 @@ arv_interface_update_device_list (ArvInterface *iface)
 	ArvInterfacePrivate *priv = arv_interface_get_instance_private (iface);
 	g_return_if_fail (ARV_IS_INTERFACE (iface));
 
+	g_rw_lock_writer_lock (&priv->device_list_lock);
+
 	arv_interface_clear_device_ids (iface);
 
 	ARV_INTERFACE_GET_CLASS (iface)->update_device_list (iface, priv->device_ids);
 
 	g_array_sort (priv->device_ids, (GCompareFunc) _compare_device_ids);
+
+	g_rw_lock_writer_unlock (&priv->device_list_lock);
 }
 
 void
@@ -378,6 +384,9 @@ arv_interface_get_device_protocol (ArvInterface *iface, unsigned int index)
  * Creates a new #ArvDevice object corresponding to the given device id string.
  * The first available device is returned if @device_id is %NULL.
  *
+ * This function can be called concurrently from several threads. Only
+ * arv_interface_update_device_list() is serialized with respect to it.
+ *
  * Returns: (transfer full): a new #ArvDevice
  *
  * Since: 0.2.0
@@ -386,9 +395,16 @@ arv_interface_get_device_protocol (ArvInterface *iface, unsigned int index)
 ArvDevice *
 arv_interface_open_device (ArvInterface *iface, const char *device_id, GError **error)
 {
+	ArvInterfacePrivate *priv = arv_interface_get_instance_private (iface);
+	ArvDevice *device;
+
 	g_return_val_if_fail (ARV_IS_INTERFACE (iface), NULL);
 
-	return ARV_INTERFACE_GET_CLASS (iface)->open_device (iface, device_id, error);
+	g_rw_lock_reader_lock (&priv->device_list_lock);
+	device = ARV_INTERFACE_GET_CLASS (iface)->open_device (iface, device_id, error);
+	g_rw_lock_reader_unlock (&priv->device_list_lock);
+
+	return device;
 }
 
 static void
@@ -397,6 +413,7 @@ arv_interface_init (ArvInterface *iface)
 	ArvInterfacePrivate *priv = arv_interface_get_instance_private (iface);
 
 	priv->device_ids = g_array_new (FALSE, TRUE, sizeof (ArvInterfaceDeviceIds *));
+	g_rw_lock_init (&priv->device_list_lock);
 }
 
 static void
@@ -410,6 +427,7 @@ arv_interface_finalize (GObject *object)
 	arv_interface_clear_device_ids (iface);
 	g_array_free (priv->device_ids, TRUE);
 	priv->device_ids = NULL;
+	g_rw_lock_clear (&priv->device_list_lock);
 }
 
 static void
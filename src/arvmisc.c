@@ -531,103 +531,254 @@ arv_copy_memory_with_endianness (void *to, size_t to_size, guint to_endianness,
 
 #define ARV_DECOMPRESS_CHUNK 16384
 
+struct _ArvInflater {
+	z_stream stream;
+
+	guchar *output;
+	size_t output_allocated_size;
+	size_t output_size;
+
+	gboolean is_finished;
+	gboolean is_error;
+};
+
 /**
- * arv_decompress:
- * @input_buffer: compressed data
- * @input_buffer: size of compressed data
- * @output_size: (out): placeholder for inflated data
- * Return value: (transfer full): a newly allocated buffer
- **/
+ * arv_inflater_new:
+ * @output_size: expected size of the inflated data, 0 if unknown
+ *
+ * Creates a new inflater for raw deflate data, as found in zip files. When the output size is known in advance,
+ * for example from a zip central directory, the output buffer is allocated only once.
+ *
+ * Return value: (transfer full): a new #ArvInflater, NULL on error
+ */
 
-void *
-arv_decompress (void *input_buffer, size_t input_size, size_t *output_size)
+ArvInflater *
+arv_inflater_new (size_t output_size)
 {
-	z_stream stream;
-	GByteArray *output;
-	guchar z_stream_output[ARV_DECOMPRESS_CHUNK];
-	unsigned have;
-	int result;
+	ArvInflater *inflater;
 
-	g_return_val_if_fail (input_buffer != NULL, NULL);
-	g_return_val_if_fail (input_size > 0, NULL);
+	inflater = g_new0 (ArvInflater, 1);
 
-	/* allocate inflate state */
-	stream.zalloc = Z_NULL;
-	stream.zfree = Z_NULL;
-	stream.opaque = Z_NULL;
-	stream.avail_in = 0;
-	stream.next_in = Z_NULL;
-	stream.data_type = Z_UNKNOWN;
-
-	g_return_val_if_fail (inflateInit2(&stream, -MAX_WBITS) == Z_OK, NULL);
-
-	output = g_byte_array_new ();
-
-	/* decompress until deflate stream ends or end of file */
-	do {
-		stream.avail_in = MIN (input_size, ARV_DECOMPRESS_CHUNK);
-		stream.next_in = input_buffer;
-
-		arv_info_misc ("[Decompress] Input ptr = 0x%p - Chunk size = %d - %c",
-				(void *) stream.next_in, stream.avail_in, *stream.next_in);
-
-		input_size -= stream.avail_in;
-		input_buffer = ((char *) input_buffer) + stream.avail_in;
-
-		/* run inflate() on input until output buffer not full */
-		do {
-			stream.avail_out = ARV_DECOMPRESS_CHUNK;
-			stream.next_out = z_stream_output;
-			result = inflate(&stream, Z_NO_FLUSH);
-			if (result == Z_STREAM_ERROR) {
-				arv_warning_misc ("[Decompress] Z_STREAM_ERROR");
-				goto CLEANUP;
-			}
+	inflater->stream.zalloc = Z_NULL;
+	inflater->stream.zfree = Z_NULL;
+	inflater->stream.opaque = Z_NULL;
+	inflater->stream.avail_in = 0;
+	inflater->stream.next_in = Z_NULL;
+	inflater->stream.data_type = Z_UNKNOWN;
 
-			switch (result) {
-				case Z_NEED_DICT:
-					arv_warning_misc ("[Decompress] Z_NEED_DICT");
-					goto CLEANUP;
-				case Z_DATA_ERROR:
-					arv_warning_misc ("[Decompress] Z_DATA_ERROR");
-					goto CLEANUP;
-				case Z_MEM_ERROR:
-					arv_warning_misc ("[Decompress] Z_MEM_ERROR");
-					goto CLEANUP;
-			}
+	if (inflateInit2 (&inflater->stream, -MAX_WBITS) != Z_OK) {
+		arv_warning_misc ("[Inflater::new] Failed to initialize inflate state");
+		g_free (inflater);
+		return NULL;
+	}
 
-			have = ARV_DECOMPRESS_CHUNK - stream.avail_out;
-			g_byte_array_append (output, z_stream_output, have);
-		} while (stream.avail_out == 0);
+	inflater->output_allocated_size = output_size > 0 ? output_size : ARV_DECOMPRESS_CHUNK;
+	inflater->output = g_malloc (inflater->output_allocated_size);
 
-		/* done when inflate() says it's done */
-	} while (input_size > 0 && result != Z_STREAM_END);
+	return inflater;
+}
 
-	/* clean up and return */
-	inflateEnd(&stream);
+static gboolean
+_inflater_run (ArvInflater *inflater, gboolean drain, ArvInflaterCallback callback, void *user_data)
+{
+	gboolean output_is_full = FALSE;
 
-	if (result != Z_STREAM_END) {
-		arv_warning_misc ("[Decompress] !Z_STREAM_END");
-		g_byte_array_free (output, TRUE);
-		if (output_size != NULL)
-			*output_size = 0;
-		return NULL;
+	while (!inflater->is_finished) {
+		size_t previous_size;
+		int result;
+
+		if (output_is_full) {
+			inflater->output_allocated_size += MAX (inflater->output_allocated_size / 2,
+								ARV_DECOMPRESS_CHUNK);
+			inflater->output = g_realloc (inflater->output, inflater->output_allocated_size);
+			output_is_full = FALSE;
+		}
+
+		previous_size = inflater->output_size;
+
+		inflater->stream.avail_out = MIN (inflater->output_allocated_size - inflater->output_size,
+						  G_MAXUINT);
+		inflater->stream.next_out = inflater->output + inflater->output_size;
+
+		result = inflate (&inflater->stream, Z_NO_FLUSH);
+
+		switch (result) {
+			case Z_OK:
+			case Z_BUF_ERROR:
+				break;
+			case Z_STREAM_END:
+				inflater->is_finished = TRUE;
+				break;
+			case Z_NEED_DICT:
+				arv_warning_misc ("[Inflater::run] Z_NEED_DICT");
+				inflater->is_error = TRUE;
+				return FALSE;
+			case Z_DATA_ERROR:
+				arv_warning_misc ("[Inflater::run] Z_DATA_ERROR");
+				inflater->is_error = TRUE;
+				return FALSE;
+			case Z_MEM_ERROR:
+				arv_warning_misc ("[Inflater::run] Z_MEM_ERROR");
+				inflater->is_error = TRUE;
+				return FALSE;
+			default:
+				arv_warning_misc ("[Inflater::run] Z_STREAM_ERROR");
+				inflater->is_error = TRUE;
+				return FALSE;
+		}
+
+		inflater->output_size = inflater->stream.next_out - inflater->output;
+
+		if (callback != NULL && inflater->output_size > previous_size &&
+		    !callback (inflater->output + previous_size, inflater->output_size - previous_size, user_data)) {
+			inflater->is_error = TRUE;
+			return FALSE;
+		}
+
+		/* The output buffer was not filled, all the available input has been consumed */
+		if (inflater->stream.avail_out > 0)
+			break;
+
+		/* No progress with a full output buffer. If there is no pending input, it is not possible to tell
+		 * if more output space is needed before the next chunk of input, unless we are draining. */
+		if (result == Z_BUF_ERROR) {
+			if (inflater->stream.avail_in == 0 && !drain)
+				break;
+			output_is_full = TRUE;
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+ * arv_inflater_push:
+ * @inflater: a #ArvInflater
+ * @input_buffer: a chunk of compressed data
+ * @input_size: size of the compressed data chunk
+ * @callback: (scope call) (allow-none): a function called with the newly inflated data
+ * @user_data: callback data
+ *
+ * Inflates a chunk of compressed data. The inflated data are appended to the internal output buffer, and the
+ * optional @callback is called with a pointer to the newly available data, allowing a zero copy processing of the
+ * output while the remaining input is still being acquired.
+ *
+ * Return value: %TRUE on success, %FALSE on a data error or if @callback returned %FALSE.
+ */
+
+gboolean
+arv_inflater_push (ArvInflater *inflater, const void *input_buffer, size_t input_size,
+		   ArvInflaterCallback callback, void *user_data)
+{
+	g_return_val_if_fail (inflater != NULL, FALSE);
+	g_return_val_if_fail (input_buffer != NULL || input_size == 0, FALSE);
+
+	if (inflater->is_error)
+		return FALSE;
+
+	while (input_size > 0 && !inflater->is_finished) {
+		size_t chunk_size;
+
+		chunk_size = MIN (input_size, G_MAXUINT);
+
+		inflater->stream.avail_in = chunk_size;
+		inflater->stream.next_in = (void *) input_buffer;
+
+		if (!_inflater_run (inflater, FALSE, callback, user_data))
+			return FALSE;
+
+		chunk_size -= inflater->stream.avail_in;
+		input_size -= chunk_size;
+		input_buffer = ((const char *) input_buffer) + chunk_size;
 	}
 
+	inflater->stream.avail_in = 0;
+	inflater->stream.next_in = Z_NULL;
+
+	return TRUE;
+}
+
+/**
+ * arv_inflater_finish:
+ * @inflater: (transfer full): a #ArvInflater
+ * @callback: (scope call) (allow-none): a function called with the last inflated data
+ * @user_data: callback data
+ * @output_size: (out): placeholder for the inflated data size
+ *
+ * Flushes the output still pending in the inflate state, terminates the decompression and frees @inflater.
+ *
+ * Return value: (transfer full): the inflated data, NULL if the deflate stream is incomplete or invalid.
+ */
+
+void *
+arv_inflater_finish (ArvInflater *inflater, ArvInflaterCallback callback, void *user_data, size_t *output_size)
+{
+	void *output = NULL;
+
 	if (output_size != NULL)
-		*output_size = output->len;
+		*output_size = 0;
+
+	g_return_val_if_fail (inflater != NULL, NULL);
+
+	if (!inflater->is_error && !inflater->is_finished)
+		_inflater_run (inflater, TRUE, callback, user_data);
 
-	return g_byte_array_free (output, FALSE);
+	if (!inflater->is_error) {
+		if (inflater->is_finished) {
+			output = inflater->output;
+			inflater->output = NULL;
 
-CLEANUP:
+			if (output_size != NULL)
+				*output_size = inflater->output_size;
+		} else
+			arv_warning_misc ("[Inflater::finish] !Z_STREAM_END");
+	}
+
+	arv_inflater_free (inflater);
+
+	return output;
+}
+
+void
+arv_inflater_free (ArvInflater *inflater)
+{
+	if (inflater == NULL)
+		return;
+
+	inflateEnd (&inflater->stream);
+	g_free (inflater->output);
+	g_free (inflater);
+}
+
+/**
+ * arv_decompress:
+ * @input_buffer: compressed data
+ * @input_buffer: size of compressed data
+ * @output_size: (out): placeholder for inflated data
+ * Return value: (transfer full): a newly allocated buffer
+ **/
+
+void *
+arv_decompress (void *input_buffer, size_t input_size, size_t *output_size)
+{
+	ArvInflater *inflater;
 
 	if (output_size != NULL)
 		*output_size = 0;
 
-	g_byte_array_free (output, TRUE);
-	inflateEnd(&stream);
+	g_return_val_if_fail (input_buffer != NULL, NULL);
+	g_return_val_if_fail (input_size > 0, NULL);
+
+	inflater = arv_inflater_new (0);
+	if (inflater == NULL)
+		return NULL;
+
+	if (!arv_inflater_push (inflater, input_buffer, input_size, NULL, NULL)) {
+		arv_inflater_free (inflater);
+		return NULL;
+	}
 
-	return NULL;
+	return arv_inflater_finish (inflater, NULL, NULL, output_size);
 }
 
 /**
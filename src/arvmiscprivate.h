@@ -80,6 +80,18 @@ ARV_API gboolean	arv_parse_genicam_url	(const char *url, gssize url_length,
 void 		arv_copy_memory_with_endianness	(void *to, size_t to_size, guint to_endianness,
 						 void *from, size_t from_size, guint from_endianness);
 
+typedef struct _ArvInflater ArvInflater;
+
+typedef gboolean (*ArvInflaterCallback) (const void *data, size_t size, void *user_data);
+
+/* private, but used by tests */
+ARV_API ArvInflater *	arv_inflater_new	(size_t output_size);
+ARV_API gboolean	arv_inflater_push	(ArvInflater *inflater, const void *input_buffer, size_t input_size,
+						 ArvInflaterCallback callback, void *user_data);
+ARV_API void *		arv_inflater_finish	(ArvInflater *inflater, ArvInflaterCallback callback, void *user_data,
+						 size_t *output_size);
+ARV_API void		arv_inflater_free	(ArvInflater *inflater);
+
 void * 		arv_decompress 			(void *input_buffer, size_t input_size, size_t *output_size);
 
 /* private, but used by tests */
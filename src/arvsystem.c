@@ -36,6 +36,7 @@
 #include <string.h>
 #include <arvmisc.h>
 #include <arvdomimplementation.h>
+#include <libxml/parser.h>
 
 static GMutex arv_system_mutex;
 
@@ -540,29 +541,43 @@ arv_get_device_protocol	(unsigned int index)
 ArvDevice *
 arv_open_device (const char *device_id, GError **error)
 {
+	GSList *available_interfaces = NULL;
+	GSList *iter;
+	ArvDevice *device = NULL;
+	GError *local_error = NULL;
 	unsigned int i;
 
+	/* Only the interface list is protected by the system mutex, in order to allow concurrent device
+	 * instantiations. Each interface is kept alive during the open, even if arv_shutdown is called
+	 * meanwhile. */
+
 	g_mutex_lock (&arv_system_mutex);
 
 	for (i = 0; i < G_N_ELEMENTS (interfaces); i++) {
-		ArvInterface *interface;
-		ArvDevice *device;
+		if (interfaces[i].is_available)
+			available_interfaces = g_slist_prepend (available_interfaces,
+								g_object_ref (interfaces[i].get_interface_instance ()));
+	}
 
-		if (interfaces[i].is_available) {
-			GError *local_error = NULL;
+	g_mutex_unlock (&arv_system_mutex);
 
-			interface = interfaces[i].get_interface_instance ();
-			device = arv_interface_open_device (interface, device_id, &local_error);
-			if (ARV_IS_DEVICE (device) || local_error != NULL) {
-				if (local_error != NULL)
-					g_propagate_error (error, local_error);
-				g_mutex_unlock (&arv_system_mutex);
-				return device;
-			}
-		}
+	available_interfaces = g_slist_reverse (available_interfaces);
+
+	for (iter = available_interfaces; iter != NULL; iter = iter->next) {
+		device = arv_interface_open_device (iter->data, device_id, &local_error);
+		if (ARV_IS_DEVICE (device) || local_error != NULL)
+			break;
 	}
 
-	g_mutex_unlock (&arv_system_mutex);
+	g_slist_free_full (available_interfaces, g_object_unref);
+
+	if (local_error != NULL) {
+		g_propagate_error (error, local_error);
+		return device;
+	}
+
+	if (ARV_IS_DEVICE (device))
+		return device;
 
 	if (device_id != NULL)
 		g_set_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_NOT_FOUND,
@@ -574,6 +589,106 @@ arv_open_device (const char *device_id, GError **error)
 	return NULL;
 }
 
+typedef struct {
+	const char *device_id;
+	ArvDevice *device;
+	GError *error;
+} ArvOpenDeviceJob;
+
+static void
+_device_unref (gpointer data)
+{
+	if (data != NULL)
+		g_object_unref (data);
+}
+
+static void
+_open_device_job (gpointer data, gpointer user_data)
+{
+	ArvOpenDeviceJob *job = data;
+
+	job->device = arv_open_device (job->device_id, &job->error);
+}
+
+/**
+ * arv_open_devices:
+ * @device_ids: (array zero-terminated=1): a %NULL terminated array of device identifier strings
+ * @n_threads: maximum number of devices opened simultaneously, -1 for one thread per device
+ * @error: a #GError placeholder, %NULL to ignore
+ *
+ * Open a set of devices concurrently, using a pool of worker threads. The genicam data download and parsing,
+ * which are the most time consuming steps of a device instantiation, are run in parallel.
+ *
+ * The returned array has the same length as @device_ids. An entry is %NULL if the corresponding device could
+ * not be opened, in which case @error is set to the first encountered error.
+ *
+ * Return value: (transfer full) (element-type ArvDevice): an array of new #ArvDevice instances.
+ *
+ * Since: 0.10.0
+ */
+
+GPtrArray *
+arv_open_devices (const char * const *device_ids, int n_threads, GError **error)
+{
+	GThreadPool *pool;
+	GPtrArray *devices;
+	ArvOpenDeviceJob *jobs;
+	GError *local_error = NULL;
+	guint n_devices;
+	guint i;
+
+	g_return_val_if_fail (device_ids != NULL, NULL);
+
+	n_devices = g_strv_length ((char **) device_ids);
+	devices = g_ptr_array_new_full (n_devices, _device_unref);
+
+	if (n_devices == 0)
+		return devices;
+
+	if (n_threads <= 0 || n_threads > (int) n_devices)
+		n_threads = n_devices;
+
+	/* libxml2 global initialization is not guaranteed to be thread safe on older versions */
+	xmlInitParser ();
+
+	jobs = g_new0 (ArvOpenDeviceJob, n_devices);
+
+	pool = g_thread_pool_new (_open_device_job, NULL, n_threads, TRUE, &local_error);
+	if (pool == NULL) {
+		g_propagate_error (error, local_error);
+		g_free (jobs);
+		g_ptr_array_unref (devices);
+		return NULL;
+	}
+
+	for (i = 0; i < n_devices; i++) {
+		jobs[i].device_id = device_ids[i];
+		g_thread_pool_push (pool, &jobs[i], NULL);
+	}
+
+	g_thread_pool_free (pool, FALSE, TRUE);
+
+	for (i = 0; i < n_devices; i++) {
+		g_ptr_array_add (devices, jobs[i].device);
+
+		if (jobs[i].error != NULL) {
+			arv_warning_interface ("[Arv::open_devices] Failed to open '%s': %s",
+					       jobs[i].device_id, jobs[i].error->message);
+			if (local_error == NULL)
+				local_error = jobs[i].error;
+			else
+				g_error_free (jobs[i].error);
+		}
+	}
+
+	g_free (jobs);
+
+	if (local_error != NULL)
+		g_propagate_error (error, local_error);
+
+	return devices;
+}
+
 /**
  * arv_shutdown:
  *
@@ -109,6 +109,8 @@ description_content[] =
 "  features:                         list all features\n"
 "  values:                           list all available feature values\n"
 "  description [<feature>] ...:      show the full feature description\n"
+"  dependents <feature> ...:         list the features depending on a feature\n"
+"  profile <feature> ...:            show the evaluation tree and transport calls of a feature read\n"
 "  control <feature>[=<value>] ...:  read/write device features\n"
 "  network <setting>[=<value>]...:   read/write network settings\n"
 "\n"
@@ -121,6 +123,8 @@ description_content[] =
 "arv-tool-" ARAVIS_API_VERSION " control Width=128 Height=128 Gain R[0x10000]=0x10\n"
 "arv-tool-" ARAVIS_API_VERSION " features\n"
 "arv-tool-" ARAVIS_API_VERSION " description Width Height\n"
+"arv-tool-" ARAVIS_API_VERSION " dependents ExposureTime\n"
+"arv-tool-" ARAVIS_API_VERSION " profile AcquisitionFrameRate\n"
 "arv-tool-" ARAVIS_API_VERSION " network mode=PersistentIP\n"
 "arv-tool-" ARAVIS_API_VERSION " network ip=192.168.0.1 mask=255.255.255.0 gateway=192.168.0.254\n"
 "arv-tool-" ARAVIS_API_VERSION " -n Basler-210ab4 genicam";
@@ -636,6 +640,81 @@ arv_tool_network (int argc, char **argv, ArvDevice *device)
         }
 }
 
+static void
+arv_tool_dependents (int argc, char **argv, ArvGc *genicam)
+{
+	int i;
+
+	if (argc < 3) {
+		printf ("dependents command requires at least one feature name\n");
+		return;
+	}
+
+	for (i = 2; i < argc; i++) {
+		GError *error = NULL;
+		const char **direct;
+		const char **transitive;
+		guint n_direct;
+		guint n_transitive;
+		guint j;
+
+		direct = arv_gc_dup_feature_dependents (genicam, argv[i], FALSE, &n_direct, &error);
+		if (error != NULL) {
+			printf ("%s error: %s\n", argv[i], error->message);
+			g_clear_error (&error);
+			continue;
+		}
+
+		transitive = arv_gc_dup_feature_dependents (genicam, argv[i], TRUE, &n_transitive, NULL);
+
+		printf ("%s: %u direct, %u total dependents\n", argv[i], n_direct, n_transitive);
+		for (j = 0; j < n_transitive; j++)
+			printf ("    %s%s\n", transitive[j],
+				g_strv_contains ((const char * const *) direct, transitive[j]) ? "" : " (indirect)");
+
+		g_free (direct);
+		g_free (transitive);
+	}
+}
+
+static void
+arv_tool_profile (int argc, char **argv, ArvGc *genicam)
+{
+	int i;
+
+	if (argc < 3) {
+		printf ("profile command requires at least one feature name\n");
+		return;
+	}
+
+	for (i = 2; i < argc; i++) {
+		GError *error = NULL;
+		ArvGcNode *node;
+		const char *value;
+		char *report;
+
+		node = arv_gc_get_node (genicam, argv[i]);
+		if (!ARV_IS_GC_FEATURE_NODE (node)) {
+			printf ("%s feature not found\n", argv[i]);
+			continue;
+		}
+
+		arv_gc_start_profiling (genicam);
+		value = arv_gc_feature_node_get_value_as_string (ARV_GC_FEATURE_NODE (node), &error);
+		report = arv_gc_stop_profiling (genicam);
+
+		if (error != NULL) {
+			printf ("%s error: %s\n", argv[i], error->message);
+			g_clear_error (&error);
+		} else
+			printf ("%s = %s\n", argv[i], value);
+
+		printf ("%s", report);
+
+		g_free (report);
+	}
+}
+
 static void
 arv_tool_execute_command (int argc, char **argv, ArvDevice *device,
 			  ArvRegisterCachePolicy register_cache_policy,
@@ -680,6 +759,10 @@ arv_tool_execute_command (int argc, char **argv, ArvDevice *device,
                 else {
                         GRegex *regex;
 
+                        /* With the register cache enabled, fill it using as few device reads as possible */
+                        if (register_cache_policy != ARV_REGISTER_CACHE_POLICY_DISABLE)
+                                arv_gc_warmup_register_cache (genicam, 0, NULL, NULL);
+
                         regex = arv_regex_new_from_glob_pattern (argc == 3 ? argv[2] : "*", TRUE);
                         arv_tool_list_features (genicam, "Root", ARV_TOOL_LIST_MODE_VALUES, regex, 0);
                         g_regex_unref (regex);
@@ -694,6 +777,10 @@ arv_tool_execute_command (int argc, char **argv, ArvDevice *device,
                         arv_tool_list_features (genicam, "Root", ARV_TOOL_LIST_MODE_DESCRIPTIONS, regex, 0);
                         g_regex_unref (regex);
                 }
+	} else if (g_strcmp0 (command, "dependents") == 0) {
+                arv_tool_dependents (argc, argv, genicam);
+	} else if (g_strcmp0 (command, "profile") == 0) {
+                arv_tool_profile (argc, argv, genicam);
 	} else if (g_strcmp0 (command, "control") == 0) {
                 arv_tool_control (argc, argv, device);
         } else if (g_strcmp0 (command, "network") == 0) {
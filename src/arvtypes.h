@@ -78,6 +78,7 @@ typedef struct _ArvGcSelector		ArvGcSelector;
 
 typedef struct _ArvInterface 		ArvInterface;
 typedef struct _ArvDevice 		ArvDevice;
+typedef struct _ArvFeatureHandle	ArvFeatureHandle;
 typedef struct _ArvStream 		ArvStream;
 typedef struct _ArvChunkParser		ArvChunkParser;
 
@@ -29,7 +29,7 @@
 #include <arvuvdeviceprivate.h>
 #include <arvuvinterfaceprivate.h>
 #include <arvuvcpprivate.h>
-#include <arvgc.h>
+#include <arvgcprivate.h>
 #include <arvdebug.h>
 #include <arvenumtypes.h>
 #include <libusb.h>
@@ -632,67 +632,62 @@ _bootstrap (ArvUvDevice *uv_device)
 	arv_info_device ("genicam address =          0x%016" G_GINT64_MODIFIER "x", entry.address);
 	arv_info_device ("genicam size    =          0x%016" G_GINT64_MODIFIER "x", entry.size);
 
-	data = g_malloc0 (entry.size);
-	success = success && arv_device_read_memory (device, entry.address, entry.size, data, NULL);
-	if (!success){
-		arv_warning_device ("[UvDevice::_bootstrap] Error during memory read");
-		g_free(data);
-		return FALSE;
-	}
-
-#if 0
-	string = g_string_new ("");
-	arv_g_string_append_hex_dump (string, data, entry.size);
-	arv_info_device ("GENICAM\n%s", string->str);
-	g_string_free (string, TRUE);
-#endif
-
 	schema_type = arv_uvcp_manifest_entry_get_schema_type (&entry);
 
 	switch (schema_type) {
 		case ARV_UVCP_SCHEMA_ZIP:
 			{
-				ArvZip *zip;
-				const GSList *zip_files;
-
-				zip = arv_zip_new (data, entry.size);
-				zip_files = arv_zip_get_file_list (zip);
-
-				if (zip_files != NULL) {
-					const char *zip_filename;
-
-					zip_filename = arv_zip_file_get_name (zip_files->data);
-                                        priv->genicam_xml = arv_zip_get_file (zip,
-                                                                              zip_filename,
-                                                                              &priv->genicam_xml_size);
-
-					arv_info_device ("zip file =                 %s", zip_filename);
+				/* Download, decompression and parsing are overlapped */
+				priv->genicam = arv_gc_new_from_device_zip (device, entry.address, entry.size,
+									    &priv->genicam_xml,
+									    &priv->genicam_xml_size, NULL);
 
 #if 0
+				if (priv->genicam_xml != NULL) {
 					string = g_string_new ("");
 					arv_g_string_append_hex_dump (string, priv->genicam_xml,
 								      priv->genicam_xml_size);
 					arv_info_device ("GENICAM\n%s", string->str);
 					g_string_free (string, TRUE);
+				}
 #endif
 
+				if (priv->genicam_xml == NULL) {
+					arv_warning_device ("[UvDevice::_bootstrap] Error during genicam data download");
+					return FALSE;
+				}
+
+				if (priv->genicam == NULL)
 					priv->genicam = arv_gc_new (ARV_DEVICE (uv_device),
 								    priv->genicam_xml,
 								    priv->genicam_xml_size);
 
+				if (priv->genicam != NULL) {
                                         genicam_url = g_strdup_printf("local:///DeviceU3V.zip;%"
                                                                       G_GINT64_MODIFIER "x;%" G_GINT64_MODIFIER "x",
                                                                       entry.address, entry.size);
                                         arv_dom_document_set_url(ARV_DOM_DOCUMENT(priv->genicam), genicam_url);
                                         g_free (genicam_url);
 				}
-
-				arv_zip_free (zip);
-				g_free (data);
 			}
 			break;
 		case ARV_UVCP_SCHEMA_RAW:
 			{
+				data = g_malloc0 (entry.size);
+				success = arv_device_read_memory (device, entry.address, entry.size, data, NULL);
+				if (!success){
+					arv_warning_device ("[UvDevice::_bootstrap] Error during memory read");
+					g_free(data);
+					return FALSE;
+				}
+
+#if 0
+				string = g_string_new ("");
+				arv_g_string_append_hex_dump (string, data, entry.size);
+				arv_info_device ("GENICAM\n%s", string->str);
+				g_string_free (string, TRUE);
+#endif
+
 				priv->genicam_xml = data;
 				priv->genicam_xml_size = entry.size;
 				priv->genicam = arv_gc_new (ARV_DEVICE (uv_device),
@@ -109,6 +109,7 @@ arv_uv_interface_device_infos_unref (ArvUvInterfaceDeviceInfos *infos)
 
 typedef struct {
 	GHashTable *devices;
+	GMutex devices_mutex;
 	libusb_context *usb;
 } ArvUvInterfacePrivate;
 
@@ -294,6 +295,8 @@ _discover (ArvUvInterface *uv_interface,  GArray *device_ids)
 		return;
 	}
 
+	g_mutex_lock (&uv_interface->priv->devices_mutex);
+
 	g_hash_table_remove_all (uv_interface->priv->devices);
 
 	for (i = 0; i < result; i++) {
@@ -317,6 +320,8 @@ _discover (ArvUvInterface *uv_interface,  GArray *device_ids)
 		}
 	}
 
+	g_mutex_unlock (&uv_interface->priv->devices_mutex);
+
 	arv_info_interface ("Found %d USB3Vision device%s (among %" G_GSSIZE_FORMAT " USB device%s)",
 			     uv_count , uv_count > 1 ? "s" : "",
 			     result, result > 1 ? "s" : "");
@@ -339,9 +344,12 @@ _open_device (ArvInterface *interface, const char *device_id, GError **error)
 {
 	ArvUvInterface *uv_interface;
 	ArvUvInterfaceDeviceInfos *device_infos;
+	ArvDevice *device;
 
 	uv_interface = ARV_UV_INTERFACE (interface);
 
+	g_mutex_lock (&uv_interface->priv->devices_mutex);
+
 	if (device_id == NULL) {
 		GList *device_list;
 
@@ -351,10 +359,19 @@ _open_device (ArvInterface *interface, const char *device_id, GError **error)
 	} else
 		device_infos = g_hash_table_lookup (uv_interface->priv->devices, device_id);
 
+	if (device_infos != NULL)
+		arv_uv_interface_device_infos_ref (device_infos);
+
+	g_mutex_unlock (&uv_interface->priv->devices_mutex);
+
 	if (device_infos == NULL)
 		return NULL;
 
-	return arv_uv_device_new_from_guid (device_infos->guid, error);
+	device = arv_uv_device_new_from_guid (device_infos->guid, error);
+
+	arv_uv_interface_device_infos_unref (device_infos);
+
+	return device;
 }
 
 static ArvDevice *
@@ -425,6 +442,7 @@ arv_uv_interface_init (ArvUvInterface *uv_interface)
 
 	uv_interface->priv->devices = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
 							     (GDestroyNotify) arv_uv_interface_device_infos_unref);
+	g_mutex_init (&uv_interface->priv->devices_mutex);
 }
 
 static void
@@ -433,6 +451,7 @@ arv_uv_interface_finalize (GObject *object)
 	ArvUvInterface *uv_interface = ARV_UV_INTERFACE (object);
 
 	g_hash_table_unref (uv_interface->priv->devices);
+	g_mutex_clear (&uv_interface->priv->devices_mutex);
 
 	G_OBJECT_CLASS (arv_uv_interface_parent_class)->finalize (object);
 
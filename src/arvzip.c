@@ -30,7 +30,7 @@
  * @short_description: A simple zip extractor
  */
 
-#include <arvzip.h>
+#include <arvzipprivate.h>
 #include <arvdebugprivate.h>
 #include <string.h>
 #include <zlib.h>
@@ -41,6 +41,7 @@ struct _ArvZipFile {
         size_t compressed_size;
         size_t uncompressed_size;
         ptrdiff_t offset;
+	guint16 compression_method;
 };
 
 const char *
@@ -59,9 +60,34 @@ arv_zip_file_get_uncompressed_size (ArvZipFile *zip_file)
 	return zip_file->uncompressed_size;
 }
 
+size_t
+arv_zip_file_get_compressed_size (ArvZipFile *zip_file)
+{
+	g_return_val_if_fail (zip_file != NULL, 0);
+
+	return zip_file->compressed_size;
+}
+
+/**
+ * arv_zip_file_get_compression_method: (skip)
+ * @zip_file: a #ArvZipFile
+ *
+ * Return value: the compression method of @zip_file, as stored in the central directory. Only
+ * %ARV_ZIP_COMPRESSION_METHOD_STORED and %ARV_ZIP_COMPRESSION_METHOD_DEFLATED are supported.
+ */
+
+guint16
+arv_zip_file_get_compression_method (ArvZipFile *zip_file)
+{
+	g_return_val_if_fail (zip_file != NULL, 0);
+
+	return zip_file->compression_method;
+}
+
 struct _ArvZip {
 	const unsigned char *buffer;
 	size_t buffer_size;
+	size_t buffer_offset;
 
 	GSList *files;
 
@@ -83,7 +109,15 @@ arv_zip_build_file_list (ArvZip *zip)
         offset = zip->directory_offset;
 
 	for (i = 0; i < zip->n_files; i++) {
-		ptr = zip->buffer + zip->header_size + offset;
+		ptrdiff_t position = zip->header_size + offset - zip->buffer_offset;
+
+		if (position < 0 || position + 0x2e > zip->buffer_size ||
+		    position + 0x2e + ARV_GUINT16_FROM_LE_PTR (zip->buffer + position, 28) > zip->buffer_size) {
+			arv_info_misc ("[Zip::build_file_list] Central directory entry out of buffer");
+			return;
+		}
+
+		ptr = zip->buffer + position;
 		if (ARV_GUINT32_FROM_LE_PTR (ptr, 0) != 0x02014b50) {
 			arv_info_misc ("[Zip::build_file_list] Magic number of central directory not found (0x02014b50)");
 			arv_info_misc ("[Zip::build_file_list] Expected at 0x%" G_GSIZE_MODIFIER "x - found 0x%08x instead",
@@ -92,6 +126,7 @@ arv_zip_build_file_list (ArvZip *zip)
 		}
 
 		zip_file = g_new0 (ArvZipFile, 1);
+		zip_file->compression_method = ARV_GUINT16_FROM_LE_PTR (ptr, 10);
                 zip_file->compressed_size = ARV_GUINT32_FROM_LE_PTR (ptr, 20);
                 zip_file->uncompressed_size = ARV_GUINT32_FROM_LE_PTR (ptr, 24);
                 zip_file->offset = ARV_GUINT32_FROM_LE_PTR (ptr, 42);
@@ -124,18 +159,27 @@ arv_zip_find_file (ArvZip *zip, const char *name)
 }
 
 static ptrdiff_t
-arv_zip_get_file_data (ArvZip *zip, ArvZipFile *zip_file)
+arv_zip_get_file_data (ArvZip *zip, ArvZipFile *zip_file, guint16 *compression_method)
 {
         const void *ptr;
+	ptrdiff_t position;
+
+	position = zip_file->offset + zip->header_size - zip->buffer_offset;
+	if (position < 0 || position + 30 > zip->buffer_size) {
+		arv_info_misc ("[Zip::get_file_data] File header out of buffer");
+		return -1;
+	}
 
-	ptr = zip->buffer + zip_file->offset + zip->header_size;
+	ptr = zip->buffer + position;
 
         if (ARV_GUINT32_FROM_LE_PTR (ptr, 0) != 0x04034b50) {
 		arv_info_misc ("[Zip::get_file_data] Magic number for file header not found (0x04034b50)");
 	       	return -1;
 	}
 
-	return zip_file->offset + zip->header_size +
+	*compression_method = ARV_GUINT16_FROM_LE_PTR (ptr, 8);
+
+	return position +
 		ARV_GUINT16_FROM_LE_PTR (ptr, 26) +
 		ARV_GUINT16_FROM_LE_PTR (ptr, 28) + 30;
 }
@@ -149,10 +193,29 @@ arv_zip_get_file_data (ArvZip *zip, ArvZipFile *zip_file)
 
 ArvZip *
 arv_zip_new (const void *buffer, size_t size)
+{
+	return arv_zip_new_partial (buffer, size, 0);
+}
+
+/**
+ * arv_zip_new_partial: (skip)
+ * @buffer: the end of the zipped data
+ * @size: size of @buffer
+ * @offset: position of @buffer in the zipped data
+ *
+ * Builds the file list of a zip archive from its last @size bytes, as long as they contain the whole central
+ * directory. It allows to retrieve the file sizes before downloading the complete archive. arv_zip_get_file()
+ * only works for files whose data are contained in @buffer.
+ *
+ * Return value: a new #ArvZip instance
+ */
+
+ArvZip *
+arv_zip_new_partial (const void *buffer, size_t size, size_t offset)
 {
         ArvZip *zip;
         const void *ptr;
-        int i;
+        gssize i;
 	gboolean directory_found;
 
 	g_return_val_if_fail (buffer != NULL, NULL);
@@ -161,14 +224,15 @@ arv_zip_new (const void *buffer, size_t size)
         zip = g_new0 (ArvZip, 1);
 	zip->buffer = buffer;
 	zip->buffer_size = size;
+	zip->buffer_offset = offset;
 
 	directory_found = FALSE;
-        for (i = zip->buffer_size - 4; i > 0; i--) {
+        for (i = (gssize) zip->buffer_size - 22; i >= 0; i--) {
                 if (zip->buffer[i] == 0x50 &&
 		    zip->buffer[i+1] == 0x4b &&
 		    zip->buffer[i+2] == 0x05 &&
 		    zip->buffer[i+3] == 0x06) {
-			zip->directory_position = i;
+			zip->directory_position = i + offset;
 			directory_found = TRUE;
                         break;
                 }
@@ -178,7 +242,7 @@ arv_zip_new (const void *buffer, size_t size)
 		return zip;
 	}
 
-	ptr = zip->buffer + zip->directory_position;
+	ptr = zip->buffer + zip->directory_position - offset;
         zip->n_files = ARV_GUINT16_FROM_LE_PTR (ptr, 10);
         if (ARV_GUINT16_FROM_LE_PTR (ptr, 8) != zip->n_files) {
 		arv_info_misc ("[Zip::new] Mismatch in number of files");
@@ -188,6 +252,11 @@ arv_zip_new (const void *buffer, size_t size)
 
         zip->directory_size = ARV_GUINT32_FROM_LE_PTR (ptr, 12);
         zip->directory_offset = ARV_GUINT32_FROM_LE_PTR (ptr, 16);
+	if (zip->directory_offset + zip->directory_size > zip->directory_position) {
+		arv_info_misc ("[Zip::new] Invalid central directory offset");
+		zip->n_files = 0;
+		return zip;
+	}
         zip->header_size = zip->directory_position - (zip->directory_offset + zip->directory_size);
 
 	arv_debug_misc ("[Zip::new] number of files = %d", zip->n_files);
@@ -226,12 +295,30 @@ arv_zip_get_file_list (ArvZip *zip)
 	return zip->files;
 }
 
+/**
+ * arv_zip_get_file_header_offset: (skip)
+ * @zip: a #ArvZip
+ * @zip_file: a file of @zip
+ *
+ * Return value: the position of the local header of @zip_file from the start of the zipped data.
+ */
+
+ptrdiff_t
+arv_zip_get_file_header_offset (ArvZip *zip, ArvZipFile *zip_file)
+{
+	g_return_val_if_fail (zip != NULL, -1);
+	g_return_val_if_fail (zip_file != NULL, -1);
+
+	return zip->header_size + zip_file->offset;
+}
+
 void *
 arv_zip_get_file (ArvZip *zip, const char *name, size_t *size)
 {
         ArvZipFile *zip_file;
 	void *output_buffer;
 	ptrdiff_t offset;
+	guint16 compression_method;
 
 	if (size != NULL)
 		*size = 0;
@@ -243,15 +330,27 @@ arv_zip_get_file (ArvZip *zip, const char *name, size_t *size)
         if (!zip_file)
 		return NULL;
 
-        offset = arv_zip_get_file_data (zip, zip_file);
-	if (offset < 0)
+        offset = arv_zip_get_file_data (zip, zip_file, &compression_method);
+	if (offset < 0 || offset + zip_file->compressed_size > zip->buffer_size)
 		return NULL;
 
+	if (compression_method != ARV_ZIP_COMPRESSION_METHOD_STORED &&
+	    compression_method != ARV_ZIP_COMPRESSION_METHOD_DEFLATED) {
+		arv_info_misc ("[Zip::get_file] Unsupported compression method (%d)", compression_method);
+		return NULL;
+	}
+
+	if (compression_method == ARV_ZIP_COMPRESSION_METHOD_STORED &&
+	    zip_file->compressed_size != zip_file->uncompressed_size) {
+		arv_info_misc ("[Zip::get_file] Size mismatch for stored file");
+		return NULL;
+	}
+
 	output_buffer = g_malloc (zip_file->uncompressed_size);
 	if (output_buffer == NULL)
 		return NULL;
 
-        if (zip_file->compressed_size < zip_file->uncompressed_size) {
+        if (compression_method == ARV_ZIP_COMPRESSION_METHOD_DEFLATED) {
                 z_stream zs;
                 zs.zalloc = NULL;
                 zs.zfree = NULL;
@@ -0,0 +1,42 @@
+/* Aravis - Digital camera library
+ *
+ * Copyright © 2009-2025 Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ *
+ * SPDX-License-Identifier: LGPL-2.1-or-later
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ *
+ * Author: Emmanuel Pacaud <emmanuel.pacaud@free.fr>
+ */
+
+#ifndef ARV_ZIP_PRIVATE_H
+#define ARV_ZIP_PRIVATE_H
+
+#include <arvapi.h>
+#include <arvzip.h>
+
+G_BEGIN_DECLS
+
+#define ARV_ZIP_COMPRESSION_METHOD_STORED	0
+#define ARV_ZIP_COMPRESSION_METHOD_DEFLATED	8
+
+ArvZip *		arv_zip_new_partial			(const void *buffer, size_t size, size_t offset);
+ptrdiff_t		arv_zip_get_file_header_offset		(ArvZip *zip, ArvZipFile *zip_file);
+
+size_t			arv_zip_file_get_compressed_size	(ArvZipFile *zip_file);
+ARV_API guint16		arv_zip_file_get_compression_method	(ArvZipFile *zip_file);
+
+G_END_DECLS
+
+#endif
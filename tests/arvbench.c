@@ -0,0 +1,534 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* End-to-end acquisition benchmark. A GigE Vision fake camera is started on the loopback interface, and its frames
+ * are received by an ArvGvStream, for each combination of stream backend, frame size, packet size, frame rate and
+ * packet loss ratio. For each run, the frame rate, the throughput, the CPU time per frame, the frame drops and the
+ * packet resends are reported as JSON, which can be compared between two builds, for example:
+ *
+ * arv-bench --frame-sizes 640x480,2048x2048 --packet-sizes 1500,8000 --loss-ratios 0,0.001 -o bench.json
+ *
+ * The receiver CPU time is the one of the stream thread, and is only available on Linux. The process CPU time also
+ * includes the fake camera emission. */
+
+#include <arv.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef G_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#if ARAVIS_HAS_PACKET_SOCKET
+#include <sys/socket.h>
+#include <linux/if_ether.h>
+#endif
+
+#define ARV_BENCH_SERIAL_NUMBER		"Bench"
+#define ARV_BENCH_DEVICE_ID		"Aravis-" ARV_BENCH_SERIAL_NUMBER
+#define ARV_BENCH_STREAM_THREAD_NAME	"arv_gv_stream"
+
+static char *arv_option_backends = "socket,packet-socket";
+static char *arv_option_frame_sizes = "640x480,1920x1080";
+static char *arv_option_packet_sizes = "1500,8000";
+static char *arv_option_frame_rates = "100";
+static char *arv_option_loss_ratios = "0,0.001";
+static double arv_option_duration = 2.0;
+static int arv_option_n_buffers = 16;
+static char *arv_option_output = NULL;
+static char *arv_option_debug_domains = NULL;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{ "backends",		'b', 0, G_OPTION_ARG_STRING,
+		&arv_option_backends,		"Stream backends (socket, packet-socket)", "<b1,b2,...>" },
+	{ "frame-sizes",	's', 0, G_OPTION_ARG_STRING,
+		&arv_option_frame_sizes,	"Frame sizes", "<WxH,...>" },
+	{ "packet-sizes",	'p', 0, G_OPTION_ARG_STRING,
+		&arv_option_packet_sizes,	"GVSP packet sizes, in bytes", "<p1,p2,...>" },
+	{ "frame-rates",	'r', 0, G_OPTION_ARG_STRING,
+		&arv_option_frame_rates,	"Frame rates, in frames per second", "<r1,r2,...>" },
+	{ "loss-ratios",	'l', 0, G_OPTION_ARG_STRING,
+		&arv_option_loss_ratios,	"Packet loss ratios", "<l1,l2,...>" },
+	{ "duration",		't', 0, G_OPTION_ARG_DOUBLE,
+		&arv_option_duration,		"Duration of each run, in seconds", NULL },
+	{ "n-buffers",		'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_buffers,		"Number of stream buffers", NULL },
+	{ "output",		'o', 0, G_OPTION_ARG_FILENAME,
+		&arv_option_output,		"JSON output file (default: stdout)", NULL },
+	{ "debug", 		'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 	"Debug mode", NULL },
+	{ NULL }
+};
+
+typedef gboolean (*ArvBenchBackendAvailable) (void);
+
+typedef struct {
+	const char *name;
+	ArvGvStreamOption options;
+	ArvBenchBackendAvailable is_available;
+} ArvBenchBackend;
+
+static gboolean
+_is_socket_available (void)
+{
+	return TRUE;
+}
+
+static gboolean
+_is_packet_socket_available (void)
+{
+#if ARAVIS_HAS_PACKET_SOCKET
+	int fd;
+
+	/* The stream silently falls back to the socket backend if a packet socket can not be opened */
+	fd = socket (PF_PACKET, SOCK_RAW, g_htons (ETH_P_ALL));
+	if (fd >= 0) {
+		close (fd);
+		return TRUE;
+	}
+#endif
+	return FALSE;
+}
+
+static const ArvBenchBackend backends[] = {
+	{ "socket",		ARV_GV_STREAM_OPTION_PACKET_SOCKET_DISABLED,	_is_socket_available },
+	{ "packet-socket",	ARV_GV_STREAM_OPTION_NONE,			_is_packet_socket_available }
+};
+
+typedef struct {
+	const ArvBenchBackend *backend;
+	guint width;
+	guint height;
+	guint packet_size;
+	double frame_rate;
+	double loss_ratio;
+
+	char *skip_reason;
+
+	double duration_s;
+	guint64 n_completed;
+	guint64 n_failures;
+	guint64 n_underruns;
+	guint64 n_missing_frames;
+	guint64 n_missing_packets;
+	guint64 n_resend_requests;
+	guint64 n_resent_packets;
+	guint64 n_transferred_bytes;
+	double receiver_cpu_s;		/* Negative if not available */
+	double process_cpu_s;		/* Negative if not available */
+} ArvBenchRun;
+
+/* Option parsing */
+
+static GArray *
+_parse_double_list (const char *string)
+{
+	GArray *array = g_array_new (FALSE, FALSE, sizeof (double));
+	char **tokens;
+	unsigned i;
+
+	tokens = g_strsplit (string, ",", -1);
+	for (i = 0; tokens[i] != NULL; i++) {
+		char *end;
+		double value = g_ascii_strtod (tokens[i], &end);
+
+		if (end == tokens[i] || *end != '\0' || value < 0.0) {
+			g_strfreev (tokens);
+			g_array_unref (array);
+			return NULL;
+		}
+		g_array_append_val (array, value);
+	}
+	g_strfreev (tokens);
+
+	return array;
+}
+
+static GArray *
+_parse_frame_size_list (const char *string)
+{
+	GArray *array = g_array_new (FALSE, FALSE, sizeof (guint) * 2);
+	char **tokens;
+	unsigned i;
+
+	tokens = g_strsplit (string, ",", -1);
+	for (i = 0; tokens[i] != NULL; i++) {
+		guint size[2];
+
+		if (sscanf (tokens[i], "%ux%u", &size[0], &size[1]) != 2 || size[0] == 0 || size[1] == 0) {
+			g_strfreev (tokens);
+			g_array_unref (array);
+			return NULL;
+		}
+		g_array_append_val (array, size);
+	}
+	g_strfreev (tokens);
+
+	return array;
+}
+
+static GPtrArray *
+_parse_backend_list (const char *string)
+{
+	GPtrArray *array = g_ptr_array_new ();
+	char **tokens;
+	unsigned i, j;
+
+	tokens = g_strsplit (string, ",", -1);
+	for (i = 0; tokens[i] != NULL; i++) {
+		for (j = 0; j < G_N_ELEMENTS (backends); j++)
+			if (g_strcmp0 (tokens[i], backends[j].name) == 0)
+				break;
+		if (j == G_N_ELEMENTS (backends)) {
+			g_strfreev (tokens);
+			g_ptr_array_unref (array);
+			return NULL;
+		}
+		g_ptr_array_add (array, (gpointer) &backends[j]);
+	}
+	g_strfreev (tokens);
+
+	return array;
+}
+
+/* CPU time measurement */
+
+static double
+_get_process_cpu_time (void)
+{
+#ifdef G_OS_UNIX
+	struct rusage usage;
+
+	if (getrusage (RUSAGE_SELF, &usage) == 0)
+		return (double) usage.ru_utime.tv_sec + (double) usage.ru_utime.tv_usec / 1e6 +
+			(double) usage.ru_stime.tv_sec + (double) usage.ru_stime.tv_usec / 1e6;
+#endif
+	return -1.0;
+}
+
+/* Sum of the user and system times of the threads of this process with the given name */
+
+static double
+_get_thread_cpu_time (const char *thread_name)
+{
+#ifdef __linux__
+	GDir *dir;
+	const char *tid;
+	guint64 n_ticks = 0;
+	gboolean found = FALSE;
+
+	dir = g_dir_open ("/proc/self/task", 0, NULL);
+	if (dir == NULL)
+		return -1.0;
+
+	while ((tid = g_dir_read_name (dir)) != NULL) {
+		char *path;
+		char *comm = NULL;
+		char *stat = NULL;
+
+		path = g_build_filename ("/proc/self/task", tid, "comm", NULL);
+		g_file_get_contents (path, &comm, NULL, NULL);
+		g_free (path);
+
+		if (comm != NULL && g_strcmp0 (g_strchomp (comm), thread_name) == 0) {
+			path = g_build_filename ("/proc/self/task", tid, "stat", NULL);
+			g_file_get_contents (path, &stat, NULL, NULL);
+			g_free (path);
+		}
+
+		/* utime and stime are the 14th and 15th fields, the thread name in the 2nd one may contain spaces */
+		if (stat != NULL) {
+			const char *fields = strrchr (stat, ')');
+			unsigned long utime, stime;
+
+			if (fields != NULL &&
+			    sscanf (fields + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+				    &utime, &stime) == 2) {
+				n_ticks += utime + stime;
+				found = TRUE;
+			}
+		}
+
+		g_free (comm);
+		g_free (stat);
+	}
+
+	g_dir_close (dir);
+
+	if (found)
+		return (double) n_ticks / (double) sysconf (_SC_CLK_TCK);
+#endif
+	return -1.0;
+}
+
+/* Benchmark run */
+
+static void
+_run (ArvCamera *camera, ArvGvFakeCamera *simulator, ArvBenchRun *run)
+{
+	ArvStream *stream;
+	GError *error = NULL;
+	size_t payload;
+	gint64 start_time;
+	gint64 end_time;
+	double process_cpu_start;
+	int i;
+
+	if (!run->backend->is_available ()) {
+		run->skip_reason = g_strdup ("backend not available");
+		return;
+	}
+
+	arv_camera_set_region (camera, 0, 0, run->width, run->height, &error);
+	if (error == NULL)
+		arv_camera_gv_set_packet_size (camera, run->packet_size, &error);
+	if (error == NULL)
+		arv_camera_set_frame_rate (camera, run->frame_rate, &error);
+	if (error != NULL) {
+		run->skip_reason = g_strdup (error->message);
+		g_clear_error (&error);
+		return;
+	}
+
+	arv_camera_gv_set_stream_options (camera, run->backend->options);
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	if (!ARV_IS_STREAM (stream)) {
+		run->skip_reason = g_strdup (error != NULL ? error->message : "stream creation failed");
+		g_clear_error (&error);
+		return;
+	}
+
+	g_object_set (stream, "packet-resend", ARV_GV_STREAM_PACKET_RESEND_ALWAYS, NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+	for (i = 0; i < arv_option_n_buffers; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	g_object_set (simulator, "gvsp-lost-ratio", run->loss_ratio, NULL);
+
+	process_cpu_start = _get_process_cpu_time ();
+	start_time = g_get_monotonic_time ();
+	end_time = start_time + (gint64) (arv_option_duration * 1e6);
+
+	arv_camera_start_acquisition (camera, &error);
+	if (error != NULL) {
+		run->skip_reason = g_strdup (error->message);
+		g_clear_error (&error);
+		g_object_unref (stream);
+		g_object_set (simulator, "gvsp-lost-ratio", 0.0, NULL);
+		return;
+	}
+
+	while (g_get_monotonic_time () < end_time) {
+		ArvBuffer *buffer;
+
+		buffer = arv_stream_timeout_pop_buffer (stream, 100000);
+		if (buffer == NULL)
+			continue;
+
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS)
+			run->n_completed++;
+		else
+			run->n_failures++;
+
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	run->duration_s = (double) (g_get_monotonic_time () - start_time) / 1e6;
+	run->receiver_cpu_s = _get_thread_cpu_time (ARV_BENCH_STREAM_THREAD_NAME);
+	run->process_cpu_s = process_cpu_start >= 0.0 ? _get_process_cpu_time () - process_cpu_start : -1.0;
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	run->n_underruns = arv_stream_get_info_uint64_by_name (stream, "n_underruns");
+	run->n_missing_frames = arv_stream_get_info_uint64_by_name (stream, "n_missing_frames");
+	run->n_missing_packets = arv_stream_get_info_uint64_by_name (stream, "n_missing_packets");
+	run->n_resend_requests = arv_stream_get_info_uint64_by_name (stream, "n_resend_requests");
+	run->n_resent_packets = arv_stream_get_info_uint64_by_name (stream, "n_resent_packets");
+	run->n_transferred_bytes = arv_stream_get_info_uint64_by_name (stream, "n_transferred_bytes");
+
+	g_object_unref (stream);
+
+	g_object_set (simulator, "gvsp-lost-ratio", 0.0, NULL);
+}
+
+/* JSON output. Doubles are printed in the C locale, and non available values as null. */
+
+static void
+_append_double (GString *string, const char *name, double value, gboolean is_available)
+{
+	char buffer[G_ASCII_DTOSTR_BUF_SIZE];
+
+	if (is_available)
+		g_string_append_printf (string, ",\n\t\t\t\"%s\": %s", name,
+					g_ascii_formatd (buffer, sizeof (buffer), "%.6g", value));
+	else
+		g_string_append_printf (string, ",\n\t\t\t\"%s\": null", name);
+}
+
+static void
+_append_uint64 (GString *string, const char *name, guint64 value)
+{
+	g_string_append_printf (string, ",\n\t\t\t\"%s\": %" G_GUINT64_FORMAT, name, value);
+}
+
+static void
+_append_run (GString *string, const ArvBenchRun *run)
+{
+	char *escaped;
+
+	g_string_append_printf (string, "\t\t{\n\t\t\t\"backend\": \"%s\"", run->backend->name);
+	_append_uint64 (string, "width", run->width);
+	_append_uint64 (string, "height", run->height);
+	_append_uint64 (string, "packet_size", run->packet_size);
+	_append_double (string, "frame_rate", run->frame_rate, TRUE);
+	_append_double (string, "loss_ratio", run->loss_ratio, TRUE);
+
+	if (run->skip_reason != NULL) {
+		escaped = g_strescape (run->skip_reason, NULL);
+		g_string_append_printf (string, ",\n\t\t\t\"status\": \"skipped\",\n\t\t\t\"reason\": \"%s\"\n\t\t}",
+					escaped);
+		g_free (escaped);
+		return;
+	}
+
+	g_string_append (string, ",\n\t\t\t\"status\": \"ok\"");
+	_append_double (string, "duration", run->duration_s, TRUE);
+	_append_double (string, "frames_per_second", run->n_completed / run->duration_s, TRUE);
+	_append_double (string, "gbits_per_second", 8.0 * run->n_transferred_bytes / run->duration_s / 1e9, TRUE);
+	_append_double (string, "receiver_cpu_per_frame_us", 1e6 * run->receiver_cpu_s / run->n_completed,
+			run->receiver_cpu_s >= 0.0 && run->n_completed > 0);
+	_append_double (string, "process_cpu_per_frame_us", 1e6 * run->process_cpu_s / run->n_completed,
+			run->process_cpu_s >= 0.0 && run->n_completed > 0);
+	_append_uint64 (string, "n_completed_buffers", run->n_completed);
+	_append_uint64 (string, "n_failures", run->n_failures);
+	_append_uint64 (string, "n_underruns", run->n_underruns);
+	_append_uint64 (string, "n_missing_frames", run->n_missing_frames);
+	_append_uint64 (string, "n_missing_packets", run->n_missing_packets);
+	_append_uint64 (string, "n_resend_requests", run->n_resend_requests);
+	_append_uint64 (string, "n_resent_packets", run->n_resent_packets);
+	_append_uint64 (string, "n_transferred_bytes", run->n_transferred_bytes);
+	g_string_append (string, "\n\t\t}");
+}
+
+int
+main (int argc, char **argv)
+{
+	GOptionContext *context;
+	GError *error = NULL;
+	ArvGvFakeCamera *simulator;
+	ArvCamera *camera;
+	GPtrArray *backend_list;
+	GArray *frame_sizes;
+	GArray *packet_sizes;
+	GArray *frame_rates;
+	GArray *loss_ratios;
+	GString *json;
+	unsigned b, s, p, r, l;
+	int n_runs = 0;
+	int status = EXIT_SUCCESS;
+
+	context = g_option_context_new (NULL);
+	g_option_context_set_summary (context, "End-to-end GigE Vision acquisition benchmark, using a fake camera.");
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		g_print ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	backend_list = _parse_backend_list (arv_option_backends);
+	frame_sizes = _parse_frame_size_list (arv_option_frame_sizes);
+	packet_sizes = _parse_double_list (arv_option_packet_sizes);
+	frame_rates = _parse_double_list (arv_option_frame_rates);
+	loss_ratios = _parse_double_list (arv_option_loss_ratios);
+
+	if (backend_list == NULL || frame_sizes == NULL || packet_sizes == NULL || frame_rates == NULL ||
+	    loss_ratios == NULL || arv_option_duration <= 0.0 || arv_option_n_buffers < 1) {
+		g_print ("Invalid benchmark parameters.\n");
+		status = EXIT_FAILURE;
+		goto parameter_error;
+	}
+
+	simulator = arv_gv_fake_camera_new ("127.0.0.1", ARV_BENCH_SERIAL_NUMBER);
+	camera = arv_camera_new (ARV_BENCH_DEVICE_ID, &error);
+	if (!ARV_IS_CAMERA (camera)) {
+		g_print ("Failed to connect to the fake camera: %s\n", error != NULL ? error->message : "unknown error");
+		g_clear_error (&error);
+		g_object_unref (simulator);
+		status = EXIT_FAILURE;
+		goto parameter_error;
+	}
+
+	arv_camera_set_acquisition_mode (camera, ARV_ACQUISITION_MODE_CONTINUOUS, NULL);
+
+	json = g_string_new ("{\n");
+	g_string_append_printf (json, "\t\"aravis_version\": \"%s\",\n", ARAVIS_VERSION);
+	g_string_append (json, "\t\"runs\": [\n");
+
+	for (b = 0; b < backend_list->len; b++)
+	for (s = 0; s < frame_sizes->len; s++)
+	for (p = 0; p < packet_sizes->len; p++)
+	for (r = 0; r < frame_rates->len; r++)
+	for (l = 0; l < loss_ratios->len; l++) {
+		ArvBenchRun run = {0};
+		guint *size = &g_array_index (frame_sizes, guint, 2 * s);
+
+		run.backend = g_ptr_array_index (backend_list, b);
+		run.width = size[0];
+		run.height = size[1];
+		run.packet_size = g_array_index (packet_sizes, double, p);
+		run.frame_rate = g_array_index (frame_rates, double, r);
+		run.loss_ratio = g_array_index (loss_ratios, double, l);
+
+		g_printerr ("%s %ux%u, %u bytes packets, %g fps, %g loss\n",
+			    run.backend->name, run.width, run.height, run.packet_size,
+			    run.frame_rate, run.loss_ratio);
+
+		_run (camera, simulator, &run);
+
+		if (n_runs++ > 0)
+			g_string_append (json, ",\n");
+		_append_run (json, &run);
+
+		g_free (run.skip_reason);
+	}
+
+	g_string_append (json, "\n\t]\n}\n");
+
+	if (arv_option_output != NULL) {
+		if (!g_file_set_contents (arv_option_output, json->str, json->len, &error)) {
+			g_print ("Failed to write %s: %s\n", arv_option_output, error->message);
+			g_clear_error (&error);
+			status = EXIT_FAILURE;
+		}
+	} else
+		fputs (json->str, stdout);
+
+	g_string_free (json, TRUE);
+
+	g_object_unref (camera);
+	g_object_unref (simulator);
+
+parameter_error:
+	g_clear_pointer (&backend_list, g_ptr_array_unref);
+	g_clear_pointer (&frame_sizes, g_array_unref);
+	g_clear_pointer (&packet_sizes, g_array_unref);
+	g_clear_pointer (&frame_rates, g_array_unref);
+	g_clear_pointer (&loss_ratios, g_array_unref);
+
+	arv_shutdown ();
+
+	return status;
+}
@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* Reports the heap usage of the GenICam DOM for a set of XML files. Run it on two builds for a before/after
+ * comparison, for example:
+ *
+ * arv-dom-memory-test -n 32 tests/data/genicam.xml src/arv-fake-camera.xml */
+
+#include <arv.h>
+#include <stdlib.h>
+
+#if defined (__GLIBC__) && defined (__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 33)
+#include <malloc.h>
+#define ARV_HAVE_MALLINFO2 1
+#endif
+#endif
+
+static char **arv_option_filenames = NULL;
+static char *arv_option_debug_domains = NULL;
+static int arv_option_n_documents = 8;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{ G_OPTION_REMAINING,	' ', 0, G_OPTION_ARG_FILENAME_ARRAY,
+		&arv_option_filenames,		NULL, NULL},
+	{ "n-documents",	'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_documents,	"Number of documents loaded simultaneously", NULL },
+	{ "debug", 		'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 	"Debug mode", NULL },
+	{ NULL }
+};
+
+static size_t
+_get_heap_size (void)
+{
+#ifdef ARV_HAVE_MALLINFO2
+	struct mallinfo2 info = mallinfo2 ();
+
+	return info.uordblks + info.hblkhd;
+#else
+	return 0;
+#endif
+}
+
+static void
+_count_nodes (ArvDomNode *node, unsigned int *n_nodes, unsigned int *n_text_nodes)
+{
+	ArvDomNode *iter;
+
+	(*n_nodes)++;
+	if (ARV_IS_DOM_TEXT (node))
+		(*n_text_nodes)++;
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		_count_nodes (iter, n_nodes, n_text_nodes);
+}
+
+int
+main (int argc, char **argv)
+{
+	GOptionContext *context;
+	GError *error = NULL;
+	int i;
+
+	context = g_option_context_new (NULL);
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		g_print ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	if (arv_option_filenames == NULL) {
+		g_print ("Missing input filename.\n");
+		return EXIT_FAILURE;
+	}
+
+	if (arv_option_n_documents < 1)
+		arv_option_n_documents = 1;
+
+#ifndef ARV_HAVE_MALLINFO2
+	g_print ("Heap statistics are not available on this platform\n");
+#endif
+
+	for (i = 0; arv_option_filenames[i] != NULL; i++) {
+		ArvGc **genicams;
+		char *xml = NULL;
+		size_t size;
+		size_t heap_size;
+		unsigned int n_nodes = 0;
+		unsigned int n_text_nodes = 0;
+		gint64 start;
+		gint64 duration;
+		int j;
+
+		if (!g_file_get_contents (arv_option_filenames[i], &xml, &size, NULL)) {
+			g_print ("File '%s' not found.\n", arv_option_filenames[i]);
+			continue;
+		}
+
+		genicams = g_new0 (ArvGc *, arv_option_n_documents);
+
+		heap_size = _get_heap_size ();
+		start = g_get_monotonic_time ();
+
+		for (j = 0; j < arv_option_n_documents; j++)
+			genicams[j] = arv_gc_new (NULL, xml, size);
+
+		duration = g_get_monotonic_time () - start;
+		heap_size = _get_heap_size () - heap_size;
+
+		_count_nodes (ARV_DOM_NODE (genicams[0]), &n_nodes, &n_text_nodes);
+
+		g_print ("%s (%" G_GSIZE_FORMAT " bytes)\n", arv_option_filenames[i], size);
+		g_print ("  nodes per document:       %u (%u text nodes)\n", n_nodes, n_text_nodes);
+#ifdef ARV_HAVE_MALLINFO2
+		g_print ("  heap per document:        %" G_GSIZE_FORMAT " bytes\n",
+			 heap_size / arv_option_n_documents);
+		g_print ("  heap per node:            %.1f bytes\n",
+			 (double) heap_size / arv_option_n_documents / n_nodes);
+#endif
+		g_print ("  load time per document:   %.3f ms\n",
+			 (double) duration / arv_option_n_documents / 1000.0);
+
+		for (j = 0; j < arv_option_n_documents; j++)
+			g_clear_object (&genicams[j]);
+		g_free (genicams);
+		g_free (xml);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* Evaluator microbenchmark. For each formula, it reports the time of a parse and evaluation cycle, of an
+ * evaluation of the already compiled expression, and of an evaluation preceded by the update of the variables,
+ * either by name or by slot, as done by the SwissKnife and Converter nodes. The "parse + evaluate" and "set by
+ * name" lines only use the public API, and can be compared with the same numbers on an older build, for example:
+ *
+ * arv-evaluator-bench -n 1000000 */
+
+#include <arv.h>
+#include <arvevaluatorprivate.h>
+#include <stdlib.h>
+
+static char *arv_option_debug_domains = NULL;
+static int arv_option_n_iterations = 200000;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{ "n-iterations",	'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_iterations,	"Number of evaluations per formula", NULL },
+	{ "debug", 		'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 	"Debug mode", NULL },
+	{ NULL }
+};
+
+/* Formulas from the evaluator tests, followed by formulas using variables, typical of SwissKnife and Converter
+ * nodes */
+
+static const char *constant_formulas[] = {
+	"10+2",
+	"(24+2)*2",
+	"24+2*8",
+	"1=1?1:0",
+	"10.1-8.1",
+	"2.5*4",
+	"10/4",
+	"4*-3",
+	"2**10*2",
+	"LN(E)",
+	"SQRT(16)",
+	"TRUNC(-11.9)",
+	"ROUND(10.11, 1)",
+	"SGN(-2.0)",
+	"(2=2)&&(1=1)",
+	"16>>4",
+	"COS(PI)",
+	"SIN(-PI/2)",
+	"ABS(-10000000000)",
+	"(0 & 1)=0?((0 & 1)+2):1",
+	"(4/(20/10000))",
+	"(~(~0xC2000221|0xFEFFFFFF)) ? 2:0"
+};
+
+static const char *variable_formulas[] = {
+	"A*B+C",
+	"(A+B)*C/(D+1)",
+	"(A & 0xff) << 8 | (B & 0xff)",
+	"A>B ? A-B : B-A",
+	"TO*2.5/(C+1)",
+	"FROM*(D+1)/2.5",
+	"ROUND(TO/3.0, 2)"
+};
+
+static const char *variable_names[] = {"A", "B", "C", "D", "TO", "FROM"};
+
+static void
+_print_time (const char *label, gint64 duration, int n_iterations)
+{
+	g_print ("  %-24s %8.1f ns\n", label, 1000.0 * (double) duration / (double) n_iterations);
+}
+
+static double
+_benchmark_formula (const char *formula, gboolean with_variables)
+{
+	ArvEvaluator *evaluator;
+	GError *error = NULL;
+	guint slots[G_N_ELEMENTS (variable_names)];
+	gint64 start;
+	double result = 0.0;
+	int n_iterations = arv_option_n_iterations;
+	int i;
+	guint j;
+
+	evaluator = arv_evaluator_new (formula);
+
+	for (j = 0; j < G_N_ELEMENTS (variable_names); j++) {
+		slots[j] = arv_evaluator_get_variable_slot (evaluator, variable_names[j]);
+		arv_evaluator_set_int64_variable (evaluator, variable_names[j], j + 1);
+	}
+
+	g_print ("%s\n", formula);
+
+	start = g_get_monotonic_time ();
+	for (i = 0; i < n_iterations / 10; i++) {
+		arv_evaluator_set_expression (evaluator, NULL);
+		arv_evaluator_set_expression (evaluator, formula);
+		result += arv_evaluator_evaluate_as_double (evaluator, NULL);
+	}
+	_print_time ("parse + evaluate", g_get_monotonic_time () - start, n_iterations / 10);
+
+	start = g_get_monotonic_time ();
+	for (i = 0; i < n_iterations; i++)
+		result += arv_evaluator_evaluate_as_double (evaluator, NULL);
+	_print_time ("evaluate (double)", g_get_monotonic_time () - start, n_iterations);
+
+	/* Some functions are not allowed in integer mode */
+	arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	if (error == NULL) {
+		start = g_get_monotonic_time ();
+		for (i = 0; i < n_iterations; i++)
+			result += arv_evaluator_evaluate_as_int64 (evaluator, NULL);
+		_print_time ("evaluate (int64)", g_get_monotonic_time () - start, n_iterations);
+	} else
+		g_clear_error (&error);
+
+	if (with_variables) {
+		start = g_get_monotonic_time ();
+		for (i = 0; i < n_iterations; i++) {
+			for (j = 0; j < G_N_ELEMENTS (variable_names); j++)
+				arv_evaluator_set_int64_variable (evaluator, variable_names[j], i + j);
+			result += arv_evaluator_evaluate_as_double (evaluator, NULL);
+		}
+		_print_time ("set by name + evaluate", g_get_monotonic_time () - start, n_iterations);
+
+		start = g_get_monotonic_time ();
+		for (i = 0; i < n_iterations; i++) {
+			for (j = 0; j < G_N_ELEMENTS (variable_names); j++)
+				arv_evaluator_set_int64_variable_by_slot (evaluator, slots[j], i + j);
+			result += arv_evaluator_evaluate_as_double (evaluator, NULL);
+		}
+		_print_time ("set by slot + evaluate", g_get_monotonic_time () - start, n_iterations);
+	}
+
+	g_object_unref (evaluator);
+
+	return result;
+}
+
+int
+main (int argc, char **argv)
+{
+	GOptionContext *context;
+	GError *error = NULL;
+	gint64 start;
+	double result = 0.0;
+	guint i;
+
+	context = g_option_context_new (NULL);
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		g_print ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	if (arv_option_n_iterations < 10) {
+		g_print ("Invalid number of iterations.\n");
+		return EXIT_FAILURE;
+	}
+
+	start = g_get_monotonic_time ();
+
+	for (i = 0; i < G_N_ELEMENTS (constant_formulas); i++)
+		result += _benchmark_formula (constant_formulas[i], FALSE);
+
+	for (i = 0; i < G_N_ELEMENTS (variable_formulas); i++)
+		result += _benchmark_formula (variable_formulas[i], TRUE);
+
+	g_print ("Total time: %.3f s (checksum %g)\n",
+		 (double) (g_get_monotonic_time () - start) / 1e6, result);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,517 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* GenICam engine microbenchmark. For each genicam document given on the command line, and for a synthetic
+ * document of configurable size, it reports the time of the document creation (xml parsing and node graph build),
+ * of the lazy document creation, of the materialization of all the nodes of a lazy document, of the node lookups
+ * using arv_gc_get_node(), and of integer, float and enumeration accesses through SwissKnife and Converter chains,
+ * against a fake device. The results are printed as JSON, for example:
+ *
+ * arv-gc-bench tests/data/genicam.xml src/arv-fake-camera.xml -s 5000 -o gc-bench.json
+ *
+ * Each benchmark is repeated, doubling the number of iterations, until it lasts at least the minimum duration. */
+
+#include <arv.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+static int arv_option_n_synthetic_features = 2000;
+static double arv_option_min_duration = 0.2;
+static char *arv_option_output = NULL;
+static char *arv_option_debug_domains = NULL;
+static char **arv_option_filenames = NULL;
+
+static guint n_results = 0;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{ "synthetic-features",	's', 0, G_OPTION_ARG_INT,
+		&arv_option_n_synthetic_features,	"Number of features of the synthetic document (0 to disable)", NULL },
+	{ "min-duration",	't', 0, G_OPTION_ARG_DOUBLE,
+		&arv_option_min_duration,		"Minimum duration of each benchmark, in seconds", NULL },
+	{ "output",		'o', 0, G_OPTION_ARG_FILENAME,
+		&arv_option_output,			"JSON output file (default: stdout)", NULL },
+	{ "debug", 		'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 		"Debug mode", NULL },
+	{ G_OPTION_REMAINING,	0, 0, G_OPTION_ARG_FILENAME_ARRAY,
+		&arv_option_filenames,			NULL, "<genicam.xml> ..." },
+	{ NULL }
+};
+
+/* Features accessed by the value benchmarks, for the known documents */
+
+typedef struct {
+	const char *basename;
+	const char *integer_get;
+	const char *integer_set;
+	gint64 integer_values[2];
+	const char *float_node;
+	double float_values[2];
+	const char *enumeration;
+	const char *entries[2];
+} ArvGcBenchFeatures;
+
+static const ArvGcBenchFeatures known_features[] = {
+	{ "genicam.xml",
+		"IntSwissKnifeTestSubAndConstant",	"IntConverter",	{100, 200},
+		"Converter",	{10.0, 20.0},
+		"Enumeration",	{"Entry0", "Entry1"} },
+	{ "arv-fake-camera.xml",
+		"PayloadSize",			"Width",	{512, 640},
+		"AcquisitionFrameRate",	{10.0, 20.0},
+		"AcquisitionMode",	{"Continuous", "SingleFrame"} }
+};
+
+#define ARV_GC_BENCH_SYNTHETIC_CHAIN_LENGTH	8
+#define ARV_GC_BENCH_SYNTHETIC_BASE_ADDRESS	0x8000
+#define ARV_GC_BENCH_SYNTHETIC_ADDRESS_RANGE	0x4000
+
+typedef struct {
+	ArvDevice *device;
+	const char *xml;
+	size_t size;
+	ArvGc *genicam;
+	GPtrArray *names;
+	ArvGcNode *node;
+	const ArvGcBenchFeatures *features;
+	guint iteration;
+} ArvGcBenchData;
+
+typedef void (*ArvGcBenchFunc) (ArvGcBenchData *data);
+
+/* Synthetic document. Each feature is an integer register, read through chains of SwissKnifes, a Converter and an
+ * Enumeration. */
+
+static char *
+_build_synthetic_xml (int n_features, size_t *size)
+{
+	GString *xml;
+	int i;
+
+	xml = g_string_new ("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+			    "<RegisterDescription ModelName=\"Synthetic\" VendorName=\"Aravis\" "
+			    "StandardNameSpace=\"None\" SchemaMajorVersion=\"1\" SchemaMinorVersion=\"0\" "
+			    "SchemaSubMinorVersion=\"0\" MajorVersion=\"1\" MinorVersion=\"0\" SubMinorVersion=\"0\" "
+			    "ProductGuid=\"0\" VersionGuid=\"0\" "
+			    "xmlns=\"http://www.genicam.org/GenApi/Version_1_0\">\n");
+
+	g_string_append (xml, "<Category Name=\"Root\" NameSpace=\"Standard\">\n");
+	for (i = 0; i < n_features; i++)
+		g_string_append_printf (xml, "<pFeature>Value%d</pFeature>\n", i);
+	g_string_append (xml, "</Category>\n");
+
+	for (i = 0; i < n_features; i++) {
+		g_string_append_printf (xml,
+					"<IntReg Name=\"Register%d\">\n"
+					"<Address>0x%x</Address>\n"
+					"<Length>4</Length>\n"
+					"<AccessMode>RW</AccessMode>\n"
+					"<pPort>Device</pPort>\n"
+					"<Sign>Unsigned</Sign>\n"
+					"<Endianess>LittleEndian</Endianess>\n"
+					"</IntReg>\n"
+					"<Integer Name=\"Value%d\">\n"
+					"<pValue>Register%d</pValue>\n"
+					"<Min>0</Min>\n"
+					"<Max>1000000</Max>\n"
+					"</Integer>\n",
+					i,
+					ARV_GC_BENCH_SYNTHETIC_BASE_ADDRESS +
+					(4 * i) % ARV_GC_BENCH_SYNTHETIC_ADDRESS_RANGE,
+					i, i);
+
+		if (i % ARV_GC_BENCH_SYNTHETIC_CHAIN_LENGTH == 0)
+			g_string_append_printf (xml,
+						"<IntSwissKnife Name=\"SwissKnife%d\">\n"
+						"<pVariable Name=\"V\">Value%d</pVariable>\n"
+						"<Formula>V * 2 + 1</Formula>\n"
+						"</IntSwissKnife>\n",
+						i, i);
+		else
+			g_string_append_printf (xml,
+						"<IntSwissKnife Name=\"SwissKnife%d\">\n"
+						"<pVariable Name=\"V\">Value%d</pVariable>\n"
+						"<pVariable Name=\"P\">SwissKnife%d</pVariable>\n"
+						"<Formula>(V &amp; 0xff) + P * 2</Formula>\n"
+						"</IntSwissKnife>\n",
+						i, i, i - 1);
+
+		g_string_append_printf (xml,
+					"<Converter Name=\"Converter%d\">\n"
+					"<FormulaTo>FROM * 0.5</FormulaTo>\n"
+					"<FormulaFrom>TO * 2.0</FormulaFrom>\n"
+					"<pValue>Value%d</pValue>\n"
+					"</Converter>\n"
+					"<Enumeration Name=\"Enumeration%d\">\n"
+					"<EnumEntry Name=\"Entry0\"><Value>0</Value></EnumEntry>\n"
+					"<EnumEntry Name=\"Entry1\"><Value>1</Value></EnumEntry>\n"
+					"<EnumEntry Name=\"Entry2\"><Value>2</Value></EnumEntry>\n"
+					"<EnumEntry Name=\"Entry3\"><Value>3</Value></EnumEntry>\n"
+					"<pValue>Value%d</pValue>\n"
+					"</Enumeration>\n",
+					i, i, i, i);
+	}
+
+	g_string_append (xml,
+			 "<Port Name=\"Device\" NameSpace=\"Standard\"></Port>\n"
+			 "</RegisterDescription>\n");
+
+	*size = xml->len;
+
+	return g_string_free (xml, FALSE);
+}
+
+static ArvGcBenchFeatures *
+_new_synthetic_features (int n_features)
+{
+	ArvGcBenchFeatures *features = g_new0 (ArvGcBenchFeatures, 1);
+	int last;
+
+	/* Last SwissKnife of the last complete chain */
+	last = ((n_features / ARV_GC_BENCH_SYNTHETIC_CHAIN_LENGTH) * ARV_GC_BENCH_SYNTHETIC_CHAIN_LENGTH) - 1;
+	if (last < 0)
+		last = n_features - 1;
+
+	features->basename = "synthetic";
+	features->integer_get = g_strdup_printf ("SwissKnife%d", last);
+	features->integer_set = "Value0";
+	features->integer_values[0] = 1;
+	features->integer_values[1] = 2;
+	features->float_node = "Converter0";
+	features->float_values[0] = 10.0;
+	features->float_values[1] = 20.0;
+	features->enumeration = "Enumeration0";
+	features->entries[0] = "Entry0";
+	features->entries[1] = "Entry1";
+
+	return features;
+}
+
+/* Names of the nodes of a document, for the lookup benchmarks. Only the names actually resolving to a node are
+ * kept. */
+
+static GPtrArray *
+_dup_node_names (ArvGc *genicam, const char *xml)
+{
+	GPtrArray *names = g_ptr_array_new_with_free_func (g_free);
+	GRegex *regex;
+	GMatchInfo *match_info;
+
+	regex = g_regex_new ("<(\\w+)\\s+Name=\"([^\"]+)\"", 0, 0, NULL);
+	g_regex_match (regex, xml, 0, &match_info);
+	while (g_match_info_matches (match_info)) {
+		char *tag = g_match_info_fetch (match_info, 1);
+		char *name = g_match_info_fetch (match_info, 2);
+
+		if (g_strcmp0 (tag, "EnumEntry") != 0 &&
+		    g_strcmp0 (tag, "pVariable") != 0 &&
+		    g_strcmp0 (tag, "Constant") != 0 &&
+		    g_strcmp0 (tag, "Expression") != 0 &&
+		    arv_gc_get_node (genicam, name) != NULL)
+			g_ptr_array_add (names, name);
+		else
+			g_free (name);
+
+		g_free (tag);
+		g_match_info_next (match_info, NULL);
+	}
+	g_match_info_free (match_info);
+	g_regex_unref (regex);
+
+	return names;
+}
+
+/* Benchmarked operations */
+
+static void
+_build (ArvGcBenchData *data)
+{
+	g_object_unref (arv_gc_new (data->device, data->xml, data->size));
+}
+
+static void
+_build_lazy (ArvGcBenchData *data)
+{
+	g_object_unref (arv_gc_new_lazy (data->device, data->xml, data->size));
+}
+
+static void
+_materialize (ArvGcBenchData *data)
+{
+	ArvGc *genicam;
+	guint i;
+
+	genicam = arv_gc_new_lazy (data->device, data->xml, data->size);
+	for (i = 0; i < data->names->len; i++)
+		arv_gc_get_node (genicam, g_ptr_array_index (data->names, i));
+	g_object_unref (genicam);
+}
+
+static void
+_lookup (ArvGcBenchData *data)
+{
+	guint i;
+
+	for (i = 0; i < data->names->len; i++)
+		arv_gc_get_node (data->genicam, g_ptr_array_index (data->names, i));
+}
+
+static void
+_integer_get (ArvGcBenchData *data)
+{
+	arv_gc_integer_get_value (ARV_GC_INTEGER (data->node), NULL);
+}
+
+static void
+_integer_set (ArvGcBenchData *data)
+{
+	arv_gc_integer_set_value (ARV_GC_INTEGER (data->node),
+				  data->features->integer_values[data->iteration++ & 1], NULL);
+}
+
+static void
+_float_get (ArvGcBenchData *data)
+{
+	arv_gc_float_get_value (ARV_GC_FLOAT (data->node), NULL);
+}
+
+static void
+_float_set (ArvGcBenchData *data)
+{
+	arv_gc_float_set_value (ARV_GC_FLOAT (data->node),
+				data->features->float_values[data->iteration++ & 1], NULL);
+}
+
+static void
+_enumeration_set (ArvGcBenchData *data)
+{
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (data->node),
+					     data->features->entries[data->iteration++ & 1], NULL);
+}
+
+/* Measurement and JSON output */
+
+static void
+_measure (GString *json, const char *document, const char *benchmark,
+	  ArvGcBenchFunc func, ArvGcBenchData *data, guint n_items)
+{
+	char buffer[G_ASCII_DTOSTR_BUF_SIZE];
+	gint64 min_duration_us = arv_option_min_duration * 1e6;
+	gint64 duration_us;
+	guint64 n_iterations = 1;
+
+	if (n_items == 0)
+		return;
+
+	func (data);
+
+	for (;;) {
+		gint64 start = g_get_monotonic_time ();
+		guint64 i;
+
+		for (i = 0; i < n_iterations; i++)
+			func (data);
+		duration_us = g_get_monotonic_time () - start;
+
+		if (duration_us >= min_duration_us)
+			break;
+
+		n_iterations *= 2;
+	}
+
+	g_printerr ("%-24s %-28s %12.1f ns\n", document, benchmark,
+		    1000.0 * (double) duration_us / (double) (n_iterations * n_items));
+
+	g_string_append_printf (json,
+				"%s\t\t{\n"
+				"\t\t\t\"document\": \"%s\",\n"
+				"\t\t\t\"benchmark\": \"%s\",\n"
+				"\t\t\t\"n_iterations\": %" G_GUINT64_FORMAT ",\n"
+				"\t\t\t\"n_items\": %u,\n"
+				"\t\t\t\"ns_per_item\": %s\n"
+				"\t\t}",
+				n_results++ > 0 ? ",\n" : "",
+				document, benchmark, n_iterations, n_items,
+				g_ascii_formatd (buffer, sizeof (buffer), "%.1f",
+						 1000.0 * (double) duration_us / (double) (n_iterations * n_items)));
+}
+
+static ArvGcNode *
+_get_node (ArvGc *genicam, const char *name, GType type)
+{
+	ArvGcNode *node;
+
+	if (name == NULL)
+		return NULL;
+
+	node = arv_gc_get_node (genicam, name);
+	if (node == NULL || !G_TYPE_CHECK_INSTANCE_TYPE (node, type)) {
+		g_printerr ("Node '%s' not found, or of an unexpected type\n", name);
+		return NULL;
+	}
+
+	return node;
+}
+
+static void
+_benchmark_document (GString *json, ArvDevice *device, const char *document,
+		     const char *xml, size_t size, const ArvGcBenchFeatures *features)
+{
+	ArvGcBenchData data = {0};
+	unsigned i;
+
+	data.device = device;
+	data.xml = xml;
+	data.size = size;
+	data.features = features;
+	data.genicam = arv_gc_new (device, xml, size);
+
+	if (!ARV_IS_GC (data.genicam)) {
+		g_printerr ("Invalid genicam document '%s'\n", document);
+		return;
+	}
+
+	data.names = _dup_node_names (data.genicam, xml);
+
+	_measure (json, document, "build", _build, &data, 1);
+	_measure (json, document, "build_lazy", _build_lazy, &data, 1);
+	_measure (json, document, "materialize", _materialize, &data, data.names->len);
+	_measure (json, document, "lookup", _lookup, &data, data.names->len);
+
+	for (i = 0; features != NULL && i < 2; i++) {
+		ArvRegisterCachePolicy policy = i == 0 ? ARV_REGISTER_CACHE_POLICY_DISABLE :
+			ARV_REGISTER_CACHE_POLICY_ENABLE;
+		const char *suffix = policy == ARV_REGISTER_CACHE_POLICY_DISABLE ? "" : "_cached";
+		char *name;
+
+		arv_gc_set_register_cache_policy (data.genicam, policy);
+
+		if ((data.node = _get_node (data.genicam, features->integer_get, ARV_TYPE_GC_INTEGER)) != NULL) {
+			name = g_strconcat ("integer_get", suffix, NULL);
+			_measure (json, document, name, _integer_get, &data, 1);
+			g_free (name);
+		}
+		if ((data.node = _get_node (data.genicam, features->integer_set, ARV_TYPE_GC_INTEGER)) != NULL) {
+			name = g_strconcat ("integer_set", suffix, NULL);
+			_measure (json, document, name, _integer_set, &data, 1);
+			g_free (name);
+		}
+		if ((data.node = _get_node (data.genicam, features->float_node, ARV_TYPE_GC_FLOAT)) != NULL) {
+			name = g_strconcat ("float_get", suffix, NULL);
+			_measure (json, document, name, _float_get, &data, 1);
+			g_free (name);
+			name = g_strconcat ("float_set", suffix, NULL);
+			_measure (json, document, name, _float_set, &data, 1);
+			g_free (name);
+		}
+		if ((data.node = _get_node (data.genicam, features->enumeration, ARV_TYPE_GC_ENUMERATION)) != NULL) {
+			name = g_strconcat ("enumeration_set", suffix, NULL);
+			_measure (json, document, name, _enumeration_set, &data, 1);
+			g_free (name);
+		}
+	}
+
+	g_ptr_array_unref (data.names);
+	g_object_unref (data.genicam);
+}
+
+int
+main (int argc, char **argv)
+{
+	GOptionContext *context;
+	GError *error = NULL;
+	ArvDevice *device;
+	GString *json;
+	int status = EXIT_SUCCESS;
+	unsigned i, j;
+
+	context = g_option_context_new (NULL);
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		g_print ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	if (arv_option_min_duration <= 0.0 || arv_option_n_synthetic_features < 0) {
+		g_print ("Invalid benchmark parameters.\n");
+		return EXIT_FAILURE;
+	}
+
+	device = arv_fake_device_new ("Bench", &error);
+	if (!ARV_IS_DEVICE (device)) {
+		g_print ("Failed to create the fake device: %s\n", error != NULL ? error->message : "unknown error");
+		g_clear_error (&error);
+		return EXIT_FAILURE;
+	}
+
+	json = g_string_new ("{\n");
+	g_string_append_printf (json, "\t\"aravis_version\": \"%s\",\n", ARAVIS_VERSION);
+	g_string_append (json, "\t\"results\": [\n");
+
+	for (i = 0; arv_option_filenames != NULL && arv_option_filenames[i] != NULL; i++) {
+		const ArvGcBenchFeatures *features = NULL;
+		char *basename;
+		char *xml;
+		size_t size;
+
+		if (!g_file_get_contents (arv_option_filenames[i], &xml, &size, &error)) {
+			g_print ("Failed to load %s: %s\n", arv_option_filenames[i], error->message);
+			g_clear_error (&error);
+			status = EXIT_FAILURE;
+			continue;
+		}
+
+		basename = g_path_get_basename (arv_option_filenames[i]);
+		for (j = 0; j < G_N_ELEMENTS (known_features); j++)
+			if (g_strcmp0 (basename, known_features[j].basename) == 0)
+				features = &known_features[j];
+
+		_benchmark_document (json, device, basename, xml, size, features);
+
+		g_free (basename);
+		g_free (xml);
+	}
+
+	if (arv_option_n_synthetic_features > 0) {
+		ArvGcBenchFeatures *features;
+		char *document;
+		char *xml;
+		size_t size;
+
+		xml = _build_synthetic_xml (arv_option_n_synthetic_features, &size);
+		features = _new_synthetic_features (arv_option_n_synthetic_features);
+		document = g_strdup_printf ("synthetic-%d", arv_option_n_synthetic_features);
+
+		_benchmark_document (json, device, document, xml, size, features);
+
+		g_free ((char *) features->integer_get);
+		g_free (features);
+		g_free (document);
+		g_free (xml);
+	}
+
+	g_string_append (json, "\n\t]\n}\n");
+
+	if (arv_option_output != NULL) {
+		if (!g_file_set_contents (arv_option_output, json->str, json->len, &error)) {
+			g_print ("Failed to write %s: %s\n", arv_option_output, error->message);
+			g_clear_error (&error);
+			status = EXIT_FAILURE;
+		}
+	} else
+		fputs (json->str, stdout);
+
+	g_string_free (json, TRUE);
+	g_object_unref (device);
+
+	arv_shutdown ();
+
+	return status;
+}
@@ -0,0 +1,237 @@
+/* SPDX-License-Identifier:Unlicense */
+
+/* GVSP capture replay. The GVSP packets of a pcap or pcapng capture, as recorded by tcpdump or wireshark on a
+ * production line, are fed to an ArvGvStream, either as fast as possible or honouring the capture timestamps. The
+ * stream statistics and the outcome of each frame are reported as JSON, for example:
+ *
+ * tcpdump -i eth0 -w line.pcap udp
+ * arv-gvsp-replay line.pcap -o replay.json
+ *
+ * A GigE Vision fake camera is started on the loopback interface, for the creation of the stream only. Packet resend
+ * requests are accounted for in the statistics, but never sent. */
+
+#include <arv.h>
+#include <arvgvstreamprivate.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define ARV_GVSP_REPLAY_SERIAL_NUMBER	"Replay"
+#define ARV_GVSP_REPLAY_DEVICE_ID	"Aravis-" ARV_GVSP_REPLAY_SERIAL_NUMBER
+
+static gboolean arv_option_realtime = FALSE;
+static int arv_option_port = 0;
+static int arv_option_n_buffers = 16;
+static int arv_option_payload_size = 0;
+static char *arv_option_packet_resend = NULL;
+static int arv_option_packet_timeout = -1;
+static int arv_option_frame_retention = -1;
+static char *arv_option_output = NULL;
+static char *arv_option_debug_domains = NULL;
+
+static const GOptionEntry arv_option_entries[] =
+{
+	{ "realtime",		'r', 0, G_OPTION_ARG_NONE,
+		&arv_option_realtime,		"Honour the capture timestamps", NULL },
+	{ "port",		'p', 0, G_OPTION_ARG_INT,
+		&arv_option_port,		"UDP destination port of the stream (default: any but GVCP)", NULL },
+	{ "n-buffers",		'n', 0, G_OPTION_ARG_INT,
+		&arv_option_n_buffers,		"Number of stream buffers", NULL },
+	{ "payload-size",	's', 0, G_OPTION_ARG_INT,
+		&arv_option_payload_size,	"Buffer size (default: deduced from the capture)", NULL },
+	{ "packet-resend",	'm', 0, G_OPTION_ARG_STRING,
+		&arv_option_packet_resend,	"Packet resend mode", "{always|never}" },
+	{ "packet-timeout",	'k', 0, G_OPTION_ARG_INT,
+		&arv_option_packet_timeout,	"Packet timeout, in µs", NULL },
+	{ "frame-retention",	'e', 0, G_OPTION_ARG_INT,
+		&arv_option_frame_retention,	"Frame retention, in µs", NULL },
+	{ "output",		'o', 0, G_OPTION_ARG_FILENAME,
+		&arv_option_output,		"JSON output file (default: stdout)", NULL },
+	{ "debug", 		'd', 0, G_OPTION_ARG_STRING,
+		&arv_option_debug_domains, 	"Debug mode", NULL },
+	{ NULL }
+};
+
+typedef struct {
+	ArvStream *stream;
+	GString *frames;
+	guint n_frames;
+} ArvGvspReplayData;
+
+static void
+_stream_callback (void *user_data, ArvStreamCallbackType type, ArvBuffer *buffer)
+{
+	ArvGvspReplayData *data = user_data;
+	GEnumClass *enum_class;
+	GEnumValue *value;
+
+	if (type != ARV_STREAM_CALLBACK_TYPE_BUFFER_DONE || data->stream == NULL)
+		return;
+
+	enum_class = g_type_class_ref (ARV_TYPE_BUFFER_STATUS);
+	value = g_enum_get_value (enum_class, arv_buffer_get_status (buffer));
+
+	g_string_append_printf (data->frames,
+				"%s\t\t{\"frame_id\": %" G_GUINT64_FORMAT ", \"status\": \"%s\", "
+				"\"timestamp\": %" G_GUINT64_FORMAT "}",
+				data->n_frames > 0 ? ",\n" : "",
+				arv_buffer_get_frame_id (buffer),
+				value != NULL ? value->value_nick : "unknown",
+				arv_buffer_get_timestamp (buffer));
+	data->n_frames++;
+
+	g_type_class_unref (enum_class);
+
+	/* Recycle the buffer, which is also the last one of the output queue */
+	buffer = arv_stream_try_pop_buffer (data->stream);
+	if (buffer != NULL)
+		arv_stream_push_buffer (data->stream, buffer);
+}
+
+int
+main (int argc, char **argv)
+{
+	GOptionContext *context;
+	GError *error = NULL;
+	ArvGvFakeCamera *simulator = NULL;
+	ArvCamera *camera = NULL;
+	ArvGvspCapture *capture = NULL;
+	ArvGvspReplayData data = {0};
+	GString *json = NULL;
+	size_t payload_size;
+	gint64 start_time;
+	double duration_s;
+	unsigned i;
+	unsigned n_statistics;
+	int status = EXIT_SUCCESS;
+
+	context = g_option_context_new ("<capture file>");
+	g_option_context_set_summary (context, "Replay of a GVSP pcap or pcapng capture through an ArvGvStream.");
+	g_option_context_add_main_entries (context, arv_option_entries, NULL);
+
+	if (!g_option_context_parse (context, &argc, &argv, &error)) {
+		g_option_context_free (context);
+		g_print ("Option parsing failed: %s\n", error->message);
+		g_error_free (error);
+		return EXIT_FAILURE;
+	}
+
+	g_option_context_free (context);
+
+	if (argc != 2 || arv_option_n_buffers < 1 || arv_option_port < 0 || arv_option_port > 65535 ||
+	    (arv_option_packet_resend != NULL &&
+	     g_strcmp0 (arv_option_packet_resend, "always") != 0 &&
+	     g_strcmp0 (arv_option_packet_resend, "never") != 0)) {
+		g_print ("Invalid replay parameters.\n");
+		return EXIT_FAILURE;
+	}
+
+	arv_debug_enable (arv_option_debug_domains);
+
+	capture = arv_gvsp_capture_new (argv[1], arv_option_port, &error);
+	if (capture == NULL) {
+		g_print ("Failed to open %s: %s\n", argv[1], error->message);
+		g_clear_error (&error);
+		return EXIT_FAILURE;
+	}
+
+	payload_size = arv_option_payload_size > 0 ?
+		(size_t) arv_option_payload_size :
+		arv_gvsp_capture_get_payload_size_max (capture);
+	if (payload_size == 0) {
+		g_print ("No GVSP image data in %s\n", argv[1]);
+		status = EXIT_FAILURE;
+		goto capture_error;
+	}
+
+	simulator = arv_gv_fake_camera_new ("127.0.0.1", ARV_GVSP_REPLAY_SERIAL_NUMBER);
+	camera = arv_camera_new (ARV_GVSP_REPLAY_DEVICE_ID, &error);
+	if (!ARV_IS_CAMERA (camera)) {
+		g_print ("Failed to connect to the fake camera: %s\n", error != NULL ? error->message : "unknown error");
+		g_clear_error (&error);
+		status = EXIT_FAILURE;
+		goto capture_error;
+	}
+
+	data.frames = g_string_new (NULL);
+	data.stream = arv_camera_create_stream (camera, _stream_callback, &data, &error);
+	if (!ARV_IS_GV_STREAM (data.stream)) {
+		g_print ("Failed to create the stream: %s\n", error != NULL ? error->message : "unknown error");
+		g_clear_error (&error);
+		status = EXIT_FAILURE;
+		goto capture_error;
+	}
+
+	if (arv_option_packet_resend != NULL)
+		g_object_set (data.stream, "packet-resend",
+			      g_strcmp0 (arv_option_packet_resend, "never") == 0 ?
+			      ARV_GV_STREAM_PACKET_RESEND_NEVER :
+			      ARV_GV_STREAM_PACKET_RESEND_ALWAYS,
+			      NULL);
+	if (arv_option_packet_timeout >= 0)
+		g_object_set (data.stream, "packet-timeout", (guint) arv_option_packet_timeout, NULL);
+	if (arv_option_frame_retention >= 0)
+		g_object_set (data.stream, "frame-retention", (guint) arv_option_frame_retention, NULL);
+
+	for (i = 0; i < (unsigned) arv_option_n_buffers; i++)
+		arv_stream_push_buffer (data.stream, arv_buffer_new (payload_size, NULL));
+
+	start_time = g_get_monotonic_time ();
+
+	if (!arv_gv_stream_replay_capture (ARV_GV_STREAM (data.stream), capture, arv_option_realtime, &error)) {
+		g_print ("Replay failed: %s\n", error->message);
+		g_clear_error (&error);
+		status = EXIT_FAILURE;
+		goto capture_error;
+	}
+
+	duration_s = (g_get_monotonic_time () - start_time) / 1e6;
+
+	json = g_string_new ("{\n");
+	g_string_append_printf (json, "\t\"aravis_version\": \"%s\",\n", ARAVIS_VERSION);
+	g_string_append_printf (json, "\t\"n_packets\": %u,\n", arv_gvsp_capture_get_n_packets (capture));
+	g_string_append_printf (json, "\t\"packet_size\": %u,\n", arv_gvsp_capture_get_packet_size (capture));
+	g_string_append_printf (json, "\t\"payload_size\": %" G_GSIZE_FORMAT ",\n", payload_size);
+	{
+		char buffer[G_ASCII_DTOSTR_BUF_SIZE];
+
+		g_string_append_printf (json, "\t\"duration\": %s,\n",
+					g_ascii_formatd (buffer, sizeof (buffer), "%.6g", duration_s));
+	}
+	g_string_append (json, "\t\"statistics\": {");
+	for (i = 0, n_statistics = 0; i < arv_stream_get_n_infos (data.stream); i++) {
+		const char *name = arv_stream_get_info_name (data.stream, i);
+
+		if (arv_stream_get_info_type (data.stream, i) != G_TYPE_UINT64)
+			continue;
+
+		g_string_append_printf (json, "%s\n\t\t\"%s\": %" G_GUINT64_FORMAT, n_statistics++ > 0 ? "," : "",
+					name, arv_stream_get_info_uint64 (data.stream, i));
+	}
+	g_string_append (json, "\n");
+	g_string_append (json, "\t},\n\t\"frames\": [\n");
+	g_string_append (json, data.frames->str);
+	g_string_append (json, "\n\t]\n}\n");
+
+	if (arv_option_output != NULL) {
+		if (!g_file_set_contents (arv_option_output, json->str, json->len, &error)) {
+			g_print ("Failed to write %s: %s\n", arv_option_output, error->message);
+			g_clear_error (&error);
+			status = EXIT_FAILURE;
+		}
+	} else
+		fputs (json->str, stdout);
+
+capture_error:
+	if (json != NULL)
+		g_string_free (json, TRUE);
+	if (data.frames != NULL)
+		g_string_free (data.frames, TRUE);
+	g_clear_object (&data.stream);
+	g_clear_object (&camera);
+	g_clear_object (&simulator);
+	arv_gvsp_capture_free (capture);
+
+	arv_shutdown ();
+
+	return status;
+}
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier:Unlicense
+
+# Generator of the GVSP capture fixtures of the fakegv test:
+#
+# gvsp.pcap: pcap file, µs timestamps
+# gvsp-ns.pcapng: same packets, in a pcapng file with a ns interface timestamp resolution (if_tsresol = 9), and a
+# sub-µs part in the timestamps
+#
+# Both captures hold an Ethernet/IPv4/UDP GVCP packet, followed by 4 frames of 64x8 Mono8 pixels, sent in 128 byte
+# blocks, from port 20202 to port 50000. The second data block of the third frame is missing. The leader of each
+# frame is captured 1 ms after the previous packet, the other packets 50 µs after the previous one, from
+# 1700000000 s.
+#
+# Usage, from the tests/data directory: ./gvsp-capture.py
+
+import struct
+
+TIMESTAMP_BASE_US = 1700000000 * 1000000
+SUB_US_NS = 250
+
+WIDTH = 64
+HEIGHT = 8
+BLOCK_SIZE = 128
+N_FRAMES = 4
+MISSING_FRAME = 3
+MISSING_BLOCK = 2
+
+GVSP_SOURCE_PORT = 20202
+GVSP_DESTINATION_PORT = 50000
+GVCP_SOURCE_PORT = 50001
+GVCP_PORT = 3956
+
+PIXEL_FORMAT_MONO_8 = 0x01080001
+LINKTYPE_ETHERNET = 1
+
+def udp_frame (source_port, destination_port, payload):
+    ethernet = bytes.fromhex ('001122334455' '66778899aabb' '0800')
+    ip = struct.pack ('>BBHHHBBH4s4s', 0x45, 0, 20 + 8 + len (payload), 0, 0x4000, 64, 17, 0,
+                      bytes ([192, 168, 0, 2]), bytes ([192, 168, 0, 1]))
+    udp = struct.pack ('>HHHH', source_port, destination_port, 8 + len (payload), 0)
+    return ethernet + ip + udp + payload
+
+def gvsp_header (frame_id, content_type, packet_id):
+    return struct.pack ('>HHI', 0, frame_id, (content_type << 24) | packet_id)
+
+def packets ():
+    time_us = 0
+    yield time_us, udp_frame (GVCP_SOURCE_PORT, GVCP_PORT, bytes (16))
+
+    for frame_id in range (1, N_FRAMES + 1):
+        image = bytes ((frame_id + i) & 0xff for i in range (WIDTH * HEIGHT))
+        n_blocks = (len (image) + BLOCK_SIZE - 1) // BLOCK_SIZE
+
+        leader = gvsp_header (frame_id, 0x01, 0) + \
+            struct.pack ('>HHQIIIIIHH', 0, 0x0001, frame_id * 1000, PIXEL_FORMAT_MONO_8,
+                         WIDTH, HEIGHT, 0, 0, 0, 0)
+        time_us += 1000
+        yield time_us, udp_frame (GVSP_SOURCE_PORT, GVSP_DESTINATION_PORT, leader)
+
+        for block in range (1, n_blocks + 1):
+            time_us += 50
+            if frame_id == MISSING_FRAME and block == MISSING_BLOCK:
+                continue
+            data = gvsp_header (frame_id, 0x03, block) + image[(block - 1) * BLOCK_SIZE:block * BLOCK_SIZE]
+            yield time_us, udp_frame (GVSP_SOURCE_PORT, GVSP_DESTINATION_PORT, data)
+
+        trailer = gvsp_header (frame_id, 0x02, n_blocks + 1) + struct.pack ('>HHI', 0, 0x0001, HEIGHT)
+        time_us += 50
+        yield time_us, udp_frame (GVSP_SOURCE_PORT, GVSP_DESTINATION_PORT, trailer)
+
+def write_pcap (filename):
+    with open (filename, 'wb') as file:
+        file.write (struct.pack ('<IHHiIII', 0xa1b2c3d4, 2, 4, 0, 0, 65535, LINKTYPE_ETHERNET))
+        for time_us, frame in packets ():
+            timestamp_us = TIMESTAMP_BASE_US + time_us
+            file.write (struct.pack ('<IIII', timestamp_us // 1000000, timestamp_us % 1000000,
+                                     len (frame), len (frame)))
+            file.write (frame)
+
+def pcapng_block (block_type, body):
+    body += bytes (-len (body) % 4)
+    size = 12 + len (body)
+    return struct.pack ('<II', block_type, size) + body + struct.pack ('<I', size)
+
+def write_pcapng (filename):
+    with open (filename, 'wb') as file:
+        # Section header, unknown section length
+        file.write (pcapng_block (0x0a0d0d0a, struct.pack ('<IHHq', 0x1a2b3c4d, 1, 0, -1)))
+        # Interface description, with if_tsresol = 9 and the end of options
+        options = struct.pack ('<HHB3x', 9, 1, 9) + struct.pack ('<HH', 0, 0)
+        file.write (pcapng_block (0x00000001, struct.pack ('<HHI', LINKTYPE_ETHERNET, 0, 65535) + options))
+        for time_us, frame in packets ():
+            timestamp_ns = (TIMESTAMP_BASE_US + time_us) * 1000 + SUB_US_NS
+            file.write (pcapng_block (0x00000006,
+                                      struct.pack ('<IIIII', 0, timestamp_ns >> 32, timestamp_ns & 0xffffffff,
+                                                   len (frame), len (frame)) + frame))
+
+write_pcap ('gvsp.pcap')
+write_pcapng ('gvsp-ns.pcapng')
@@ -34,6 +34,99 @@ child_list_test (void)
         g_object_unref (device);
 }
 
+static ArvDomCharacterData *
+_get_property_text (ArvGc *genicam, const char *feature, const char *property)
+{
+	ArvDomNode *iter;
+
+	for (iter = arv_dom_node_get_first_child (ARV_DOM_NODE (arv_gc_get_node (genicam, feature)));
+	     iter != NULL;
+	     iter = arv_dom_node_get_next_sibling (iter))
+		if (g_strcmp0 (arv_dom_node_get_node_name (iter), property) == 0)
+			return ARV_DOM_CHARACTER_DATA (arv_dom_node_get_first_child (iter));
+
+	return NULL;
+}
+
+static void
+interned_string_test (void)
+{
+	ArvGc *genicam;
+	ArvDomCharacterData *sign_a;
+	ArvDomCharacterData *sign_c;
+	char *xml;
+	size_t size;
+
+	g_file_get_contents (GENICAM_FILENAME, &xml, &size, NULL);
+	g_assert (xml != NULL);
+
+	genicam = arv_gc_new (NULL, xml, size);
+	g_assert (ARV_IS_GC (genicam));
+
+	sign_a = _get_property_text (genicam, "IntRegisterA", "Sign");
+	sign_c = _get_property_text (genicam, "IntRegisterC", "Sign");
+	g_assert (ARV_IS_DOM_CHARACTER_DATA (sign_a));
+	g_assert (ARV_IS_DOM_CHARACTER_DATA (sign_c));
+
+	/* Identical text content share the same storage */
+	g_assert_cmpstr (arv_dom_character_data_get_data (sign_a), ==, "Unsigned");
+	g_assert (arv_dom_character_data_get_data (sign_a) == arv_dom_character_data_get_data (sign_c));
+
+	/* But can still be modified independently */
+	arv_dom_character_data_set_data (sign_a, "Signed");
+	g_assert_cmpstr (arv_dom_character_data_get_data (sign_a), ==, "Signed");
+	g_assert_cmpstr (arv_dom_character_data_get_data (sign_c), ==, "Unsigned");
+
+	g_assert_cmpstr (arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (arv_gc_get_node (genicam, "IntRegisterA"))),
+			 ==, "IntRegisterA");
+
+	g_object_unref (genicam);
+	g_free (xml);
+}
+
+static void
+interned_string_lifetime_test (void)
+{
+	ArvGc *genicam;
+	ArvDomNode *sign;
+	ArvDomCharacterData *text;
+	ArvDomDocument *document;
+	char *xml;
+	size_t size;
+
+	g_file_get_contents (GENICAM_FILENAME, &xml, &size, NULL);
+	g_assert (xml != NULL);
+
+	genicam = arv_gc_new (NULL, xml, size);
+	g_assert (ARV_IS_GC (genicam));
+
+	text = _get_property_text (genicam, "IntRegisterA", "Sign");
+	g_assert (ARV_IS_DOM_CHARACTER_DATA (text));
+	sign = arv_dom_node_get_parent_node (ARV_DOM_NODE (text));
+
+	/* Interned text moved out of its document, which is destroyed */
+	text = ARV_DOM_CHARACTER_DATA (arv_dom_node_remove_child (sign, ARV_DOM_NODE (text)));
+	g_assert (ARV_IS_DOM_CHARACTER_DATA (text));
+
+	g_object_unref (genicam);
+
+	g_assert_cmpstr (arv_dom_character_data_get_data (text), ==, "Unsigned");
+
+	/* The text holds the last reference to the pool, its data must outlive the switch to owned storage */
+	arv_dom_character_data_set_data (text, arv_dom_character_data_get_data (text));
+	g_assert_cmpstr (arv_dom_character_data_get_data (text), ==, "Unsigned");
+
+	/* And adopted by another one */
+	genicam = arv_gc_new (NULL, xml, size);
+	document = ARV_DOM_DOCUMENT (genicam);
+	sign = arv_dom_node_get_parent_node (ARV_DOM_NODE (_get_property_text (genicam, "IntRegisterC", "Sign")));
+	arv_dom_node_append_child (sign, ARV_DOM_NODE (text));
+	g_assert (arv_dom_node_get_owner_document (ARV_DOM_NODE (text)) == document);
+
+	g_object_unref (genicam);
+	g_free (xml);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -44,6 +137,8 @@ main (int argc, char *argv[])
 	arv_set_fake_camera_genicam_filename (GENICAM_FILENAME);
 
 	g_test_add_func ("/dom/child-list", child_list_test);
+	g_test_add_func ("/dom/interned-strings", interned_string_test);
+	g_test_add_func ("/dom/interned-string-lifetime", interned_string_lifetime_test);
 
 	result = g_test_run();
 
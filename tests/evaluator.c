@@ -2,6 +2,7 @@
 
 #include <glib.h>
 #include <arv.h>
+#include <arvevaluatorprivate.h>
 #include <math.h>
 
 typedef struct {
@@ -198,6 +199,55 @@ set_int64_variable_test (void)
 	g_object_unref (evaluator);
 }
 
+static void
+variable_slot_test (void)
+{
+	ArvEvaluator *evaluator;
+	GError *error = NULL;
+	gint64 v_int64;
+	double v_double;
+	guint slot;
+
+	evaluator = arv_evaluator_new ("2*3+X");
+
+	/* Slot allocated, but variable not set */
+	slot = arv_evaluator_get_variable_slot (evaluator, "X");
+	arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	arv_evaluator_set_int64_variable_by_slot (evaluator, slot, 4);
+	v_int64 = arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert_cmpint (v_int64, ==, 10);
+	g_assert (error == NULL);
+
+	g_assert_cmpint (arv_evaluator_get_variable_slot (evaluator, "X"), ==, slot);
+
+	arv_evaluator_set_double_variable (evaluator, "X", 0.5);
+	v_double = arv_evaluator_evaluate_as_double (evaluator, &error);
+	g_assert_cmpfloat (v_double, ==, 6.5);
+	g_assert (error == NULL);
+
+	/* Slots are kept across expression changes */
+	arv_evaluator_set_expression (evaluator, "X*(10/5)");
+	g_assert_cmpint (arv_evaluator_get_variable_slot (evaluator, "X"), ==, slot);
+	arv_evaluator_set_double_variable_by_slot (evaluator, slot, 1.5);
+	v_double = arv_evaluator_evaluate_as_double (evaluator, &error);
+	g_assert_cmpfloat (v_double, ==, 3.0);
+	g_assert (error == NULL);
+
+	/* Errors in constant sub-expressions are still reported at evaluation time */
+	arv_evaluator_set_expression (evaluator, "X+(1/(2/4))");
+	arv_evaluator_evaluate_as_int64 (evaluator, &error);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+	v_double = arv_evaluator_evaluate_as_double (evaluator, &error);
+	g_assert_cmpfloat (v_double, ==, 3.5);
+	g_assert (error == NULL);
+
+	g_object_unref (evaluator);
+}
+
 static void
 sub_expression_test (void)
 {
@@ -346,6 +396,7 @@ main (int argc, char *argv[])
 	g_test_add_func ("/evaluator/set-get-expression", set_get_expression_test);
 	g_test_add_func ("/evaluator/double-variable", set_double_variable_test);
 	g_test_add_func ("/evaluator/int64-variable", set_int64_variable_test);
+	g_test_add_func ("/evaluator/variable-slot", variable_slot_test);
 	g_test_add_func ("/evaluator/sub-expression", sub_expression_test);
 	g_test_add_func ("/evaluator/constant", constant_test);
 	g_test_add_func ("/evaluator/empty", empty_test);
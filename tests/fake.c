@@ -2,6 +2,8 @@
 
 #include <glib.h>
 #include <arv.h>
+#include <glib/gstdio.h>
+#include <string.h>
 
 static void
 discovery_test (void)
@@ -317,6 +319,75 @@ fill_pattern_cb (ArvBuffer *buffer, void *fill_pattern_data, guint32 exposure_ti
 	(*counter)++;
 }
 
+static void
+fill_pattern_test (void)
+{
+	ArvFakeCamera *fake_camera;
+	ArvBuffer *buffer;
+	GError *error = NULL;
+	const guint8 *data;
+	const guint8 image[] = "P5\n# comment\n4 2\n255\n\x01\x02\x03\x04\x05\x06\x07\x08";
+	guint8 first_row[64];
+	char *filename;
+	size_t size;
+	guint32 width;
+	guint i;
+
+	fake_camera = arv_fake_camera_new ("TEST0");
+	g_assert (ARV_IS_FAKE_CAMERA (fake_camera));
+
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, 64);
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, 16);
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &width);
+	g_assert_cmpint (width, ==, 64);
+
+	buffer = arv_buffer_new (arv_fake_camera_get_payload (fake_camera), NULL);
+
+	/* Default pattern: each row is the previous one shifted by one pixel, and so is each frame */
+	arv_fake_camera_fill_buffer (fake_camera, buffer, NULL);
+	data = arv_buffer_get_data (buffer, &size);
+	g_assert_cmpint (size, ==, 64 * 16);
+	for (i = 0; i < 63; i++)
+		g_assert_cmpint (data[i + 1], ==, data[64 + i]);
+	memcpy (first_row, data, 64);
+
+	arv_fake_camera_fill_buffer (fake_camera, buffer, NULL);
+	data = arv_buffer_get_data (buffer, &size);
+	g_assert_cmpint (size, ==, 64 * 16);
+	g_assert (memcmp (data, first_row + 1, 63) == 0);
+
+	filename = g_build_filename (g_get_tmp_dir (), "arv-fake-test-image.pgm", NULL);
+	g_assert (g_file_set_contents (filename, (const char *) image, sizeof (image) - 1, &error));
+	g_assert (error == NULL);
+
+	g_assert (arv_fake_camera_set_static_image (fake_camera, filename, &error));
+	g_assert (error == NULL);
+
+	/* The netpbm header is skipped, and the data is repeated over the image */
+	arv_fake_camera_fill_buffer (fake_camera, buffer, NULL);
+	data = arv_buffer_get_data (buffer, &size);
+	g_assert_cmpint (size, ==, 64 * 16);
+	for (i = 0; i < size; i++)
+		g_assert_cmpint (data[i], ==, 1 + i % 8);
+
+	g_assert (!arv_fake_camera_set_static_image (fake_camera, "/nonexistent/image.pgm", &error));
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	arv_fake_camera_set_fill_pattern (fake_camera, NULL, NULL, NULL);
+
+	arv_fake_camera_fill_buffer (fake_camera, buffer, NULL);
+	data = arv_buffer_get_data (buffer, &size);
+	for (i = 0; i < 63; i++)
+		g_assert_cmpint (data[i + 1], ==, data[64 + i]);
+
+	g_unlink (filename);
+	g_free (filename);
+
+	g_object_unref (buffer);
+	g_object_unref (fake_camera);
+}
+
 static void
 fake_stream_test (void)
 {
@@ -413,6 +484,111 @@ fake_stream_test (void)
 	g_clear_object (&camera);
 }
 
+static void
+payload_types_test (void)
+{
+	ArvCamera *camera;
+	ArvFakeCamera *fake_camera;
+	ArvChunkParser *parser;
+	ArvBuffer *buffer;
+	GError *error = NULL;
+	const guint8 *data;
+	size_t size;
+	gint width, height;
+
+	camera = arv_camera_new ("Fake_1", &error);
+	g_assert (ARV_IS_CAMERA (camera));
+	g_assert (error == NULL);
+
+	fake_camera = arv_fake_device_get_fake_camera (ARV_FAKE_DEVICE (arv_camera_get_device (camera)));
+	g_assert (ARV_IS_FAKE_CAMERA (fake_camera));
+
+	arv_camera_set_region (camera, 0, 0, 64, 48, &error);
+	g_assert (error == NULL);
+	arv_camera_get_region (camera, NULL, NULL, &width, &height, &error);
+	g_assert (error == NULL);
+
+	/* Image followed by chunk data */
+
+	arv_camera_set_exposure_time (camera, 2000.0, &error);
+	g_assert (error == NULL);
+	arv_camera_set_chunks (camera, "FrameID,ExposureTime", &error);
+	g_assert (error == NULL);
+
+	g_assert_cmpint (arv_camera_get_payload (camera, NULL), ==, width * height + 8 + 2 * 16);
+	g_assert_cmpint (arv_camera_get_payload (camera, NULL), ==, arv_fake_camera_get_payload (fake_camera));
+
+	buffer = arv_camera_acquisition (camera, 0, &error);
+	g_assert (error == NULL);
+	g_assert (ARV_IS_BUFFER (buffer));
+	g_assert_cmpint (arv_buffer_get_status (buffer), ==, ARV_BUFFER_STATUS_SUCCESS);
+	g_assert (arv_buffer_has_chunks (buffer));
+	g_assert_cmpint (arv_buffer_get_image_width (buffer), ==, width);
+
+	parser = arv_camera_create_chunk_parser (camera);
+	g_assert (ARV_IS_CHUNK_PARSER (parser));
+
+	g_assert_cmpint (arv_chunk_parser_get_integer_value (parser, buffer, "ChunkFrameID", &error), ==,
+			 arv_buffer_get_frame_id (buffer));
+	g_assert (error == NULL);
+	g_assert_cmpfloat (arv_chunk_parser_get_float_value (parser, buffer, "ChunkExposureTime", &error), ==, 2000.0);
+	g_assert (error == NULL);
+
+	g_assert (arv_buffer_get_chunk_data (buffer, ARV_FAKE_CAMERA_CHUNK_ID_TIMESTAMP, &size) == NULL);
+	data = arv_buffer_get_chunk_data (buffer, ARV_FAKE_CAMERA_CHUNK_ID_IMAGE, &size);
+	g_assert (data == arv_buffer_get_data (buffer, NULL));
+	g_assert_cmpint (size, ==, width * height);
+
+	g_clear_object (&parser);
+	g_clear_object (&buffer);
+
+	/* Multipart intensity and range payload */
+
+	arv_camera_set_chunk_mode (camera, FALSE, &error);
+	g_assert (error == NULL);
+	arv_camera_set_string (camera, "ComponentSelector", "Range", &error);
+	g_assert (error == NULL);
+	arv_camera_set_boolean (camera, "ComponentEnable", TRUE, &error);
+	g_assert (error == NULL);
+
+	g_assert_cmpint (arv_camera_get_payload (camera, NULL), ==, 3 * width * height);
+	g_assert_cmpint (arv_camera_get_payload (camera, NULL), ==, arv_fake_camera_get_payload (fake_camera));
+
+	buffer = arv_camera_acquisition (camera, 0, &error);
+	g_assert (error == NULL);
+	g_assert (ARV_IS_BUFFER (buffer));
+	g_assert_cmpint (arv_buffer_get_status (buffer), ==, ARV_BUFFER_STATUS_SUCCESS);
+	g_assert_cmpint (arv_buffer_get_payload_type (buffer), ==, ARV_BUFFER_PAYLOAD_TYPE_MULTIPART);
+	g_assert_cmpint (arv_buffer_get_n_parts (buffer), ==, 2);
+	g_assert_cmpint (arv_buffer_find_component (buffer, ARV_FAKE_CAMERA_COMPONENT_RANGE), ==, 1);
+	g_assert_cmpint (arv_buffer_get_part_pixel_format (buffer, 1), ==, ARV_PIXEL_FORMAT_COORD3D_C_16);
+
+	data = arv_buffer_get_part_data (buffer, 1, &size);
+	g_assert_cmpint (size, ==, 2 * width * height);
+	g_assert_cmpint (data[0] | (data[1] << 8), ==, 1000 + (arv_buffer_get_frame_id (buffer) & 0x3ff));
+
+	g_clear_object (&buffer);
+
+	/* Range only */
+
+	arv_camera_set_string (camera, "ComponentSelector", "Intensity", &error);
+	g_assert (error == NULL);
+	arv_camera_set_boolean (camera, "ComponentEnable", FALSE, &error);
+	g_assert (error == NULL);
+
+	g_assert_cmpint (arv_camera_get_payload (camera, NULL), ==, 2 * width * height);
+	g_assert_cmpint (arv_camera_get_payload (camera, NULL), ==, arv_fake_camera_get_payload (fake_camera));
+
+	buffer = arv_camera_acquisition (camera, 0, &error);
+	g_assert (error == NULL);
+	g_assert (ARV_IS_BUFFER (buffer));
+	g_assert_cmpint (arv_buffer_get_n_parts (buffer), ==, 1);
+	g_assert_cmpint (arv_buffer_get_part_component_id (buffer, 0), ==, ARV_FAKE_CAMERA_COMPONENT_RANGE);
+
+	g_clear_object (&buffer);
+	g_clear_object (&camera);
+}
+
 static void
 camera_api_test (void)
 {
@@ -678,6 +854,492 @@ camera_trigger_selector_test (void)
 	g_object_unref (camera);
 }
 
+static void
+feature_handle_test (void)
+{
+	ArvDevice *device;
+	ArvFeatureHandle *handle;
+	GError *error = NULL;
+	gint64 int_value;
+	gint64 int_min, int_max;
+	double float_value;
+	const char *string;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	handle = arv_device_get_feature_handle (device, "Width");
+	g_assert (handle != NULL);
+	g_assert (handle == arv_device_get_feature_handle (device, "Width"));
+	g_assert_cmpstr (arv_feature_handle_get_name (handle), ==, "Width");
+	g_assert (arv_feature_handle_get_node (handle) == arv_device_get_feature (device, "Width"));
+	g_assert (arv_feature_handle_is_available (handle, NULL));
+
+	arv_feature_handle_set_integer_value (handle, 256, &error);
+	g_assert (error == NULL);
+	int_value = arv_feature_handle_get_integer_value (handle, &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (int_value, ==, 256);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 256);
+
+	arv_feature_handle_get_integer_bounds (handle, &int_min, &int_max, &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (int_min, <=, 256);
+	g_assert_cmpint (int_max, >=, 256);
+
+	arv_feature_handle_get_float_value (handle, &error);
+	g_assert_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_WRONG_FEATURE);
+	g_clear_error (&error);
+
+	handle = arv_device_get_feature_handle (device, "AcquisitionFrameRate");
+	arv_feature_handle_set_float_value (handle, 10.0, &error);
+	g_assert (error == NULL);
+	float_value = arv_feature_handle_get_float_value (handle, &error);
+	g_assert (error == NULL);
+	g_assert_cmpfloat (float_value, ==, 10.0);
+
+	handle = arv_device_get_feature_handle (device, "TestBoolean");
+	arv_feature_handle_set_boolean_value (handle, TRUE, &error);
+	g_assert (error == NULL);
+	g_assert (arv_feature_handle_get_boolean_value (handle, &error));
+	g_assert (error == NULL);
+
+	handle = arv_device_get_feature_handle (device, "TestStringReg");
+	arv_feature_handle_set_string_value (handle, "handle", &error);
+	g_assert (error == NULL);
+	string = arv_feature_handle_get_string_value (handle, &error);
+	g_assert (error == NULL);
+	g_assert_cmpstr (string, ==, "handle");
+
+	handle = arv_device_get_feature_handle (device, "NotAFeature");
+	g_assert (handle != NULL);
+	g_assert (arv_feature_handle_get_node (handle) == NULL);
+	g_assert (!arv_feature_handle_is_available (handle, NULL));
+	arv_feature_handle_get_integer_value (handle, &error);
+	g_assert_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND);
+	g_clear_error (&error);
+
+	g_object_unref (device);
+}
+
+static gpointer
+transaction_thread_func (gpointer data)
+{
+	ArvDevice *device = data;
+	GError *error = NULL;
+	gboolean success;
+
+	/* Outside of the transaction of the main thread, the write must reach the device directly */
+	g_assert (!arv_device_is_in_transaction (device));
+	success = arv_device_write_register (device, ARV_FAKE_CAMERA_REGISTER_TEST, 0x87654321, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	return NULL;
+}
+
+static void
+transaction_test (void)
+{
+	ArvDevice *device;
+	ArvFakeCamera *fake_camera;
+	GError *error = NULL;
+	guint32 value;
+	gint64 int_value;
+	gboolean success;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	fake_camera = arv_fake_device_get_fake_camera (ARV_FAKE_DEVICE (device));
+
+	arv_device_begin_transaction (device);
+	g_assert (arv_device_is_in_transaction (device));
+
+	arv_device_set_integer_feature_value (device, "Width", 256, &error);
+	g_assert (error == NULL);
+	arv_device_set_integer_feature_value (device, "Height", 128, &error);
+	g_assert (error == NULL);
+
+	/* Staged values are visible inside the transaction, but not yet written */
+	int_value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (int_value, ==, 256);
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, ARV_FAKE_CAMERA_WIDTH_DEFAULT);
+
+	/* The transaction belongs to this thread */
+	g_thread_join (g_thread_new ("transaction", transaction_thread_func, device));
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, &value);
+	g_assert_cmpint (value, ==, 0x87654321);
+
+	/* Nested transaction */
+	arv_device_begin_transaction (device);
+	success = arv_device_write_register (device, ARV_FAKE_CAMERA_REGISTER_TEST, 0x12345678, &error);
+	g_assert (success);
+	success = arv_device_read_register (device, ARV_FAKE_CAMERA_REGISTER_TEST, &value, &error);
+	g_assert (success);
+	g_assert_cmpint (value, ==, 0x12345678);
+	success = arv_device_commit_transaction (device, &error);
+	g_assert (success);
+	g_assert (arv_device_is_in_transaction (device));
+
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, &value);
+	g_assert_cmpint (value, ==, ARV_FAKE_CAMERA_HEIGHT_DEFAULT);
+
+	success = arv_device_commit_transaction (device, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+	g_assert (!arv_device_is_in_transaction (device));
+
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, 256);
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_HEIGHT, &value);
+	g_assert_cmpint (value, ==, 128);
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, &value);
+	g_assert_cmpint (value, ==, 0x12345678);
+
+	/* Aborted transaction */
+	arv_device_begin_transaction (device);
+	arv_device_set_integer_feature_value (device, "Width", 512, &error);
+	g_assert (error == NULL);
+	arv_device_abort_transaction (device);
+	g_assert (!arv_device_is_in_transaction (device));
+
+	arv_fake_camera_read_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_WIDTH, &value);
+	g_assert_cmpint (value, ==, 256);
+	int_value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (int_value, ==, 256);
+
+	g_object_unref (device);
+}
+
+static void
+snapshot_features_test (void)
+{
+	ArvDevice *device;
+	GError *error = NULL;
+	const char *features[] = {"Width", "Height", "PixelFormat", "ExposureTimeAbs", NULL};
+	const char *not_a_feature[] = {"NotAFeature", NULL};
+	char *snapshot;
+	char *full_snapshot;
+	gboolean success;
+	gint64 int_value;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	success = arv_device_set_features_from_string (device, "Width=256 Height=128 PixelFormat=RGB8", &error);
+	g_assert (success);
+
+	snapshot = arv_device_snapshot_features (device, features, &error);
+	g_assert (error == NULL);
+	g_assert (snapshot != NULL);
+	g_assert (strstr (snapshot, "Width=256") != NULL);
+	g_assert (strstr (snapshot, "Height=128") != NULL);
+	g_assert (strstr (snapshot, "PixelFormat=RGB8") != NULL);
+	g_assert (strstr (snapshot, "ExposureTimeAbs=") != NULL);
+
+	/* Round trip */
+	success = arv_device_set_features_from_string (device, "Width=512 Height=512 PixelFormat=Mono8", &error);
+	g_assert (success);
+	success = arv_device_set_features_from_string (device, snapshot, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	int_value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (int_value, ==, 256);
+	int_value = arv_device_get_integer_feature_value (device, "Height", &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (int_value, ==, 128);
+	g_assert_cmpstr (arv_device_get_string_feature_value (device, "PixelFormat", NULL), ==, "RGB8");
+
+	/* Whole feature tree, with the same values */
+	full_snapshot = arv_device_snapshot_features (device, NULL, &error);
+	g_assert (error == NULL);
+	g_assert (full_snapshot != NULL);
+	g_assert (strstr (full_snapshot, "Width=256") != NULL);
+	g_assert (strstr (full_snapshot, "PixelFormat=RGB8") != NULL);
+	/* Commands are not part of the snapshot */
+	g_assert (strstr (full_snapshot, "AcquisitionStart") == NULL);
+
+	g_free (snapshot);
+	g_free (full_snapshot);
+
+	snapshot = arv_device_snapshot_features (device, not_a_feature, &error);
+	g_assert (snapshot == NULL);
+	g_assert_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_FEATURE_NOT_FOUND);
+	g_clear_error (&error);
+
+	g_object_unref (device);
+}
+
+static void
+_feature_changed_cb (ArvDevice *device, const char *feature, gpointer user_data)
+{
+	GPtrArray *changed_features = user_data;
+
+	g_ptr_array_add (changed_features, g_strdup (feature));
+}
+
+static void
+_feature_changed_stop_cb (ArvDevice *device, const char *feature, gpointer user_data)
+{
+	arv_device_stop_feature_polling (device);
+}
+
+static void
+_feature_changed_restart_cb (ArvDevice *device, const char *feature, gpointer user_data)
+{
+	arv_device_set_feature_polling_time (device, "TestRegister", 20);
+}
+
+static gboolean
+_timeout_cb (gpointer user_data)
+{
+	gboolean *is_timed_out = user_data;
+
+	*is_timed_out = TRUE;
+
+	return G_SOURCE_REMOVE;
+}
+
+/* Runs the default main context until @n_changes feature changes are received, or @timeout_ms elapsed */
+
+static void
+_wait_feature_changes (GPtrArray *changed_features, guint n_changes, guint timeout_ms)
+{
+	GSource *source;
+	gboolean is_timed_out = FALSE;
+
+	source = g_timeout_source_new (timeout_ms);
+	g_source_set_callback (source, _timeout_cb, &is_timed_out, NULL);
+	g_source_attach (source, NULL);
+
+	while (changed_features->len < n_changes && !is_timed_out)
+		g_main_context_iteration (NULL, TRUE);
+
+	g_source_destroy (source);
+	g_source_unref (source);
+}
+
+static void
+feature_polling_test (void)
+{
+	ArvDevice *device;
+	ArvFakeCamera *fake_camera;
+	GPtrArray *changed_features;
+	GError *error = NULL;
+	gulong handler_id;
+	gboolean success;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	fake_camera = arv_fake_device_get_fake_camera (ARV_FAKE_DEVICE (device));
+
+	changed_features = g_ptr_array_new_with_free_func (g_free);
+	g_signal_connect (device, "feature-changed", G_CALLBACK (_feature_changed_cb), changed_features);
+
+	arv_device_set_feature_polling_time (device, "TestRegister", 10);
+
+	success = arv_device_start_feature_polling (device, NULL, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	success = arv_device_start_feature_polling (device, NULL, &error);
+	g_assert (!success);
+	g_assert (error != NULL);
+	g_clear_error (&error);
+
+	/* No signal without a value change */
+	_wait_feature_changes (changed_features, 1, 50);
+	g_assert_cmpint (changed_features->len, ==, 0);
+
+	/* Change behind the back of the Genicam cache */
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, 0xabcd);
+
+	_wait_feature_changes (changed_features, 1, 2000);
+	g_assert_cmpint (changed_features->len, ==, 1);
+	g_assert_cmpstr (g_ptr_array_index (changed_features, 0), ==, "TestRegister");
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "TestRegister", NULL), ==, 0xabcd);
+
+	/* Restart from a signal handler */
+	handler_id = g_signal_connect (device, "feature-changed", G_CALLBACK (_feature_changed_restart_cb), NULL);
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, 0x1234);
+	_wait_feature_changes (changed_features, 2, 2000);
+	g_assert_cmpint (changed_features->len, ==, 2);
+	g_signal_handler_disconnect (device, handler_id);
+
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, 0x4321);
+	_wait_feature_changes (changed_features, 3, 2000);
+	g_assert_cmpint (changed_features->len, ==, 3);
+
+	/* Stop from a signal handler */
+	g_signal_connect (device, "feature-changed", G_CALLBACK (_feature_changed_stop_cb), NULL);
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, 0xabcd);
+	_wait_feature_changes (changed_features, 4, 2000);
+	g_assert_cmpint (changed_features->len, ==, 4);
+
+	arv_fake_camera_write_register (fake_camera, ARV_FAKE_CAMERA_REGISTER_TEST, 0x1234);
+	_wait_feature_changes (changed_features, 5, 100);
+	g_assert_cmpint (changed_features->len, ==, 4);
+
+	success = arv_device_start_feature_polling (device, NULL, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	arv_device_stop_feature_polling (device);
+
+	g_object_unref (device);
+	g_ptr_array_unref (changed_features);
+}
+
+static void
+profiling_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	GError *error = NULL;
+	char *report;
+	gint64 value;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+
+	report = arv_gc_stop_profiling (genicam);
+	g_assert (report == NULL);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	arv_gc_start_profiling (genicam);
+	value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert (error == NULL);
+	value = arv_device_get_integer_feature_value (device, "Width", &error);
+	g_assert (error == NULL);
+	report = arv_gc_stop_profiling (genicam);
+
+	g_assert (report != NULL);
+	g_assert (strstr (report, "Width.get_value") != NULL);
+	g_assert (strstr (report, "ReadMemory 0x") != NULL || strstr (report, "ReadRegister 0x") != NULL);
+	g_assert (strstr (report, "1 hit") != NULL);
+	g_assert (strstr (report, "transport requests") != NULL);
+	g_assert_cmpint (value, ==, 512);
+
+	g_free (report);
+
+	/* Not recorded anymore */
+	arv_device_get_integer_feature_value (device, "Width", NULL);
+	g_assert (arv_gc_stop_profiling (genicam) == NULL);
+
+	g_object_unref (device);
+}
+
+static void
+register_cache_warmup_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	GError *error = NULL;
+	char *report;
+	guint n_registers;
+	guint n_reads;
+	guint n_gapless_reads;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_DISABLE);
+	arv_gc_warmup_register_cache (genicam, 0, &n_registers, &n_reads);
+	g_assert_cmpint (n_registers, ==, 0);
+	g_assert_cmpint (n_reads, ==, 0);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+	arv_gc_warmup_register_cache (genicam, 0, &n_registers, &n_gapless_reads);
+	g_assert_cmpint (n_registers, >, 0);
+	g_assert_cmpint (n_gapless_reads, >, 0);
+	g_assert_cmpint (n_gapless_reads, <, n_registers);
+
+	/* Nothing left to read */
+	arv_gc_warmup_register_cache (genicam, 0, &n_registers, &n_reads);
+	g_assert_cmpint (n_registers, ==, 0);
+
+	g_object_unref (device);
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+	arv_gc_warmup_register_cache (genicam, 256, &n_registers, &n_reads);
+	g_assert_cmpint (n_registers, >, 0);
+	g_assert_cmpint (n_reads, <=, n_gapless_reads);
+
+	/* Seeded values are used without device access */
+	arv_gc_start_profiling (genicam);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), ==, 512);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Height", NULL), ==, 512);
+	report = arv_gc_stop_profiling (genicam);
+	g_assert (strstr (report, "ReadMemory 0x00000100") == NULL);
+	g_assert (strstr (report, "ReadMemory 0x00000104") == NULL);
+	g_free (report);
+
+	g_object_unref (device);
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+
+	/* Gaps are never bridged over the NoCache registers at 0x400 and 0x440, or the write only software trigger
+	 * register at 0x30c */
+	arv_device_set_register_cache_policy (device, ARV_REGISTER_CACHE_POLICY_ENABLE);
+	arv_gc_start_profiling (genicam);
+	arv_gc_warmup_register_cache (genicam, 0x10000, &n_registers, &n_reads);
+	report = arv_gc_stop_profiling (genicam);
+	g_assert_cmpint (n_registers, >, 0);
+	{
+		char **lines = g_strsplit (report, "\n", -1);
+		guint i;
+
+		for (i = 0; lines[i] != NULL; i++) {
+			const char *request = strstr (lines[i], "ReadMemory 0x");
+			guint64 address;
+			guint64 size;
+
+			if (request == NULL)
+				continue;
+
+			address = g_ascii_strtoull (request + strlen ("ReadMemory "), NULL, 16);
+			size = g_ascii_strtoull (strchr (request, '(') + 1, NULL, 10);
+
+			g_assert (address + size <= 0x30c || address >= 0x310);
+			g_assert (address + size <= 0x400 || address >= 0x404);
+			g_assert (address + size <= 0x440 || address >= 0x448);
+		}
+
+		g_strfreev (lines);
+	}
+	g_free (report);
+
+	g_object_unref (device);
+}
+
 static void
 set_features_from_string_test (void)
 {
@@ -744,6 +1406,54 @@ set_features_from_string_test (void)
 	g_object_unref (device);
 }
 
+static void
+open_devices_test (void)
+{
+	const char *device_ids[] = {"Fake_1", "Fake_1", "Fake_1", "Fake_1",
+				    "Fake_1", "Fake_1", "Fake_1", "Fake_1",
+				    "Fake_1", "Fake_1", "Fake_1", "Fake_1",
+				    "Fake_1", "Fake_1", "Fake_1", "Fake_1", NULL};
+	const char *bad_device_ids[] = {"Fake_1", "Unknown", NULL};
+	GPtrArray *devices;
+	GError *error = NULL;
+	guint i, j;
+
+	devices = arv_open_devices (device_ids, -1, &error);
+	g_assert (devices != NULL);
+	g_assert (error == NULL);
+	g_assert_cmpint (devices->len, ==, G_N_ELEMENTS (device_ids) - 1);
+
+	for (i = 0; i < devices->len; i++) {
+		ArvDevice *device = g_ptr_array_index (devices, i);
+		gint64 width;
+
+		g_assert (ARV_IS_FAKE_DEVICE (device));
+		g_assert (ARV_IS_GC (arv_device_get_genicam (device)));
+
+		for (j = 0; j < i; j++)
+			g_assert (arv_device_get_genicam (device) !=
+				  arv_device_get_genicam (g_ptr_array_index (devices, j)));
+
+		arv_device_set_integer_feature_value (device, "Width", 128 + i, &error);
+		g_assert (error == NULL);
+		width = arv_device_get_integer_feature_value (device, "Width", &error);
+		g_assert (error == NULL);
+		g_assert_cmpint (width, ==, 128 + i);
+	}
+
+	g_ptr_array_unref (devices);
+
+	devices = arv_open_devices (bad_device_ids, 2, &error);
+	g_assert (devices != NULL);
+	g_assert_error (error, ARV_DEVICE_ERROR, ARV_DEVICE_ERROR_NOT_FOUND);
+	g_assert_cmpint (devices->len, ==, 2);
+	g_assert (ARV_IS_FAKE_DEVICE (g_ptr_array_index (devices, 0)));
+	g_assert (g_ptr_array_index (devices, 1) == NULL);
+	g_clear_error (&error);
+
+	g_ptr_array_unref (devices);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -762,11 +1472,20 @@ main (int argc, char *argv[])
 	g_test_add_func ("/fake/registers", registers_test);
 	g_test_add_func ("/fake/fake-device", fake_device_test);
 	g_test_add_func ("/fake/fake-device-error", fake_device_error_test);
+	g_test_add_func ("/fake/fill-pattern", fill_pattern_test);
 	g_test_add_func ("/fake/fake-stream", fake_stream_test);
+	g_test_add_func ("/fake/payload-types", payload_types_test);
 	g_test_add_func ("/fake/camera-api", camera_api_test);
 	g_test_add_func ("/fake/camera-device", camera_device_test);
 	g_test_add_func ("/fake/camera-trigger-selector", camera_trigger_selector_test);
+	g_test_add_func ("/fake/feature-handle", feature_handle_test);
+	g_test_add_func ("/fake/transaction", transaction_test);
 	g_test_add_func ("/fake/set-features-from-string", set_features_from_string_test);
+	g_test_add_func ("/fake/snapshot-features", snapshot_features_test);
+	g_test_add_func ("/fake/feature-polling", feature_polling_test);
+	g_test_add_func ("/fake/profiling", profiling_test);
+	g_test_add_func ("/fake/register-cache-warmup", register_cache_warmup_test);
+	g_test_add_func ("/fake/open-devices", open_devices_test);
 
 	result = g_test_run();
 
@@ -1,9 +1,14 @@
 /* SPDX-License-Identifier:Unlicense */
 
 #include <glib.h>
+#include <string.h>
 #include <arv.h>
+#include <arvgvstreamprivate.h>
+#include <arvgvfakecameraprivate.h>
+#include <arvgvdeviceprivate.h>
 
 static ArvCamera *camera = NULL;
+static ArvGvFakeCamera *simulator = NULL;
 
 static void
 discovery_test (void)
@@ -111,6 +116,386 @@ register_test (void)
 	g_assert_cmpint (int_value, ==, 321);
 }
 
+static void
+gvcp_statistics_test (void)
+{
+	ArvDevice *device;
+	guint64 n_round_trips;
+	guint64 n_retransmissions;
+	guint64 n_round_trips_after;
+	double srtt_ms, rttvar_ms, rtt_min_ms, rtt_max_ms;
+	int i;
+
+	device = arv_camera_get_device (camera);
+	g_assert (ARV_IS_GV_DEVICE (device));
+
+	arv_gv_device_get_gvcp_statistics (ARV_GV_DEVICE (device), &n_round_trips, NULL, NULL, NULL, NULL, NULL);
+
+	for (i = 0; i < 10; i++)
+		arv_device_get_integer_feature_value (device, "TestRegister", NULL);
+
+	arv_gv_device_get_gvcp_statistics (ARV_GV_DEVICE (device), &n_round_trips_after, &n_retransmissions,
+					   &srtt_ms, &rttvar_ms, &rtt_min_ms, &rtt_max_ms);
+
+	g_assert_cmpint (n_round_trips_after, >=, n_round_trips + 10);
+	g_assert_cmpfloat (rtt_min_ms, >=, 0.0);
+	g_assert_cmpfloat (rtt_min_ms, <=, srtt_ms);
+	g_assert_cmpfloat (srtt_ms, <=, rtt_max_ms);
+	g_assert_cmpfloat (rttvar_ms, >=, 0.0);
+
+	/* Same behaviour with the adaptive timeout */
+	arv_gv_device_set_adaptive_gvcp_timeout (ARV_GV_DEVICE (device), TRUE);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), >, 0);
+	arv_gv_device_set_adaptive_gvcp_timeout (ARV_GV_DEVICE (device), FALSE);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "Width", NULL), >, 0);
+}
+
+#define GVCP_LOSS_TEST_ADDRESS		0x1f0
+
+typedef struct {
+	GMutex mutex;
+	guint n_drops;
+	guint n_pending_acks;
+	gboolean drop_after_pending_ack;
+	GArray *times;
+} GvcpLossData;
+
+/* Drops or delays the register commands accessing the test address */
+
+static gboolean
+_gvcp_loss_cb (ArvGvFakeCamera *gv_fake_camera, const ArvGvcpPacket *packet, size_t size, void *user_data)
+{
+	GvcpLossData *data = user_data;
+	guint32 address;
+	gint64 time;
+
+	switch (g_ntohs (packet->header.command)) {
+		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
+			address = arv_gvcp_packet_get_read_registers_cmd_address (packet, size, 0);
+			break;
+		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
+			arv_gvcp_packet_get_write_registers_cmd_infos (packet, size, 0, &address, NULL);
+			break;
+		default:
+			return TRUE;
+	}
+
+	if (address != GVCP_LOSS_TEST_ADDRESS)
+		return TRUE;
+
+	time = g_get_monotonic_time ();
+
+	g_mutex_lock (&data->mutex);
+
+	g_array_append_val (data->times, time);
+
+	if (data->n_drops > 0) {
+		data->n_drops--;
+		g_mutex_unlock (&data->mutex);
+		return FALSE;
+	}
+
+	if (data->n_pending_acks > 0) {
+		gboolean drop = data->drop_after_pending_ack;
+
+		data->n_pending_acks--;
+		g_mutex_unlock (&data->mutex);
+
+		/* Answer well after the retransmission timeout, but before the announced completion time, or never */
+		arv_gv_fake_camera_send_pending_ack (gv_fake_camera, packet, 200);
+		if (drop)
+			return FALSE;
+
+		g_usleep (50000);
+		return TRUE;
+	}
+
+	g_mutex_unlock (&data->mutex);
+
+	return TRUE;
+}
+
+static void
+gvcp_loss_test (void)
+{
+	GvcpLossData data = {0};
+	ArvDevice *device;
+	GError *error = NULL;
+	guint64 n_retransmissions;
+	guint64 n_retransmissions_after;
+	guint32 value;
+	gint64 *times;
+	int i;
+
+	device = arv_camera_get_device (camera);
+	g_assert (ARV_IS_GV_DEVICE (device));
+
+	g_mutex_init (&data.mutex);
+	data.times = g_array_new (FALSE, FALSE, sizeof (gint64));
+
+	arv_gv_device_set_adaptive_gvcp_timeout (ARV_GV_DEVICE (device), TRUE);
+
+	/* Round trip time samples on the loopback interface */
+	for (i = 0; i < 10; i++) {
+		arv_device_read_register (device, GVCP_LOSS_TEST_ADDRESS, &value, &error);
+		g_assert_no_error (error);
+	}
+
+	arv_gv_fake_camera_set_command_callback (simulator, _gvcp_loss_cb, &data);
+
+	/* Lost read commands are sent again after the adaptive timeout, doubled after each retransmission */
+	arv_gv_device_get_gvcp_statistics (ARV_GV_DEVICE (device), NULL, &n_retransmissions, NULL, NULL, NULL, NULL);
+	g_mutex_lock (&data.mutex);
+	g_array_set_size (data.times, 0);
+	data.n_drops = 2;
+	g_mutex_unlock (&data.mutex);
+
+	g_assert (arv_device_read_register (device, GVCP_LOSS_TEST_ADDRESS, &value, &error));
+	g_assert_no_error (error);
+
+	arv_gv_device_get_gvcp_statistics (ARV_GV_DEVICE (device), NULL, &n_retransmissions_after,
+					   NULL, NULL, NULL, NULL);
+	g_assert_cmpint (n_retransmissions_after, ==, n_retransmissions + 2);
+
+	g_mutex_lock (&data.mutex);
+	g_assert_cmpint (data.times->len, ==, 3);
+	times = (gint64 *) data.times->data;
+	g_assert_cmpint (times[1] - times[0], >=, (ARV_GV_DEVICE_GVCP_READ_TIMEOUT_MS_MIN - 1) * 1000);
+	g_assert_cmpint (times[2] - times[1], >=, (2 * ARV_GV_DEVICE_GVCP_READ_TIMEOUT_MS_MIN - 1) * 1000);
+	g_assert_cmpint (times[2] - times[0], <, ARV_GV_DEVICE_GVCP_TIMEOUT_MS_DEFAULT * 1000);
+	g_mutex_unlock (&data.mutex);
+
+	/* A lost write command is only sent again after the full GVCP timeout */
+	g_mutex_lock (&data.mutex);
+	g_array_set_size (data.times, 0);
+	data.n_drops = 1;
+	g_mutex_unlock (&data.mutex);
+
+	g_assert (arv_device_write_register (device, GVCP_LOSS_TEST_ADDRESS, value, &error));
+	g_assert_no_error (error);
+
+	g_mutex_lock (&data.mutex);
+	g_assert_cmpint (data.times->len, ==, 2);
+	times = (gint64 *) data.times->data;
+	g_assert_cmpint (times[1] - times[0], >=, (ARV_GV_DEVICE_GVCP_TIMEOUT_MS_DEFAULT - 1) * 1000);
+	g_mutex_unlock (&data.mutex);
+
+	/* A pending acknowledge extends the timeout, without retransmission */
+	arv_gv_device_get_gvcp_statistics (ARV_GV_DEVICE (device), NULL, &n_retransmissions, NULL, NULL, NULL, NULL);
+	g_mutex_lock (&data.mutex);
+	g_array_set_size (data.times, 0);
+	data.n_pending_acks = 1;
+	g_mutex_unlock (&data.mutex);
+
+	g_assert (arv_device_read_register (device, GVCP_LOSS_TEST_ADDRESS, &value, &error));
+	g_assert_no_error (error);
+
+	arv_gv_device_get_gvcp_statistics (ARV_GV_DEVICE (device), NULL, &n_retransmissions_after,
+					   NULL, NULL, NULL, NULL);
+	g_assert_cmpint (n_retransmissions_after, ==, n_retransmissions);
+
+	g_mutex_lock (&data.mutex);
+	g_assert_cmpint (data.times->len, ==, 1);
+	g_mutex_unlock (&data.mutex);
+
+	/* Without the adaptive timeout, a command is sent again once the announced time has elapsed */
+	arv_gv_device_set_adaptive_gvcp_timeout (ARV_GV_DEVICE (device), FALSE);
+
+	g_mutex_lock (&data.mutex);
+	g_array_set_size (data.times, 0);
+	data.n_pending_acks = 1;
+	data.drop_after_pending_ack = TRUE;
+	g_mutex_unlock (&data.mutex);
+
+	g_assert (arv_device_read_register (device, GVCP_LOSS_TEST_ADDRESS, &value, &error));
+	g_assert_no_error (error);
+
+	g_mutex_lock (&data.mutex);
+	g_assert_cmpint (data.times->len, ==, 2);
+	times = (gint64 *) data.times->data;
+	g_assert_cmpint (times[1] - times[0], >=, 199 * 1000);
+	g_assert_cmpint (times[1] - times[0], <, (200 + ARV_GV_DEVICE_GVCP_TIMEOUT_MS_DEFAULT) * 1000);
+	g_mutex_unlock (&data.mutex);
+
+	arv_gv_fake_camera_set_command_callback (simulator, NULL, NULL);
+
+	g_array_unref (data.times);
+	g_mutex_clear (&data.mutex);
+}
+
+typedef struct {
+	GMutex mutex;
+	guint n_write_register_cmds;
+	guint n_write_memory_cmds;
+	GArray *register_addresses;
+	guint n_read_register_cmds;
+	guint n_read_memory_cmds;
+	guint n_read_registers;
+} CommandData;
+
+static gboolean
+_command_cb (ArvGvFakeCamera *gv_fake_camera, const ArvGvcpPacket *packet, size_t size, void *user_data)
+{
+	CommandData *data = user_data;
+	guint i;
+
+	g_mutex_lock (&data->mutex);
+
+	switch (g_ntohs (packet->header.command)) {
+		case ARV_GVCP_COMMAND_WRITE_REGISTER_CMD:
+			data->n_write_register_cmds++;
+			for (i = 0; i < arv_gvcp_packet_get_write_register_cmd_n_registers (packet, size); i++) {
+				guint32 address;
+
+				arv_gvcp_packet_get_write_registers_cmd_infos (packet, size, i, &address, NULL);
+				g_array_append_val (data->register_addresses, address);
+			}
+			break;
+		case ARV_GVCP_COMMAND_WRITE_MEMORY_CMD:
+			data->n_write_memory_cmds++;
+			break;
+		case ARV_GVCP_COMMAND_READ_REGISTER_CMD:
+			data->n_read_register_cmds++;
+			data->n_read_registers += arv_gvcp_packet_get_read_register_cmd_n_registers (packet, size);
+			break;
+		case ARV_GVCP_COMMAND_READ_MEMORY_CMD:
+			data->n_read_memory_cmds++;
+			break;
+		default:
+			break;
+	}
+
+	g_mutex_unlock (&data->mutex);
+
+	return TRUE;
+}
+
+static void
+write_combining_test (void)
+{
+	CommandData data = {0};
+	ArvDevice *device;
+	ArvFakeCamera *fake_camera;
+	GError *error = NULL;
+	guint32 be_value;
+	guint32 value;
+	gboolean success;
+
+	device = arv_camera_get_device (camera);
+	g_assert (ARV_IS_GV_DEVICE (device));
+	fake_camera = arv_gv_fake_camera_get_fake_camera (simulator);
+
+	g_mutex_init (&data.mutex);
+	data.register_addresses = g_array_new (FALSE, FALSE, sizeof (guint32));
+	arv_gv_fake_camera_set_command_callback (simulator, _command_cb, &data);
+
+	arv_device_begin_transaction (device);
+
+	be_value = GUINT32_TO_BE (0x11111111);
+	success = arv_device_write_memory (device, 0xf000, sizeof (be_value), &be_value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+	be_value = GUINT32_TO_BE (0x22222222);
+	success = arv_device_write_memory (device, 0xf010, sizeof (be_value), &be_value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+	success = arv_device_write_register (device, 0xf020, 0x33333333, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+
+	/* Contiguous memory writes are merged in a single memory write */
+	be_value = GUINT32_TO_BE (0x44444444);
+	success = arv_device_write_memory (device, 0xf100, sizeof (be_value), &be_value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+	be_value = GUINT32_TO_BE (0x55555555);
+	success = arv_device_write_memory (device, 0xf104, sizeof (be_value), &be_value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+
+	/* Register and memory reads share the same view of the staged writes */
+	success = arv_device_read_register (device, 0xf010, &value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+	g_assert_cmphex (value, ==, 0x22222222);
+	success = arv_device_read_memory (device, 0xf020, sizeof (be_value), &be_value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+	g_assert_cmphex (GUINT32_FROM_BE (be_value), ==, 0x33333333);
+	success = arv_device_read_register (device, 0xf104, &value, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+	g_assert_cmphex (value, ==, 0x55555555);
+
+	g_mutex_lock (&data.mutex);
+	g_assert_cmpint (data.n_write_register_cmds, ==, 0);
+	g_assert_cmpint (data.n_write_memory_cmds, ==, 0);
+	g_mutex_unlock (&data.mutex);
+
+	success = arv_device_commit_transaction (device, &error);
+	g_assert_no_error (error);
+	g_assert (success);
+
+	arv_gv_fake_camera_set_command_callback (simulator, NULL, NULL);
+
+	/* The isolated memory writes and the register write are sent in a single multiple address WRITEREG */
+	g_assert_cmpint (data.n_write_register_cmds, ==, 1);
+	g_assert_cmpint (data.register_addresses->len, ==, 3);
+	g_assert_cmphex (g_array_index (data.register_addresses, guint32, 0), ==, 0xf000);
+	g_assert_cmphex (g_array_index (data.register_addresses, guint32, 1), ==, 0xf010);
+	g_assert_cmphex (g_array_index (data.register_addresses, guint32, 2), ==, 0xf020);
+	g_assert_cmpint (data.n_write_memory_cmds, ==, 1);
+
+	arv_fake_camera_read_register (fake_camera, 0xf000, &value);
+	g_assert_cmphex (value, ==, 0x11111111);
+	arv_fake_camera_read_register (fake_camera, 0xf010, &value);
+	g_assert_cmphex (value, ==, 0x22222222);
+	arv_fake_camera_read_register (fake_camera, 0xf020, &value);
+	g_assert_cmphex (value, ==, 0x33333333);
+	arv_fake_camera_read_register (fake_camera, 0xf100, &value);
+	g_assert_cmphex (value, ==, 0x44444444);
+	arv_fake_camera_read_register (fake_camera, 0xf104, &value);
+	g_assert_cmphex (value, ==, 0x55555555);
+
+	g_array_unref (data.register_addresses);
+	g_mutex_clear (&data.mutex);
+}
+
+static void
+snapshot_test (void)
+{
+	CommandData data = {0};
+	ArvDevice *device;
+	GError *error = NULL;
+	char *snapshot;
+
+	device = arv_camera_get_device (camera);
+	g_assert (ARV_IS_GV_DEVICE (device));
+
+	/* No register is skipped as cached under the default policy */
+	g_assert_cmpint (arv_gc_get_register_cache_policy (arv_device_get_genicam (device)), ==,
+			 ARV_REGISTER_CACHE_POLICY_DISABLE);
+
+	g_mutex_init (&data.mutex);
+	data.register_addresses = g_array_new (FALSE, FALSE, sizeof (guint32));
+	arv_gv_fake_camera_set_command_callback (simulator, _command_cb, &data);
+
+	snapshot = arv_device_snapshot_features (device, NULL, &error);
+	g_assert_no_error (error);
+	g_assert (snapshot != NULL);
+
+	arv_gv_fake_camera_set_command_callback (simulator, NULL, NULL);
+
+	/* The scattered 4 byte registers of the fake camera are read using multiple address READREG commands */
+	g_assert_cmpint (data.n_read_register_cmds, >, 0);
+	g_assert_cmpint (data.n_read_registers, >, data.n_read_register_cmds);
+	g_assert (strstr (snapshot, "Width=") != NULL);
+
+	g_free (snapshot);
+	g_array_unref (data.register_addresses);
+	g_mutex_clear (&data.mutex);
+}
+
 static void
 acquisition_test (void)
 {
@@ -166,6 +551,313 @@ new_buffer_cb (ArvStream *stream, unsigned *buffer_count)
 	}
 }
 
+static void
+packet_delay_test (void)
+{
+	GError *error = NULL;
+	ArvDevice *device;
+	ArvBuffer *buffer;
+        const char *ignore_buffer;
+
+        ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	device = arv_camera_get_device (camera);
+
+	/* 1 GHz timestamp tick frequency, the delay is in ns */
+	arv_device_set_integer_feature_value (device, "GevSCPD", 1000, &error);
+	g_assert (error == NULL);
+	g_assert_cmpint (arv_device_get_integer_feature_value (device, "GevSCPD", NULL), ==, 1000);
+
+	buffer = arv_camera_acquisition (camera, 0, &error);
+	g_assert (error == NULL);
+	g_assert (ARV_IS_BUFFER (buffer));
+
+        if (ignore_buffer == NULL)
+                g_assert_cmpint (arv_buffer_get_status (buffer), ==, ARV_BUFFER_STATUS_SUCCESS);
+
+	g_clear_object (&buffer);
+
+	arv_device_set_integer_feature_value (device, "GevSCPD", 0, &error);
+	g_assert (error == NULL);
+}
+
+static ArvStream *
+_acquire_with_resend (guint n_buffers, guint *n_completed)
+{
+	ArvStream *stream;
+	ArvBuffer *buffer;
+	GError *error = NULL;
+	size_t payload;
+	unsigned i;
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_STREAM (stream));
+	g_assert (error == NULL);
+
+	g_object_set (stream, "packet-resend", ARV_GV_STREAM_PACKET_RESEND_ALWAYS, NULL);
+
+	payload = arv_camera_get_payload (camera, NULL);
+
+	for (i = 0; i < 5; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (payload, NULL));
+
+	arv_camera_start_acquisition (camera, NULL);
+
+	*n_completed = 0;
+	for (i = 0; i < n_buffers; i++) {
+		buffer = arv_stream_timeout_pop_buffer (stream, 2000000);
+		if (buffer == NULL)
+			continue;
+		if (arv_buffer_get_status (buffer) == ARV_BUFFER_STATUS_SUCCESS)
+			(*n_completed)++;
+		arv_stream_push_buffer (stream, buffer);
+	}
+
+	arv_camera_stop_acquisition (camera, NULL);
+
+	return stream;
+}
+
+static void
+packet_resend_test (void)
+{
+	ArvStream *stream;
+	guint n_completed;
+	const char *ignore_buffer;
+
+	ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	g_object_set (simulator, "gvsp-lost-ratio", 0.02, NULL);
+
+	stream = _acquire_with_resend (10, &n_completed);
+
+	g_object_set (simulator, "gvsp-lost-ratio", 0.0, NULL);
+
+	/* Lost packets are recovered from the frames retained by the camera */
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_resend_requests"), >, 0);
+	if (ignore_buffer == NULL)
+		g_assert_cmpint (n_completed, >, 0);
+
+	g_clear_object (&stream);
+}
+
+static void
+network_impairment_test (void)
+{
+	ArvStream *stream;
+	guint n_completed;
+	const char *ignore_buffer;
+
+	ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	g_object_set (simulator,
+		      "gvsp-burst-ratio", 0.002,
+		      "gvsp-burst-length", 4.0,
+		      "gvsp-reorder-ratio", 0.05,
+		      "gvsp-duplicate-ratio", 0.05,
+		      "gvsp-jitter", 100,
+		      "gvsp-seed", 1,
+		      NULL);
+
+	stream = _acquire_with_resend (10, &n_completed);
+
+	g_object_set (simulator,
+		      "gvsp-burst-ratio", 0.0,
+		      "gvsp-reorder-ratio", 0.0,
+		      "gvsp-duplicate-ratio", 0.0,
+		      "gvsp-jitter", 0,
+		      "gvsp-seed", 0,
+		      NULL);
+
+	/* Duplicates are detected, bursts are recovered by resend, and reordered packets are accepted */
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_duplicated_packets"), >, 0);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_resend_requests"), >, 0);
+	if (ignore_buffer == NULL)
+		g_assert_cmpint (n_completed, >, 0);
+
+	g_clear_object (&stream);
+}
+
+static void
+capture_replay_test (void)
+{
+	ArvGvspCapture *capture;
+	ArvStream *stream;
+	ArvBuffer *buffer;
+	GError *error = NULL;
+	gboolean success;
+	unsigned i;
+
+	capture = arv_gvsp_capture_new (GVSP_CAPTURE_FILENAME, 0, &error);
+	g_assert (capture != NULL);
+	g_assert (error == NULL);
+
+	/* 4 frames of 64x8 Mono8 in 128 byte blocks, the second block of the third frame being lost. The GVCP
+	 * packet of the capture is ignored. */
+	g_assert_cmpint (arv_gvsp_capture_get_n_packets (capture), ==, 23);
+	g_assert_cmpint (arv_gvsp_capture_get_packet_size (capture), ==, 128 + 36);
+	g_assert_cmpint (arv_gvsp_capture_get_payload_size_max (capture), ==, 64 * 8);
+
+	stream = arv_camera_create_stream (camera, NULL, NULL, NULL, &error);
+	g_assert (ARV_IS_GV_STREAM (stream));
+	g_assert (error == NULL);
+
+	for (i = 0; i < 4; i++)
+		arv_stream_push_buffer (stream, arv_buffer_new (arv_gvsp_capture_get_payload_size_max (capture), NULL));
+
+	success = arv_gv_stream_replay_capture (ARV_GV_STREAM (stream), capture, FALSE, &error);
+	g_assert (success);
+	g_assert (error == NULL);
+
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_completed_buffers"), ==, 3);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_failures"), ==, 1);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_timeouts"), ==, 1);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_missing_packets"), >=, 1);
+	g_assert_cmpint (arv_stream_get_info_uint64_by_name (stream, "n_resend_requests"), >=, 1);
+
+	for (i = 0; i < 4; i++) {
+		buffer = arv_stream_try_pop_buffer (stream);
+		g_assert (ARV_IS_BUFFER (buffer));
+		g_assert_cmpint (arv_buffer_get_frame_id (buffer), ==, i + 1);
+		g_assert_cmpint (arv_buffer_get_status (buffer), ==,
+				 i == 2 ? ARV_BUFFER_STATUS_TIMEOUT : ARV_BUFFER_STATUS_SUCCESS);
+		if (i != 2) {
+			g_assert_cmpint (arv_buffer_get_image_width (buffer), ==, 64);
+			g_assert_cmpint (arv_buffer_get_image_height (buffer), ==, 8);
+		}
+		g_object_unref (buffer);
+	}
+
+	g_clear_object (&stream);
+	arv_gvsp_capture_free (capture);
+}
+
+static void
+capture_resolution_test (void)
+{
+	ArvGvspCapture *capture;
+	ArvGvspCapture *ns_capture;
+	const ArvGvspPacket *packet;
+	const ArvGvspPacket *ns_packet;
+	size_t packet_size;
+	size_t ns_packet_size;
+	guint64 timestamp_us;
+	guint64 ns_timestamp_us;
+	GError *error = NULL;
+	guint n_packets = 0;
+
+	/* Same packets as the pcap capture, in a pcapng file with a ns timestamp resolution, and a sub-µs part in the
+	 * timestamps. Both files are written by tests/data/gvsp-capture.py. */
+	capture = arv_gvsp_capture_new (GVSP_CAPTURE_FILENAME, 0, &error);
+	g_assert_no_error (error);
+	ns_capture = arv_gvsp_capture_new (GVSP_NS_CAPTURE_FILENAME, 0, &error);
+	g_assert_no_error (error);
+	g_assert (ns_capture != NULL);
+
+	g_assert_cmpint (arv_gvsp_capture_get_n_packets (ns_capture), ==, 23);
+	g_assert_cmpint (arv_gvsp_capture_get_packet_size (ns_capture), ==, 128 + 36);
+	g_assert_cmpint (arv_gvsp_capture_get_payload_size_max (ns_capture), ==, 64 * 8);
+
+	while (arv_gvsp_capture_next_packet (capture, &packet, &packet_size, &timestamp_us)) {
+		g_assert (arv_gvsp_capture_next_packet (ns_capture, &ns_packet, &ns_packet_size, &ns_timestamp_us));
+		g_assert_cmpint (ns_packet_size, ==, packet_size);
+		g_assert (memcmp (ns_packet, packet, packet_size) == 0);
+		g_assert_cmpuint (ns_timestamp_us, ==, timestamp_us);
+
+		if (n_packets == 0)
+			g_assert_cmpuint (ns_timestamp_us, ==, G_GUINT64_CONSTANT (1700000000001000));
+
+		n_packets++;
+	}
+
+	g_assert (!arv_gvsp_capture_next_packet (ns_capture, NULL, NULL, NULL));
+	g_assert_cmpint (n_packets, ==, 23);
+
+	arv_gvsp_capture_free (ns_capture);
+	arv_gvsp_capture_free (capture);
+}
+
+static void
+payload_types_test (void)
+{
+	ArvChunkParser *parser;
+	ArvBuffer *buffer;
+	GError *error = NULL;
+	const guint8 *data;
+	size_t size;
+	gint width, height;
+	const char *ignore_buffer;
+
+	ignore_buffer = g_getenv("ARV_TEST_IGNORE_BUFFER");
+
+	arv_camera_get_region (camera, NULL, NULL, &width, &height, &error);
+	g_assert (error == NULL);
+
+	/* Image leader with the chunk flag */
+
+	arv_camera_set_exposure_time (camera, 2000.0, &error);
+	g_assert (error == NULL);
+	arv_camera_set_chunks (camera, "Timestamp,FrameID,ExposureTime", &error);
+	g_assert (error == NULL);
+
+	buffer = arv_camera_acquisition (camera, 0, &error);
+	g_assert (error == NULL);
+	g_assert (ARV_IS_BUFFER (buffer));
+
+	if (ignore_buffer == NULL) {
+		g_assert_cmpint (arv_buffer_get_status (buffer), ==, ARV_BUFFER_STATUS_SUCCESS);
+		g_assert (arv_buffer_has_chunks (buffer));
+
+		parser = arv_camera_create_chunk_parser (camera);
+		g_assert_cmpint (arv_chunk_parser_get_integer_value (parser, buffer, "ChunkFrameID", &error), ==,
+				 arv_buffer_get_frame_id (buffer));
+		g_assert (error == NULL);
+		g_assert_cmpfloat (arv_chunk_parser_get_float_value (parser, buffer, "ChunkExposureTime", &error),
+				   ==, 2000.0);
+		g_assert (error == NULL);
+		g_assert_cmpint (arv_chunk_parser_get_integer_value (parser, buffer, "ChunkTimestamp", &error), >, 0);
+		g_assert (error == NULL);
+
+		g_clear_object (&parser);
+	}
+
+	g_clear_object (&buffer);
+
+	arv_camera_set_chunk_mode (camera, FALSE, &error);
+	g_assert (error == NULL);
+
+	/* Multipart leader and data packets */
+
+	arv_camera_set_string (camera, "ComponentSelector", "Range", &error);
+	g_assert (error == NULL);
+	arv_camera_set_boolean (camera, "ComponentEnable", TRUE, &error);
+	g_assert (error == NULL);
+
+	buffer = arv_camera_acquisition (camera, 0, &error);
+	g_assert (error == NULL);
+	g_assert (ARV_IS_BUFFER (buffer));
+
+	if (ignore_buffer == NULL) {
+		g_assert_cmpint (arv_buffer_get_status (buffer), ==, ARV_BUFFER_STATUS_SUCCESS);
+		g_assert_cmpint (arv_buffer_get_payload_type (buffer), ==, ARV_BUFFER_PAYLOAD_TYPE_MULTIPART);
+		g_assert_cmpint (arv_buffer_get_n_parts (buffer), ==, 2);
+		g_assert_cmpint (arv_buffer_get_part_component_id (buffer, 1), ==, ARV_FAKE_CAMERA_COMPONENT_RANGE);
+		g_assert_cmpint (arv_buffer_get_part_pixel_format (buffer, 1), ==, ARV_PIXEL_FORMAT_COORD3D_C_16);
+		g_assert_cmpint (arv_buffer_get_part_width (buffer, 1), ==, width);
+		g_assert_cmpint (arv_buffer_get_part_height (buffer, 1), ==, height);
+
+		data = arv_buffer_get_part_data (buffer, 1, &size);
+		g_assert_cmpint (size, ==, 2 * width * height);
+		g_assert_cmpint (data[size - 2] | (data[size - 1] << 8), ==,
+				 1000 + ((width - 1 + height - 1 + arv_buffer_get_frame_id (buffer)) & 0x3ff));
+	}
+
+	g_clear_object (&buffer);
+
+	arv_camera_set_boolean (camera, "ComponentEnable", FALSE, &error);
+	g_assert (error == NULL);
+}
+
 static void
 stream_test (void)
 {
@@ -267,7 +959,6 @@ dynamic_roi_test (void)
 int
 main (int argc, char *argv[])
 {
-	ArvGvFakeCamera *simulator;
 	int result;
 
 	g_test_init (&argc, &argv, NULL);
@@ -284,7 +975,17 @@ main (int argc, char *argv[])
 
 	g_test_add_func ("/fakegv/discovery", discovery_test);
 	g_test_add_func ("/fakegv/device_registers", register_test);
+	g_test_add_func ("/fakegv/gvcp_statistics", gvcp_statistics_test);
+	g_test_add_func ("/fakegv/gvcp_loss", gvcp_loss_test);
+	g_test_add_func ("/fakegv/write_combining", write_combining_test);
+	g_test_add_func ("/fakegv/snapshot", snapshot_test);
 	g_test_add_func ("/fakegv/acquisition", acquisition_test);
+	g_test_add_func ("/fakegv/packet_delay", packet_delay_test);
+	g_test_add_func ("/fakegv/packet_resend", packet_resend_test);
+	g_test_add_func ("/fakegv/network_impairment", network_impairment_test);
+	g_test_add_func ("/fakegv/capture_replay", capture_replay_test);
+	g_test_add_func ("/fakegv/capture_resolution", capture_resolution_test);
+	g_test_add_func ("/fakegv/payload_types", payload_types_test);
 	g_test_add_func ("/fakegv/stream", stream_test);
 	g_test_add_func ("/fakegv/dynamic_roi", dynamic_roi_test);
 
@@ -532,6 +532,140 @@ enumeration_test (void)
 	g_object_unref (device);
 }
 
+static void
+enumeration_availability_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvGcNode *not_available;
+	GError *error = NULL;
+	const char *string;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	node = arv_gc_get_node (genicam, "Enumeration");
+	g_assert (ARV_IS_GC_ENUMERATION (node));
+	not_available = arv_gc_get_node (genicam, "NotAvailable");
+	g_assert (ARV_IS_GC_INTEGER (not_available));
+
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "EntryNotAvailable", &error);
+	g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE);
+	g_clear_error (&error);
+
+	/* The entry availability must follow the changes of its pIsAvailable dependency */
+	arv_gc_integer_set_value (ARV_GC_INTEGER (not_available), 1, &error);
+	g_assert_no_error (error);
+
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "EntryNotAvailable", &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "EntryNotAvailable");
+
+	arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 3, &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "EntryNotImplemented");
+
+	arv_gc_integer_set_value (ARV_GC_INTEGER (not_available), 0, &error);
+	g_assert_no_error (error);
+
+	arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 2, &error);
+	g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_OUT_OF_RANGE);
+	g_clear_error (&error);
+
+	arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 1, &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "Entry1");
+
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "NotAnEntry", &error);
+	g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_ENUM_ENTRY_NOT_FOUND);
+	g_clear_error (&error);
+
+	g_object_unref (device);
+}
+
+static void
+enumeration_duplicate_value_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvGcNode *not_available;
+	GError *error = NULL;
+	const char *string;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	arv_gc_set_default_node_data (genicam, "DuplicateEnumeration",
+				      "<Integer Name=\"DuplicateEnumerationValue\">"
+				      "<Value>0</Value>"
+				      "</Integer>",
+				      "<Enumeration Name=\"DuplicateEnumeration\">"
+				      "<EnumEntry Name=\"Zero\"><Value>0</Value></EnumEntry>"
+				      "<EnumEntry Name=\"OneNotAvailable\">"
+				      "<pIsAvailable>NotAvailable</pIsAvailable><Value>1</Value>"
+				      "</EnumEntry>"
+				      "<EnumEntry Name=\"One\"><Value>1</Value></EnumEntry>"
+				      "<EnumEntry Name=\"OneAgain\"><Value>1</Value></EnumEntry>"
+				      "<pValue>DuplicateEnumerationValue</pValue>"
+				      "</Enumeration>",
+				      NULL);
+
+	node = arv_gc_get_node (genicam, "DuplicateEnumeration");
+	g_assert (ARV_IS_GC_ENUMERATION (node));
+	not_available = arv_gc_get_node (genicam, "NotAvailable");
+	g_assert (ARV_IS_GC_INTEGER (not_available));
+
+	/* The value is valid as long as one of the entries sharing it is available, and the string value is always
+	 * the one of the first entry in document order, as before the indexing of the entries */
+	arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 1, &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "OneNotAvailable");
+
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "OneAgain", &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "OneNotAvailable");
+
+	/* A set by name is a set of the entry value */
+	arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 0, &error);
+	g_assert_no_error (error);
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "OneNotAvailable", &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "OneNotAvailable");
+
+	arv_gc_integer_set_value (ARV_GC_INTEGER (not_available), 1, &error);
+	g_assert_no_error (error);
+
+	arv_gc_enumeration_set_int_value (ARV_GC_ENUMERATION (node), 1, &error);
+	g_assert_no_error (error);
+	string = arv_gc_enumeration_get_string_value (ARV_GC_ENUMERATION (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpstr (string, ==, "OneNotAvailable");
+
+	g_object_unref (device);
+}
+
 static void
 swiss_knife_test (void)
 {
@@ -1422,6 +1556,447 @@ access_mode_test (void)
 	g_object_unref (device);
 }
 
+static unsigned int
+_count_children (ArvDomNode *node)
+{
+	ArvDomNode *iter;
+	unsigned int n_children = 0;
+
+	for (iter = arv_dom_node_get_first_child (node); iter != NULL; iter = arv_dom_node_get_next_sibling (iter))
+		n_children++;
+
+	return n_children;
+}
+
+static void
+memoization_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvGcNode *x;
+	ArvGcNode *converter_value;
+	GError *error = NULL;
+	guint64 register_value;
+	gint64 value;
+	double v_double;
+	int i;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	arv_gc_set_register_cache_policy (genicam, ARV_REGISTER_CACHE_POLICY_ENABLE);
+
+	node = arv_gc_get_node (genicam, "IntSwissKnifeTestSubAndConstant");
+	g_assert (ARV_IS_GC_SWISS_KNIFE (node));
+	x = arv_gc_get_node (genicam, "X");
+	g_assert (ARV_IS_GC_INTEGER (x));
+
+	for (i = 0; i < 3; i++) {
+		value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+		g_assert_no_error (error);
+		g_assert_cmpint (value, ==, 140);
+	}
+
+	/* A change of a pVariable must invalidate the memoized result */
+	arv_gc_integer_set_value (ARV_GC_INTEGER (x), 5, &error);
+	g_assert_no_error (error);
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 150);
+
+	/* With the register cache enabled, a formula over a cachable register stays memoized until one of its inputs is
+	 * changed through the genicam tree */
+	arv_gc_set_default_node_data (genicam, "MemoizedCachedSum",
+				      "<IntReg Name=\"MemoizedRegister\">"
+				      "<Address>0x1200</Address>"
+				      "<Length>8</Length>"
+				      "<AccessMode>RW</AccessMode>"
+				      "<pPort>Device</pPort>"
+				      "<Cachable>WriteThrough</Cachable>"
+				      "<Sign>Unsigned</Sign>"
+				      "<Endianess>BigEndian</Endianess>"
+				      "</IntReg>",
+				      "<IntSwissKnife Name=\"MemoizedCachedSum\">"
+				      "<pVariable Name=\"X\">X</pVariable>"
+				      "<pVariable Name=\"R\">MemoizedRegister</pVariable>"
+				      "<Formula>X + 2 * R</Formula>"
+				      "</IntSwissKnife>",
+				      NULL);
+	arv_gc_set_default_node_data (genicam, "MemoizedUncachedSum",
+				      "<IntSwissKnife Name=\"MemoizedUncachedSum\">"
+				      "<pVariable Name=\"X\">X</pVariable>"
+				      "<pVariable Name=\"R\">IntRegisterA</pVariable>"
+				      "<Formula>X + 2 * R</Formula>"
+				      "</IntSwissKnife>",
+				      NULL);
+
+	node = arv_gc_get_node (genicam, "MemoizedCachedSum");
+	g_assert (ARV_IS_GC_SWISS_KNIFE (node));
+
+	arv_gc_integer_set_value (ARV_GC_INTEGER (arv_gc_get_node (genicam, "MemoizedRegister")), 10, &error);
+	g_assert_no_error (error);
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 25);
+
+	/* A write outside of the genicam tree is not seen, as for the register cache */
+	register_value = GUINT64_TO_BE (20);
+	g_assert (arv_device_write_memory (device, 0x1200, sizeof (register_value), &register_value, NULL));
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 25);
+
+	/* But a change of the other input invalidates the result */
+	arv_gc_integer_set_value (ARV_GC_INTEGER (x), 6, &error);
+	g_assert_no_error (error);
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 26);
+
+	/* Under the default policy, the register is read from the device on each evaluation, and nothing is memoized */
+	arv_gc_set_register_cache_policy (genicam, ARV_REGISTER_CACHE_POLICY_DISABLE);
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 46);
+
+	register_value = GUINT64_TO_BE (30);
+	g_assert (arv_device_write_memory (device, 0x1200, sizeof (register_value), &register_value, NULL));
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 66);
+
+	/* IntRegisterA, at 0x1000 + 0x50, is not cachable. Its value must be read again on each evaluation */
+	node = arv_gc_get_node (genicam, "MemoizedUncachedSum");
+	g_assert (ARV_IS_GC_SWISS_KNIFE (node));
+
+	arv_gc_integer_set_value (ARV_GC_INTEGER (arv_gc_get_node (genicam, "IntRegisterA")), 10, &error);
+	g_assert_no_error (error);
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 26);
+
+	register_value = GUINT64_TO_BE (20);
+	g_assert (arv_device_write_memory (device, 0x1050, sizeof (register_value), &register_value, NULL));
+
+	value = arv_gc_integer_get_value (ARV_GC_INTEGER (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (value, ==, 46);
+
+	node = arv_gc_get_node (genicam, "Converter");
+	g_assert (ARV_IS_GC_CONVERTER (node));
+	converter_value = arv_gc_get_node (genicam, "ConverterValue");
+	g_assert (ARV_IS_GC_INTEGER (converter_value));
+
+	v_double = arv_gc_float_get_value (ARV_GC_FLOAT (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpfloat (v_double, ==, 200.0);
+
+	arv_gc_integer_set_value (ARV_GC_INTEGER (converter_value), 50, &error);
+	g_assert_no_error (error);
+
+	v_double = arv_gc_float_get_value (ARV_GC_FLOAT (node), &error);
+	g_assert_no_error (error);
+	g_assert_cmpfloat (v_double, ==, 100.0);
+
+	g_object_unref (device);
+}
+
+static void
+dependents_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	GError *error = NULL;
+	const char **dependents;
+	guint n_dependents;
+
+	device = arv_fake_device_new ("TEST0", &error);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "ConverterValue", FALSE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (n_dependents, ==, 2);
+	g_assert (g_strv_contains (dependents, "Converter"));
+	g_assert (g_strv_contains (dependents, "IntConverter"));
+	g_free (dependents);
+
+	/* ROConverter depends on ROIntRegisterA, which uses IntRegisterAddress as pAddress */
+	dependents = arv_gc_dup_feature_dependents (genicam, "IntRegisterAddress", FALSE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert (g_strv_contains (dependents, "IntRegisterA"));
+	g_assert (g_strv_contains (dependents, "ROIntRegisterA"));
+	g_assert (!g_strv_contains (dependents, "ROConverter"));
+	g_free (dependents);
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "IntRegisterAddress", TRUE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert (g_strv_contains (dependents, "IntRegisterA"));
+	g_assert (g_strv_contains (dependents, "ROConverter"));
+	g_assert_cmpint (g_strv_length ((char **) dependents), ==, n_dependents);
+	g_free (dependents);
+
+	/* Enumeration entries are not registered as nodes, but their state depends on their own links */
+	dependents = arv_gc_dup_feature_dependents (genicam, "NotAvailable", FALSE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert (g_strv_contains (dependents, "EntryNotAvailable"));
+	g_assert (g_strv_contains (dependents, "EntryNotImplemented"));
+	g_free (dependents);
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "NotAvailable", TRUE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert (g_strv_contains (dependents, "Enumeration"));
+	g_free (dependents);
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "IntSwissKnifeTest", TRUE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (n_dependents, ==, 0);
+	g_free (dependents);
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "NotAFeature", TRUE, &n_dependents, &error);
+	g_assert_error (error, ARV_GC_ERROR, ARV_GC_ERROR_NODE_NOT_FOUND);
+	g_assert (dependents == NULL);
+	g_clear_error (&error);
+
+	g_object_unref (device);
+}
+
+static void
+lazy_test (void)
+{
+	ArvDevice *device;
+	ArvGc *genicam;
+	ArvGcNode *node;
+	ArvDomNode *register_description;
+	GError *error = NULL;
+	const char **dependents;
+	unsigned int n_children;
+	guint n_dependents;
+	gint64 v_int64;
+	char *xml;
+	size_t size;
+	int i;
+
+	arv_set_genicam_lazy_loading (TRUE);
+	device = arv_fake_device_new ("TEST0", &error);
+	arv_set_genicam_lazy_loading (FALSE);
+	g_assert (ARV_IS_FAKE_DEVICE (device));
+	g_assert (error == NULL);
+
+	genicam = arv_device_get_genicam (device);
+	g_assert (ARV_IS_GC (genicam));
+
+	register_description = ARV_DOM_NODE (arv_dom_document_get_document_element (ARV_DOM_DOCUMENT (genicam)));
+	g_assert (ARV_IS_GC_REGISTER_DESCRIPTION_NODE (register_description));
+	g_assert_cmpint (arv_gc_register_description_node_get_schema_major_version
+			 (ARV_GC_REGISTER_DESCRIPTION_NODE (register_description)), ==, 1);
+
+	n_children = _count_children (register_description);
+
+	node = arv_gc_get_node (genicam, "RWInteger");
+	g_assert (ARV_IS_GC_INTEGER (node));
+	g_assert_cmpint (_count_children (register_description), ==, n_children + 1);
+	g_assert (arv_gc_get_node (genicam, "RWInteger") == node);
+	g_assert_cmpint (_count_children (register_description), ==, n_children + 1);
+
+	/* Referenced nodes are built on access */
+	v_int64 = arv_gc_integer_get_max (ARV_GC_INTEGER (arv_gc_get_node (genicam, "P_RWInteger")), NULL);
+	g_assert_cmpint (v_int64, ==, 20);
+
+	for (i = 0; i < G_N_ELEMENTS (node_types); i++)
+		g_assert (ARV_IS_GC_FEATURE_NODE (arv_gc_get_node (genicam, node_types[i].name)));
+
+	/* Inlined nodes are built with their parent */
+	g_assert (ARV_IS_GC_NODE (arv_gc_get_node (genicam, "IntRegisterBAddress")));
+
+	/* Enumeration entries are not registered */
+	g_assert (arv_gc_get_node (genicam, "Entry1") == NULL);
+	node = arv_gc_get_node (genicam, "Enumeration");
+	g_assert (ARV_IS_GC_ENUMERATION (node));
+	arv_gc_enumeration_set_string_value (ARV_GC_ENUMERATION (node), "Entry1", NULL);
+	g_assert_cmpint (arv_gc_enumeration_get_int_value (ARV_GC_ENUMERATION (node), NULL), ==, 1);
+
+	g_assert (arv_gc_get_node (genicam, "NotANode") == NULL);
+
+	g_object_unref (device);
+
+	g_file_get_contents (GENICAM_FILENAME, &xml, &size, NULL);
+	g_assert (xml != NULL);
+
+	genicam = arv_gc_new_lazy (NULL, xml, size);
+	g_assert (ARV_IS_GC (genicam));
+	g_assert (ARV_IS_GC_FLOAT (arv_gc_get_node (genicam, "RWFloat")));
+
+	/* The dependency graph does not materialize the link targets, their links are added on materialization */
+	register_description = ARV_DOM_NODE (arv_dom_document_get_document_element (ARV_DOM_DOCUMENT (genicam)));
+	g_assert (ARV_IS_GC_CONVERTER (arv_gc_get_node (genicam, "Converter")));
+	n_children = _count_children (register_description);
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "Converter", TRUE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (n_dependents, ==, 0);
+	g_free (dependents);
+	g_assert_cmpint (_count_children (register_description), ==, n_children);
+
+	g_assert (ARV_IS_GC_INTEGER (arv_gc_get_node (genicam, "ConverterValue")));
+	g_assert_cmpint (_count_children (register_description), ==, n_children + 1);
+
+	dependents = arv_gc_dup_feature_dependents (genicam, "ConverterValue", FALSE, &n_dependents, &error);
+	g_assert_no_error (error);
+	g_assert_cmpint (n_dependents, ==, 1);
+	g_assert (g_strv_contains (dependents, "Converter"));
+	g_free (dependents);
+	g_assert_cmpint (_count_children (register_description), ==, n_children + 1);
+
+	g_object_unref (genicam);
+
+	g_assert (arv_gc_new_lazy (NULL, xml, size / 2) == NULL);
+
+	g_free (xml);
+}
+
+static void
+_assert_same_tree (ArvDomNode *a, ArvDomNode *b)
+{
+	ArvDomNode *iter_a, *iter_b;
+
+	g_assert_cmpstr (arv_dom_node_get_node_name (a), ==, arv_dom_node_get_node_name (b));
+	g_assert (G_OBJECT_TYPE (a) == G_OBJECT_TYPE (b));
+	if (ARV_IS_DOM_CHARACTER_DATA (a))
+		g_assert_cmpstr (arv_dom_character_data_get_data (ARV_DOM_CHARACTER_DATA (a)), ==,
+				 arv_dom_character_data_get_data (ARV_DOM_CHARACTER_DATA (b)));
+
+	for (iter_a = arv_dom_node_get_first_child (a), iter_b = arv_dom_node_get_first_child (b);
+	     iter_a != NULL && iter_b != NULL;
+	     iter_a = arv_dom_node_get_next_sibling (iter_a), iter_b = arv_dom_node_get_next_sibling (iter_b))
+		_assert_same_tree (iter_a, iter_b);
+
+	g_assert (iter_a == NULL && iter_b == NULL);
+}
+
+static char *
+_get_ancestor_path (ArvDomNode *node)
+{
+	GString *path = g_string_new (NULL);
+
+	for (node = arv_dom_node_get_parent_node (node); node != NULL; node = arv_dom_node_get_parent_node (node))
+		g_string_prepend (path, arv_dom_node_get_node_name (node));
+
+	return g_string_free (path, FALSE);
+}
+
+/* Compares the top level nodes of an eagerly parsed document with their lazily materialized counterparts */
+
+static unsigned int
+_assert_lazy_equivalence (ArvGc *lazy, ArvDomNode *container)
+{
+	ArvDomNode *iter;
+	unsigned int n_nodes = 0;
+
+	for (iter = arv_dom_node_get_first_child (container); iter != NULL; iter = arv_dom_node_get_next_sibling (iter)) {
+		ArvGcNode *node;
+		char *eager_path;
+		char *lazy_path;
+
+		if (ARV_IS_GC_GROUP_NODE (iter)) {
+			n_nodes += _assert_lazy_equivalence (lazy, iter);
+			continue;
+		}
+
+		if (!ARV_IS_GC_FEATURE_NODE (iter) || arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (iter)) == NULL)
+			continue;
+
+		node = arv_gc_get_node (lazy, arv_gc_feature_node_get_name (ARV_GC_FEATURE_NODE (iter)));
+		g_assert (ARV_IS_GC_FEATURE_NODE (node));
+
+		_assert_same_tree (iter, ARV_DOM_NODE (node));
+
+		eager_path = _get_ancestor_path (iter);
+		lazy_path = _get_ancestor_path (ARV_DOM_NODE (node));
+		g_assert_cmpstr (eager_path, ==, lazy_path);
+		g_free (eager_path);
+		g_free (lazy_path);
+
+		n_nodes++;
+	}
+
+	return n_nodes;
+}
+
+static const char lazy_group_xml[] =
+"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+"<!DOCTYPE RegisterDescription [\n"
+"  <!ENTITY Ten \"10\">\n"
+"]>\n"
+"<RegisterDescription ModelName=\"Lazy\" VendorName=\"Aravis\" StandardNameSpace=\"None\"\n"
+"  SchemaMajorVersion=\"1\" SchemaMinorVersion=\"1\" SchemaSubMinorVersion=\"0\"\n"
+"  MajorVersion=\"1\" MinorVersion=\"0\" SubMinorVersion=\"0\" ProductGuid=\"0\" VersionGuid=\"0\">\n"
+"  <Group Comment=\"Outer\">\n"
+"    <Group Comment=\"Inner\">\n"
+"      <Integer Name=\"Grouped\"><Value>&Ten;</Value></Integer>\n"
+"    </Group>\n"
+"    <Integer Name=\"OuterGrouped\"><Value>&Ten;&Ten;</Value></Integer>\n"
+"  </Group>\n"
+"  <Integer Name=\"Plain\"><pValue>Grouped</pValue></Integer>\n"
+"</RegisterDescription>\n";
+
+static void
+lazy_equivalence_test (void)
+{
+	ArvGc *eager;
+	ArvGc *lazy;
+	char *xml;
+	size_t size;
+
+	g_file_get_contents (GENICAM_FILENAME, &xml, &size, NULL);
+	g_assert (xml != NULL);
+
+	eager = arv_gc_new (NULL, xml, size);
+	lazy = arv_gc_new_lazy (NULL, xml, size);
+	g_assert (ARV_IS_GC (eager));
+	g_assert (ARV_IS_GC (lazy));
+
+	g_assert_cmpint (_assert_lazy_equivalence (lazy, ARV_DOM_NODE (arv_dom_document_get_document_element
+								       (ARV_DOM_DOCUMENT (eager)))), >, 0);
+
+	g_object_unref (lazy);
+	g_object_unref (eager);
+	g_free (xml);
+
+	/* Groups and entities */
+
+	eager = arv_gc_new (NULL, lazy_group_xml, strlen (lazy_group_xml));
+	lazy = arv_gc_new_lazy (NULL, lazy_group_xml, strlen (lazy_group_xml));
+	g_assert (ARV_IS_GC (eager));
+	g_assert (ARV_IS_GC (lazy));
+
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (eager, "Plain")), NULL), ==, 10);
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (lazy, "Plain")), NULL), ==, 10);
+	g_assert_cmpint (arv_gc_integer_get_value (ARV_GC_INTEGER (arv_gc_get_node (lazy, "OuterGrouped")), NULL),
+			 ==, 1010);
+
+	g_assert_cmpint (_assert_lazy_equivalence (lazy, ARV_DOM_NODE (arv_dom_document_get_document_element
+								       (ARV_DOM_DOCUMENT (eager)))), ==, 3);
+
+	g_object_unref (lazy);
+	g_object_unref (eager);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -1436,6 +2011,8 @@ main (int argc, char *argv[])
 	g_test_add_func ("/genicam/boolean", boolean_test);
 	g_test_add_func ("/genicam/float", float_test);
 	g_test_add_func ("/genicam/enumeration", enumeration_test);
+	g_test_add_func ("/genicam/enumeration-availability", enumeration_availability_test);
+	g_test_add_func ("/genicam/enumeration-duplicate-value", enumeration_duplicate_value_test);
 	g_test_add_func ("/genicam/swissknife", swiss_knife_test);
 	g_test_add_func ("/genicam/converter", converter_test);
 	g_test_add_func ("/genicam/register", register_test);
@@ -1448,6 +2025,10 @@ main (int argc, char *argv[])
 	g_test_add_func ("/genicam/category", category_test);
 	g_test_add_func ("/genicam/lock", lock_test);
 	g_test_add_func ("/genicam/access-mode", access_mode_test);
+	g_test_add_func ("/genicam/memoization", memoization_test);
+	g_test_add_func ("/genicam/dependents", dependents_test);
+	g_test_add_func ("/genicam/lazy", lazy_test);
+	g_test_add_func ("/genicam/lazy-equivalence", lazy_equivalence_test);
 
 	result = g_test_run();
 
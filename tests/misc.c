@@ -4,7 +4,9 @@
 #include <arv.h>
 #include <arvstr.h>
 #include <string.h>
+#include <zlib.h>
 #include "../src/arvmiscprivate.h"
+#include "../src/arvzipprivate.h"
 
 #if !ARAVIS_CHECK_VERSION (ARAVIS_MAJOR_VERSION, ARAVIS_MINOR_VERSION, ARAVIS_MICRO_VERSION)
 #error
@@ -278,6 +280,218 @@ match_test (void)
 	}
 }
 
+static gboolean
+inflater_cb (const void *data, size_t size, void *user_data)
+{
+	GByteArray *array = user_data;
+
+	g_byte_array_append (array, data, size);
+
+	return TRUE;
+}
+
+static void
+inflater_test (void)
+{
+	GString *input;
+	z_stream stream = {0};
+	guint8 *compressed;
+	size_t compressed_size;
+	size_t chunk_sizes[] = {1, 7, 1000, 0};
+	int i, j;
+
+	input = g_string_new ("");
+	for (i = 0; i < 5000; i++)
+		g_string_append_printf (input, "<Integer Name=\"Node%d\"><Value>%d</Value></Integer>\n", i, i * 7);
+
+	g_assert (deflateInit2 (&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+	compressed = g_malloc (deflateBound (&stream, input->len));
+	stream.next_in = (guint8 *) input->str;
+	stream.avail_in = input->len;
+	stream.next_out = compressed;
+	stream.avail_out = deflateBound (&stream, input->len);
+	g_assert (deflate (&stream, Z_FINISH) == Z_STREAM_END);
+	compressed_size = stream.total_out;
+	deflateEnd (&stream);
+
+	for (i = 0; i < G_N_ELEMENTS (chunk_sizes); i++) {
+		for (j = 0; j < 3; j++) {
+			ArvInflater *inflater;
+			GByteArray *array;
+			size_t chunk_size = chunk_sizes[i] > 0 ? chunk_sizes[i] : compressed_size;
+			size_t offset;
+			size_t output_size;
+			char *output;
+
+			/* Exact, unknown and too small output size */
+			inflater = arv_inflater_new (j == 0 ? input->len : (j == 1 ? 0 : 10));
+			g_assert (inflater != NULL);
+
+			array = g_byte_array_new ();
+
+			for (offset = 0; offset < compressed_size; offset += chunk_size)
+				g_assert (arv_inflater_push (inflater, compressed + offset,
+							     MIN (chunk_size, compressed_size - offset),
+							     inflater_cb, array));
+
+			output = arv_inflater_finish (inflater, inflater_cb, array, &output_size);
+			g_assert (output != NULL);
+			g_assert_cmpint (output_size, ==, input->len);
+			g_assert (memcmp (output, input->str, input->len) == 0);
+			g_assert_cmpint (array->len, ==, input->len);
+			g_assert (memcmp (array->data, input->str, input->len) == 0);
+
+			g_free (output);
+			g_byte_array_unref (array);
+		}
+	}
+
+	/* Truncated stream */
+	{
+		ArvInflater *inflater;
+		size_t output_size;
+
+		inflater = arv_inflater_new (input->len);
+		g_assert (arv_inflater_push (inflater, compressed, compressed_size / 2, NULL, NULL));
+		g_assert (arv_inflater_finish (inflater, NULL, NULL, &output_size) == NULL);
+		g_assert_cmpint (output_size, ==, 0);
+	}
+
+	g_free (compressed);
+	g_string_free (input, TRUE);
+}
+
+static void
+_append_le (GByteArray *array, guint32 value, guint n_bytes)
+{
+	guint i;
+
+	for (i = 0; i < n_bytes; i++) {
+		guint8 byte = (value >> (8 * i)) & 0xff;
+
+		g_byte_array_append (array, &byte, 1);
+	}
+}
+
+/* Single file archive, with a local header, the data, a central directory entry and its end record */
+
+static GByteArray *
+_build_zip (guint16 method, const char *name, const void *data, size_t compressed_size, size_t uncompressed_size)
+{
+	GByteArray *array = g_byte_array_new ();
+	guint32 directory_offset;
+	guint32 directory_size;
+
+	_append_le (array, 0x04034b50, 4);
+	_append_le (array, 20, 2);			/* version needed */
+	_append_le (array, 0, 2);			/* flags */
+	_append_le (array, method, 2);
+	_append_le (array, 0, 4);			/* time and date */
+	_append_le (array, 0, 4);			/* crc32, not checked */
+	_append_le (array, compressed_size, 4);
+	_append_le (array, uncompressed_size, 4);
+	_append_le (array, strlen (name), 2);
+	_append_le (array, 0, 2);			/* extra field */
+	g_byte_array_append (array, (const guint8 *) name, strlen (name));
+	g_byte_array_append (array, data, compressed_size);
+
+	directory_offset = array->len;
+
+	_append_le (array, 0x02014b50, 4);
+	_append_le (array, 20, 2);			/* version made by */
+	_append_le (array, 20, 2);			/* version needed */
+	_append_le (array, 0, 2);			/* flags */
+	_append_le (array, method, 2);
+	_append_le (array, 0, 4);			/* time and date */
+	_append_le (array, 0, 4);			/* crc32 */
+	_append_le (array, compressed_size, 4);
+	_append_le (array, uncompressed_size, 4);
+	_append_le (array, strlen (name), 2);
+	_append_le (array, 0, 2);			/* extra field */
+	_append_le (array, 0, 2);			/* comment */
+	_append_le (array, 0, 2);			/* disk number */
+	_append_le (array, 0, 2);			/* internal attributes */
+	_append_le (array, 0, 4);			/* external attributes */
+	_append_le (array, 0, 4);			/* local header offset */
+	g_byte_array_append (array, (const guint8 *) name, strlen (name));
+
+	directory_size = array->len - directory_offset;
+
+	_append_le (array, 0x06054b50, 4);
+	_append_le (array, 0, 2);			/* disk number */
+	_append_le (array, 0, 2);			/* directory disk */
+	_append_le (array, 1, 2);			/* entries on this disk */
+	_append_le (array, 1, 2);			/* entries */
+	_append_le (array, directory_size, 4);
+	_append_le (array, directory_offset, 4);
+	_append_le (array, 0, 2);			/* comment */
+
+	return array;
+}
+
+static void
+zip_test (void)
+{
+	const char *text = "<RegisterDescription/>";
+	GByteArray *array;
+	z_stream stream = {0};
+	guint8 compressed[128];
+	size_t compressed_size;
+	ArvZip *zip;
+	char *data;
+	size_t size;
+
+	/* Stored */
+
+	array = _build_zip (ARV_ZIP_COMPRESSION_METHOD_STORED, "stored.xml", text, strlen (text), strlen (text));
+	zip = arv_zip_new (array->data, array->len);
+	g_assert (arv_zip_get_file_list (zip) != NULL);
+	g_assert_cmpint (arv_zip_file_get_compression_method (arv_zip_get_file_list (zip)->data), ==,
+			 ARV_ZIP_COMPRESSION_METHOD_STORED);
+	data = arv_zip_get_file (zip, "stored.xml", &size);
+	g_assert (data != NULL);
+	g_assert_cmpint (size, ==, strlen (text));
+	g_assert (memcmp (data, text, size) == 0);
+	g_free (data);
+	arv_zip_free (zip);
+	g_byte_array_unref (array);
+
+	/* Deflated, with a compressed size larger than the uncompressed one */
+
+	g_assert (deflateInit2 (&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+	stream.next_in = (guint8 *) text;
+	stream.avail_in = strlen (text);
+	stream.next_out = compressed;
+	stream.avail_out = sizeof (compressed);
+	g_assert (deflate (&stream, Z_FINISH) == Z_STREAM_END);
+	compressed_size = stream.total_out;
+	deflateEnd (&stream);
+
+	g_assert_cmpint (compressed_size, >=, strlen (text));
+
+	array = _build_zip (ARV_ZIP_COMPRESSION_METHOD_DEFLATED, "deflated.xml", compressed, compressed_size,
+			    strlen (text));
+	zip = arv_zip_new (array->data, array->len);
+	data = arv_zip_get_file (zip, "deflated.xml", &size);
+	g_assert (data != NULL);
+	g_assert_cmpint (size, ==, strlen (text));
+	g_assert (memcmp (data, text, size) == 0);
+	g_free (data);
+	arv_zip_free (zip);
+	g_byte_array_unref (array);
+
+	/* Unsupported method (bzip2) */
+
+	array = _build_zip (12, "bzip2.xml", text, strlen (text), strlen (text));
+	zip = arv_zip_new (array->data, array->len);
+	g_assert (arv_zip_get_file_list (zip) != NULL);
+	data = arv_zip_get_file (zip, "bzip2.xml", &size);
+	g_assert (data == NULL);
+	g_assert_cmpint (size, ==, 0);
+	arv_zip_free (zip);
+	g_byte_array_unref (array);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -294,6 +508,8 @@ main (int argc, char *argv[])
 	g_test_add_func ("/gstreamer/caps-string", caps_string_test);
 	g_test_add_func ("/misc/globs", glob_test);
 	g_test_add_func ("/misc/matches", match_test);
+	g_test_add_func ("/misc/inflater", inflater_test);
+	g_test_add_func ("/misc/zip", zip_test);
 
 
 	result = g_test_run();